@@ -63,14 +63,14 @@ int aflr3_to_MeshStruct( INT_ Number_of_Nodes,
                          INT_ Number_of_Vol_Pents_5,
                          INT_ Number_of_Vol_Pents_6,
                          INT_ Number_of_Vol_Hexs,
-                         INT_1D *Surf_ID_Flag,
-                         INT_3D *Surf_Tria_Connectivity,
-                         INT_4D *Surf_Quad_Connectivity,
-                         INT_4D *Vol_Tet_Connectivity,
-                         INT_5D *Vol_Pent_5_Connectivity,
-                         INT_6D *Vol_Pent_6_Connectivity,
-                         INT_8D *Vol_Hex_Connectivity,
-                         DOUBLE_3D *Coordinates,
+                         INT_1D **Surf_ID_Flag,
+                         INT_3D **Surf_Tria_Connectivity,
+                         INT_4D **Surf_Quad_Connectivity,
+                         INT_4D **Vol_Tet_Connectivity,
+                         INT_5D **Vol_Pent_5_Connectivity,
+                         INT_6D **Vol_Pent_6_Connectivity,
+                         INT_8D **Vol_Hex_Connectivity,
+                         DOUBLE_3D **Coordinates,
                          meshStruct *genUnstrMesh) {
 
     int status; // Function return status
@@ -152,11 +152,13 @@ int aflr3_to_MeshStruct( INT_ Number_of_Nodes,
         // Copy node data
         genUnstrMesh->node[i].nodeID = i+1;
 
-        genUnstrMesh->node[i].xyz[0] = Coordinates[i+1][0];
-        genUnstrMesh->node[i].xyz[1] = Coordinates[i+1][1];
-        genUnstrMesh->node[i].xyz[2] = Coordinates[i+1][2];
+        genUnstrMesh->node[i].xyz[0] = (*Coordinates)[i+1][0];
+        genUnstrMesh->node[i].xyz[1] = (*Coordinates)[i+1][1];
+        genUnstrMesh->node[i].xyz[2] = (*Coordinates)[i+1][2];
     }
 
+    // Release each AFLR array once it has been transferred to keep the peak memory down
+    ug_free(*Coordinates); *Coordinates = NULL;
 
     // Start of element index
     elementIndex = 0;
@@ -170,7 +172,7 @@ int aflr3_to_MeshStruct( INT_ Number_of_Nodes,
         genUnstrMesh->element[elementIndex].elementType = Triangle;
         genUnstrMesh->element[elementIndex].elementID   = elementIndex+1;
 
-        genUnstrMesh->element[elementIndex].markerID = Surf_ID_Flag[i+1];
+        genUnstrMesh->element[elementIndex].markerID = (*Surf_ID_Flag)[i+1];
 
         status = mesh_allocMeshElementConnectivity(&genUnstrMesh->element[elementIndex]);
         if (status != CAPS_SUCCESS) return status;
@@ -180,12 +182,14 @@ int aflr3_to_MeshStruct( INT_ Number_of_Nodes,
         }
 
         for (j = 0; j < numPoint; j++ ) {
-            genUnstrMesh->element[elementIndex].connectivity[j] = Surf_Tria_Connectivity[i+1][j];
+            genUnstrMesh->element[elementIndex].connectivity[j] = (*Surf_Tria_Connectivity)[i+1][j];
         }
 
         elementIndex += 1;
     }
 
+    ug_free(*Surf_Tria_Connectivity); *Surf_Tria_Connectivity = NULL;
+
     // Elements -Set quadrilateral
     if (Number_of_Surf_Quads > 0) genUnstrMesh->meshQuickRef.startIndexQuadrilateral = elementIndex;
 
@@ -193,7 +197,7 @@ int aflr3_to_MeshStruct( INT_ Number_of_Nodes,
 
         genUnstrMesh->element[elementIndex].elementType = Quadrilateral;
         genUnstrMesh->element[elementIndex].elementID   = elementIndex+1;
-        genUnstrMesh->element[elementIndex].markerID = Surf_ID_Flag[Number_of_Surf_Trias+i+1];
+        genUnstrMesh->element[elementIndex].markerID = (*Surf_ID_Flag)[Number_of_Surf_Trias+i+1];
 
         status = mesh_allocMeshElementConnectivity(&genUnstrMesh->element[elementIndex]);
         if (status != CAPS_SUCCESS) return status;
@@ -203,12 +207,15 @@ int aflr3_to_MeshStruct( INT_ Number_of_Nodes,
         }
 
         for (j = 0; j < numPoint; j++ ) {
-            genUnstrMesh->element[elementIndex].connectivity[j] = Surf_Quad_Connectivity[i+1][j];
+            genUnstrMesh->element[elementIndex].connectivity[j] = (*Surf_Quad_Connectivity)[i+1][j];
         }
 
         elementIndex += 1;
     }
 
+    ug_free(*Surf_Quad_Connectivity); *Surf_Quad_Connectivity = NULL;
+    ug_free(*Surf_ID_Flag); *Surf_ID_Flag = NULL;
+
     // Elements -Set Tetrahedral
     if (Number_of_Vol_Tets > 0) genUnstrMesh->meshQuickRef.startIndexTetrahedral = elementIndex;
 
@@ -226,12 +233,14 @@ int aflr3_to_MeshStruct( INT_ Number_of_Nodes,
         }
 
         for (j = 0; j < numPoint; j++ ) {
-            genUnstrMesh->element[elementIndex].connectivity[j] = Vol_Tet_Connectivity[i+1][j];
+            genUnstrMesh->element[elementIndex].connectivity[j] = (*Vol_Tet_Connectivity)[i+1][j];
         }
 
         elementIndex += 1;
     }
 
+    ug_free(*Vol_Tet_Connectivity); *Vol_Tet_Connectivity = NULL;
+
     // Elements -Set Pyramid
     if (Number_of_Vol_Pents_5 > 0) genUnstrMesh->meshQuickRef.startIndexPyramid = elementIndex;
 
@@ -249,12 +258,14 @@ int aflr3_to_MeshStruct( INT_ Number_of_Nodes,
         }
 
         for (j = 0; j < numPoint; j++ ) {
-            genUnstrMesh->element[elementIndex].connectivity[j] = Vol_Pent_5_Connectivity[i+1][j];
+            genUnstrMesh->element[elementIndex].connectivity[j] = (*Vol_Pent_5_Connectivity)[i+1][j];
         }
 
         elementIndex += 1;
     }
 
+    ug_free(*Vol_Pent_5_Connectivity); *Vol_Pent_5_Connectivity = NULL;
+
     // Elements -Set Prism
     if (Number_of_Vol_Pents_6 > 0) genUnstrMesh->meshQuickRef.startIndexPrism = elementIndex;
 
@@ -272,12 +283,14 @@ int aflr3_to_MeshStruct( INT_ Number_of_Nodes,
         }
 
         for (j = 0; j < numPoint; j++ ) {
-            genUnstrMesh->element[elementIndex].connectivity[j] = Vol_Pent_6_Connectivity[i+1][j];
+            genUnstrMesh->element[elementIndex].connectivity[j] = (*Vol_Pent_6_Connectivity)[i+1][j];
         }
 
         elementIndex += 1;
     }
 
+    ug_free(*Vol_Pent_6_Connectivity); *Vol_Pent_6_Connectivity = NULL;
+
     // Elements -Set Hexa
     if (Number_of_Vol_Hexs > 0) genUnstrMesh->meshQuickRef.startIndexHexahedral = elementIndex;
 
@@ -295,12 +308,14 @@ int aflr3_to_MeshStruct( INT_ Number_of_Nodes,
         }
 
         for (j = 0; j < numPoint; j++ ) {
-            genUnstrMesh->element[elementIndex].connectivity[j] = Vol_Hex_Connectivity[i+1][j];
+            genUnstrMesh->element[elementIndex].connectivity[j] = (*Vol_Hex_Connectivity)[i+1][j];
         }
 
         elementIndex += 1;
     }
 
+    ug_free(*Vol_Hex_Connectivity); *Vol_Hex_Connectivity = NULL;
+
     status = CAPS_SUCCESS;
     goto cleanup;
 
@@ -1304,6 +1319,7 @@ int aflr3_Volume_Mesh (void *aimInfo, capsValue *aimInputs,
 
     // Transfer grid to volumeMesh
     if (status == 0) {
+        // The AFLR grid arrays are released (and set to NULL) as they are transferred
         status = aflr3_to_MeshStruct(Number_of_Nodes,
                                      Number_of_Surf_Trias,
                                      Number_of_Surf_Quads,
@@ -1311,14 +1327,14 @@ int aflr3_Volume_Mesh (void *aimInfo, capsValue *aimInputs,
                                      Number_of_Vol_Pents_5,
                                      Number_of_Vol_Pents_6,
                                      Number_of_Vol_Hexs,
-                                     Surf_ID_Flag,
-                                     Surf_Tria_Connectivity,
-                                     Surf_Quad_Connectivity,
-                                     Vol_Tet_Connectivity,
-                                     Vol_Pent_5_Connectivity,
-                                     Vol_Pent_6_Connectivity,
-                                     Vol_Hex_Connectivity,
-                                     Coordinates,
+                                     &Surf_ID_Flag,
+                                     &Surf_Tria_Connectivity,
+                                     &Surf_Quad_Connectivity,
+                                     &Vol_Tet_Connectivity,
+                                     &Vol_Pent_5_Connectivity,
+                                     &Vol_Pent_6_Connectivity,
+                                     &Vol_Hex_Connectivity,
+                                     &Coordinates,
                                      volumeMesh);
         if (status != CAPS_SUCCESS) {
             printf("Error occurred while transferring volume grid, status = %d\n", status);
@@ -3273,12 +3273,44 @@ int astros_writeDesignConstraintCard(FILE *fp, int feaDesignConstraintSetID, fea
     return CAPS_SUCCESS;
 }
 
+// Block headers recorded when indexing an Astros OUT file
+static const char *outSummaryLine      = "                                   S U M M A R Y   O F   R E A L   E I G E N   A N A L Y S I S";
+static const char *outEigenVectorLine  = "            EIGENVALUE       =";
+static const char *outEigenValueLine   = "                              ORDER         (RAD/S)**2         (RAD/S)           (HZ)            MASS           STIFFNESS";
+static const char *outSubcaseLine      = "0                                                                                                            SUBCASE ";
+static const char *outDisplacementLine = "                                             D I S P L A C E M E N T   V E C T O R";
+
+// Index of the last OUT file read - kept until the file is modified so repeated reads of
+//  the same results (e.g. one per data transfer) seek directly to the blocks they need
+static resultFileIndexStruct outIndex;
+
+// Index the result blocks of an Astros OUT file (if not already indexed)
+static int astros_indexOUT(FILE *fp) {
+
+    const char *keyword[5];
+
+    keyword[0] = outSummaryLine;
+    keyword[1] = outEigenVectorLine;
+    keyword[2] = outEigenValueLine;
+    keyword[3] = outSubcaseLine;
+    keyword[4] = outDisplacementLine;
+
+    return index_resultFile(fp, 5, keyword, &outIndex);
+}
+
+// Free the index kept of the last OUT file read
+int astros_freeOUTIndex(void) {
+
+    return destroy_resultFileIndexStruct(&outIndex);
+}
+
 // Read data from a Astros OUT file to determine the number of eignevalues
 int astros_readOUTNumEigenValue(FILE *fp, int *numEigenVector) {
 
     int status; // Function return
 
-    char *beginEigenLine = "                                   S U M M A R Y   O F   R E A L   E I G E N   A N A L Y S I S";
+    const char *beginEigenLine = outSummaryLine;
+    int block = -1;
 
     size_t linecap = 0;
 
@@ -3286,29 +3318,26 @@ int astros_readOUTNumEigenValue(FILE *fp, int *numEigenVector) {
 
     int tempInt[2];
 
-    while (*numEigenVector == 0) {
+    status = astros_indexOUT(fp);
+    if (status != CAPS_SUCCESS) return status;
 
-        // Get line from file
+    // See how many Eigen-Values we have
+    while (*numEigenVector == 0 &&
+           seek_resultFileBlock(fp, &outIndex, beginEigenLine, &block) == CAPS_SUCCESS) {
+
+        // Skip ahead 2 lines
+        status = getline(&line, &linecap, fp);
+        if (status < 0) break;
         status = getline(&line, &linecap, fp);
         if (status < 0) break;
 
-        // See how many Eigen-Values we have
-        if (strncmp(beginEigenLine, line, strlen(beginEigenLine)) == 0) {
-
-            // Skip ahead 2 lines
-            status = getline(&line, &linecap, fp);
-            if (status < 0) break;
-            status = getline(&line, &linecap, fp);
-            if (status < 0) break;
-
-            // Grab summary line
-            status = getline(&line,&linecap,fp );
-            if (status < 0) break;
+        // Grab summary line
+        status = getline(&line,&linecap,fp );
+        if (status < 0) break;
 
-            sscanf(line, "%d EIGENVALUES AND %d EIGENVECTORS", &tempInt[0],
-                    &tempInt[1]);
-            *numEigenVector = tempInt[1];
-        }
+        sscanf(line, "%d EIGENVALUES AND %d EIGENVECTORS", &tempInt[0],
+                &tempInt[1]);
+        *numEigenVector = tempInt[1];
     }
 
     if (line != NULL) EG_free(line);
@@ -3326,59 +3355,59 @@ int astros_readOUTNumGridPoint(FILE *fp, int *numGridPoint) {
     int status; // Function return status
 
     int i, j;
+    int block = -1;
 
-    size_t linecap;
+    size_t linecap = 0;
 
     char *line = NULL; // Temporary line holder
 
-    char *beginEigenLine = "            EIGENVALUE       =";
-    char *endEigenLine   = "            EIGENVALUE       =";
+    const char *beginEigenLine = outEigenVectorLine;
+    const char *endEigenLine   = outEigenVectorLine;
 
     int stop = (int) false;
 
     *numGridPoint = 0;
 
-    // Loop through file line by line until we have determined how many grid points we have
-    while (*numGridPoint == 0) {
-
-        // Get line from file
-        status = getline(&line, &linecap, fp);
-        if (status < 0) break;
+    status = astros_indexOUT(fp);
+    if (status != CAPS_SUCCESS) return status;
 
-        // Look for start of Eigen-Vector 1
-        if (strncmp(beginEigenLine, line, strlen(beginEigenLine)) == 0) {
+    // Go through the Eigen-Vector blocks until we have determined how many grid points we have
+    while (*numGridPoint == 0 &&
+           seek_resultFileBlock(fp, &outIndex, beginEigenLine, &block) == CAPS_SUCCESS) {
 
-            // Fast forward 3 lines
-            for (i = 0; i < 3; i++) {
-                status = getline(&line, &linecap, fp);
-                if (status < 0) break;
-            }
+        // Fast forward 3 lines
+        for (i = 0; i < 3; i++) {
+            status = getline(&line, &linecap, fp);
+            if (status < 0) break;
+        }
 
-            // Loop through lines counting the number of grid points
-            while (stop == (int) false) {
+        // Loop through lines counting the number of grid points
+        while (stop == (int) false) {
 
-                status = getline(&line, &linecap, fp);
-                if (status < 0)  break;
+            status = getline(&line, &linecap, fp);
+            if (status < 0)  break;
 
-                // If we have a new page - skip ahead 8 lines and continue
-                if (strncmp("1", line, 1) == 0) {
+            // If we have a new page - skip ahead 8 lines and continue
+            if (strncmp("1", line, 1) == 0) {
 
-                    for (j = 0; j < 7; j++) {
-                        status = getline(&line, &linecap, fp);
-                        if (status < 0) break;
+                for (j = 0; j < 7; j++) {
+                    status = getline(&line, &linecap, fp);
+                    if (status < 0) break;
 
-                        if (strncmp(endEigenLine, line, strlen(endEigenLine)) == 0) stop = (int) true;
+                    if (strncmp(endEigenLine, line, strlen(endEigenLine)) == 0) stop = (int) true;
 
-                    }
-                    continue;
                 }
+                continue;
+            }
 
-                if (strncmp(endEigenLine, line, strlen(endEigenLine)) == 0 ||
-                        strlen(line) == 1) break;
+            if (strncmp(endEigenLine, line, strlen(endEigenLine)) == 0 ||
+                    strlen(line) == 1) break;
 
-                *numGridPoint +=1;
-            }
+            *numGridPoint +=1;
         }
+
+        // Don't start counting again within the lines already read
+        (void) sync_resultFileBlock(fp, &outIndex, &block);
     }
 
     if (line != NULL) EG_free(line);
@@ -3398,12 +3427,13 @@ int astros_readOUTEigenVector(FILE *fp, int *numEigenVector, int *numGridPoint,
     int status = CAPS_SUCCESS; // Function return
 
     int i, j, eigenValue = 0; // Indexing
+    int block = -1;
 
-    size_t linecap;
+    size_t linecap = 0;
 
     char *line = NULL; // Temporary line holder
 
-    char *beginEigenLine = "            EIGENVALUE       =";
+    const char *beginEigenLine = outEigenVectorLine;
 
     int tempInt;
     char tempString[2];
@@ -3450,71 +3480,60 @@ int astros_readOUTEigenVector(FILE *fp, int *numEigenVector, int *numGridPoint,
         }
     }
 
+    // Go to each Eigen-Vector block and pull out data
     eigenValue = 0;
-    // Loop through the file again and pull out data
-    while (getline(&line, &linecap, fp) >= 0) {
-
-        // Look for start of Eigen-Vector
-        if (strncmp(beginEigenLine, line, strlen(beginEigenLine)) == 0) {
+    while (eigenValue < *numEigenVector &&
+           seek_resultFileBlock(fp, &outIndex, beginEigenLine, &block) == CAPS_SUCCESS) {
 
-            printf("\tLoading Eigen-Vector = %d\n", eigenValue+1);
+        printf("\tLoading Eigen-Vector = %d\n", eigenValue+1);
 
-            // Fast forward 3 lines
-            for (i = 0; i < 3; i++) {
-                status = getline(&line, &linecap, fp);
-                if (status < 0) break;
-            }
+        // Fast forward 3 lines
+        for (i = 0; i < 3; i++) {
+            status = getline(&line, &linecap, fp);
+            if (status < 0) break;
+        }
 
-            i = 0;
-            while (i != *numGridPoint) {
-                status = getline(&line, &linecap, fp);
-                if (status < 0) break;
+        i = 0;
+        while (i != *numGridPoint) {
+            status = getline(&line, &linecap, fp);
+            if (status < 0) break;
 
-                // If we have a new page - skip ahead 7 lines and continue
-                if (strncmp("1", line, 1) == 0) {
+            // If we have a new page - skip ahead 7 lines and continue
+            if (strncmp("1", line, 1) == 0) {
 
-                    for (j = 0; j < 7; j++) {
-                        status = getline(&line, &linecap, fp);
-                        if (status < 0) break;
-                    }
-                    continue;
+                for (j = 0; j < 7; j++) {
+                    status = getline(&line, &linecap, fp);
+                    if (status < 0) break;
                 }
+                continue;
+            }
 
-                sscanf(line, "%d%s%lf%lf%lf%lf%lf%lf", &tempInt,
-                                                       tempString,
-                                                       &(*dataMatrix)[eigenValue][2+numVariable*i],
-                                                       &(*dataMatrix)[eigenValue][3+numVariable*i],
-                                                       &(*dataMatrix)[eigenValue][4+numVariable*i],
-                                                       &(*dataMatrix)[eigenValue][5+numVariable*i],
-                                                       &(*dataMatrix)[eigenValue][6+numVariable*i],
-                                                       &(*dataMatrix)[eigenValue][7+numVariable*i]);
+            sscanf(line, "%d%s%lf%lf%lf%lf%lf%lf", &tempInt,
+                                                   tempString,
+                                                   &(*dataMatrix)[eigenValue][2+numVariable*i],
+                                                   &(*dataMatrix)[eigenValue][3+numVariable*i],
+                                                   &(*dataMatrix)[eigenValue][4+numVariable*i],
+                                                   &(*dataMatrix)[eigenValue][5+numVariable*i],
+                                                   &(*dataMatrix)[eigenValue][6+numVariable*i],
+                                                   &(*dataMatrix)[eigenValue][7+numVariable*i]);
 
-                (*dataMatrix)[eigenValue][0+numVariable*i] = (double) i+1;
-                (*dataMatrix)[eigenValue][1+numVariable*i] = 0.0;
+            (*dataMatrix)[eigenValue][0+numVariable*i] = (double) i+1;
+            (*dataMatrix)[eigenValue][1+numVariable*i] = 0.0;
 
-                /*
-                printf("Data = %f %f %f %f %f %f %f %f\n", (*dataMatrix)[eigenValue][0+numVariable*i],
-                                                           (*dataMatrix)[eigenValue][1+numVariable*i],
-                                                           (*dataMatrix)[eigenValue][2+numVariable*i],
-                                                           (*dataMatrix)[eigenValue][3+numVariable*i],
-                                                           (*dataMatrix)[eigenValue][4+numVariable*i],
-                                                           (*dataMatrix)[eigenValue][5+numVariable*i],
-                                                           (*dataMatrix)[eigenValue][6+numVariable*i],
-                                                           (*dataMatrix)[eigenValue][7+numVariable*i]);
-                 */
-                i = i+1;
-            }
+            i = i+1;
+        }
 
-            eigenValue += 1;
+        eigenValue += 1;
 
-            // Skip ahead 6 lines after reading an eigenvector
-            for (j = 0; j < 6; j++) {
-                status = getline(&line, &linecap, fp);
-                if (status < 0) break;
-            }
+        // Skip ahead 6 lines after reading an eigenvector
+        for (j = 0; j < 6; j++) {
+            status = getline(&line, &linecap, fp);
+            if (status < 0) break;
         }
 
-        if (eigenValue == *numEigenVector) break;
+        // Continue with the first block header not already read (page headers repeat within a block)
+        status = sync_resultFileBlock(fp, &outIndex, &block);
+        if (status != CAPS_SUCCESS) goto cleanup;
     }
 
     if (eigenValue != *numEigenVector) {
@@ -3529,6 +3548,8 @@ int astros_readOUTEigenVector(FILE *fp, int *numEigenVector, int *numGridPoint,
     cleanup:
         if (line != NULL) EG_free(line);
 
+        rewind(fp);
+
         return status;
 }
 
@@ -3539,6 +3560,7 @@ int astros_readOUTEigenValue(FILE *fp, int *numEigenVector, double ***dataMatrix
     int status; // Function return
 
     int i, j;// Indexing
+    int block = -1;
 
     int tempInt, eigenValue =0;
 
@@ -3546,7 +3568,7 @@ int astros_readOUTEigenValue(FILE *fp, int *numEigenVector, double ***dataMatrix
 
     char *line = NULL; // Temporary line holder
 
-    char *beginEigenLine = "                              ORDER         (RAD/S)**2         (RAD/S)           (HZ)            MASS           STIFFNESS";
+    const char *beginEigenLine = outEigenValueLine;
     //char *endEigenLine = "1";
 
     int numVariable = 5; // EigenValue, eigenValue(radians), eigenValue(cycles), generalized mass, and generalized stiffness.
@@ -3582,53 +3604,51 @@ int astros_readOUTEigenValue(FILE *fp, int *numEigenVector, double ***dataMatrix
         }
     }
 
-    // Loop through the file again and pull out data
-    while (eigenValue != *numEigenVector) {
+    // Go to the Eigen-Value table and pull out data
+    while (eigenValue != *numEigenVector &&
+           seek_resultFileBlock(fp, &outIndex, beginEigenLine, &block) == CAPS_SUCCESS) {
 
-        // Get line from file
-        status = getline(&line, &linecap, fp);
-        if (status < 0) break;
-
-        // Look for start of Eigen-Vector
-        if (strncmp(beginEigenLine, line, strlen(beginEigenLine)) == 0) {
-
-            // Fast forward 1 lines
-            for (i = 0; i < 1; i++) {
-                status = getline(&line, &linecap, fp);
-                if (status < 0) break;
-            }
+        // Fast forward 1 lines
+        for (i = 0; i < 1; i++) {
+            status = getline(&line, &linecap, fp);
+            if (status < 0) break;
+        }
 
-            i = 0;
-            while (eigenValue != *numEigenVector) {
-                status = getline(&line, &linecap, fp);
-                if (status < 0) break;
+        i = 0;
+        while (eigenValue != *numEigenVector) {
+            status = getline(&line, &linecap, fp);
+            if (status < 0) break;
 
-                // If we have a new page - skip ahead 8 lines and continue
-                if (strncmp("1", line, 1) == 0) {
+            // If we have a new page - skip ahead 8 lines and continue
+            if (strncmp("1", line, 1) == 0) {
 
-                    for (j = 0; j < 8; j++) {
-                        status = getline(&line, &linecap, fp);
-                        if (status < 0) break;
-                    }
-                    continue;
+                for (j = 0; j < 8; j++) {
+                    status = getline(&line, &linecap, fp);
+                    if (status < 0) break;
                 }
-
-                // Loop through the file and fill up the data matrix
-                sscanf(line, "%d%d%lf%lf%lf%lf%lf", &eigenValue,
-                        &tempInt,
-                        &(*dataMatrix)[i][0],
-                        &(*dataMatrix)[i][1],
-                        &(*dataMatrix)[i][2],
-                        &(*dataMatrix)[i][3],
-                        &(*dataMatrix)[i][4]);
-                printf("\tLoading Eigen-Value = %d\n", eigenValue);
-                i += 1;
+                continue;
             }
+
+            // Loop through the file and fill up the data matrix
+            sscanf(line, "%d%d%lf%lf%lf%lf%lf", &eigenValue,
+                    &tempInt,
+                    &(*dataMatrix)[i][0],
+                    &(*dataMatrix)[i][1],
+                    &(*dataMatrix)[i][2],
+                    &(*dataMatrix)[i][3],
+                    &(*dataMatrix)[i][4]);
+            printf("\tLoading Eigen-Value = %d\n", eigenValue);
+            i += 1;
         }
+
+        // Continue with the first block header not already read (page headers repeat within the table)
+        (void) sync_resultFileBlock(fp, &outIndex, &block);
     }
 
     if (line != NULL) EG_free(line);
 
+    rewind(fp);
+
     return CAPS_SUCCESS;
 }
 
@@ -3639,13 +3659,14 @@ int astros_readOUTDisplacement(FILE *fp, int subcaseId, int *numGridPoint, doubl
     int status; // Function return
 
     int i, j; // Indexing
+    int block = -1;
 
     size_t linecap = 0;
 
     char *line = NULL; // Temporary line holder
 
-    char *outputSubcaseLine = "0                                                                                                            SUBCASE ";
-    char *displacementLine ="                                             D I S P L A C E M E N T   V E C T O R";
+    const char *outputSubcaseLine = outSubcaseLine;
+    const char *displacementLine = outDisplacementLine;
     char *beginSubcaseLine=NULL;
     char *endSubcaseLine = "1";
     char tempString[2];
@@ -3744,6 +3765,8 @@ int astros_readOUTDisplacement(FILE *fp, int subcaseId, int *numGridPoint, doubl
 
         sprintf(beginSubcaseLine,"%s%d",outputSubcaseLine, subcaseId);
 
+        beginSubcaseLine[strlen(outputSubcaseLine)+intLength] = '\0';
+
         lineFastForward = 4;
 
     } else {
@@ -3755,32 +3778,23 @@ int astros_readOUTDisplacement(FILE *fp, int subcaseId, int *numGridPoint, doubl
 
         lineFastForward = 2;
     }
-    printf("beginSubcaseLine=%s, lineFastForward=%d\n", beginSubcaseLine, lineFastForward);
-
-    beginSubcaseLine[strlen(outputSubcaseLine)+intLength] = '\0';
-
-    // Loop through file line by line until we have determined how many grid points we have
-    while (*numGridPoint == 0) {
-
-        // Get line from file
-        status = getline(&line, &linecap, fp);
-        if (status < 0) break;
-        printf("line=%s\n", line);
+    status = astros_indexOUT(fp);
+    if (status != CAPS_SUCCESS) goto cleanup;
 
-        // Look for start of subcaseId
-        if (strncmp(beginSubcaseLine, line, strlen(beginSubcaseLine)) == 0) {
+    // Loop through the matching blocks until we have determined how many grid points we have
+    while (*numGridPoint == 0 &&
+           seek_resultFileBlock(fp, &outIndex, beginSubcaseLine, &block) == CAPS_SUCCESS) {
 
-            // Fast forward lines
-            for (i = 0; i < lineFastForward; i++) {
-                status = getline(&line, &linecap, fp);
-                if (status < 0) break;
-            }
+        // Fast forward lines
+        for (i = 0; i < lineFastForward; i++) {
+            status = getline(&line, &linecap, fp);
+            if (status < 0) break;
+        }
 
-            // Loop through lines counting the number of grid points
-            while (getline(&line, &linecap, fp) >= 0) {
-                if (strncmp(endSubcaseLine, line, strlen(endSubcaseLine)) == 0) break;
-                *numGridPoint +=1;
-            }
+        // Loop through lines counting the number of grid points
+        while (getline(&line, &linecap, fp) >= 0) {
+            if (strncmp(endSubcaseLine, line, strlen(endSubcaseLine)) == 0) break;
+            *numGridPoint +=1;
         }
     }
 
@@ -3793,9 +3807,6 @@ int astros_readOUTDisplacement(FILE *fp, int subcaseId, int *numGridPoint, doubl
         goto cleanup;
     }
 
-    // Rewind the file
-    rewind(fp);
-
     // Allocate dataMatrix array
     *dataMatrix = (double **) EG_alloc(*numGridPoint *sizeof(double *));
     if (*dataMatrix == NULL) { status = EGADS_MALLOC; goto cleanup; }
@@ -3815,39 +3826,36 @@ int astros_readOUTDisplacement(FILE *fp, int subcaseId, int *numGridPoint, doubl
         }
     }
 
-    // Loop through the file again and pull out data
-    while (getline(&line, &linecap, fp) >= 0) {
+    // Go back to the block the grid points were counted in and pull out data
+    block -= 1;
+    if (seek_resultFileBlock(fp, &outIndex, beginSubcaseLine, &block) == CAPS_SUCCESS) {
 
-        // Look for start of Displacement
-        if (strncmp(beginSubcaseLine, line, strlen(beginSubcaseLine)) == 0) {
+        printf("Loading displacements for Subcase = %d\n", subcaseId);
 
-            printf("Loading displacements for Subcase = %d\n", subcaseId);
+        // Fast forward lines
+        for (i = 0; i < lineFastForward; i++) {
+            status = getline(&line, &linecap, fp);
+            if (status < 0) break;
+        }
 
-            // Fast forward lines
-            for (i = 0; i < lineFastForward; i++) {
-                status = getline(&line, &linecap, fp);
-                if (status < 0) break;
-            }
+        // Loop through the file and fill up the data matrix
+        for (i = 0; i < (*numGridPoint); i++) {
+            for (j = 0; j < numVariable; j++) {
 
-            // Loop through the file and fill up the data matrix
-            for (i = 0; i < (*numGridPoint); i++) {
-                for (j = 0; j < numVariable; j++) {
-
-                    if (j == 0 || j % numVariable+1 == 0) {
-                        fscanf(fp, "%lf", &(*dataMatrix)[i][j]);
-                        fscanf(fp, "%s", tempString);
-                        j = j + 1;
-                        (*dataMatrix)[i][j] = 0.0;
-                    } else {
-                        fscanf(fp, "%lf", &(*dataMatrix)[i][j]);
-                    }
+                if (j == 0 || j % numVariable+1 == 0) {
+                    fscanf(fp, "%lf", &(*dataMatrix)[i][j]);
+                    fscanf(fp, "%s", tempString);
+                    j = j + 1;
+                    (*dataMatrix)[i][j] = 0.0;
+                } else {
+                    fscanf(fp, "%lf", &(*dataMatrix)[i][j]);
                 }
             }
-
-            break;
         }
     }
 
+    rewind(fp);
+
     status = CAPS_SUCCESS;
 
 cleanup:
@@ -94,6 +94,9 @@ int astros_readOUTEigenValue(FILE *fp, int *numEigenVector, double ***dataMatrix
 // where variables are Grid Id, Coord Id, T1, T2, T3, R1, R2, R3
 int astros_readOUTDisplacement(FILE *fp, int subcaseId, int *numGridPoint, double ***dataMatrix);
 
+// Free the index kept of the last OUT file read
+int astros_freeOUTIndex(void);
+
 // Write geometric parametrization - only valid for modifications made by Bob Canfield to Astros
 int astros_writeGeomParametrization(FILE *fp,
 								  	void *aimInfo,
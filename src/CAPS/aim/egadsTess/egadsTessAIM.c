@@ -24,6 +24,7 @@
 #include <math.h>
 #include "capsTypes.h"
 #include "aimUtil.h"
+#include "emp.h"
 
 #include "meshUtils.h"       // Collection of helper functions for meshing
 #include "cfdUtils.h"        // Collection of helper functions for cfd analysis
@@ -421,6 +422,9 @@ int aimPreAnalysis(int iIndex, void *aimInfo, const char *analysisPath, capsValu
     char *filename = NULL;
     char bodyNumber[11];
 
+    // Per body timing
+    double time0, *tessTime = NULL, *meshTime = NULL;
+
     // NULL out errors
     *errs = NULL;
 
@@ -611,28 +615,49 @@ int aimPreAnalysis(int iIndex, void *aimInfo, const char *analysisPath, capsValu
         meshProp = NULL;
     }
 
-    // Run egadsTess for each body
+    tessTime = (double *) EG_alloc(numBody*sizeof(double));
+    meshTime = (double *) EG_alloc(numBody*sizeof(double));
+    if (tessTime == NULL || meshTime == NULL) {
+        status = EGADS_MALLOC;
+        goto cleanup;
+    }
+
+    // Tessellate each body - EGADS objects may only be used by the thread that owns the context,
+    //  and EG_makeTessBody already spreads the Edges and Faces of a body over threads
     for (bodyIndex = 0 ; bodyIndex < numBody; bodyIndex++) {
 
         printf("Getting surface mesh for body %d (of %d)\n", bodyIndex+1, numBody);
 
-        status = mesh_surfaceMeshEGADSBody(bodies[bodyIndex],
-                                           refLen,
-                                           egadsInstance[iIndex].meshInput.paramTess,
-                                           quadMesh,
-                                           &egadsInstance[iIndex].attrMap,
-                                           &egadsInstance[iIndex].surfaceMesh[bodyIndex]);
+        time0 = EMP_Clock();
+        status = mesh_tessellateEGADSBody(bodies[bodyIndex],
+                                          refLen,
+                                          egadsInstance[iIndex].meshInput.paramTess,
+                                          quadMesh,
+                                          &egadsInstance[iIndex].surfaceMesh[bodyIndex]);
+        tessTime[bodyIndex] = EMP_Clock() - time0;
         if (status != CAPS_SUCCESS) {
             printf("Problem during surface meshing of body %d\n", bodyIndex+1);
             goto cleanup;
         }
+    }
+
+    // Convert the tessellations to surface meshes - the bodies are done concurrently
+    status = mesh_surfaceMeshEGADSTessBodies(numBody,
+                                             &egadsInstance[iIndex].attrMap,
+                                             egadsInstance[iIndex].surfaceMesh,
+                                             meshTime);
+    if (status != CAPS_SUCCESS) goto cleanup;
+
+    // Register the tessellations and report in body order
+    for (bodyIndex = 0 ; bodyIndex < numBody; bodyIndex++) {
 
         status = aim_setTess(aimInfo, egadsInstance[iIndex].surfaceMesh[bodyIndex].bodyTessMap.egadsTess);
-         if (status != CAPS_SUCCESS) {
-             printf(" aim_setTess return = %d\n", status);
-             goto cleanup;
-         }
+        if (status != CAPS_SUCCESS) {
+            printf(" aim_setTess return = %d\n", status);
+            goto cleanup;
+        }
 
+        printf("Body %d\n", bodyIndex+1);
         printf("Number of nodes = %d\n", egadsInstance[iIndex].surfaceMesh[bodyIndex].numNode);
         printf("Number of elements = %d\n", egadsInstance[iIndex].surfaceMesh[bodyIndex].numElement);
 
@@ -642,6 +667,9 @@ int aimPreAnalysis(int iIndex, void *aimInfo, const char *analysisPath, capsValu
             printf("Number of tris = %d\n", egadsInstance[iIndex].surfaceMesh[bodyIndex].meshQuickRef.numTriangle);
             printf("Number of quad = %d\n", egadsInstance[iIndex].surfaceMesh[bodyIndex].meshQuickRef.numQuadrilateral);
         }
+
+        printf("Tessellation time = %.3f s, surface mesh time = %.3f s\n",
+               tessTime[bodyIndex], meshTime[bodyIndex]);
     }
 
 
@@ -843,6 +871,8 @@ int aimPreAnalysis(int iIndex, void *aimInfo, const char *analysisPath, capsValu
         (void) destroy_meshStruct(&combineMesh);
 
         if (filename != NULL) EG_free(filename);
+        if (tessTime != NULL) EG_free(tessTime);
+        if (meshTime != NULL) EG_free(meshTime);
         return status;
 }
 
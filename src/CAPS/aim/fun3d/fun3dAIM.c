@@ -2729,12 +2729,15 @@ int aimTransfer(capsDiscr *discr, const char *dataName, int numPoint, int dataRa
     // Variables used in global node mapping
     int *nodeMap, *storage;
     int globalNodeID;
-    int found = (int) false;
+    int *globalIDList = NULL;
+    mapIDToIndexStruct globalIDMap;
 
     // Filename stuff
     int *capsGroupList;
     char *filename = NULL; //"pyCAPS_FUN3D_Tetgen_ddfdrive_bndry1.dat";
 
+    (void) initiate_mapIDToIndexStruct(&globalIDMap);
+
 #ifdef DEBUG
     printf(" fun3dAIM/aimTransfer name = %s  instance = %d  npts = %d/%d!\n", dataName, discr->instance, numPoint, dataRank);
 #endif
@@ -2862,19 +2865,30 @@ int aimTransfer(capsDiscr *discr, const char *dataName, int numPoint, int dataRa
             goto bail;
         }
 
+        // Global node ID -> data point lookup for this file
+        globalIDList = (int *) EG_alloc(numDataPoint*sizeof(int));
+        if (globalIDList == NULL) {
+            status = EGADS_MALLOC;
+            goto bail;
+        }
+
+        for (dataPoint = 0; dataPoint < numDataPoint; dataPoint++) {
+            globalIDList[dataPoint] = (int) dataMatrix[globalIDIndex][dataPoint];
+        }
+
+        status = create_mapIDToIndexStruct(numDataPoint, globalIDList, &globalIDMap);
+        if (status != CAPS_SUCCESS) goto bail;
+
+        EG_free(globalIDList);
+        globalIDList = NULL;
+
         for (i = 0; i < numPoint; i++) {
 
             globalNodeID = nodeMap[i];
 
-            found = (int) false;
-            for (dataPoint = 0; dataPoint < numDataPoint; dataPoint++) {
-                if ((int) dataMatrix[globalIDIndex][dataPoint] ==  globalNodeID) {
-                    found = (int) true;
-                    break;
-                }
-            }
+            dataPoint = get_mapIDToIndex(&globalIDMap, globalNodeID);
 
-            if (found == (int) true) {
+            if (dataPoint >= 0) {
                 for (j = 0; j < dataRank; j++) {
 
                     // Add something for units - aim_covert()
@@ -2887,6 +2901,8 @@ int aimTransfer(capsDiscr *discr, const char *dataName, int numPoint, int dataRa
             }
         }
 
+        (void) destroy_mapIDToIndexStruct(&globalIDMap);
+
         // Free data matrix
         if (dataMatrix != NULL) {
             for (i = 0; i < numVariable; i++) {
@@ -2916,6 +2932,9 @@ int aimTransfer(capsDiscr *discr, const char *dataName, int numPoint, int dataRa
             EG_free(dataMatrix);
         }
 
+        if (globalIDList != NULL) EG_free(globalIDList);
+        (void) destroy_mapIDToIndexStruct(&globalIDMap);
+
         // Free variable list
         status2 = string_freeArray(numVariable, &variableName);
         if (status2 != CAPS_SUCCESS) return status2;
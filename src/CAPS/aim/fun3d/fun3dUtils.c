@@ -135,11 +135,18 @@ int fun3d_readAeroLoad(char *filename, int *numVariable, char **variableName[],
             }
         }
 
-        // Loop through the file and fill up the data matrix
-        for (j = 0; j < *numDataPoint; j++) {
-            for (i = 0; i < *numVariable; i++) {
-                fscanf(fp, "%lf", &(*dataMatrix)[i][j]);
-            }
+        // Read the rest of the file and fill up the data matrix
+        status = read_dataColumns(fp, *numDataPoint, *numVariable, *dataMatrix);
+        if (status != CAPS_SUCCESS) {
+            printf("Error reading data values from file - %s\n", filename);
+
+            for (i = 0; i < *numVariable; i++) EG_free((*dataMatrix)[i]);
+            EG_free(*dataMatrix);
+            *dataMatrix = NULL;
+
+            fclose(fp);
+            if (line != NULL) EG_free(line);
+            return status;
         }
 
         // Output the first row of the dataMatrix
@@ -368,6 +375,8 @@ int fun3D_dataTransfer(void *aimInfo,
     // Variables used in global node mapping
     int *nodeMap, *storage;
     int globalNodeID;
+    int *nodeIDList = NULL;
+    mapIDToIndexStruct nodeIDMap;
 
     // Data transfer Out variables
     const char *dataOutName[] = {"x","y","z", "id", "dx", "dy", "dz"};
@@ -392,6 +401,7 @@ int fun3D_dataTransfer(void *aimInfo,
     if (status != CAPS_SUCCESS) return status;
 
     (void) initiate_meshStruct(&surfaceMesh);
+    (void) initiate_mapIDToIndexStruct(&nodeIDMap);
 
     foundDisplacement = foundEigenVector = (int) false;
     for (i = 0; i < numTransferName; i++) {
@@ -578,6 +588,18 @@ int fun3D_dataTransfer(void *aimInfo,
         }
     }
 
+    // Global node ID -> dataOutMatrix index lookup, shared by all data sets
+    nodeIDList = (int *) EG_alloc(numOutDataPoint*sizeof(int));
+    if (nodeIDList == NULL) {
+        status = EGADS_MALLOC;
+        goto cleanup;
+    }
+
+    for (i = 0; i < numOutDataPoint; i++) nodeIDList[i] = surfaceMesh.node[i].nodeID;
+
+    status = create_mapIDToIndexStruct(numOutDataPoint, nodeIDList, &nodeIDMap);
+    if (status != CAPS_SUCCESS) goto cleanup;
+
     // Re-loop through transfers - if we are doing displacements
     if (foundDisplacement == (int) true) {
 
@@ -604,18 +626,16 @@ int fun3D_dataTransfer(void *aimInfo,
             for (j = 0; j < numDataTransferPoint; j++) {
 
                 globalNodeID = nodeMap[j];
-                for (k = 0; k < numOutDataPoint; k++) {
 
-                    // If the global node IDs match store the displacement values in the dataOutMatrix
-                    if (globalNodeID  == (int) dataOutMatrix[3][k]) {
+                // If the global node ID is found store the displacement values in the dataOutMatrix
+                k = get_mapIDToIndex(&nodeIDMap, globalNodeID);
+                if (k >= 0) {
 
-                        // A rank of 3 should have already been checked
-                        // Delta displacements
-                        dataOutMatrix[4][k] = dataTransferData[3*j+0];
-                        dataOutMatrix[5][k] = dataTransferData[3*j+1];
-                        dataOutMatrix[6][k] = dataTransferData[3*j+2];
-                        break;
-                    }
+                    // A rank of 3 should have already been checked
+                    // Delta displacements
+                    dataOutMatrix[4][k] = dataTransferData[3*j+0];
+                    dataOutMatrix[5][k] = dataTransferData[3*j+1];
+                    dataOutMatrix[6][k] = dataTransferData[3*j+2];
                 }
             }
         } // End dataTransferDiscreteObj loop
@@ -702,18 +722,16 @@ int fun3D_dataTransfer(void *aimInfo,
                 for (j = 0; j < numDataTransferPoint; j++) {
 
                     globalNodeID = nodeMap[j];
-                    for (k = 0; k < numOutDataPoint; k++) {
 
-                        // If the global node IDs match store the displacement values in the dataOutMatrix
-                        if (globalNodeID  == (int) dataOutMatrix[3][k]) {
+                    // If the global node ID is found store the displacement values in the dataOutMatrix
+                    k = get_mapIDToIndex(&nodeIDMap, globalNodeID);
+                    if (k >= 0) {
 
-                            // A rank of 3 should have already been checked
-                            // Eigen-vector
-                            dataOutMatrix[4][k] = dataTransferData[3*j+0];
-                            dataOutMatrix[5][k] = dataTransferData[3*j+1];
-                            dataOutMatrix[6][k] = dataTransferData[3*j+2];
-                            break;
-                        }
+                        // A rank of 3 should have already been checked
+                        // Eigen-vector
+                        dataOutMatrix[4][k] = dataTransferData[3*j+0];
+                        dataOutMatrix[5][k] = dataTransferData[3*j+1];
+                        dataOutMatrix[6][k] = dataTransferData[3*j+2];
                     }
                 }
             } // End dataTransferDiscreteObj loop
@@ -781,6 +799,9 @@ int fun3D_dataTransfer(void *aimInfo,
     if (status != CAPS_SUCCESS) printf("Error: Premature exit in fun3D_dataTransfer status = %d\n", status);
 
     (void) destroy_meshStruct(&surfaceMesh);
+    (void) destroy_mapIDToIndexStruct(&nodeIDMap);
+
+    if (nodeIDList != NULL) EG_free(nodeIDList);
 
     if (dataOutMatrix != NULL) {
         for (i = 0; i < numOutVariable; i++) {
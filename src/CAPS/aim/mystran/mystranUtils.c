@@ -203,6 +203,33 @@ int mystran_readOutput4Data(FILE *fp, const char *keyword, capsValue *val) {
     }
 }
 
+// Block headers recorded when indexing a Mystran F06 file
+static const char *f06NumEigenLine = "                                NUMBER OF EIGENVALUES EXTRACTED  . . . . . .";
+static const char *f06EigenVectorLine = " OUTPUT FOR EIGENVECTOR        ";
+static const char *f06SubcaseLine = " OUTPUT FOR SUBCASE        ";
+
+// Index of the last F06 file read - kept until the file is modified so repeated reads of
+//  the same results (e.g. one per data transfer) seek directly to the blocks they need
+static resultFileIndexStruct f06Index;
+
+// Index the result blocks of a Mystran F06 file (if not already indexed)
+static int mystran_indexF06(FILE *fp) {
+
+    const char *keyword[3];
+
+    keyword[0] = f06NumEigenLine;
+    keyword[1] = f06EigenVectorLine;
+    keyword[2] = f06SubcaseLine;
+
+    return index_resultFile(fp, 3, keyword, &f06Index);
+}
+
+// Free the index kept of the last F06 file read
+int mystran_freeF06Index(void) {
+
+    return destroy_resultFileIndexStruct(&f06Index);
+}
+
 // Read data from a Mystran F06 file and load it into a dataMatrix[numEigenVector][numGridPoint*8]
 // where variables are Grid Id, Coord Id, T1, T2, T3, R1, R2, R3
 int mystran_readF06EigenVector(FILE *fp, int *numEigenVector, int *numGridPoint, double ***dataMatrix) {
@@ -210,13 +237,14 @@ int mystran_readF06EigenVector(FILE *fp, int *numEigenVector, int *numGridPoint,
     int status; // Function return
 
     int i, j, eigenValue; // Indexing
+    int block = -1, firstBlock;
 
     size_t linecap = 0;
 
     char *line = NULL; // Temporary line holder
 
-    char *numEigenLine = "                                NUMBER OF EIGENVALUES EXTRACTED  . . . . . .";
-    char *outputEigenLine = " OUTPUT FOR EIGENVECTOR        ";
+    const char *numEigenLine = f06NumEigenLine;
+    const char *outputEigenLine = f06EigenVectorLine;
     char *beginEigenLine=NULL;
     char *endEigenLine = "                         ------------- ------------- ------------- ------------- ------------- -------------";
 
@@ -228,47 +256,43 @@ int mystran_readF06EigenVector(FILE *fp, int *numEigenVector, int *numGridPoint,
     *numEigenVector = 0;
     *numGridPoint = 0;
 
-    // Loop through file line by line until we have determined how many Eigen-Values and grid points we have
-    while (*numGridPoint == 0) {
+    status = mystran_indexF06(fp);
+    if (status != CAPS_SUCCESS) return status;
 
-        // Get line from file
-        status = getline(&line, &linecap, fp);
-        if (status < 0) break;
+    // See how many Eigen-Values we have
+    status = seek_resultFileBlock(fp, &f06Index, numEigenLine, &block);
+    if (status == CAPS_SUCCESS) {
+        sscanf(&f06Index.blockLine[block][strlen(numEigenLine)], "%d", numEigenVector);
+    }
 
-        // See how many Eigen-Values we have
-        if (strncmp(numEigenLine, line,strlen(numEigenLine)) == 0) {
-            sscanf(&line[strlen(numEigenLine)], "%d", numEigenVector);
+    firstBlock = block;
 
-            // Build begin Eigen-Value string
-            beginEigenLine = (char *) EG_alloc((strlen(outputEigenLine)+2)*sizeof(char));
-            if (beginEigenLine == NULL) {
-                if (line != NULL) EG_free(line);
-                return EGADS_MALLOC;
-            }
+    // Once we know how many Eigen-Values we have, we need to determine how many grid points exist
+    if (*numEigenVector > 0) {
 
-            sprintf(beginEigenLine,"%s%d",outputEigenLine, 1);
-            beginEigenLine[strlen(outputEigenLine)+1] = '\0';
-        }
+        // Build begin Eigen-Value string
+        beginEigenLine = (char *) EG_alloc((strlen(outputEigenLine)+2)*sizeof(char));
+        if (beginEigenLine == NULL) return EGADS_MALLOC;
 
-        // Once we know how many Eigen-Values we have, we need to determine how many grid points exist
-        if (*numEigenVector > 0) {
+        sprintf(beginEigenLine,"%s%d",outputEigenLine, 1);
+        beginEigenLine[strlen(outputEigenLine)+1] = '\0';
 
-            // Look for start of Eigen-Vector 1
-            if (strncmp(beginEigenLine, line, strlen(beginEigenLine)) == 0) {
+        // Look for start of Eigen-Vector 1
+        while (*numGridPoint == 0 &&
+               seek_resultFileBlock(fp, &f06Index, beginEigenLine, &block) == CAPS_SUCCESS) {
 
-                // Fast forward 5 lines
-                for (i = 0; i < 5; i++) {
-                    status = getline(&line, &linecap, fp);
-                    if (status < 0) break;
-                }
+            // Fast forward 5 lines
+            for (i = 0; i < 5; i++) {
+                status = getline(&line, &linecap, fp);
+                if (status < 0) break;
+            }
 
-                // Loop through lines counting the number of grid points
-                while (getline(&line, &linecap, fp) >= 0) {
-                    *numGridPoint +=1;
-                    if (strncmp(endEigenLine, line,strlen(endEigenLine)) == 0) {
-                        *numGridPoint -= 1; // Get rid of last line
-                        break;
-                    }
+            // Loop through lines counting the number of grid points
+            while (getline(&line, &linecap, fp) >= 0) {
+                *numGridPoint +=1;
+                if (strncmp(endEigenLine, line,strlen(endEigenLine)) == 0) {
+                    *numGridPoint -= 1; // Get rid of last line
+                    break;
                 }
             }
         }
@@ -285,10 +309,9 @@ int mystran_readF06EigenVector(FILE *fp, int *numEigenVector, int *numGridPoint,
         printf("\tEither the number of data points  = 0 and/or the number of Eigen-Values = 0!!!\n");
         printf("\tWas a modal analysis run?\n");
         if (line != NULL) EG_free(line);
+        rewind(fp);
         return CAPS_NOTFOUND;
     }
-    // Rewind the file
-    rewind(fp);
 
     // Allocate dataMatrix array
     if (*dataMatrix != NULL) EG_free(*dataMatrix);
@@ -321,54 +344,46 @@ int mystran_readF06EigenVector(FILE *fp, int *numEigenVector, int *numGridPoint,
     else if (*numEigenVector >= 10) intLength = 2;
     else intLength = 1;
 
-    // Loop through the file again and pull out data
-    eigenValue = 1;
-    while (eigenValue <= *numEigenVector) {
+    // Go to each Eigen-Vector block and pull out data
+    block = firstBlock;
+    for (eigenValue = 1; eigenValue <= *numEigenVector; eigenValue++) {
 
+        // Build begin Eigen-Value string
+        beginEigenLine = (char *) EG_alloc((strlen(outputEigenLine)+intLength+1)*sizeof(char));
         if (beginEigenLine == NULL) {
-            // Build begin Eigen-Value string
-            beginEigenLine = (char *) EG_alloc((strlen(outputEigenLine)+intLength+1)*sizeof(char));
-            if (beginEigenLine == NULL) {
-                if (line != NULL) EG_free(line);
-                return EGADS_MALLOC;
-            }
-
-            sprintf(beginEigenLine,"%s%d",outputEigenLine, eigenValue);
-            beginEigenLine[strlen(outputEigenLine)+intLength] = '\0';
+            if (line != NULL) EG_free(line);
+            return EGADS_MALLOC;
         }
 
-        // Get line from file
-        status = getline(&line, &linecap, fp);
-        if (status < 0) break;
+        sprintf(beginEigenLine,"%s%d",outputEigenLine, eigenValue);
+        beginEigenLine[strlen(outputEigenLine)+intLength] = '\0';
 
-        // Look for start of Eigen-Vector
-        if (strncmp(beginEigenLine, line, strlen(beginEigenLine)) == 0) {
+        status = seek_resultFileBlock(fp, &f06Index, beginEigenLine, &block);
 
-            printf("\tLoading Eigen-Vector = %d\n", eigenValue);
+        EG_free(beginEigenLine);
+        beginEigenLine = NULL;
 
-            // Fast forward 5 lines
-            for (i = 0; i < 5; i++) {
-                status = getline(&line, &linecap, fp);
-                if (status < 0) break;
-            }
+        if (status != CAPS_SUCCESS) break;
 
-            // Loop through the file and fill up the data matrix
-            for (j = 0; j < (*numGridPoint)*numVariable; j++) {
-                // eigenValue is 1 bias
-                fscanf(fp, "%lf", &(*dataMatrix)[eigenValue-1][j]);
-            }
+        printf("\tLoading Eigen-Vector = %d\n", eigenValue);
 
-            if (beginEigenLine != NULL) EG_free(beginEigenLine);
-            beginEigenLine = NULL;
+        // Fast forward 5 lines
+        for (i = 0; i < 5; i++) {
+            status = getline(&line, &linecap, fp);
+            if (status < 0) break;
+        }
 
-            eigenValue += 1;
+        // Loop through the file and fill up the data matrix
+        for (j = 0; j < (*numGridPoint)*numVariable; j++) {
+            // eigenValue is 1 bias
+            fscanf(fp, "%lf", &(*dataMatrix)[eigenValue-1][j]);
         }
     }
 
-    if (beginEigenLine != NULL) EG_free(beginEigenLine);
-
     if (line != NULL) EG_free(line);
 
+    rewind(fp);
+
     return CAPS_SUCCESS;
 }
 
@@ -379,12 +394,13 @@ int mystran_readF06Displacement(FILE *fp, int subcaseId, int *numGridPoint, doub
     int status; // Function return
 
     int i, j; // Indexing
+    int block = -1;
 
     size_t linecap = 0;
 
     char *line = NULL; // Temporary line holder
 
-    char *outputSubcaseLine = " OUTPUT FOR SUBCASE        ";
+    const char *outputSubcaseLine = f06SubcaseLine;
     char *beginSubcaseLine=NULL;
     char *endSubcaseLine = "                         ------------- ------------- ------------- ------------- ------------- -------------";
 
@@ -396,6 +412,9 @@ int mystran_readF06Displacement(FILE *fp, int subcaseId, int *numGridPoint, doub
 
     *numGridPoint = 0;
 
+    status = mystran_indexF06(fp);
+    if (status != CAPS_SUCCESS) return status;
+
     if      (subcaseId >= 1000) intLength = 4;
     else if (subcaseId >= 100) intLength = 3;
     else if (subcaseId >= 10) intLength = 2;
@@ -407,29 +426,22 @@ int mystran_readF06Displacement(FILE *fp, int subcaseId, int *numGridPoint, doub
     sprintf(beginSubcaseLine,"%s%d",outputSubcaseLine, subcaseId);
     beginSubcaseLine[strlen(outputSubcaseLine)+intLength] = '\0';
 
-    // Loop through file line by line until we have determined how many grid points we have
-    while (*numGridPoint == 0) {
-
-        // Get line from file
-        status = getline(&line, &linecap, fp);
-        if (status < 0) break;
+    // Loop through the matching blocks until we have determined how many grid points we have
+    while (*numGridPoint == 0 &&
+           seek_resultFileBlock(fp, &f06Index, beginSubcaseLine, &block) == CAPS_SUCCESS) {
 
-        // Look for start of subcaseId
-        if (strncmp(beginSubcaseLine, line, strlen(beginSubcaseLine)) == 0) {
-
-            // Fast forward 5 lines
-            for (i = 0; i < 5; i++) {
-                status = getline(&line, &linecap, fp);
-                if (status < 0) break;
-            }
+        // Fast forward 5 lines
+        for (i = 0; i < 5; i++) {
+            status = getline(&line, &linecap, fp);
+            if (status < 0) break;
+        }
 
-            // Loop through lines counting the number of grid points
-            while (getline(&line, &linecap, fp) >= 0) {
-                if (strncmp(endSubcaseLine, line,strlen(endSubcaseLine)) == 0) {
-                    break;
-                }
-                *numGridPoint +=1;
+        // Loop through lines counting the number of grid points
+        while (getline(&line, &linecap, fp) >= 0) {
+            if (strncmp(endSubcaseLine, line,strlen(endSubcaseLine)) == 0) {
+                break;
             }
+            *numGridPoint +=1;
         }
     }
 
@@ -440,17 +452,19 @@ int mystran_readF06Displacement(FILE *fp, int subcaseId, int *numGridPoint, doub
 
         if (beginSubcaseLine != NULL) EG_free(beginSubcaseLine);
         if (line != NULL) EG_free(line);
+        rewind(fp);
         return CAPS_NOTFOUND;
     }
 
-    // Rewind the file
-    rewind(fp);
-
     // Allocate dataMatrix array
     if (*dataMatrix != NULL) EG_free(*dataMatrix);
 
     *dataMatrix = (double **) EG_alloc(*numGridPoint *sizeof(double *));
-    if (*dataMatrix == NULL) return EGADS_MALLOC; // If allocation failed ....
+    if (*dataMatrix == NULL) {
+        if (beginSubcaseLine != NULL) EG_free(beginSubcaseLine);
+        if (line != NULL) EG_free(line);
+        return EGADS_MALLOC; // If allocation failed ....
+    }
 
     for (i = 0; i < *numGridPoint; i++) {
 
@@ -464,34 +478,32 @@ int mystran_readF06Displacement(FILE *fp, int subcaseId, int *numGridPoint, doub
 
             if ((*dataMatrix) != NULL) EG_free((*dataMatrix));
 
+            if (beginSubcaseLine != NULL) EG_free(beginSubcaseLine);
+            if (line != NULL) EG_free(line);
             return EGADS_MALLOC;
         }
     }
 
-    // Loop through the file again and pull out data
-    while (getline(&line, &linecap, fp) >= 0) {
-
-        // Look for start of Eigen-Vector
-        if (strncmp(beginSubcaseLine, line, strlen(beginSubcaseLine)) == 0) {
+    // Go back to the block the grid points were counted in and pull out data
+    block -= 1;
+    status = seek_resultFileBlock(fp, &f06Index, beginSubcaseLine, &block);
+    if (status == CAPS_SUCCESS) {
 
-            printf("\tLoading displacements for Subcase = %d\n", subcaseId);
+        printf("\tLoading displacements for Subcase = %d\n", subcaseId);
 
-            // Fast forward 5 lines
-            for (i = 0; i < 5; i++) {
-                status = getline(&line, &linecap, fp);
-                if (status < 0) break;
-            }
+        // Fast forward 5 lines
+        for (i = 0; i < 5; i++) {
+            status = getline(&line, &linecap, fp);
+            if (status < 0) break;
+        }
 
-            // Loop through the file and fill up the data matrix
-            for (i = 0; i < (*numGridPoint); i++) {
-                for (j = 0; j < numVariable; j++) {
+        // Loop through the file and fill up the data matrix
+        for (i = 0; i < (*numGridPoint); i++) {
+            for (j = 0; j < numVariable; j++) {
 
-                    if (fscanf(fp, "%lf", &(*dataMatrix)[i][j]) == 1)
-                        numDataRead++;
-                }
+                if (fscanf(fp, "%lf", &(*dataMatrix)[i][j]) == 1)
+                    numDataRead++;
             }
-
-            break;
         }
     }
 
@@ -499,6 +511,8 @@ int mystran_readF06Displacement(FILE *fp, int subcaseId, int *numGridPoint, doub
 
     if (line != NULL) EG_free(line);
 
+    rewind(fp);
+
     if (numDataRead/numVariable != *numGridPoint) {
         printf("Failed to read %d grid points. Only found %d.\n", *numGridPoint, numDataRead/numVariable);
         return CAPS_IOERR;
@@ -15,6 +15,9 @@ int mystran_readF06EigenVector(FILE *fp, int *numEigenVector, int *numGridPoint,
 // where variables are Grid Id, Coord Id, T1, T2, T3, R1, R2, R3
 int mystran_readF06Displacement(FILE *fp, int subcaseId, int *numGridPoint, double ***dataMatrix);
 
+// Free the index kept of the last F06 file read
+int mystran_freeF06Index(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -2495,6 +2495,7 @@ void aimCleanup()
     if (nastranInstance != NULL) EG_free(nastranInstance);
     nastranInstance = NULL;
 
+    (void) nastran_freeF06Index();
 }
 
 
@@ -3361,6 +3362,8 @@ int aimTransfer(capsDiscr *discr, const char *dataName, int numPoint, int dataRa
     // Variables used in global node mapping
     int *nodeMap, *storage;
     int globalNodeID;
+    int *gridIDList = NULL;
+    mapIDToIndexStruct gridIDMap;
 
 
     // Filename stuff
@@ -3371,6 +3374,8 @@ int aimTransfer(capsDiscr *discr, const char *dataName, int numPoint, int dataRa
         printf(" nastranAIM/aimTransfer name = %s  instance = %d  npts = %d/%d!\n", dataName, discr->instance, numPoint, dataRank);
     #endif
 
+    (void) initiate_mapIDToIndexStruct(&gridIDMap);
+
     //Get the appropriate parts of the tessellation to data
     storage = (int *) discr->ptrm;
     nodeMap = &storage[0]; // Global indexing on the body
@@ -3488,21 +3493,36 @@ int aimTransfer(capsDiscr *discr, const char *dataName, int numPoint, int dataRa
 
     }
 
+    // Grid ID -> data matrix row lookup
+    gridIDList = (int *) EG_alloc(numGridPoint*sizeof(int));
+    if (gridIDList == NULL) {
+        status = EGADS_MALLOC;
+        goto cleanup;
+    }
+
+    for (dataPoint = 0; dataPoint < numGridPoint; dataPoint++) {
+        if (strcasecmp(dataName, "Displacement") == 0) {
+            gridIDList[dataPoint] = (int) dataMatrix[dataPoint][0];
+        } else {
+            gridIDList[dataPoint] = (int) dataMatrix[eigenVectorIndex - 1][8*dataPoint + 0];
+        }
+    }
+
+    status = create_mapIDToIndexStruct(numGridPoint, gridIDList, &gridIDMap);
+    if (status != CAPS_SUCCESS) goto cleanup;
+
     for (i = 0; i < numPoint; i++) {
 
         globalNodeID = nodeMap[i];
 
-        if (strcasecmp(dataName, "Displacement") == 0) {
-
-            for (dataPoint = 0; dataPoint < numGridPoint; dataPoint++) {
-                if ((int) dataMatrix[dataPoint][0] ==  globalNodeID) break;
-            }
+        dataPoint = get_mapIDToIndex(&gridIDMap, globalNodeID);
+        if (dataPoint < 0) {
+            printf("Unable to locate global ID = %d in the data matrix\n", globalNodeID);
+            status = CAPS_NOTFOUND;
+            goto cleanup;
+        }
 
-            if (dataPoint == numGridPoint) {
-                printf("Unable to locate global ID = %d in the data matrix\n", globalNodeID);
-                status = CAPS_NOTFOUND;
-                goto cleanup;
-            }
+        if (strcasecmp(dataName, "Displacement") == 0) {
 
             dataVal[dataRank*i+0] = dataMatrix[dataPoint][2]; // T1
             dataVal[dataRank*i+1] = dataMatrix[dataPoint][3]; // T2
@@ -3510,17 +3530,6 @@ int aimTransfer(capsDiscr *discr, const char *dataName, int numPoint, int dataRa
 
         } else if (strncmp(dataName, "EigenVector", 11) == 0) {
 
-
-            for (dataPoint = 0; dataPoint < numGridPoint; dataPoint++) {
-                if ((int) dataMatrix[eigenVectorIndex - 1][8*dataPoint + 0] ==  globalNodeID) break;
-            }
-
-            if (dataPoint == numGridPoint) {
-                printf("Unable to locate global ID = %d in the data matrix\n", globalNodeID);
-                status = CAPS_NOTFOUND;
-                goto cleanup;
-            }
-
             dataVal[dataRank*i+0] = dataMatrix[eigenVectorIndex- 1][8*dataPoint + 2]; // T1
             dataVal[dataRank*i+1] = dataMatrix[eigenVectorIndex- 1][8*dataPoint + 3]; // T2
             dataVal[dataRank*i+2] = dataMatrix[eigenVectorIndex- 1][8*dataPoint + 4]; // T3
@@ -3547,6 +3556,9 @@ int aimTransfer(capsDiscr *discr, const char *dataName, int numPoint, int dataRa
             EG_free(dataMatrix);
         }
 
+        if (gridIDList != NULL) EG_free(gridIDList);
+        (void) destroy_mapIDToIndexStruct(&gridIDMap);
+
         return status;
 }
 int aimInterpolation(capsDiscr *discr, /*@unused@*/ const char *name, int eIndex,
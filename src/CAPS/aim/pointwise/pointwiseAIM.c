@@ -365,24 +365,60 @@ static int destroy_aimStorage(int iIndex) {
 }
 
 
-static int getUGRID(FILE *fp, meshStruct *volumeMesh)
+// Fill the elements of a given type from the connectivity block of a UGRID file view
+static int getUGRIDElements(const char *data, meshElementTypeEnum elementType, int markerID,
+                            int numType, int *elementIndex, meshStruct *volumeMesh)
+{
+  int status;
+  int i, numPoint;
+  meshElementStruct *element;
+
+  numPoint = mesh_numMeshConnectivity(elementType);
+
+  for (i = 0; i < numType; i++) {
+
+      element = &volumeMesh->element[*elementIndex];
+
+      element->elementType = elementType;
+      element->elementID   = *elementIndex+1;
+      element->markerID    = markerID;
+
+      status = mesh_allocMeshElementConnectivity(element);
+      if (status != CAPS_SUCCESS) return status;
+
+      // copy the element connectivity straight out of the mapped file
+      memcpy(element->connectivity, data + (size_t) i*numPoint*sizeof(int), numPoint*sizeof(int));
+
+      *elementIndex += 1;
+  }
+
+  return CAPS_SUCCESS;
+}
+
+
+static int getUGRID(const fileViewStruct *view, meshStruct *volumeMesh)
 {
   int    status = CAPS_SUCCESS;
 
+  int    header[7];
   int    numNode, numTriangle, numQuadrilateral;
   int    numTetrahedral, numPyramid, numPrism, numHexahedral;
-  int    i, elementIndex, numPoint;
+  int    i, elementIndex;
   int    defaultVolID = 1; // Defailt volume ID
-  double *coords = NULL;
+  size_t offset, size;
+
+  /* we get a binary UGRID file from Pointwise - it is read in place from a view of the file */
+  if (view->size < sizeof(header)) { status = CAPS_IOERR; goto cleanup; }
 
-  /* we get a binary UGRID file from Pointwise */
-  status = fread(&numNode,          sizeof(int), 1, fp); if (status != 1) { status = CAPS_IOERR; goto cleanup; }
-  status = fread(&numTriangle,      sizeof(int), 1, fp); if (status != 1) { status = CAPS_IOERR; goto cleanup; }
-  status = fread(&numQuadrilateral, sizeof(int), 1, fp); if (status != 1) { status = CAPS_IOERR; goto cleanup; }
-  status = fread(&numTetrahedral,   sizeof(int), 1, fp); if (status != 1) { status = CAPS_IOERR; goto cleanup; }
-  status = fread(&numPyramid,       sizeof(int), 1, fp); if (status != 1) { status = CAPS_IOERR; goto cleanup; }
-  status = fread(&numPrism,         sizeof(int), 1, fp); if (status != 1) { status = CAPS_IOERR; goto cleanup; }
-  status = fread(&numHexahedral,    sizeof(int), 1, fp); if (status != 1) { status = CAPS_IOERR; goto cleanup; }
+  memcpy(header, view->data, sizeof(header));
+
+  numNode          = header[0];
+  numTriangle      = header[1];
+  numQuadrilateral = header[2];
+  numTetrahedral   = header[3];
+  numPyramid       = header[4];
+  numPrism         = header[5];
+  numHexahedral    = header[6];
 
   /*
   printf("\n Header from UGRID file: %d  %d %d  %d %d %d %d\n", numNode,
@@ -390,12 +426,18 @@ static int getUGRID(FILE *fp, meshStruct *volumeMesh)
          numHexahedral);
    */
 
-  coords = (double *) EG_alloc(3*numNode*sizeof(double));
-  if (coords == NULL) return EGADS_MALLOC;
-
-  /* read all of the vertices */
-  status = fread(coords, sizeof(double), 3*numNode, fp);
-  if (status != 3*numNode) { status = CAPS_IOERR; goto cleanup; }
+  // Make sure the file holds everything the header says it does
+  size = sizeof(header) + 3*(size_t) numNode*sizeof(double)
+       + (3*(size_t) numTriangle + 4*(size_t) numQuadrilateral)*sizeof(int)
+       + ((size_t) numTriangle + (size_t) numQuadrilateral)*sizeof(int)
+       + (4*(size_t) numTetrahedral + 5*(size_t) numPyramid +
+          6*(size_t) numPrism + 8*(size_t) numHexahedral)*sizeof(int);
+
+  if (numNode < 0 || numTriangle < 0 || numQuadrilateral < 0 || numTetrahedral < 0 ||
+      numPyramid < 0 || numPrism < 0 || numHexahedral < 0 || view->size < size) {
+    status = CAPS_IOERR;
+    goto cleanup;
+  }
 
   // TODO: Should this be something else?
   volumeMesh->analysisType = UnknownMeshAnalysis;
@@ -436,23 +478,19 @@ static int getUGRID(FILE *fp, meshStruct *volumeMesh)
   volumeMesh->node = (meshNodeStruct *) EG_alloc(volumeMesh->numNode*sizeof(meshNodeStruct));
   if (volumeMesh->node == NULL) return EGADS_MALLOC;
 
-  // Initialize
+  // Nodes - set straight from the file (the coordinates are not necessarily aligned)
+  offset = sizeof(header);
   for (i = 0; i < volumeMesh->numNode; i++) {
-      status = initiate_meshNodeStruct(&volumeMesh->node[i], volumeMesh->analysisType);
-      if (status != CAPS_SUCCESS) return status;
-  }
 
-  // Nodes - set
-  for (i = 0; i < volumeMesh->numNode; i++) {
+    status = initiate_meshNodeStruct(&volumeMesh->node[i], volumeMesh->analysisType);
+    if (status != CAPS_SUCCESS) return status;
 
     // Copy node data
     volumeMesh->node[i].nodeID = i+1;
 
-    volumeMesh->node[i].xyz[0] = coords[3*i+0];
-    volumeMesh->node[i].xyz[1] = coords[3*i+1];
-    volumeMesh->node[i].xyz[2] = coords[3*i+2];
+    memcpy(volumeMesh->node[i].xyz, view->data + offset, 3*sizeof(double));
+    offset += 3*sizeof(double);
   }
-  EG_free(coords); coords = NULL;
 
 
   // Elements - allocate
@@ -474,133 +512,53 @@ static int getUGRID(FILE *fp, meshStruct *volumeMesh)
   // Elements -Set triangles
   if (numTriangle > 0) volumeMesh->meshQuickRef.startIndexTriangle = elementIndex;
 
-  numPoint = mesh_numMeshConnectivity(Triangle);
-  for (i = 0; i < numTriangle; i++) {
-
-      volumeMesh->element[elementIndex].elementType = Triangle;
-      volumeMesh->element[elementIndex].elementID   = elementIndex+1;
-
-      status = mesh_allocMeshElementConnectivity(&volumeMesh->element[elementIndex]);
-      if (status != CAPS_SUCCESS) return status;
-
-      // read the element connectivity
-      status = fread(volumeMesh->element[elementIndex].connectivity, sizeof(int), numPoint, fp);
-      if (status != numPoint) { status = CAPS_IOERR; goto cleanup; }
-
-      elementIndex += 1;
-  }
+  status = getUGRIDElements(view->data + offset, Triangle, 0, numTriangle, &elementIndex, volumeMesh);
+  if (status != CAPS_SUCCESS) goto cleanup;
+  offset += 3*(size_t) numTriangle*sizeof(int);
 
   // Elements -Set quadrilateral
   if (numQuadrilateral > 0) volumeMesh->meshQuickRef.startIndexQuadrilateral = elementIndex;
 
-  numPoint = mesh_numMeshConnectivity(Quadrilateral);
-  for (i = 0; i < numQuadrilateral; i++) {
-
-      volumeMesh->element[elementIndex].elementType = Quadrilateral;
-      volumeMesh->element[elementIndex].elementID   = elementIndex+1;
-
-      status = mesh_allocMeshElementConnectivity(&volumeMesh->element[elementIndex]);
-      if (status != CAPS_SUCCESS) return status;
-
-      // read the element connectivity
-      status = fread(volumeMesh->element[elementIndex].connectivity, sizeof(int), numPoint, fp);
-      if (status != numPoint) { status = CAPS_IOERR; goto cleanup; }
-
-      elementIndex += 1;
-  }
+  status = getUGRIDElements(view->data + offset, Quadrilateral, 0, numQuadrilateral, &elementIndex, volumeMesh);
+  if (status != CAPS_SUCCESS) goto cleanup;
+  offset += 4*(size_t) numQuadrilateral*sizeof(int);
 
   // skip face ID section of the file
   // they do not map to the elements on faces
-  status = fseek(fp, (numTriangle + numQuadrilateral)*sizeof(int), SEEK_CUR);
-  if (status != 0) { status = CAPS_IOERR; goto cleanup; }
+  offset += ((size_t) numTriangle + (size_t) numQuadrilateral)*sizeof(int);
 
   // Elements -Set Tetrahedral
   if (numTetrahedral > 0) volumeMesh->meshQuickRef.startIndexTetrahedral = elementIndex;
 
-  numPoint = mesh_numMeshConnectivity(Tetrahedral);
-  for (i = 0; i < numTetrahedral; i++) {
-
-      volumeMesh->element[elementIndex].elementType = Tetrahedral;
-      volumeMesh->element[elementIndex].elementID   = elementIndex+1;
-      volumeMesh->element[elementIndex].markerID    = defaultVolID;
-
-      status = mesh_allocMeshElementConnectivity(&volumeMesh->element[elementIndex]);
-      if (status != CAPS_SUCCESS) return status;
-
-      // read the element connectivity
-      status = fread(volumeMesh->element[elementIndex].connectivity, sizeof(int), numPoint, fp);
-      if (status != numPoint) { status = CAPS_IOERR; goto cleanup; }
-
-      elementIndex += 1;
-  }
+  status = getUGRIDElements(view->data + offset, Tetrahedral, defaultVolID, numTetrahedral, &elementIndex, volumeMesh);
+  if (status != CAPS_SUCCESS) goto cleanup;
+  offset += 4*(size_t) numTetrahedral*sizeof(int);
 
   // Elements -Set Pyramid
   if (numPyramid > 0) volumeMesh->meshQuickRef.startIndexPyramid = elementIndex;
 
-  numPoint = mesh_numMeshConnectivity(Pyramid);
-  for (i = 0; i < numPyramid; i++) {
-
-      volumeMesh->element[elementIndex].elementType = Pyramid;
-      volumeMesh->element[elementIndex].elementID   = elementIndex+1;
-      volumeMesh->element[elementIndex].markerID    = defaultVolID;
-
-      status = mesh_allocMeshElementConnectivity(&volumeMesh->element[elementIndex]);
-      if (status != CAPS_SUCCESS) return status;
-
-      // read the element connectivity
-      status = fread(volumeMesh->element[elementIndex].connectivity, sizeof(int), numPoint, fp);
-      if (status != numPoint) { status = CAPS_IOERR; goto cleanup; }
-
-      elementIndex += 1;
-  }
+  status = getUGRIDElements(view->data + offset, Pyramid, defaultVolID, numPyramid, &elementIndex, volumeMesh);
+  if (status != CAPS_SUCCESS) goto cleanup;
+  offset += 5*(size_t) numPyramid*sizeof(int);
 
   // Elements -Set Prism
   if (numPrism > 0) volumeMesh->meshQuickRef.startIndexPrism = elementIndex;
 
-  numPoint = mesh_numMeshConnectivity(Prism);
-  for (i = 0; i < numPrism; i++) {
-
-      volumeMesh->element[elementIndex].elementType = Prism;
-      volumeMesh->element[elementIndex].elementID   = elementIndex+1;
-      volumeMesh->element[elementIndex].markerID    = defaultVolID;
-
-      status = mesh_allocMeshElementConnectivity(&volumeMesh->element[elementIndex]);
-      if (status != CAPS_SUCCESS) return status;
-
-      // read the element connectivity
-      status = fread(volumeMesh->element[elementIndex].connectivity, sizeof(int), numPoint, fp);
-      if (status != numPoint) { status = CAPS_IOERR; goto cleanup; }
-
-      elementIndex += 1;
-  }
+  status = getUGRIDElements(view->data + offset, Prism, defaultVolID, numPrism, &elementIndex, volumeMesh);
+  if (status != CAPS_SUCCESS) goto cleanup;
+  offset += 6*(size_t) numPrism*sizeof(int);
 
   // Elements -Set Hexa
   if (numHexahedral > 0) volumeMesh->meshQuickRef.startIndexHexahedral = elementIndex;
 
-  numPoint = mesh_numMeshConnectivity(Hexahedral);
-  for (i = 0; i < numHexahedral; i++) {
-
-      volumeMesh->element[elementIndex].elementType = Hexahedral;
-      volumeMesh->element[elementIndex].elementID   = elementIndex+1;
-      volumeMesh->element[elementIndex].markerID    = defaultVolID;
-
-      status = mesh_allocMeshElementConnectivity(&volumeMesh->element[elementIndex]);
-      if (status != CAPS_SUCCESS) return status;
-
-      // read the element connectivity
-      status = fread(volumeMesh->element[elementIndex].connectivity, sizeof(int), numPoint, fp);
-      if (status != numPoint) { status = CAPS_IOERR; goto cleanup; }
-
-      elementIndex += 1;
-  }
+  status = getUGRIDElements(view->data + offset, Hexahedral, defaultVolID, numHexahedral, &elementIndex, volumeMesh);
+  if (status != CAPS_SUCCESS) goto cleanup;
 
   status = CAPS_SUCCESS;
 
   cleanup:
       if (status != CAPS_SUCCESS) printf("Premature exit in getUGRID status = %d\n", status);
 
-      EG_free(coords); coords = NULL;
-
       return status;
 }
 
@@ -2498,15 +2456,18 @@ aimPostAnalysis(/*@unused@*/ int iIndex, /*@unused@*/ void *aimInfo,
     gmaVertex  *surfacedata = NULL;
     meshStruct *surfaceMeshes = NULL, *volumeMesh;
     hashElemTable table;
+    fileViewStruct ugridView;
     FILE       *fp = NULL;
 
     (void) getcwd(currentPath, PATH_MAX);
     if (chdir(analysisPath) != 0) return CAPS_DIRERR;
 
     initiate_hashTable(&table);
+    (void) initiate_fileViewStruct(&ugridView);
 
-    fp = fopen(ugridfilename, "rb");
-    if (fp == NULL) {
+    // Map the UGRID file written by Pointwise rather than reading it through a buffer
+    status = open_fileView(ugridfilename, &ugridView);
+    if (status != CAPS_SUCCESS) {
       printf("*********************************************************\n");
       printf("\n Error: Pointwise did not generate %s!\n\n", ugridfilename);
       printf("*********************************************************\n");
@@ -2521,8 +2482,8 @@ aimPostAnalysis(/*@unused@*/ int iIndex, /*@unused@*/ void *aimInfo,
     status = initiate_meshStruct(pointwiseInstance[iIndex].volumeMesh);
     if (status != CAPS_SUCCESS) goto cleanup;
 
-    status = getUGRID(fp, pointwiseInstance[iIndex].volumeMesh);
-    fclose(fp); fp = NULL;
+    status = getUGRID(&ugridView, pointwiseInstance[iIndex].volumeMesh);
+    (void) destroy_fileViewStruct(&ugridView);
     if (status != EGADS_SUCCESS) {
       printf("\n Error: getUGRID = %d!\n\n", status);
       goto cleanup;
@@ -3360,6 +3321,7 @@ aimPostAnalysis(/*@unused@*/ int iIndex, /*@unused@*/ void *aimInfo,
 
         destroy_bodyData(numBody, bodydata);
         destroy_hashTable(&table);
+        (void) destroy_fileViewStruct(&ugridView);
         EG_free(surfacedata);
         EG_free(bodydata);
         EG_free(faces);
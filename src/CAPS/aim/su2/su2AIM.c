@@ -2179,11 +2179,14 @@ int aimTransfer(capsDiscr *discr, const char *dataName, int numPoint, int dataRa
     // Variables used in global node mapping
     int *nodeMap, *storage;
     int globalNodeID;
-    int found = (int) false;
+    int *globalIDList = NULL;
+    mapIDToIndexStruct globalIDMap;
 
     // Filename stuff
     char *filename = NULL; //"pyCAPS_SU2_Tetgen_ddfdrive_bndry1.dat";
 
+    (void) initiate_mapIDToIndexStruct(&globalIDMap);
+
     #ifdef DEBUG
         printf(" su2AIM/aimTransfer name = %s  instance = %d  npts = %d/%d!\n", dataName, discr->instance, numPoint, dataRank);
     #endif
@@ -2314,19 +2317,27 @@ int aimTransfer(capsDiscr *discr, const char *dataName, int numPoint, int dataRa
         goto bail;
     }
 
+    // Global node ID -> data point lookup
+    globalIDList = (int *) EG_alloc(numDataPoint*sizeof(int));
+    if (globalIDList == NULL) {
+        status = EGADS_MALLOC;
+        goto bail;
+    }
+
+    for (dataPoint = 0; dataPoint < numDataPoint; dataPoint++) {
+        globalIDList[dataPoint] = (int) dataMatrix[globalIDIndex][dataPoint] +1; // SU2 meshes are 0-index
+    }
+
+    status = create_mapIDToIndexStruct(numDataPoint, globalIDList, &globalIDMap);
+    if (status != CAPS_SUCCESS) goto bail;
+
     for (i = 0; i < numPoint; i++) {
 
         globalNodeID = nodeMap[i];
 
-        found = (int) false;
-        for (dataPoint = 0; dataPoint < numDataPoint; dataPoint++) {
-            if ((int) dataMatrix[globalIDIndex][dataPoint] +1 ==  globalNodeID) { // SU2 meshes are 0-index
-                found = (int) true;
-                break;
-            }
-        }
+        dataPoint = get_mapIDToIndex(&globalIDMap, globalNodeID);
 
-        if (found == (int) true) {
+        if (dataPoint >= 0) {
             for (j = 0; j < dataRank; j++) {
 
                 // Add something for units - aim_covert()
@@ -2352,6 +2363,9 @@ int aimTransfer(capsDiscr *discr, const char *dataName, int numPoint, int dataRa
         EG_free(dataMatrix);
     }
 
+    EG_free(globalIDList);
+    (void) destroy_mapIDToIndexStruct(&globalIDMap);
+
     // Free variable list
     status = string_freeArray(numVariable, &variableName);
     if (status != CAPS_SUCCESS) return status;
@@ -2368,6 +2382,9 @@ int aimTransfer(capsDiscr *discr, const char *dataName, int numPoint, int dataRa
             EG_free(dataMatrix);
         }
 
+        if (globalIDList != NULL) EG_free(globalIDList);
+        (void) destroy_mapIDToIndexStruct(&globalIDMap);
+
         // Free variable list
         status2 = string_freeArray(numVariable, &variableName);
         if (status2 != CAPS_SUCCESS) return status2;
@@ -25,8 +25,6 @@ int su2_readAeroLoad(char *filename, int *numVariable, char **variableName[], in
     char *line = NULL; // Temporary line holder
     char *tempStr = NULL; // Temporary strings
 
-    char comma;
-
     FILE *fp = NULL; // File pointer
 
     // Open file
@@ -109,15 +107,9 @@ int su2_readAeroLoad(char *filename, int *numVariable, char **variableName[], in
             }
         }
 
-        // Loop through the file and fill up the data matrix
-        for (j = 0; j < *numDataPoint; j++) {
-
-            for (i = 0; i < *numVariable; i++) {
-                fscanf(fp, "%lf", &(*dataMatrix)[i][j]);
-
-                if (i != *numVariable-1) fscanf(fp, "%c", &comma);
-            }
-        }
+        // Read the rest of the file and fill up the data matrix
+        status = read_dataColumns(fp, *numDataPoint, *numVariable, *dataMatrix);
+        if (status != CAPS_SUCCESS) goto cleanup;
 
         // Output the first two rows of the dataMatrix
         //for (i = 0; i < *numVariable; i++) printf("Variable %d - %.6f\n", i, (*dataMatrix)[i][0]);
@@ -148,7 +140,7 @@ int su2_readAeroLoad(char *filename, int *numVariable, char **variableName[], in
             if ((*dataMatrix) != NULL) {
 
                 for (i = 0; i < *numVariable; i++) {
-                    if ((*dataMatrix)[i] == NULL) EG_free((*dataMatrix)[i]);
+                    if ((*dataMatrix)[i] != NULL) EG_free((*dataMatrix)[i]);
                 }
 
                 EG_free((*dataMatrix));
@@ -277,6 +269,8 @@ int su2_dataTransfer(void *aimInfo,
     // Variables used in global node mapping
     int *nodeMap, *storage;
     int globalNodeID;
+    int *nodeIDList = NULL;
+    mapIDToIndexStruct nodeIDMap;
 
     // Data transfer Out variables
 
@@ -298,6 +292,7 @@ int su2_dataTransfer(void *aimInfo,
     if (status != CAPS_SUCCESS) return status;
 
     (void) initiate_meshStruct(&surfaceMesh);
+    (void) initiate_mapIDToIndexStruct(&nodeIDMap);
 
     foundDisplacement = (int) false;
     for (i = 0; i < numTransferName; i++) {
@@ -421,6 +416,18 @@ int su2_dataTransfer(void *aimInfo,
     // Re-loop through transfers - if we are doing displacements
     if (foundDisplacement == (int) true) {
 
+        // Global node ID -> dataOutMatrix index lookup, shared by all transfers
+        nodeIDList = (int *) EG_alloc(numOutDataPoint*sizeof(int));
+        if (nodeIDList == NULL) {
+            status = EGADS_MALLOC;
+            goto cleanup;
+        }
+
+        for (i = 0; i < numOutDataPoint; i++) nodeIDList[i] = surfaceMesh.node[i].nodeID;
+
+        status = create_mapIDToIndexStruct(numOutDataPoint, nodeIDList, &nodeIDMap);
+        if (status != CAPS_SUCCESS) goto cleanup;
+
         for (i = 0; i < numTransferName; i++) {
 
             status = aim_getDiscr(aimInfo, transferName[i], &dataTransferDiscreteObj);
@@ -450,18 +457,16 @@ int su2_dataTransfer(void *aimInfo,
                 for (j = 0; j < numDataTransferPoint; j++) {
 
                     globalNodeID = nodeMap[j];
-                    for (k = 0; k < numOutDataPoint; k++) {
-
-                        // If the global node IDs match store the displacement values in the dataOutMatrix
-                        if (globalNodeID  == (int) dataOutMatrix[0][k]) {
-
-                            // A rank of 3 should have already been checked
-                            // Delta displacements
-                            dataOutMatrix[4][k] = dataTransferData[3*j+0];
-                            dataOutMatrix[5][k] = dataTransferData[3*j+1];
-                            dataOutMatrix[6][k] = dataTransferData[3*j+2];
-                            break;
-                        }
+
+                    // If the global node ID is found store the displacement values in the dataOutMatrix
+                    k = get_mapIDToIndex(&nodeIDMap, globalNodeID);
+                    if (k >= 0) {
+
+                        // A rank of 3 should have already been checked
+                        // Delta displacements
+                        dataOutMatrix[4][k] = dataTransferData[3*j+0];
+                        dataOutMatrix[5][k] = dataTransferData[3*j+1];
+                        dataOutMatrix[6][k] = dataTransferData[3*j+2];
                     }
                 }
             }
@@ -514,6 +519,9 @@ int su2_dataTransfer(void *aimInfo,
     cleanup:
 
         (void) destroy_meshStruct(&surfaceMesh);
+        (void) destroy_mapIDToIndexStruct(&nodeIDMap);
+
+        if (nodeIDList != NULL) EG_free(nodeIDList);
 
         if (dataOutMatrix != NULL) {
             for (i = 0; i < numOutVariable; i++) {
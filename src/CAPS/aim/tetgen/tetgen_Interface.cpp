@@ -1,12 +1,13 @@
 // Tetgen interface functions - Written by Dr. Ryan Durscher AFRL/RQVC
 
 #include <vector>
-#include <set>
+#include <map>
 #include <iostream>
 
 #include "tetgen.h"
 #include "meshTypes.h"
 #include "egads.h"
+#include "emp.h"
 #include "capsTypes.h"
 
 #include "meshUtils.h"
@@ -19,54 +20,152 @@
 #define DOT(a,b)     (a[0]*b[0] + a[1]*b[1] + a[2]*b[2])
 
 
-static int tetgen_to_MeshStruct(tetgenio *mesh, meshStruct *genUnstrMesh)  {
-    int status; // Function return status
+// Number of items handed to a thread at a time by tetgen_threadBlock
+#define TETGEN_CHUNK 4096
 
-    int i, j, elementIndex; // Indexing
+// Work shared by the threads of a tetgen_threadBlock
+typedef struct {
+    void *mutex;  // Mutex for the chunk queue and shared results
+    long master;  // Thread ID of the calling thread
+    int  end;     // Number of items
+    int  index;   // Next item to process
+    int  stat;    // First bad status returned by work
 
-    int numPoint;
-    int defaultVolID = 1; // Default volume ID
+    int (*work)(void *data, void *mutex, int start, int end);
+    void *data;
+} EMPtetgen;
 
-    meshAnalysisTypeEnum analysisType;
+// Thread function for tetgen_threadBlock
+static void tetgen_thread(void *struc)
+{
+    int start, end, stat;
+    long ID;
+    EMPtetgen *block = (EMPtetgen *) struc;
+
+    // Get our identifier
+    ID = EMP_ThreadID();
+
+    // Look for work
+    for (;;) {
+
+        // Only one thread at a time here -- controlled by a mutex!
+        if (block->mutex != NULL) EMP_LockSet(block->mutex);
+        start = block->index;
+        if (block->stat != CAPS_SUCCESS) start = block->end;
+        block->index += TETGEN_CHUNK;
+        if (block->mutex != NULL) EMP_LockRelease(block->mutex);
+        if (start >= block->end) break;
+
+        end = start + TETGEN_CHUNK;
+        if (end > block->end) end = block->end;
+
+        stat = block->work(block->data, block->mutex, start, end);
+        if (stat != CAPS_SUCCESS) {
+            if (block->mutex != NULL) EMP_LockSet(block->mutex);
+            if (block->stat == CAPS_SUCCESS) block->stat = stat;
+            if (block->mutex != NULL) EMP_LockRelease(block->mutex);
+        }
+    }
 
-    analysisType = genUnstrMesh->analysisType;
+    // Exhausted all work -- exit
+    if (ID != block->master) EMP_ThreadExit();
+}
 
-    // Cleanup existing node and elements
-    (void) destroy_meshNodes(genUnstrMesh);
+// Run work over the items [0, numItem) in chunks on all available threads. work is handed the
+// mutex (NULL when running serially) to guard any state it shares between chunks.
+static int tetgen_threadBlock(int numItem, int (*work)(void *data, void *mutex, int start, int end),
+                              void *data)
+{
+    int       i, np;
+    long      start;
+    void    **threads = NULL;
+    EMPtetgen block;
+
+    block.mutex  = NULL;
+    block.master = EMP_ThreadID();
+    block.end    = numItem;
+    block.index  = 0;
+    block.stat   = CAPS_SUCCESS;
+    block.work   = work;
+    block.data   = data;
+
+    np = EMP_Init(&start);
+    if (np > (numItem + TETGEN_CHUNK - 1)/TETGEN_CHUNK) np = (numItem + TETGEN_CHUNK - 1)/TETGEN_CHUNK;
+    if (np > 1) {
+        // Create the mutex to handle list synchronization
+        block.mutex = EMP_LockCreate();
+        if (block.mutex == NULL) {
+            printf(" EMP Error: mutex creation = NULL!\n");
+            np = 1;
+        } else {
+            // Get storage for our extra threads
+            threads = (void **) EG_alloc((np-1)*sizeof(void *));
+            if (threads == NULL) {
+                EMP_LockDestroy(block.mutex);
+                block.mutex = NULL;
+                np = 1;
+            }
+        }
+    }
 
-    (void) destroy_meshElements(genUnstrMesh);
+    // Create the threads and get going!
+    if (threads != NULL) {
+        for (i = 0; i < np-1; i++) {
+            threads[i] = EMP_ThreadCreate(tetgen_thread, &block);
+            if (threads[i] == NULL) printf(" EMP Error Creating Thread #%d!\n", i+1);
+        }
+    }
 
-    (void) destroy_meshQuickRefStruct(&genUnstrMesh->meshQuickRef);
+    // Now run the thread block from the original thread
+    tetgen_thread(&block);
 
-    genUnstrMesh->meshType = VolumeMesh;
+    // Wait for all others to return
+    if (threads != NULL) {
+        for (i = 0; i < np-1; i++) {
+            if (threads[i] != NULL) EMP_ThreadWait(threads[i]);
+        }
 
-    // Numbers
-    genUnstrMesh->numNode = mesh->numberofpoints;
-    genUnstrMesh->numElement = mesh->numberoftrifaces + mesh->numberoftetrahedra;
+        for (i = 0; i < np-1; i++) {
+            if (threads[i] != NULL) EMP_ThreadDestroy(threads[i]);
+        }
+    }
 
-    genUnstrMesh->meshQuickRef.useStartIndex = (int) true;
-    genUnstrMesh->meshQuickRef.numTriangle = mesh->numberoftrifaces;
-    genUnstrMesh->meshQuickRef.numTetrahedral = mesh->numberoftetrahedra;
-    genUnstrMesh->meshQuickRef.startIndexTriangle = 0;
-    genUnstrMesh->meshQuickRef.startIndexTetrahedral = mesh->numberoftrifaces;
+    // Cleanup
+    if (block.mutex != NULL) EMP_LockDestroy(block.mutex);
+    if (threads != NULL) EG_free(threads);
 
-    // Nodes - allocate
-    genUnstrMesh->node = (meshNodeStruct *) EG_alloc(genUnstrMesh->numNode*sizeof(meshNodeStruct));
-    if (genUnstrMesh->node == NULL) return EGADS_MALLOC;
+    return block.stat;
+}
 
-    // Nodes - set
-    for (i = 0; i < genUnstrMesh->numNode; i++) {
+// TetGen output and the mesh it is transferred to
+typedef struct {
+    tetgenio   *mesh;
+    meshStruct *genUnstrMesh;
+} tetgenTransfer;
+
+// Transfer the nodes [start, end)
+static int tetgen_transferNodes(void *data, void *mutex, int start, int end)
+{
+    int status, i;
+    tetgenTransfer *transfer = (tetgenTransfer *) data;
+    meshNodeStruct *node;
+
+    (void) mutex;
+
+    for (i = start; i < end; i++) {
+
+        node = &transfer->genUnstrMesh->node[i];
 
         // Initiate node
-        status = initiate_meshNodeStruct(&genUnstrMesh->node[i], analysisType);
+        status = initiate_meshNodeStruct(node, transfer->genUnstrMesh->analysisType);
         if (status != CAPS_SUCCESS) return status;
 
         // Copy node data
-        genUnstrMesh->node[i].nodeID = i+1;
+        node->nodeID = i+1;
 
-        genUnstrMesh->node[i].xyz[0] = mesh->pointlist[3*i+0];
-        genUnstrMesh->node[i].xyz[1] = mesh->pointlist[3*i+1];
-        genUnstrMesh->node[i].xyz[2] = mesh->pointlist[3*i+2];
+        node->xyz[0] = transfer->mesh->pointlist[3*i+0];
+        node->xyz[1] = transfer->mesh->pointlist[3*i+1];
+        node->xyz[2] = transfer->mesh->pointlist[3*i+2];
 
         /*
         if (mesh->numberofpointattributes != 0) {
@@ -75,65 +174,257 @@ static int tetgen_to_MeshStruct(tetgenio *mesh, meshStruct *genUnstrMesh)  {
          */
     }
 
-    // Elements - allocate
-    genUnstrMesh->element = (meshElementStruct *) EG_alloc(genUnstrMesh->numElement*sizeof(meshElementStruct));
-    if (genUnstrMesh->element == NULL) return EGADS_MALLOC;
+    return CAPS_SUCCESS;
+}
 
-    elementIndex = 0;
-    numPoint = 0;
-    // Elements -Set triangles
-    for (i = 0; i < mesh->numberoftrifaces; i++) {
-        status = initiate_meshElementStruct(&genUnstrMesh->element[elementIndex], analysisType);
+// Transfer the boundary triangles [start, end) - they come first in the element array
+static int tetgen_transferTriangles(void *data, void *mutex, int start, int end)
+{
+    int status, i, j;
+    tetgenTransfer *transfer = (tetgenTransfer *) data;
+    meshElementStruct *element;
+
+    (void) mutex;
+
+    for (i = start; i < end; i++) {
+
+        element = &transfer->genUnstrMesh->element[i];
+
+        status = initiate_meshElementStruct(element, transfer->genUnstrMesh->analysisType);
         if (status != CAPS_SUCCESS) return status;
 
-        genUnstrMesh->element[elementIndex].elementType = Triangle;
-        genUnstrMesh->element[elementIndex].elementID   = elementIndex+1;
-        genUnstrMesh->element[elementIndex].markerID = mesh->trifacemarkerlist[i];
+        element->elementType = Triangle;
+        element->elementID   = i+1;
+        element->markerID    = transfer->mesh->trifacemarkerlist[i];
 
-        status = mesh_allocMeshElementConnectivity(&genUnstrMesh->element[elementIndex]);
+        status = mesh_allocMeshElementConnectivity(element);
         if (status != CAPS_SUCCESS) return status;
 
-        if (i == 0) { // Only need this once
-            numPoint = mesh_numMeshElementConnectivity(&genUnstrMesh->element[elementIndex]);
+        for (j = 0; j < 3; j++) {
+            element->connectivity[j] = transfer->mesh->trifacelist[3*i+j];
         }
+    }
 
-        for (j = 0; j < numPoint; j++ ) {
-            genUnstrMesh->element[elementIndex].connectivity[j] = mesh->trifacelist[numPoint*i+j];
-        }
+    return CAPS_SUCCESS;
+}
 
-        elementIndex += 1;
-    }
+// Transfer the tetrahedra [start, end) - they follow the triangles in the element array
+static int tetgen_transferTetrahedra(void *data, void *mutex, int start, int end)
+{
+    int status, i, j, elementIndex;
+    int defaultVolID = 1; // Default volume ID
+    tetgenTransfer *transfer = (tetgenTransfer *) data;
+    meshElementStruct *element;
+    tetgenio *mesh = transfer->mesh;
 
-    //Set tetrahedral
-    numPoint = 0;
-    for (i = 0; i < mesh->numberoftetrahedra; i++) {
-        status = initiate_meshElementStruct(&genUnstrMesh->element[elementIndex], analysisType);
+    (void) mutex;
+
+    for (i = start; i < end; i++) {
+
+        elementIndex = mesh->numberoftrifaces + i;
+        element = &transfer->genUnstrMesh->element[elementIndex];
+
+        status = initiate_meshElementStruct(element, transfer->genUnstrMesh->analysisType);
         if (status != CAPS_SUCCESS) return status;
 
-        genUnstrMesh->element[elementIndex].elementType = Tetrahedral;
-        genUnstrMesh->element[elementIndex].elementID   = elementIndex+1;
+        element->elementType = Tetrahedral;
+        element->elementID   = elementIndex+1;
 
         if (mesh->numberoftetrahedronattributes != 0) {
-            genUnstrMesh->element[elementIndex].markerID = (int) mesh->tetrahedronattributelist[mesh->numberoftetrahedronattributes*i + 0];
+            element->markerID = (int) mesh->tetrahedronattributelist[mesh->numberoftetrahedronattributes*i + 0];
         } else {
-            genUnstrMesh->element[elementIndex].markerID = defaultVolID;
+            element->markerID = defaultVolID;
         }
 
-        status = mesh_allocMeshElementConnectivity(&genUnstrMesh->element[elementIndex]);
+        status = mesh_allocMeshElementConnectivity(element);
         if (status != CAPS_SUCCESS) return status;
 
-        if (i == 0) { // Only need this once
-            numPoint = mesh_numMeshElementConnectivity(&genUnstrMesh->element[elementIndex]);
+        for (j = 0; j < 4; j++) {
+            element->connectivity[j] = mesh->tetrahedronlist[4*i+j];
         }
+    }
+
+    return CAPS_SUCCESS;
+}
 
-        for (j = 0; j < numPoint; j++ ) {
-            genUnstrMesh->element[elementIndex].connectivity[j] = mesh->tetrahedronlist[numPoint*i+j];
+static int tetgen_to_MeshStruct(tetgenio *mesh, meshStruct *genUnstrMesh)  {
+    int status; // Function return status
+
+    tetgenTransfer transfer;
+
+    // Cleanup existing node and elements
+    (void) destroy_meshNodes(genUnstrMesh);
+
+    (void) destroy_meshElements(genUnstrMesh);
+
+    (void) destroy_meshQuickRefStruct(&genUnstrMesh->meshQuickRef);
+
+    genUnstrMesh->meshType = VolumeMesh;
+
+    // Numbers
+    genUnstrMesh->numNode = mesh->numberofpoints;
+    genUnstrMesh->numElement = mesh->numberoftrifaces + mesh->numberoftetrahedra;
+
+    genUnstrMesh->meshQuickRef.useStartIndex = (int) true;
+    genUnstrMesh->meshQuickRef.numTriangle = mesh->numberoftrifaces;
+    genUnstrMesh->meshQuickRef.numTetrahedral = mesh->numberoftetrahedra;
+    genUnstrMesh->meshQuickRef.startIndexTriangle = 0;
+    genUnstrMesh->meshQuickRef.startIndexTetrahedral = mesh->numberoftrifaces;
+
+    // Nodes and elements - allocate; they are filled in place by the threads
+    genUnstrMesh->node = (meshNodeStruct *) EG_alloc(genUnstrMesh->numNode*sizeof(meshNodeStruct));
+    if (genUnstrMesh->node == NULL) return EGADS_MALLOC;
+
+    genUnstrMesh->element = (meshElementStruct *) EG_alloc(genUnstrMesh->numElement*sizeof(meshElementStruct));
+    if (genUnstrMesh->element == NULL) return EGADS_MALLOC;
+
+    transfer.mesh = mesh;
+    transfer.genUnstrMesh = genUnstrMesh;
+
+    // Nodes - set
+    status = tetgen_threadBlock(genUnstrMesh->numNode, tetgen_transferNodes, &transfer);
+    if (status != CAPS_SUCCESS) return status;
+
+    // Release each TetGen array once it has been transferred to keep the peak memory down
+    delete [] mesh->pointlist;
+    mesh->pointlist = NULL;
+
+    // Elements -Set triangles
+    status = tetgen_threadBlock(mesh->numberoftrifaces, tetgen_transferTriangles, &transfer);
+    if (status != CAPS_SUCCESS) return status;
+
+    delete [] mesh->trifacelist;
+    mesh->trifacelist = NULL;
+
+    //Set tetrahedral
+    status = tetgen_threadBlock(mesh->numberoftetrahedra, tetgen_transferTetrahedra, &transfer);
+    if (status != CAPS_SUCCESS) return status;
+
+    delete [] mesh->tetrahedronlist;
+    mesh->tetrahedronlist = NULL;
+
+    return 0;
+}
+
+// Hash of the surface triangles used to detect holes, keyed on their sorted vertex triple, and the
+// (up to) two tetrahedra of the empty mesh found on each of them
+typedef struct {
+    int numHash;       // Power of 2
+    int *key;          // Sorted vertex triple of each slot, size[3*numHash]
+    int *triangle;     // Triangle of each slot (-1 if empty), size[numHash]
+
+    int numTriangle;
+    int *numTet;       // Number of tetrahedra found on each triangle, size[numTriangle]
+    int *tet;          // The two lowest indexed tetrahedra found, size[2*numTriangle]
+
+    const int *tetrahedronlist;
+} tetgenFaceHash;
+
+// Sort a vertex triple
+static void tetgen_sortTriple(int a, int b, int c, int key[3])
+{
+    int temp;
+
+    if (a > b) { temp = a; a = b; b = temp; }
+    if (b > c) { temp = b; b = c; c = temp; }
+    if (a > b) { temp = a; a = b; b = temp; }
+
+    key[0] = a;
+    key[1] = b;
+    key[2] = c;
+}
+
+// Slot to start probing from for a sorted vertex triple
+static int tetgen_hashTriple(const int key[3], int numHash)
+{
+    unsigned int hash;
+
+    hash = (unsigned int) key[0]*73856093u ^ (unsigned int) key[1]*19349663u ^ (unsigned int) key[2]*83492791u;
+
+    return (int) ((hash*2654435761u) & (unsigned int) (numHash-1));
+}
+
+// Look up the faces of the tetrahedra [start, end) in the face hash
+static int tetgen_matchFaces(void *data, void *mutex, int start, int end)
+{
+    int k, n, i, t, temp, key[3];
+    const int *v;
+    tetgenFaceHash *faces = (tetgenFaceHash *) data;
+
+    for (k = start; k < end; k++) {
+
+        v = faces->tetrahedronlist + 4*k;
+
+        for (n = 0; n < 4; n++) {
+
+            // The face opposite vertex n
+            tetgen_sortTriple(v[(n+1)%4], v[(n+2)%4], v[(n+3)%4], key);
+
+            for (i = tetgen_hashTriple(key, faces->numHash); (t = faces->triangle[i]) >= 0;
+                 i = (i+1) & (faces->numHash-1)) {
+
+                if (faces->key[3*i  ] != key[0] ||
+                    faces->key[3*i+1] != key[1] ||
+                    faces->key[3*i+2] != key[2]) continue;
+
+                // Keep the two lowest indexed tetrahedra - as a serial search in order would
+                if (mutex != NULL) EMP_LockSet(mutex);
+                if (faces->numTet[t] < 2) {
+                    faces->tet[2*t+faces->numTet[t]] = k;
+                    faces->numTet[t] += 1;
+                } else if (k < faces->tet[2*t+1]) {
+                    faces->tet[2*t+1] = k;
+                }
+                if (faces->numTet[t] == 2 && faces->tet[2*t] > faces->tet[2*t+1]) {
+                    temp = faces->tet[2*t];
+                    faces->tet[2*t] = faces->tet[2*t+1];
+                    faces->tet[2*t+1] = temp;
+                }
+                if (mutex != NULL) EMP_LockRelease(mutex);
+            }
         }
+    }
 
-        elementIndex += 1;
+    return CAPS_SUCCESS;
+}
+
+// Storage for the polygons and vertex lists of all surface facets handed to TetGen. The facets point
+// into two contiguous blocks instead of owning two small allocations each, and are detached again
+// before tetgenio releases its memory (it would otherwise delete them one by one).
+class tetgenFacetPool {
+public:
+    tetgenFacetPool(tetgenio *io) : io(io) {}
+    ~tetgenFacetPool() { release(); }
+
+    void allocate(int numPolygon, int numVertex) {
+        polygons.resize(numPolygon);
+        vertices.resize(numVertex);
     }
 
-    return 0;
+    // Detach the facets from the pool and free it
+    void release() {
+        int i;
+        if (io != NULL && io->facetlist != NULL) {
+            for (i = 0; i < io->numberoffacets; i++) {
+                io->facetlist[i].numberofpolygons = 0;
+                io->facetlist[i].polygonlist = NULL;
+            }
+        }
+        std::vector<tetgenio::polygon>().swap(polygons);
+        std::vector<int>().swap(vertices);
+    }
+
+    std::vector<tetgenio::polygon> polygons;
+    std::vector<int> vertices;
+
+private:
+    tetgenio *io;
+};
+
+// Free all memory held by a tetgenio and leave it empty
+static void tetgen_release(tetgenio *io) {
+    io->deinitialize();
+    io->initialize();
 }
 
 //#ifdef __cplusplus
@@ -166,10 +457,12 @@ int tetgen_VolumeMesh(meshInputStruct meshInput,
     char q[80];
 
 
-    // TetGen variables
+    // TetGen variables - the facet pool must be destroyed before the input
     tetgenio in, out;
     tetgenio::facet *f;
     tetgenio::polygon *p;
+    tetgenFacetPool facetPool(&in);
+    int numVertex;
 
     printf("\nGenerating volume mesh using TetGen.....\n");
 
@@ -202,17 +495,26 @@ int tetgen_VolumeMesh(meshInputStruct meshInput,
     // Create surface marker/BC arrays
     in.facetmarkerlist = new int[in.numberoffacets];
 
-    // Transfer input surfaceMesh->localTriFaceList array to tetgen array
+    // Transfer input surfaceMesh->localTriFaceList array to tetgen array - one polygon per facet, all
+    // stored in the facet pool
+    numVertex = 0;
+    for(i = 0; i < surfaceMesh->numElement; i++) {
+        numVertex += mesh_numMeshElementConnectivity(&surfaceMesh->element[i]);
+    }
+    facetPool.allocate(in.numberoffacets, numVertex);
+
+    numVertex = 0;
     for(i = 0; i < surfaceMesh->numElement; i++) {
         f =&in.facetlist[i];
         f->numberofpolygons = 1;
-        f->polygonlist = new tetgenio::polygon[f->numberofpolygons];
+        f->polygonlist = &facetPool.polygons[i];
         f->numberofholes = 0;
         f->holelist = NULL;
         p = &f->polygonlist[0];
 
         p->numberofvertices = mesh_numMeshElementConnectivity(&surfaceMesh->element[i]);
-        p->vertexlist = new int[p->numberofvertices];
+        p->vertexlist = &facetPool.vertices[numVertex];
+        numVertex += p->numberofvertices;
 
         for (j = 0; j < p->numberofvertices; j++) {
             p->vertexlist[j] = surfaceMesh->element[i].connectivity[j];
@@ -220,10 +522,8 @@ int tetgen_VolumeMesh(meshInputStruct meshInput,
     }
 
     // Transfer input BC array to tetgen array
-    std::set<int> uniqueMarker;
     for(i = 0; i < surfaceMesh->numElement; i++) {
         in.facetmarkerlist[i] = surfaceMesh->element[i].markerID;
-        uniqueMarker.insert(in.facetmarkerlist[i]);
     }
 
     // If no input string is provided create a simple one based on exposed parameters
@@ -304,44 +604,69 @@ int tetgen_VolumeMesh(meshInputStruct meshInput,
 
     std::vector<REAL> holepoints;
 
+    // Representative (first) facet of each marker
+    std::map<int, int> markerFacet;
+    for (i = 0; i < in.numberoffacets; i++) {
+        markerFacet.insert(std::make_pair(in.facetmarkerlist[i], i));
+    }
+
+    // Hash the representative triangles on their sorted vertex triple and find the tets attached to
+    // them with a single (threaded) pass over the faces of the empty mesh
+    tetgenFaceHash faces;
+    std::vector<int> faceKey, faceTriangle, faceNumTet, faceTet;
+
+    faces.numTriangle = (int) markerFacet.size();
+    faces.numHash = 16;
+    while (faces.numHash < 2*faces.numTriangle) faces.numHash *= 2;
+
+    faceKey.assign(3*faces.numHash, 0);
+    faceTriangle.assign(faces.numHash, -1);
+    faceNumTet.assign(faces.numTriangle, 0);
+    faceTet.assign(2*faces.numTriangle, -1);
+
+    faces.key      = faceKey.data();
+    faces.triangle = faceTriangle.data();
+    faces.numTet   = faceNumTet.data();
+    faces.tet      = faceTet.data();
+    faces.tetrahedronlist = emptymesh.tetrahedronlist;
+
+    int t = 0;
+    for ( std::map<int, int>::const_iterator marker = markerFacet.begin(); marker != markerFacet.end(); marker++, t++ )
+    {
+        int key[3];
+        p = in.facetlist[marker->second].polygonlist;
+
+        tetgen_sortTriple(p->vertexlist[0], p->vertexlist[1], p->vertexlist[2], key);
+
+        j = tetgen_hashTriple(key, faces.numHash);
+        while (faces.triangle[j] >= 0) j = (j+1) & (faces.numHash-1);
+
+        faces.key[3*j  ] = key[0];
+        faces.key[3*j+1] = key[1];
+        faces.key[3*j+2] = key[2];
+        faces.triangle[j] = t;
+    }
+
+    if (faces.numTriangle > 0 && emptymesh.numberoftetrahedra > 0) {
+        status = tetgen_threadBlock(emptymesh.numberoftetrahedra, tetgen_matchFaces, &faces);
+        if (status != CAPS_SUCCESS) return status;
+    }
+
     // Only solid bodies can have holes
-    for ( std::set<int>::const_iterator marker = uniqueMarker.begin(); marker != uniqueMarker.end(); marker++ )
+    t = 0;
+    for ( std::map<int, int>::const_iterator marker = markerFacet.begin(); marker != markerFacet.end(); marker++, t++ )
     {
-        int globaltri = 0;
-        while ( globaltri < in.numberoffacets && in.facetmarkerlist[globaltri] != *marker ) globaltri++;
-        tetgenio::facet *f = in.facetlist + globaltri;
-        tetgenio::polygon *p = f->polygonlist;
+        tetgenio::polygon *p = in.facetlist[marker->second].polygonlist;
 
-        // Look for two tets attached to a polygon
-        int tet = 0;
+        // The two tets attached to the polygon
+        int tet = faces.numTet[t];
         int twotets[2][4] = {{-1, -1, -1, -1}, {-1, -1, -1, -1}};
-        for ( int k = 0; k < emptymesh.numberoftetrahedra; k++ )
+        for (int n = 0; n < tet; n++)
         {
-            bool match[3] = {false, false, false};
-            for (int v0 = 0; v0 < 3; v0++)
-            {
-                for (int n0 = 0; n0 < 4; n0++)
-                {
-                    if ( p->vertexlist[v0] == emptymesh.tetrahedronlist[4*k+n0] )
-                    {
-                        match[v0] = true;
-                        break;
-                    }
-                }
-                //Found a match, save it of. There should be two tets for a face with holes
-                if ( match[0] && match[1] && match[2] )
-                {
-                    for (int n0 = 0; n0 < 4; n0++)
-                        twotets[tet][n0] = emptymesh.tetrahedronlist[4*k+n0];
-                    tet++;
-
-                }
-            }
-            if ( tet == 2 )
-                break;
+            for (int n0 = 0; n0 < 4; n0++)
+                twotets[n][n0] = emptymesh.tetrahedronlist[4*faces.tet[2*t+n]+n0];
         }
 
-
         if ( tet == 2 )
         {
             //Found two tets, the one with a postive normal vector to the cell center is a hole
@@ -389,6 +714,9 @@ int tetgen_VolumeMesh(meshInputStruct meshInput,
         }
     }
 
+    // The empty mesh is no longer needed
+    tetgen_release(&emptymesh);
+
     const tetgenRegionsStruct* regions = &meshInput.tetgenInput.regions;
     const tetgenHolesStruct* holes = &meshInput.tetgenInput.holes;
 
@@ -469,6 +797,10 @@ int tetgen_VolumeMesh(meshInputStruct meshInput,
     //in.save_poly((char *) "TETGEN_Test");
     //out.save_faces((char *) "TETGEN_Test");
 
+    // Release the input before the output is transferred
+    facetPool.release();
+    tetgen_release(&in);
+
     // Transfer tetgen mesh structure to genUnstrMesh format
     status = tetgen_to_MeshStruct(&out, volumeMesh);
     if (status != 0) return status;
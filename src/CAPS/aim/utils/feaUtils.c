@@ -9446,7 +9446,7 @@ int fea_transferExternalPressure(void *aimInfo, meshStruct *feaMesh, feaLoadStru
 
     // Variables used in global node mapping
     int *tessNodeMap = NULL, *storage = NULL;
-    int globalNodeID;
+    mapIDToIndexStruct tessNodeIDMap;
     int nodeIndex[4], transferIndex[4], elementID, elementIndex, elementCount;
 
     // Discrete data transfer variables
@@ -9459,6 +9459,8 @@ int fea_transferExternalPressure(void *aimInfo, meshStruct *feaMesh, feaLoadStru
     int dataTransferRank;
     double *dataTransferData;
 
+    (void) initiate_mapIDToIndexStruct(&tessNodeIDMap);
+
     printf("Extracting external pressure loads from data transfer....\n");
 
     feaLoad->numElementID = 0;
@@ -9540,6 +9542,10 @@ int fea_transferExternalPressure(void *aimInfo, meshStruct *feaMesh, feaLoadStru
         storage = (int *) dataTransferDiscreteObj->ptrm;
         tessNodeMap = &storage[0]; // Local indexing on the body
 
+        // Node ID -> data set index lookup for this transfer
+        status = create_mapIDToIndexStruct(numDataTransferPoint, tessNodeMap, &tessNodeIDMap);
+        if (status != CAPS_SUCCESS) goto cleanup;
+
         //Now lets loop through our ctria3 mesh and get the node indexes for each element
         for (i = 0; i < feaMesh->numElement; i++) {
 
@@ -9555,25 +9561,11 @@ int fea_transferExternalPressure(void *aimInfo, meshStruct *feaMesh, feaLoadStru
 
             //printf("Node Index = %d %d %d\n", nodeIndex[0], nodeIndex[1], nodeIndex[2]);
 
-            transferIndex[0] = -1;
-            transferIndex[1] = -1;
-            transferIndex[2] = -1;
             transferIndex[3] = -1;
 
-            // Loop through the nodeMap of the data set getting nodeIDs trying
-            //   to match the nodes in the element
-            for (j = 0; j < numDataTransferPoint; j++) {
-
-                globalNodeID = tessNodeMap[j];
-
-                if (nodeIndex[0] == globalNodeID) transferIndex[0] = j;
-                if (nodeIndex[1] == globalNodeID) transferIndex[1] = j;
-                if (nodeIndex[2] == globalNodeID) transferIndex[2] = j;
-
-                // If the nodes completely match the nodes on the element - break
-                if (transferIndex[0] >= 0 && transferIndex[1] >= 0 && transferIndex[2] >= 0) {
-                    break;
-                }
+            // Look up the nodes of the element in the nodeMap of the data set
+            for (j = 0; j < 3; j++) {
+                transferIndex[j] = get_mapIDToIndex(&tessNodeIDMap, nodeIndex[j]);
             }
 
             // If all the nodeIndexes match the transferIndex the element is in the data set
@@ -9607,27 +9599,9 @@ int fea_transferExternalPressure(void *aimInfo, meshStruct *feaMesh, feaLoadStru
             nodeIndex[2] = feaMesh->element[i].connectivity[2];
             nodeIndex[3] = feaMesh->element[i].connectivity[3];
 
-            transferIndex[0] = -1;
-            transferIndex[1] = -1;
-            transferIndex[2] = -1;
-            transferIndex[3] = -1;
-
-            // Loop through the nodeMap of the data set getting nodeIDs trying
-            //   to match the nodes in the element
-            for (j = 0; j < numDataTransferPoint; j++) {
-
-                globalNodeID = tessNodeMap[j];
-
-                if (nodeIndex[0] == globalNodeID) transferIndex[0] = j;
-                if (nodeIndex[1] == globalNodeID) transferIndex[1] = j;
-                if (nodeIndex[2] == globalNodeID) transferIndex[2] = j;
-                if (nodeIndex[3] == globalNodeID) transferIndex[3] = j;
-
-                // If the nodes completely match the nodes on the element - break
-                if (transferIndex[0] >= 0 && transferIndex[1] >= 0 &&
-                        transferIndex[2] >= 0 && transferIndex[3] >= 0) {
-                    break;
-                }
+            // Look up the nodes of the element in the nodeMap of the data set
+            for (j = 0; j < 4; j++) {
+                transferIndex[j] = get_mapIDToIndex(&tessNodeIDMap, nodeIndex[j]);
             }
 
             // If all the nodeIndexes match the transferIndex the element is in the data set
@@ -9681,6 +9655,8 @@ cleanup:
 
     if (transferName != NULL) EG_free(transferName);
 
+    (void) destroy_mapIDToIndexStruct(&tessNodeIDMap);
+
     return status;
 }
 
@@ -2,6 +2,7 @@
 
 #include "egads.h"
 #include "aimUtil.h"
+#include "emp.h"
 #include <math.h>
 #include <string.h>
 #include <stdio.h>
@@ -82,6 +83,133 @@ static double root_BisectionMethod( double (*f)(double, double *),
     return upperBnd;
 }
 
+// Number of Edges handed to a thread at a time when evaluating Edge tangents
+#define TFICHUNK 128
+
+// Work for the threads evaluating the start tangents of the Edges of four-sided Faces
+typedef struct {
+    void *mutex;       // Mutex for the Edge queue
+    long master;       // Thread ID of the calling thread
+    int end;           // Number of Edges
+    int index;         // Next Edge to process
+
+    ego *edges;        // Body Edges [end]
+    int *stat;         // (in) 1 if the Edge is needed, (out) status of the Edge [end]
+    double *tangent;   // Scaled start tangent of each Edge [3*end]
+} EMPedgeTangent;
+
+// Thread function for the Edge tangents of mesh_edgeVertexTFI
+static void mesh_edgeTangentThread(void *struc) {
+
+    int i, index, status;
+    long ID;
+    EMPedgeTangent *data;
+
+    int oclass, mtype, nchild, *senses;
+    double range[4], eval[18], scale;
+    ego eref, *echilds;
+
+    data = (EMPedgeTangent *) struc;
+
+    // Get our identifier
+    ID = EMP_ThreadID();
+
+    // Look for work
+    for (;;) {
+
+        // Only one thread at a time here -- controlled by a mutex!
+        if (data->mutex != NULL) EMP_LockSet(data->mutex);
+        index = data->index;
+        data->index += TFICHUNK;
+        if (data->mutex != NULL) EMP_LockRelease(data->mutex);
+        if (index >= data->end) break;
+
+        for (i = index; i < index+TFICHUNK && i < data->end; i++) {
+            if (data->stat[i] != 1) continue;
+
+            mtype = 0;
+            status = EG_getTopology(data->edges[i], &eref, &oclass, &mtype, range, &nchild, &echilds, &senses);
+            if (mtype == DEGENERATE) { data->stat[i] = EGADS_DEGEN; continue; }
+            if (status < EGADS_SUCCESS) { data->stat[i] = status; continue; }
+
+            status = EG_evaluate(data->edges[i], range, eval);
+            if (status < EGADS_SUCCESS) { data->stat[i] = status; continue; }
+
+            scale = dot_DoubleVal(&eval[3], &eval[3]);
+            data->tangent[3*i  ] = eval[3]/scale;
+            data->tangent[3*i+1] = eval[4]/scale;
+            data->tangent[3*i+2] = eval[5]/scale;
+
+            data->stat[i] = EGADS_SUCCESS;
+        }
+    }
+
+    // Exhausted all work -- exit
+    if (ID != data->master) EMP_ThreadExit();
+}
+
+// Evaluate the start tangents of the needed (stat[i] == 1) Edges of a body
+static void mesh_edgeTangents(int numEdge, ego *edges, int *stat, double *tangent) {
+
+    int i, np = 1;
+    long start;
+
+    void **threads = NULL;
+    EMPedgeTangent data;
+
+    data.mutex   = NULL;
+    data.end     = numEdge;
+    data.index   = 0;
+    data.edges   = edges;
+    data.stat    = stat;
+    data.tangent = tangent;
+
+    np = EMP_Init(&start);
+    if (np > (numEdge+TFICHUNK-1)/TFICHUNK) np = (numEdge+TFICHUNK-1)/TFICHUNK;
+    if (np > 1) {
+        // Create the mutex to handle list synchronization
+        data.mutex = EMP_LockCreate();
+        if (data.mutex == NULL) {
+            printf(" EMP Error: mutex creation = NULL!\n");
+            np = 1;
+        } else {
+            // Get storage for our extra threads
+            threads = (void **) EG_alloc((np-1)*sizeof(void *));
+            if (threads == NULL) {
+                EMP_LockDestroy(data.mutex);
+                data.mutex = NULL;
+                np = 1;
+            }
+        }
+    }
+    data.master = EMP_ThreadID();
+
+    // Create the threads and get going!
+    if (threads != NULL) {
+        for (i = 0; i < np-1; i++) {
+            threads[i] = EMP_ThreadCreate(mesh_edgeTangentThread, &data);
+            if (threads[i] == NULL) printf(" EMP Error Creating Thread #%d!\n", i+1);
+        }
+    }
+
+    // Now run the thread block from the original thread
+    mesh_edgeTangentThread(&data);
+
+    // Wait for all others to return
+    if (threads != NULL) {
+        for (i = 0; i < np-1; i++) {
+            if (threads[i] != NULL) EMP_ThreadWait(threads[i]);
+        }
+
+        for (i = 0; i < np-1; i++) {
+            if (threads[i] != NULL) EMP_ThreadDestroy(threads[i]);
+        }
+    }
+
+    if (data.mutex != NULL) EMP_LockDestroy(data.mutex);
+    if (threads != NULL) EG_free(threads);
+}
+
 // Modify edge vertex counts to maximize TFI (transfinite interpolation)
 static int mesh_edgeVertexTFI( ego ebody,
                                int *points,   // (in) 1-based vertex count in each edge, (out) vertex countt maximize TIF
@@ -98,15 +226,18 @@ static int mesh_edgeVertexTFI( ego ebody,
     const double *reals;
     const char *string;
 
-    int     nchange = 0, oclass, mtype, nchild, nchild2, *senses;
+    int     nchange = 0, oclass, mtype, nchild, *senses;
 
     // Edge point distributions
     int    *isouth=NULL, *ieast=NULL, *inorth=NULL, *iwest=NULL;
-    double  range[2], data[4], eval[18], eval2[18];
-    ego     eref, *echilds, *echilds2, eloop;
+    double  data[4];
+    ego     eref, *echilds, eloop;
+
+    // Edge start tangents - evaluated once for all Faces sharing an Edge
+    int    *edgeStat=NULL, iedge[4];
+    double *edgeTangent=NULL;
 
     int    i, j, k, face; // Indexing
-    double scale;
 
     status = EG_attributeRet(ebody, ".qParams", &atype, &alen, &ints, &reals, &string);
     if (status == EGADS_SUCCESS && (atype != ATTRREAL || (atype == ATTRREAL && reals[0] <= 0 ))) {
@@ -126,10 +257,17 @@ static int mesh_edgeVertexTFI( ego ebody,
     inorth = (int *) EG_alloc((numFace+1)*sizeof(int));
     iwest  = (int *) EG_alloc((numFace+1)*sizeof(int));
 
+    edgeStat    = (int *)    EG_alloc((numEdge+1)*sizeof(int));
+    edgeTangent = (double *) EG_alloc(3*(numEdge+1)*sizeof(double));
+
     if (isouth == NULL ||
         ieast  == NULL  ||
         inorth == NULL ||
-        iwest  == NULL   ) { status = EGADS_MALLOC; goto cleanup; }
+        iwest  == NULL ||
+        edgeStat    == NULL ||
+        edgeTangent == NULL) { status = EGADS_MALLOC; goto cleanup; }
+
+    for (i = 0; i < numEdge; i++) edgeStat[i] = 0;
 
     for (i = 1; i <= numFace; i++) {
         isouth[i] = 0;
@@ -157,37 +295,53 @@ static int mesh_edgeVertexTFI( ego ebody,
 
         if (nchild != 4) continue;
 
+        isouth[i] = status = EG_indexBodyTopo(ebody, echilds[0]);
+        if (status < EGADS_SUCCESS) goto cleanup;
+
+        ieast[i]  = status = EG_indexBodyTopo(ebody, echilds[1]);
+        if (status < EGADS_SUCCESS) goto cleanup;
+
+        inorth[i] = status = EG_indexBodyTopo(ebody, echilds[2]);
+        if (status < EGADS_SUCCESS) goto cleanup;
+
+        iwest[i]  = status = EG_indexBodyTopo(ebody, echilds[3]);
+        if (status < EGADS_SUCCESS) goto cleanup;
+
+        // the start tangent of these Edges is needed
+        edgeStat[isouth[i]-1] = 1;
+        edgeStat[ieast [i]-1] = 1;
+        edgeStat[inorth[i]-1] = 1;
+        edgeStat[iwest [i]-1] = 1;
+    }
+
+    // evaluate the start tangent of each needed Edge once
+    mesh_edgeTangents(numEdge, eedges, edgeStat, edgeTangent);
+
+    for (i = 1; i <= numFace; i++) {
+        if (isouth[i] <= 0) continue;
+
+        iedge[0] = isouth[i]-1;
+        iedge[1] = ieast [i]-1;
+        iedge[2] = inorth[i]-1;
+        iedge[3] = iwest [i]-1;
+
         // Check to see if two "straight" edges next to each other are parallel - Don't Quad if so
+        status = EGADS_SUCCESS;
         for (j = 0; j < 4; j++) {
 
-            status = EG_getTopology(echilds[j], &eref, &oclass, &mtype, data, &nchild2, &echilds2, &senses);
-            if (mtype == DEGENERATE) { status = EGADS_DEGEN; break; }
-            if (status < EGADS_SUCCESS) goto cleanup;
-
             if (j < 3) k = j+1;
             else k = 0;
 
-            status = EG_getTopology(echilds[k], &eref, &oclass, &mtype, range, &nchild2, &echilds2, &senses);
-            if (mtype == DEGENERATE) { status = EGADS_DEGEN; break; }
-            if (status < EGADS_SUCCESS) goto cleanup;
+            if (edgeStat[iedge[j]] == EGADS_DEGEN ||
+                edgeStat[iedge[k]] == EGADS_DEGEN) { status = EGADS_DEGEN; break; }
 
-            status = EG_evaluate(echilds[j], data, eval);
+            status = edgeStat[iedge[j]];
             if (status < EGADS_SUCCESS) goto cleanup;
 
-            status = EG_evaluate(echilds[k], range, eval2);
+            status = edgeStat[iedge[k]];
             if (status < EGADS_SUCCESS) goto cleanup;
 
-            scale = dot_DoubleVal(&eval[3], &eval[3]);
-            eval[3] /= scale;
-            eval[4] /= scale;
-            eval[5] /= scale;
-
-            scale = dot_DoubleVal(&eval2[3], &eval2[3]);
-            eval2[3] /= scale;
-            eval2[4] /= scale;
-            eval2[5] /= scale;
-
-            if (fabs(fabs(dot_DoubleVal(&eval[3], &eval2[3])) - 1) < 1E-6) {
+            if (fabs(fabs(dot_DoubleVal(&edgeTangent[3*iedge[j]], &edgeTangent[3*iedge[k]])) - 1) < 1E-6) {
                 status = EGADS_OUTSIDE;
                 break;
             }
@@ -195,25 +349,18 @@ static int mesh_edgeVertexTFI( ego ebody,
 
         if (status == EGADS_OUTSIDE) {
             printf("\tFace %d has parallel edges - no TFI quading\n", i);
-            continue;
         }
 
         if (status == EGADS_DEGEN) {
             printf("\tFace %d has a degenerate edge - no TFI quading\n", i);
-            continue;
         }
 
-        isouth[i] = status = EG_indexBodyTopo(ebody, echilds[0]);
-        if (status < EGADS_SUCCESS) goto cleanup;
-
-        ieast[i]  = status = EG_indexBodyTopo(ebody, echilds[1]);
-        if (status < EGADS_SUCCESS) goto cleanup;
-
-        inorth[i] = status = EG_indexBodyTopo(ebody, echilds[2]);
-        if (status < EGADS_SUCCESS) goto cleanup;
-
-        iwest[i]  = status = EG_indexBodyTopo(ebody, echilds[3]);
-        if (status < EGADS_SUCCESS) goto cleanup;
+        if (status != EGADS_SUCCESS) {
+            isouth[i] = 0;
+            ieast [i] = 0;
+            inorth[i] = 0;
+            iwest [i] = 0;
+        }
     }
 
     // make "opposite" sides of four-sided Faces (with only one loop) match
@@ -286,6 +433,9 @@ static int mesh_edgeVertexTFI( ego ebody,
         EG_free(inorth);
         EG_free(iwest);
 
+        EG_free(edgeStat);
+        EG_free(edgeTangent);
+
         EG_free(eedges);
         EG_free(efaces);
 
@@ -1154,13 +1304,12 @@ int mesh_surfaceMeshEGADSTess(mapAttrToIndexStruct *attrMap, meshStruct *surfMes
         return status;
 }
 
-// Create a surface mesh in meshStruct format using the EGADS body object
-int mesh_surfaceMeshEGADSBody(ego body,
-                              double refLen,
-                              double tessParams[3],
-                              int quadMesh,
-                              mapAttrToIndexStruct *attrMap,
-                              meshStruct *surfMesh) {
+// Tessellate an EGADS body (including quading) and store the tessellation in surfMesh->bodyTessMap
+int mesh_tessellateEGADSBody(ego body,
+                             double refLen,
+                             double tessParams[3],
+                             int quadMesh,
+                             meshStruct *surfMesh) {
 
     int status; // Function return integer
 
@@ -1289,6 +1438,30 @@ int mesh_surfaceMeshEGADSBody(ego body,
         }
     }
 
+    status = CAPS_SUCCESS;
+
+    cleanup:
+        if (status != CAPS_SUCCESS) printf("Error: Premature exit in mesh_tessellateEGADSBody, status = %d\n", status);
+
+        EG_free(faces);
+
+        return status;
+
+}
+
+// Create a surface mesh in meshStruct format using the EGADS body object
+int mesh_surfaceMeshEGADSBody(ego body,
+                              double refLen,
+                              double tessParams[3],
+                              int quadMesh,
+                              mapAttrToIndexStruct *attrMap,
+                              meshStruct *surfMesh) {
+
+    int status; // Function return integer
+
+    status = mesh_tessellateEGADSBody(body, refLen, tessParams, quadMesh, surfMesh);
+    if (status != CAPS_SUCCESS) goto cleanup;
+
     status = mesh_surfaceMeshEGADSTess(attrMap, surfMesh);
     if (status != CAPS_SUCCESS) goto cleanup;
 
@@ -1297,10 +1470,142 @@ int mesh_surfaceMeshEGADSBody(ego body,
     cleanup:
         if (status != CAPS_SUCCESS) printf("Error: Premature exit in mesh_surfaceMeshEGADSBody, status = %d\n", status);
 
-        EG_free(faces);
-
         return status;
+}
+
+// Work for the threads converting body tessellations to surface meshes
+typedef struct {
+    void *mutex;       // Mutex for the body queue
+    long master;       // Thread ID of the calling thread
+    int end;           // Number of bodies
+    int index;         // Next body to process
+    int stat;          // Status of the first (lowest index) body that failed
+    int fail;          // Index of the first body that failed (-1 if none)
+
+    mapAttrToIndexStruct *attrMap;
+    meshStruct *surfMesh;
+    double *bodyTime;
+} EMPsurfaceMesh;
+
+// Thread function for mesh_surfaceMeshEGADSTessBodies
+static void mesh_surfaceMeshThread(void *struc) {
+
+    int index, status;
+    long ID;
+    double time0;
+    EMPsurfaceMesh *data;
+
+    data = (EMPsurfaceMesh *) struc;
+
+    // Get our identifier
+    ID = EMP_ThreadID();
+
+    // Look for work
+    for (;;) {
+
+        // Only one thread at a time here -- controlled by a mutex!
+        if (data->mutex != NULL) EMP_LockSet(data->mutex);
+        index = data->index;
+        data->index += 1;
+        if (data->mutex != NULL) EMP_LockRelease(data->mutex);
+        if (index >= data->end) break;
+
+        time0 = EMP_Clock();
+        status = mesh_surfaceMeshEGADSTess(data->attrMap, &data->surfMesh[index]);
+        if (data->bodyTime != NULL) data->bodyTime[index] = EMP_Clock() - time0;
+
+        if (status != CAPS_SUCCESS) {
+            if (data->mutex != NULL) EMP_LockSet(data->mutex);
+            if (data->fail < 0 || index < data->fail) {
+                data->fail = index;
+                data->stat = status;
+            }
+            if (data->mutex != NULL) EMP_LockRelease(data->mutex);
+        }
+    }
+
+    // Exhausted all work -- exit
+    if (ID != data->master) EMP_ThreadExit();
+}
+
+// Create surface meshes in meshStruct format from the EGADS tessellations of numBody bodies. The
+//  tessellations (surfMesh[].bodyTessMap) must already exist; only read-only EGADS tessellation queries
+//  are made so the bodies are converted concurrently. Each surfMesh[i] only depends on its own
+//  tessellation, so the result does not depend on the number of threads. The wall clock time spent on
+//  each body is returned in bodyTime[numBody] if not NULL.
+int mesh_surfaceMeshEGADSTessBodies(int numBody,
+                                    mapAttrToIndexStruct *attrMap,
+                                    meshStruct surfMesh[],
+                                    double bodyTime[]) {
+
+    int i, np = 1;
+    long start;
+
+    void **threads = NULL;
+    EMPsurfaceMesh data;
+
+    if (numBody <= 0) return CAPS_SUCCESS;
+    if (attrMap == NULL || surfMesh == NULL) return CAPS_NULLVALUE;
+
+    data.mutex    = NULL;
+    data.end      = numBody;
+    data.index    = 0;
+    data.stat     = CAPS_SUCCESS;
+    data.fail     = -1;
+    data.attrMap  = attrMap;
+    data.surfMesh = surfMesh;
+    data.bodyTime = bodyTime;
+
+    np = EMP_Init(&start);
+    if (np > numBody) np = numBody;
+    if (np > 1) {
+        // Create the mutex to handle list synchronization
+        data.mutex = EMP_LockCreate();
+        if (data.mutex == NULL) {
+            printf(" EMP Error: mutex creation = NULL!\n");
+            np = 1;
+        } else {
+            // Get storage for our extra threads
+            threads = (void **) EG_alloc((np-1)*sizeof(void *));
+            if (threads == NULL) {
+                EMP_LockDestroy(data.mutex);
+                data.mutex = NULL;
+                np = 1;
+            }
+        }
+    }
+    data.master = EMP_ThreadID();
+
+    // Create the threads and get going!
+    if (threads != NULL) {
+        for (i = 0; i < np-1; i++) {
+            threads[i] = EMP_ThreadCreate(mesh_surfaceMeshThread, &data);
+            if (threads[i] == NULL) printf(" EMP Error Creating Thread #%d!\n", i+1);
+        }
+    }
+
+    // Now run the thread block from the original thread
+    mesh_surfaceMeshThread(&data);
+
+    // Wait for all others to return
+    if (threads != NULL) {
+        for (i = 0; i < np-1; i++) {
+            if (threads[i] != NULL) EMP_ThreadWait(threads[i]);
+        }
+
+        for (i = 0; i < np-1; i++) {
+            if (threads[i] != NULL) EMP_ThreadDestroy(threads[i]);
+        }
+    }
+
+    if (data.mutex != NULL) EMP_LockDestroy(data.mutex);
+    if (threads != NULL) EG_free(threads);
+
+    if (data.fail >= 0) {
+        printf("Error: Problem creating the surface mesh of body %d, status = %d\n", data.fail+1, data.stat);
+    }
 
+    return data.stat;
 }
 
 int mesh_modifyBodyTess(int numMeshProp,
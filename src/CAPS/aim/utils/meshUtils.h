@@ -23,9 +23,16 @@ int mesh_bodyTessellation(ego tess, mapAttrToIndexStruct *attrMap,
 // Create a surface mesh in meshStruct format using the EGADS body object
 int mesh_surfaceMeshEGADSBody(ego body, double refLen, double tessParams[3], int quadMesh, mapAttrToIndexStruct *attrMap, meshStruct *surfMesh);
 
+// Tessellate an EGADS body (including quading) and store the tessellation in surfMesh->bodyTessMap
+int mesh_tessellateEGADSBody(ego body, double refLen, double tessParams[3], int quadMesh, meshStruct *surfMesh);
+
 // Create a surface mesh in meshStruct format using the EGADS body tessellation
 int mesh_surfaceMeshEGADSTess(mapAttrToIndexStruct *attrMap, meshStruct *surfMesh);
 
+// Create surface meshes in meshStruct format from the existing EGADS tessellations of numBody bodies
+//  concurrently - the wall clock time for each body is returned in bodyTime (if not NULL)
+int mesh_surfaceMeshEGADSTessBodies(int numBody, mapAttrToIndexStruct *attrMap, meshStruct surfMesh[], double bodyTime[]);
+
 // Modify the EGADS body tessellation based on given inputs
 int mesh_modifyBodyTess(int numMeshProp,
                         meshSizingStruct meshProp[],
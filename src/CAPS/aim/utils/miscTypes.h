@@ -3,6 +3,8 @@
 #ifndef MISCTYPES_H
 #define MISCTYPES_H
 
+#include <stddef.h>
+
 // General container for to map attribute names to an assigned index
 typedef struct {
 
@@ -12,6 +14,57 @@ typedef struct {
     char **attributeName;
     int  *attributeIndex;
 
+    // Open addressing hash of attributeName (numHash is a power of 2) - entries are positions
+    //  in attributeName, -1 if empty
+    int numHash;
+    int *hashTable;
+
 } mapAttrToIndexStruct;
 
+// Lookup from integer IDs (e.g. global node IDs) to their index in an array
+typedef struct {
+
+    int numID;
+
+    // Direct table for (mostly) contiguous IDs - index = directIndex[ID - minID]
+    int minID;
+    int maxID;
+    int *directIndex;
+
+    // Open addressing hash for sparse IDs (numHash is a power of 2)
+    int numHash;
+    int *hashID;
+    int *hashIndex;
+
+} mapIDToIndexStruct;
+
+// Index of the result blocks in a text output file (e.g. a Nastran F06) - one entry per line
+//  beginning with one of a set of header keywords
+typedef struct {
+
+    // Keywords the file was indexed against
+    int numKeyword;
+    char **keyword;
+
+    // Identity of the indexed file - the index is rebuilt if any of these change
+    long long fileID;
+    long long fileSize;
+    long long modTime; // Nanoseconds where the system provides them
+
+    int numBlock;
+    int *blockKeyword; // Keyword index of each block header
+    char **blockLine;  // Header line of each block
+    long long *blockOffset; // File offset just after the header line
+
+} resultFileIndexStruct;
+
+// Read-only view of the contents of a file - a memory map of the file where possible, otherwise a copy
+typedef struct {
+
+    size_t size; // Size of the file in bytes
+    char *data;  // File contents, size[size]
+    int mapped;  // Is data a memory map of the file?
+
+} fileViewStruct;
+
 #endif
@@ -5,13 +5,19 @@
 #include <ctype.h>
 #include <stdio.h>
 #include <math.h>
+#include <sys/stat.h>
 #ifdef WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
 #include <io.h>
 #else
 #include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
 #endif
 
 #include "egads.h"
+#include "emp.h"
 #include "capsTypes.h"  // Bring in CAPS types
 #include "miscTypes.h"  // Bring in misc. structures
 #include "miscUtils.h"  // Bring in misc. utility header
@@ -20,6 +26,8 @@
 #define snprintf _snprintf
 #define strcasecmp stricmp
 #define access _access
+#define ftello _ftelli64
+#define fseeko _fseeki64
 #endif
 
 #define NINT(A)         (((A) < 0)   ? (int)(A-0.5) : (int)(A+0.5))
@@ -1492,6 +1500,80 @@ int print_AllAttr( ego obj )
     return status;
 }
 
+// Hash a keyword of a mapAttrToIndex structure (FNV-1a)
+static unsigned int hash_mapAttrToIndexKeyword(const char *keyWord) {
+
+    unsigned int hash = 2166136261u;
+
+    while (*keyWord != '\0') {
+        hash ^= (unsigned char) *keyWord++;
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+// Position of a keyword in the attributeName array of a mapAttrToIndex structure, -1 if not found
+static int find_mapAttrToIndexKeyword(const mapAttrToIndexStruct *attrMap, const char *keyWord) {
+
+    int i, pos; // Indexing
+
+    // No hash (e.g. a map filled outside of the utility functions) - linear search
+    if (attrMap->hashTable == NULL) {
+        for (i = 0; i < attrMap->numAttribute; i++) {
+            if (strcmp(attrMap->attributeName[i], keyWord) == 0) return i;
+        }
+        return -1;
+    }
+
+    i = (int) (hash_mapAttrToIndexKeyword(keyWord) & (unsigned int) (attrMap->numHash-1));
+    while ((pos = attrMap->hashTable[i]) >= 0) {
+        if (strcmp(attrMap->attributeName[pos], keyWord) == 0) return pos;
+        i = (i+1) & (attrMap->numHash-1);
+    }
+
+    return -1;
+}
+
+// Add attributeName[pos] to the hash of a mapAttrToIndex structure
+static void insert_mapAttrToIndexHash(mapAttrToIndexStruct *attrMap, int pos) {
+
+    int i; // Indexing
+
+    i = (int) (hash_mapAttrToIndexKeyword(attrMap->attributeName[pos]) & (unsigned int) (attrMap->numHash-1));
+    while (attrMap->hashTable[i] >= 0) i = (i+1) & (attrMap->numHash-1);
+
+    attrMap->hashTable[i] = pos;
+}
+
+// (Re)build the hash of a mapAttrToIndex structure - the table is kept at most half full
+static int hash_mapAttrToIndexStruct(mapAttrToIndexStruct *attrMap) {
+
+    int i; // Indexing
+    int numHash = 16;
+
+    while (numHash < 2*attrMap->numAttribute) numHash *= 2;
+
+    if (numHash != attrMap->numHash || attrMap->hashTable == NULL) {
+
+        if (attrMap->hashTable != NULL) EG_free(attrMap->hashTable);
+        attrMap->numHash = 0;
+
+        attrMap->hashTable = (int *) EG_alloc(numHash*sizeof(int));
+        if (attrMap->hashTable == NULL) return EGADS_MALLOC;
+
+        attrMap->numHash = numHash;
+    }
+
+    for (i = 0; i < attrMap->numHash; i++) attrMap->hashTable[i] = -1;
+
+    for (i = 0; i < attrMap->numAttribute; i++) {
+        if (attrMap->attributeName[i] != NULL) insert_mapAttrToIndexHash(attrMap, i);
+    }
+
+    return CAPS_SUCCESS;
+}
+
 // Search a mapAttrToIndex structure for a given keyword and set/return the corresponding index
 int get_mapAttrToIndexIndex(mapAttrToIndexStruct *attrMap, const char *keyWord, int *index) {
 
@@ -1504,17 +1586,12 @@ int get_mapAttrToIndexIndex(mapAttrToIndexStruct *attrMap, const char *keyWord,
     if (attrMap == NULL) return CAPS_NULLVALUE;
     if (keyWord == NULL) return CAPS_NULLVALUE;
 
-    for (i = 0; i < attrMap->numAttribute; i++) {
-
-        if (strcmp(attrMap->attributeName[i], keyWord ) == 0) {
-
-            *index = attrMap->attributeIndex[i];
-            return CAPS_SUCCESS;
-        }
-    }
+    i = find_mapAttrToIndexKeyword(attrMap, keyWord);
+    if (i < 0) return CAPS_NOTFOUND;
 
+    *index = attrMap->attributeIndex[i];
 
-    return CAPS_NOTFOUND;
+    return CAPS_SUCCESS;
 }
 
 // Search a mapAttrToIndex structure for a given index and return the corresponding keyword
@@ -1548,16 +1625,12 @@ int set_mapAttrToIndexStruct(mapAttrToIndexStruct *attrMap, const char *keyWord,
     if (attrMap == NULL) return CAPS_NULLVALUE;
     if (keyWord == NULL) return CAPS_NULLVALUE;
 
-    for (i = 0; i < attrMap->numAttribute; i++) {
-
-        if (strcmp(attrMap->attributeName[i], (char *) keyWord ) == 0) {
+    i = find_mapAttrToIndexKeyword(attrMap, keyWord);
+    if (i < 0) return CAPS_NOTFOUND;
 
-            attrMap->attributeIndex[i] = index;
-            return CAPS_SUCCESS;
-        }
-    }
+    attrMap->attributeIndex[i] = index;
 
-    return CAPS_NOTFOUND;
+    return CAPS_SUCCESS;
 }
 
 // Increment a mapAttrToIndex structure with the given keyword and set the default index (= numAttribute)
@@ -1606,14 +1679,25 @@ int increment_mapAttrToIndexStruct(mapAttrToIndexStruct *attrMap, const char *ke
             EG_free(attrMap->attributeName[i]);
         }
         attrMap->attributeName = NULL;
+
+        if (attrMap->hashTable != NULL) EG_free(attrMap->hashTable);
+        attrMap->hashTable = NULL;
+        attrMap->numHash = 0;
         return EGADS_MALLOC;
     }
 
     //printf("KEY WORD = %s\n",keyWord);
     sprintf(attrMap->attributeName[attrMap->numAttribute-1], "%s", keyWord);
 
-    status = set_mapAttrToIndexStruct(attrMap, keyWord, attrMap->numAttribute);
-    if (status != CAPS_SUCCESS) return status;
+    // Add the keyword to the hash - rebuilding it once the table is half full
+    if (attrMap->hashTable == NULL || 2*attrMap->numAttribute > attrMap->numHash) {
+        status = hash_mapAttrToIndexStruct(attrMap);
+        if (status != CAPS_SUCCESS) return status;
+    } else {
+        insert_mapAttrToIndexHash(attrMap, attrMap->numAttribute-1);
+    }
+
+    attrMap->attributeIndex[attrMap->numAttribute-1] = attrMap->numAttribute;
 
     return CAPS_SUCCESS;
 }
@@ -1629,6 +1713,9 @@ int initiate_mapAttrToIndexStruct(mapAttrToIndexStruct *attrMap) {
     attrMap->attributeName = NULL;
     attrMap->attributeIndex = NULL;
 
+    attrMap->numHash = 0;
+    attrMap->hashTable = NULL;
+
     return CAPS_SUCCESS;
 }
 
@@ -1654,14 +1741,836 @@ int destroy_mapAttrToIndexStruct(mapAttrToIndexStruct *attrMap) {
 
     if (attrMap->attributeIndex != NULL) EG_free(attrMap->attributeIndex);
 
+    if (attrMap->hashTable != NULL) EG_free(attrMap->hashTable);
+
     attrMap->attributeName  = NULL;
     attrMap->attributeIndex = NULL;
 
     attrMap->numAttribute = 0;
 
+    attrMap->numHash = 0;
+    attrMap->hashTable = NULL;
+
+    return CAPS_SUCCESS;
+}
+
+// Initiate (0 out all values and NULL all pointers) an ID map in the mapIDToIndexStruct structure format
+int initiate_mapIDToIndexStruct(mapIDToIndexStruct *idMap) {
+
+    if (idMap == NULL) return CAPS_NULLVALUE;
+
+    idMap->numID = 0;
+
+    idMap->minID = 0;
+    idMap->maxID = -1;
+    idMap->directIndex = NULL;
+
+    idMap->numHash = 0;
+    idMap->hashID = NULL;
+    idMap->hashIndex = NULL;
+
+    return CAPS_SUCCESS;
+}
+
+// Destroy (0 out all values and NULL all pointers) an ID map in the mapIDToIndexStruct structure format
+int destroy_mapIDToIndexStruct(mapIDToIndexStruct *idMap) {
+
+    if (idMap == NULL) return CAPS_NULLVALUE;
+
+    if (idMap->directIndex != NULL) EG_free(idMap->directIndex);
+    if (idMap->hashID      != NULL) EG_free(idMap->hashID);
+    if (idMap->hashIndex   != NULL) EG_free(idMap->hashIndex);
+
+    return initiate_mapIDToIndexStruct(idMap);
+}
+
+// Hash bucket for an ID in a table of numHash (power of 2) entries
+static int hash_mapIDToIndex(int ID, int numHash) {
+
+    return (int) (((unsigned int) ID * 2654435761u) & (unsigned int) (numHash-1));
+}
+
+// Create a lookup from the IDs in idList to their index in idList (the first index is kept for repeated IDs)
+//  IDs that span a range no more than 4 times the number of IDs use a direct table, otherwise an open addressing hash
+int create_mapIDToIndexStruct(int numID, const int idList[], mapIDToIndexStruct *idMap) {
+
+    int status; // Function return status
+    int i, k; // Indexing
+    int minID, maxID;
+
+    if (idMap == NULL) return CAPS_NULLVALUE;
+
+    status = destroy_mapIDToIndexStruct(idMap);
+    if (status != CAPS_SUCCESS) return status;
+
+    if (numID <= 0) return CAPS_SUCCESS;
+    if (idList == NULL) return CAPS_NULLVALUE;
+
+    minID = maxID = idList[0];
+    for (i = 1; i < numID; i++) {
+        if (idList[i] < minID) minID = idList[i];
+        if (idList[i] > maxID) maxID = idList[i];
+    }
+
+    idMap->numID = numID;
+
+    if ((double) maxID - (double) minID < 4.0*numID) {
+
+        idMap->minID = minID;
+        idMap->maxID = maxID;
+
+        idMap->directIndex = (int *) EG_alloc((maxID-minID+1)*sizeof(int));
+        if (idMap->directIndex == NULL) {
+            (void) destroy_mapIDToIndexStruct(idMap);
+            return EGADS_MALLOC;
+        }
+
+        for (i = 0; i < maxID-minID+1; i++) idMap->directIndex[i] = -1;
+
+        for (i = numID-1; i >= 0; i--) idMap->directIndex[idList[i]-minID] = i;
+
+    } else {
+
+        idMap->numHash = 1;
+        while (idMap->numHash < 2*numID) idMap->numHash *= 2;
+
+        idMap->hashID    = (int *) EG_alloc(idMap->numHash*sizeof(int));
+        idMap->hashIndex = (int *) EG_alloc(idMap->numHash*sizeof(int));
+        if (idMap->hashID == NULL || idMap->hashIndex == NULL) {
+            (void) destroy_mapIDToIndexStruct(idMap);
+            return EGADS_MALLOC;
+        }
+
+        for (i = 0; i < idMap->numHash; i++) idMap->hashIndex[i] = -1;
+
+        for (i = 0; i < numID; i++) {
+
+            k = hash_mapIDToIndex(idList[i], idMap->numHash);
+            while (idMap->hashIndex[k] >= 0) {
+                if (idMap->hashID[k] == idList[i]) break;
+                k = (k+1) & (idMap->numHash-1);
+            }
+
+            if (idMap->hashIndex[k] >= 0) continue; // Keep the first index of a repeated ID
+
+            idMap->hashID[k]    = idList[i];
+            idMap->hashIndex[k] = i;
+        }
+    }
+
+    return CAPS_SUCCESS;
+}
+
+// Return the index of a given ID in a mapIDToIndex structure (-1 if the ID is not in the map)
+int get_mapIDToIndex(const mapIDToIndexStruct *idMap, int ID) {
+
+    int k;
+
+    if (idMap == NULL) return -1;
+
+    if (idMap->directIndex != NULL) {
+
+        if (ID < idMap->minID || ID > idMap->maxID) return -1;
+
+        return idMap->directIndex[ID-idMap->minID];
+    }
+
+    if (idMap->hashIndex == NULL) return -1;
+
+    k = hash_mapIDToIndex(ID, idMap->numHash);
+    while (idMap->hashIndex[k] >= 0) {
+        if (idMap->hashID[k] == ID) return idMap->hashIndex[k];
+        k = (k+1) & (idMap->numHash-1);
+    }
+
+    return -1;
+}
+
+// Initiate (0 out all values and NULL all pointers) a result file index in the resultFileIndexStruct structure format
+int initiate_resultFileIndexStruct(resultFileIndexStruct *fileIndex) {
+
+    if (fileIndex == NULL) return CAPS_NULLVALUE;
+
+    fileIndex->numKeyword = 0;
+    fileIndex->keyword = NULL;
+
+    fileIndex->fileID = 0;
+    fileIndex->fileSize = -1;
+    fileIndex->modTime = 0;
+
+    fileIndex->numBlock = 0;
+    fileIndex->blockKeyword = NULL;
+    fileIndex->blockLine = NULL;
+    fileIndex->blockOffset = NULL;
+
+    return CAPS_SUCCESS;
+}
+
+// Destroy (0 out all values and NULL all pointers) a result file index in the resultFileIndexStruct structure format
+int destroy_resultFileIndexStruct(resultFileIndexStruct *fileIndex) {
+
+    int i; // Indexing
+
+    if (fileIndex == NULL) return CAPS_NULLVALUE;
+
+    (void) string_freeArray(fileIndex->numKeyword, &fileIndex->keyword);
+
+    if (fileIndex->blockLine != NULL) {
+        for (i = 0; i < fileIndex->numBlock; i++) {
+            if (fileIndex->blockLine[i] != NULL) EG_free(fileIndex->blockLine[i]);
+        }
+        EG_free(fileIndex->blockLine);
+    }
+
+    if (fileIndex->blockKeyword != NULL) EG_free(fileIndex->blockKeyword);
+    if (fileIndex->blockOffset  != NULL) EG_free(fileIndex->blockOffset);
+
+    return initiate_resultFileIndexStruct(fileIndex);
+}
+
+// File status used to tell whether a result file has changed since it was indexed
+#ifdef WIN32
+typedef struct __stat64 resultFileStat_T;
+#else
+typedef struct stat resultFileStat_T;
+#endif
+
+static int resultFile_stat(FILE *fp, resultFileStat_T *fileStat) {
+
+#ifdef WIN32
+    return _fstat64(_fileno(fp), fileStat);
+#else
+    return fstat(fileno(fp), fileStat);
+#endif
+}
+
+// Modification time in nanoseconds (where the system provides it) so that a file rewritten within
+//  the same second is still seen as changed
+static long long resultFile_modTime(const resultFileStat_T *fileStat) {
+
+#if defined(WIN32)
+    return (long long) fileStat->st_mtime * 1000000000LL;
+#elif defined(__APPLE__)
+    return (long long) fileStat->st_mtimespec.tv_sec * 1000000000LL + (long long) fileStat->st_mtimespec.tv_nsec;
+#else
+    return (long long) fileStat->st_mtim.tv_sec * 1000000000LL + (long long) fileStat->st_mtim.tv_nsec;
+#endif
+}
+
+// Index the blocks of a text result file in a single pass (reused if the file has not been modified since it was indexed)
+//  Every line beginning with one of the keywords is recorded along with the position that follows it. The file is
+//  rewound on return.
+int index_resultFile(FILE *fp, int numKeyword, const char *keyword[], resultFileIndexStruct *fileIndex) {
+
+    int status; // Function return status
+    int i, k; // Indexing
+
+    int numAlloc = 0;
+    size_t linecap = 0, *keywordLength = NULL;
+    char *line = NULL; // Temporary line holder
+
+    resultFileStat_T fileStat;
+
+    void *temp;
+
+    if (fp == NULL) return CAPS_IOERR;
+    if (fileIndex == NULL) return CAPS_NULLVALUE;
+    if (numKeyword <= 0 || keyword == NULL) return CAPS_BADVALUE;
+
+    if (resultFile_stat(fp, &fileStat) != 0) return CAPS_IOERR;
+
+    // Nothing to do if the file and keywords are the same as the last time this index was built
+    if (fileIndex->numKeyword == numKeyword &&
+        fileIndex->fileID   == (long long) fileStat.st_ino &&
+        fileIndex->fileSize == (long long) fileStat.st_size &&
+        fileIndex->modTime  == resultFile_modTime(&fileStat)) {
+
+        for (k = 0; k < numKeyword; k++) {
+            if (strcmp(fileIndex->keyword[k], keyword[k]) != 0) break;
+        }
+
+        if (k == numKeyword) {
+            rewind(fp);
+            return CAPS_SUCCESS;
+        }
+    }
+
+    status = destroy_resultFileIndexStruct(fileIndex);
+    if (status != CAPS_SUCCESS) return status;
+
+    fileIndex->keyword = (char **) EG_alloc(numKeyword*sizeof(char *));
+    keywordLength = (size_t *) EG_alloc(numKeyword*sizeof(size_t));
+    if (fileIndex->keyword == NULL || keywordLength == NULL) {
+        status = EGADS_MALLOC;
+        goto cleanup;
+    }
+
+    for (k = 0; k < numKeyword; k++) fileIndex->keyword[k] = NULL;
+    fileIndex->numKeyword = numKeyword;
+
+    for (k = 0; k < numKeyword; k++) {
+        fileIndex->keyword[k] = EG_strdup(keyword[k]);
+        if (fileIndex->keyword[k] == NULL) {
+            status = EGADS_MALLOC;
+            goto cleanup;
+        }
+
+        keywordLength[k] = strlen(keyword[k]);
+    }
+
+    rewind(fp);
+
+    while (getline(&line, &linecap, fp) >= 0) {
+
+        for (k = 0; k < numKeyword; k++) {
+            if (line[0] != keyword[k][0]) continue;
+            if (strncmp(keyword[k], line, keywordLength[k]) == 0) break;
+        }
+
+        if (k == numKeyword) continue;
+
+        if (fileIndex->numBlock == numAlloc) {
+
+            numAlloc = 2*numAlloc + 64;
+
+            temp = EG_reall(fileIndex->blockKeyword, numAlloc*sizeof(int));
+            if (temp == NULL) { status = EGADS_MALLOC; goto cleanup; }
+            fileIndex->blockKeyword = (int *) temp;
+
+            temp = EG_reall(fileIndex->blockLine, numAlloc*sizeof(char *));
+            if (temp == NULL) { status = EGADS_MALLOC; goto cleanup; }
+            fileIndex->blockLine = (char **) temp;
+
+            temp = EG_reall(fileIndex->blockOffset, numAlloc*sizeof(long long));
+            if (temp == NULL) { status = EGADS_MALLOC; goto cleanup; }
+            fileIndex->blockOffset = (long long *) temp;
+        }
+
+        i = fileIndex->numBlock;
+
+        fileIndex->blockKeyword[i] = k;
+        fileIndex->blockLine[i] = EG_strdup(line);
+        if (fileIndex->blockLine[i] == NULL) {
+            status = EGADS_MALLOC;
+            goto cleanup;
+        }
+
+        fileIndex->blockOffset[i] = (long long) ftello(fp);
+        if (fileIndex->blockOffset[i] < 0) {
+            EG_free(fileIndex->blockLine[i]);
+            status = CAPS_IOERR;
+            goto cleanup;
+        }
+
+        fileIndex->numBlock += 1;
+    }
+
+    fileIndex->fileID   = (long long) fileStat.st_ino;
+    fileIndex->fileSize = (long long) fileStat.st_size;
+    fileIndex->modTime  = resultFile_modTime(&fileStat);
+
+    status = CAPS_SUCCESS;
+
+    cleanup:
+        if (status != CAPS_SUCCESS) {
+            printf("Error: Premature exit in index_resultFile, status = %d\n", status);
+            (void) destroy_resultFileIndexStruct(fileIndex);
+        }
+
+        if (keywordLength != NULL) EG_free(keywordLength);
+        if (line != NULL) EG_free(line);
+
+        rewind(fp);
+
+        return status;
+}
+
+// Position the file just after the next block header (after *block) beginning with the given string
+//  Set *block = -1 to search from the start of the file.
+int seek_resultFileBlock(FILE *fp, const resultFileIndexStruct *fileIndex, const char *header, int *block) {
+
+    int i; // Indexing
+    size_t headerLength;
+
+    if (fp == NULL) return CAPS_IOERR;
+    if (fileIndex == NULL || header == NULL || block == NULL) return CAPS_NULLVALUE;
+
+    headerLength = strlen(header);
+
+    for (i = *block+1; i < fileIndex->numBlock; i++) {
+
+        if (strncmp(header, fileIndex->blockLine[i], headerLength) != 0) continue;
+
+        if (fseeko(fp, fileIndex->blockOffset[i], SEEK_SET) != 0) return CAPS_IOERR;
+
+        *block = i;
+        return CAPS_SUCCESS;
+    }
+
+    return CAPS_NOTFOUND;
+}
+
+// Set *block to the last block whose header is before the current file position - used to continue
+//  a seek after a reader has consumed lines past one or more block headers
+int sync_resultFileBlock(FILE *fp, const resultFileIndexStruct *fileIndex, int *block) {
+
+    long long offset;
+
+    if (fp == NULL) return CAPS_IOERR;
+    if (fileIndex == NULL || block == NULL) return CAPS_NULLVALUE;
+
+    offset = (long long) ftello(fp);
+    if (offset < 0) return CAPS_IOERR;
+
+    while (*block+1 < fileIndex->numBlock &&
+           fileIndex->blockOffset[*block+1] <= offset) *block += 1;
+
+    return CAPS_SUCCESS;
+}
+
+// Initiate (0 out all values and NULL all pointers) a file view in the fileViewStruct structure format
+int initiate_fileViewStruct(fileViewStruct *view) {
+
+    if (view == NULL) return CAPS_NULLVALUE;
+
+    view->size = 0;
+    view->data = NULL;
+    view->mapped = (int) false;
+
+    return CAPS_SUCCESS;
+}
+
+// Destroy (0 out all values and NULL all pointers) a file view in the fileViewStruct structure format
+int destroy_fileViewStruct(fileViewStruct *view) {
+
+    if (view == NULL) return CAPS_NULLVALUE;
+
+    if (view->data != NULL) {
+        if (view->mapped == (int) true) {
+#ifdef WIN32
+            (void) UnmapViewOfFile(view->data);
+#else
+            (void) munmap(view->data, view->size);
+#endif
+        } else {
+            EG_free(view->data);
+        }
+    }
+
+    view->size = 0;
+    view->data = NULL;
+    view->mapped = (int) false;
+
     return CAPS_SUCCESS;
 }
 
+// Open a read-only view of a file. The file is memory mapped so that its pages are shared with the
+//  page cache (and the process that wrote it) instead of being copied; if it cannot be mapped it is read.
+int open_fileView(const char *filename, fileViewStruct *view) {
+
+    int status; // Function return status
+    size_t numRead;
+    FILE *fp = NULL;
+
+#ifdef WIN32
+    HANDLE fileHandle, mapHandle;
+    LARGE_INTEGER fileSize;
+#else
+    int fd;
+    struct stat fileStat;
+    void *data;
+#endif
+
+    if (filename == NULL) return CAPS_NULLVALUE;
+    if (view     == NULL) return CAPS_NULLVALUE;
+
+    status = destroy_fileViewStruct(view);
+    if (status != CAPS_SUCCESS) return status;
+
+#ifdef WIN32
+    fileHandle = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                             FILE_ATTRIBUTE_NORMAL, NULL);
+    if (fileHandle == INVALID_HANDLE_VALUE) return CAPS_IOERR;
+
+    if (GetFileSizeEx(fileHandle, &fileSize) == 0) {
+        CloseHandle(fileHandle);
+        return CAPS_IOERR;
+    }
+    view->size = (size_t) fileSize.QuadPart;
+
+    if (view->size > 0) {
+        // The view keeps the mapping alive once the handles are closed
+        mapHandle = CreateFileMappingA(fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (mapHandle != NULL) {
+            view->data = (char *) MapViewOfFile(mapHandle, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapHandle);
+        }
+    }
+    CloseHandle(fileHandle);
+#else
+    fd = open(filename, O_RDONLY);
+    if (fd < 0) return CAPS_IOERR;
+
+    if (fstat(fd, &fileStat) != 0) {
+        close(fd);
+        return CAPS_IOERR;
+    }
+    view->size = (size_t) fileStat.st_size;
+
+    if (view->size > 0) {
+        data = mmap(NULL, view->size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) view->data = (char *) data;
+    }
+    close(fd);
+#endif
+
+    if (view->size == 0) return CAPS_SUCCESS;
+
+    if (view->data != NULL) {
+        view->mapped = (int) true;
+        return CAPS_SUCCESS;
+    }
+
+    // Mapping failed - read the file instead
+    view->data = (char *) EG_alloc(view->size*sizeof(char));
+    if (view->data == NULL) {
+        view->size = 0;
+        return EGADS_MALLOC;
+    }
+
+    fp = fopen(filename, "rb");
+    if (fp == NULL) {
+        status = CAPS_IOERR;
+        goto cleanup;
+    }
+
+    numRead = fread(view->data, sizeof(char), view->size, fp);
+    if (numRead != view->size) {
+        status = CAPS_IOERR;
+        goto cleanup;
+    }
+
+    status = CAPS_SUCCESS;
+
+    cleanup:
+        if (fp != NULL) fclose(fp);
+
+        if (status != CAPS_SUCCESS) (void) destroy_fileViewStruct(view);
+
+        return status;
+}
+
+// Smallest number of bytes parsed per chunk by read_dataColumns
+#define DATACHUNK 1048576
+
+// Value separator in a block of numeric data
+#define IS_DATASEP(c) ((c) == ' ' || (c) == ',' || (c) == '\n' || (c) == '\r' || (c) == '\t')
+
+// Work for the threads parsing a block of numeric data
+typedef struct {
+    void *mutex;       // Mutex for the chunk queue
+    long master;       // Thread ID of the calling thread
+    int end;           // Number of chunks
+    int index;         // Next chunk to process
+    int pass;          // 0 - count the values in each chunk, 1 - parse them
+
+    const char *buffer;
+    size_t *chunk;     // Chunk start offsets in buffer [end+1]
+    long long *first;  // Number of values in (pass 0) or index of the first value of (pass 1) each chunk
+
+    int numRow;
+    int numColumn;
+    double **dataMatrix;
+} EMPdataColumns;
+
+// Parse a double at string - equivalent to strtod but with an exact fast path for typical (<= 19 digit) values
+static double parse_double(const char *string, const char **end) {
+
+    // Exactly representable powers of 10
+    static const double pow10[23] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                     1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                     1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+    const char *p = string;
+    int negative = (int) false, numDigit = 0, haveDigit = (int) false, exponent = 0, expSign = 1, expValue = 0;
+    unsigned long long mantissa = 0;
+    double value;
+
+    if (*p == '-' || *p == '+') {
+        negative = *p == '-';
+        p++;
+    }
+
+    while (*p >= '0' && *p <= '9') {
+        if (numDigit == 19) break;
+        mantissa = 10*mantissa + (unsigned long long) (*p - '0');
+        if (mantissa != 0) numDigit++;
+        haveDigit = (int) true;
+        p++;
+    }
+
+    if (*p == '.') {
+        p++;
+        while (*p >= '0' && *p <= '9') {
+            if (numDigit == 19) break;
+            mantissa = 10*mantissa + (unsigned long long) (*p - '0');
+            if (mantissa != 0) numDigit++;
+            haveDigit = (int) true;
+            exponent--;
+            p++;
+        }
+    }
+
+    // Too many digits or not a plain decimal number
+    if ((*p >= '0' && *p <= '9') || haveDigit == (int) false) {
+        return strtod(string, (char **) end);
+    }
+
+    if (*p == 'e' || *p == 'E') {
+        p++;
+        if      (*p == '-') { expSign = -1; p++; }
+        else if (*p == '+') p++;
+
+        if (!(*p >= '0' && *p <= '9')) return strtod(string, (char **) end);
+
+        while (*p >= '0' && *p <= '9') {
+            if (expValue < 10000) expValue = 10*expValue + (*p - '0');
+            p++;
+        }
+
+        exponent += expSign*expValue;
+    }
+
+    // Exact when both the mantissa and the power of 10 are exactly representable
+    if (mantissa > 9007199254740992ULL || exponent < -22 || exponent > 22 ||
+        !(*p == '\0' || IS_DATASEP(*p))) {
+        return strtod(string, (char **) end);
+    }
+
+    value = (double) mantissa;
+    if (exponent < 0) value /= pow10[-exponent];
+    else              value *= pow10[ exponent];
+
+    *end = p;
+
+    return negative == (int) true ? -value : value;
+}
+
+// Count or parse the values of one chunk of a numeric data block
+static void read_dataChunk(EMPdataColumns *data, int chunk) {
+
+    long long k, numValue;
+    const char *p, *pEnd, *q;
+    double value;
+
+    p    = data->buffer + data->chunk[chunk];
+    pEnd = data->buffer + data->chunk[chunk+1];
+
+    numValue = (long long) data->numRow*data->numColumn;
+
+    k = 0;
+    if (data->pass == 1) k = data->first[chunk];
+
+    while (p < pEnd) {
+
+        while (p < pEnd && IS_DATASEP(*p)) p++;
+        if (p == pEnd) break;
+
+        if (data->pass == 1) {
+
+            if (k >= numValue) break;
+
+            value = parse_double(p, &q);
+            if (q == p) value = 0.0;
+
+            data->dataMatrix[k % data->numColumn][k / data->numColumn] = value;
+            p = q;
+        }
+
+        // Skip to the end of the value
+        while (p < pEnd && !IS_DATASEP(*p)) p++;
+        k++;
+    }
+
+    if (data->pass == 0) data->first[chunk] = k;
+}
+
+// Thread function for read_dataColumns
+static void read_dataThread(void *struc) {
+
+    int index;
+    long ID;
+    EMPdataColumns *data;
+
+    data = (EMPdataColumns *) struc;
+
+    // Get our identifier
+    ID = EMP_ThreadID();
+
+    // Look for work
+    for (;;) {
+
+        // Only one thread at a time here -- controlled by a mutex!
+        if (data->mutex != NULL) EMP_LockSet(data->mutex);
+        index = data->index;
+        data->index += 1;
+        if (data->mutex != NULL) EMP_LockRelease(data->mutex);
+        if (index >= data->end) break;
+
+        read_dataChunk(data, index);
+    }
+
+    // Exhausted all work -- exit
+    if (ID != data->master) EMP_ThreadExit();
+}
+
+// Read numRow rows of numColumn values (separated by white space and/or commas) from the current
+//  position of a file into dataMatrix[numColumn][numRow]. The rest of the file is read in one block
+//  and split into chunks at value boundaries. The values in each chunk are counted and then parsed
+//  concurrently. Values that are not numbers are set to 0.
+int read_dataColumns(FILE *fp, int numRow, int numColumn, double **dataMatrix) {
+
+    int status; // Function return status
+    int i, pass, np = 1;
+    long start;
+
+    size_t size = 0, numAlloc, numRead;
+    long long numValue = 0;
+    char *buffer = NULL, *temp;
+
+    void **threads = NULL;
+    EMPdataColumns data;
+
+    data.chunk = NULL;
+    data.first = NULL;
+    data.mutex = NULL;
+
+    if (fp == NULL) return CAPS_IOERR;
+    if (dataMatrix == NULL) return CAPS_NULLVALUE;
+    if (numRow <= 0 || numColumn <= 0) return CAPS_SUCCESS;
+
+    // Read the rest of the file
+    numAlloc = DATACHUNK;
+    buffer = (char *) EG_alloc((numAlloc+1)*sizeof(char));
+    if (buffer == NULL) return EGADS_MALLOC;
+
+    for (;;) {
+        numRead = fread(buffer+size, sizeof(char), numAlloc-size, fp);
+        size += numRead;
+        if (size < numAlloc) break;
+
+        numAlloc *= 2;
+        temp = (char *) EG_reall(buffer, (numAlloc+1)*sizeof(char));
+        if (temp == NULL) {
+            status = EGADS_MALLOC;
+            goto cleanup;
+        }
+        buffer = temp;
+    }
+    buffer[size] = '\0';
+
+    // Split the buffer into chunks that start after a separator
+    data.end = (int) (size/DATACHUNK) + 1;
+    if (data.end > 4096) data.end = 4096;
+
+    data.chunk = (size_t *) EG_alloc((data.end+1)*sizeof(size_t));
+    data.first = (long long *) EG_alloc(data.end*sizeof(long long));
+    if (data.chunk == NULL || data.first == NULL) {
+        status = EGADS_MALLOC;
+        goto cleanup;
+    }
+
+    data.chunk[0] = 0;
+    for (i = 1; i < data.end; i++) {
+        data.chunk[i] = (size_t) ((double) size*i/data.end);
+        if (data.chunk[i] < data.chunk[i-1]) data.chunk[i] = data.chunk[i-1];
+        while (data.chunk[i] < size && !IS_DATASEP(buffer[data.chunk[i]])) data.chunk[i]++;
+    }
+    data.chunk[data.end] = size;
+
+    data.buffer     = buffer;
+    data.numRow     = numRow;
+    data.numColumn  = numColumn;
+    data.dataMatrix = dataMatrix;
+
+    np = EMP_Init(&start);
+    if (np > data.end) np = data.end;
+    if (np > 1) {
+        // Create the mutex to handle list synchronization
+        data.mutex = EMP_LockCreate();
+        if (data.mutex == NULL) {
+            printf(" EMP Error: mutex creation = NULL!\n");
+            np = 1;
+        } else {
+            // Get storage for our extra threads
+            threads = (void **) EG_alloc((np-1)*sizeof(void *));
+            if (threads == NULL) {
+                EMP_LockDestroy(data.mutex);
+                data.mutex = NULL;
+                np = 1;
+            }
+        }
+    }
+    data.master = EMP_ThreadID();
+
+    // Pass 0 counts the values in each chunk, pass 1 parses them
+    for (pass = 0; pass < 2; pass++) {
+
+        data.pass  = pass;
+        data.index = 0;
+
+        // Create the threads and get going!
+        if (threads != NULL) {
+            for (i = 0; i < np-1; i++) {
+                threads[i] = EMP_ThreadCreate(read_dataThread, &data);
+                if (threads[i] == NULL) printf(" EMP Error Creating Thread #%d!\n", i+1);
+            }
+        }
+
+        // Now run the thread block from the original thread
+        read_dataThread(&data);
+
+        // Wait for all others to return
+        if (threads != NULL) {
+            for (i = 0; i < np-1; i++) {
+                if (threads[i] != NULL) EMP_ThreadWait(threads[i]);
+            }
+
+            for (i = 0; i < np-1; i++) {
+                if (threads[i] != NULL) EMP_ThreadDestroy(threads[i]);
+            }
+        }
+
+        // Convert the value counts into the index of the first value of each chunk
+        if (pass == 0) {
+            numValue = 0;
+            for (i = 0; i < data.end; i++) {
+                numValue += data.first[i];
+                data.first[i] = numValue - data.first[i];
+            }
+        }
+    }
+
+    if (numValue < (long long) numRow*numColumn) {
+        printf("Error: Only %lld of %lld values found in data block!\n",
+               numValue, (long long) numRow*numColumn);
+        status = CAPS_IOERR;
+        goto cleanup;
+    }
+
+    status = CAPS_SUCCESS;
+
+    cleanup:
+        if (data.mutex != NULL) EMP_LockDestroy(data.mutex);
+        if (threads != NULL) EG_free(threads);
+
+        if (data.chunk != NULL) EG_free(data.chunk);
+        if (data.first != NULL) EG_free(data.first);
+        if (buffer != NULL) EG_free(buffer);
+
+        return status;
+}
+
 // Make a copy of attribute map (attrMapIn)
 int copy_mapAttrToIndexStruct(mapAttrToIndexStruct *attrMapIn, mapAttrToIndexStruct *attrMapOut) {
 
@@ -1722,6 +2631,22 @@ int copy_mapAttrToIndexStruct(mapAttrToIndexStruct *attrMapIn, mapAttrToIndexStr
         sprintf(attrMapOut->attributeName[i], "%s", keyWord);
     }
 
+    // The keyword positions are unchanged so the hash can be copied as is
+    if (attrMapIn->hashTable != NULL) {
+
+        attrMapOut->hashTable = (int *) EG_alloc(attrMapIn->numHash*sizeof(int));
+        if (attrMapOut->hashTable == NULL) return EGADS_MALLOC;
+
+        memcpy(attrMapOut->hashTable,
+                attrMapIn->hashTable,
+                attrMapIn->numHash*sizeof(int));
+        attrMapOut->numHash = attrMapIn->numHash;
+
+    } else {
+
+        status = hash_mapAttrToIndexStruct(attrMapOut);
+        if (status != CAPS_SUCCESS) return status;
+    }
 
     return CAPS_SUCCESS;
 }
@@ -106,6 +106,45 @@ int copy_mapAttrToIndexStruct(mapAttrToIndexStruct *attrMapIn, mapAttrToIndexStr
 // Merge two attribute maps preserving the order (and name) of the first input map.
 int merge_mapAttrToIndexStruct(mapAttrToIndexStruct *attrMap1, mapAttrToIndexStruct *attrMap2, mapAttrToIndexStruct *attrMapOut);
 
+// Initiate (0 out all values and NULL all pointers) an ID map in the mapIDToIndexStruct structure format
+int initiate_mapIDToIndexStruct(mapIDToIndexStruct *idMap);
+
+// Destroy (0 out all values and NULL all pointers) an ID map in the mapIDToIndexStruct structure format
+int destroy_mapIDToIndexStruct(mapIDToIndexStruct *idMap);
+
+// Create a lookup from the IDs in idList to their index in idList (the first index is kept for repeated IDs)
+int create_mapIDToIndexStruct(int numID, const int idList[], mapIDToIndexStruct *idMap);
+
+// Return the index of a given ID in a mapIDToIndex structure (-1 if the ID is not in the map)
+int get_mapIDToIndex(const mapIDToIndexStruct *idMap, int ID);
+
+// Initiate (0 out all values and NULL all pointers) a result file index in the resultFileIndexStruct structure format
+int initiate_resultFileIndexStruct(resultFileIndexStruct *fileIndex);
+
+// Destroy (0 out all values and NULL all pointers) a result file index in the resultFileIndexStruct structure format
+int destroy_resultFileIndexStruct(resultFileIndexStruct *fileIndex);
+
+// Index the blocks of a text result file in a single pass (reused if the file has not been modified since it was indexed)
+int index_resultFile(FILE *fp, int numKeyword, const char *keyword[], resultFileIndexStruct *fileIndex);
+
+// Position the file just after the next block header (after *block) beginning with the given string
+int seek_resultFileBlock(FILE *fp, const resultFileIndexStruct *fileIndex, const char *header, int *block);
+
+// Set *block to the last block whose header is before the current file position
+int sync_resultFileBlock(FILE *fp, const resultFileIndexStruct *fileIndex, int *block);
+
+// Initiate (0 out all values and NULL all pointers) a file view in the fileViewStruct structure format
+int initiate_fileViewStruct(fileViewStruct *view);
+
+// Destroy (0 out all values and NULL all pointers) a file view in the fileViewStruct structure format
+int destroy_fileViewStruct(fileViewStruct *view);
+
+// Open a read-only view of a file - memory mapped where possible, otherwise read into memory
+int open_fileView(const char *filename, fileViewStruct *view);
+
+// Read numRow rows of numColumn values (separated by white space and/or commas) from the current position of a file into dataMatrix[numColumn][numRow]
+int read_dataColumns(FILE *fp, int numRow, int numColumn, double **dataMatrix);
+
 // Search a mapAttrToIndex structure for a given keyword and set/return the corresponding index
 int get_mapAttrToIndexIndex(mapAttrToIndexStruct *attrMap, const char *keyWord, int *index);
 
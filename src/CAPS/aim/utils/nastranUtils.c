@@ -2861,14 +2861,44 @@ int nastran_writeDDVALCard(FILE *fp, int ddvalID, int numDDVALSet, double ddvalS
     return CAPS_SUCCESS;
 }
 
+// Block headers recorded when indexing a Nastran F06 file
+static const char *f06EigenValueLine   = "                                              R E A L   E I G E N V A L U E S";
+static const char *f06EigenVectorLine  = "      EIGENVALUE =";
+static const char *f06SubcaseLine      = "0                                                                                                            SUBCASE ";
+static const char *f06DisplacementLine = "                                             D I S P L A C E M E N T   V E C T O R";
+
+// Index of the last F06 file read - kept until the file is modified so repeated reads of
+//  the same results (e.g. one per data transfer) seek directly to the blocks they need
+static resultFileIndexStruct f06Index;
+
+// Index the result blocks of a Nastran F06 file (if not already indexed)
+static int nastran_indexF06(FILE *fp) {
+
+    const char *keyword[4];
+
+    keyword[0] = f06EigenValueLine;
+    keyword[1] = f06EigenVectorLine;
+    keyword[2] = f06SubcaseLine;
+    keyword[3] = f06DisplacementLine;
+
+    return index_resultFile(fp, 4, keyword, &f06Index);
+}
+
+// Free the index kept of the last F06 file read
+int nastran_freeF06Index(void) {
+
+    return destroy_resultFileIndexStruct(&f06Index);
+}
+
 // Read data from a Nastran F06 file to determine the number of eignevalues
 int nastran_readF06NumEigenValue(FILE *fp, int *numEigenVector) {
 
     int status; // Function return
 
-    char *beginEigenLine = "                                              R E A L   E I G E N V A L U E S";
+    const char *beginEigenLine = f06EigenValueLine;
     char *endEigenLine = "1";
     int keepCollecting = (int) true;
+    int block = -1;
 
     size_t linecap = 0;
 
@@ -2881,45 +2911,42 @@ int nastran_readF06NumEigenValue(FILE *fp, int *numEigenVector) {
 
     if (fp == NULL) return CAPS_IOERR;
 
-    while (*numEigenVector == 0) {
+    status = nastran_indexF06(fp);
+    if (status != CAPS_SUCCESS) return status;
+
+    // See how many Eigen-Values we have
+    while (*numEigenVector == 0 &&
+           seek_resultFileBlock(fp, &f06Index, beginEigenLine, &block) == CAPS_SUCCESS) {
 
-        // Get line from file
+        // Skip ahead 2 lines
+        status = getline(&line, &linecap, fp);
+        if (status < 0) break;
         status = getline(&line, &linecap, fp);
         if (status < 0) break;
 
-        // See how many Eigen-Values we have
-        if (strncmp(beginEigenLine, line,strlen(beginEigenLine)) == 0) {
-
-            // Skip ahead 2 lines
-            status = getline(&line, &linecap, fp);
-            if (status < 0) break;
+        while (keepCollecting == (int) true) {
             status = getline(&line, &linecap, fp);
             if (status < 0) break;
 
-            while (keepCollecting == (int) true) {
-                status = getline(&line, &linecap, fp);
-                if (status < 0) break;
-
-                if (strncmp(endEigenLine, line, strlen(endEigenLine)) == 0) {
-                    keepCollecting = (int) false;
-                    break;
-                }
+            if (strncmp(endEigenLine, line, strlen(endEigenLine)) == 0) {
+                keepCollecting = (int) false;
+                break;
+            }
 
-                sscanf(line, "%d%d%lf%lf%lf%lf%lf", &tempInt[0],
-                                                    &tempInt[1],
-                                                    &tempDouble[0],
-                                                    &tempDouble[1],
-                                                    &tempDouble[2],
-                                                    &tempDouble[3],
-                                                    &tempDouble[4]);
+            sscanf(line, "%d%d%lf%lf%lf%lf%lf", &tempInt[0],
+                                                &tempInt[1],
+                                                &tempDouble[0],
+                                                &tempDouble[1],
+                                                &tempDouble[2],
+                                                &tempDouble[3],
+                                                &tempDouble[4]);
 
-                if (tempDouble[3] < 1E-15 && tempDouble[4] < 1E-15){
-                    keepCollecting = (int) false;
-                    break;
-                }
-
-                *numEigenVector += 1;
+            if (tempDouble[3] < 1E-15 && tempDouble[4] < 1E-15){
+                keepCollecting = (int) false;
+                break;
             }
+
+            *numEigenVector += 1;
         }
     }
 
@@ -2939,12 +2966,13 @@ int nastran_readF06EigenVector(FILE *fp, int *numEigenVector, int *numGridPoint,
     int status = 0; // Function return
 
     int i, j, eigenValue = 0; // Indexing
+    int block = -1;
 
     size_t linecap = 0;
 
     char *line = NULL; // Temporary line holder
 
-    char *beginEigenLine = "      EIGENVALUE =";
+    const char *beginEigenLine = f06EigenVectorLine;
     char *endEigenLine = "1";
     char tempString[30];
 
@@ -2957,35 +2985,31 @@ int nastran_readF06EigenVector(FILE *fp, int *numEigenVector, int *numGridPoint,
 
     if (fp == NULL) return CAPS_IOERR;
 
+    status = nastran_indexF06(fp);
+    if (status != CAPS_SUCCESS) return status;
+
     // See how many Eigen-Values we have
     //status = nastran_readF06NumEigenValue(fp, numEigenVector);
     *numEigenVector = 10;
     printf("\tNumber of Eigen-Vectors = %d\n", *numEigenVector);
     if (status != CAPS_SUCCESS) return status;
 
-    // Loop through file line by line until we have determined how many Eigen-Values and grid points we have
-    while (*numGridPoint == 0) {
-
-        // Get line from file
-        status = getline(&line, &linecap, fp);
-        if (status < 0) break;
-
-        // Look for start of Eigen-Vector 1
-        if (strncmp(beginEigenLine, line, strlen(beginEigenLine)) == 0) {
+    // Loop through the Eigen-Vector blocks until we have determined how many grid points we have
+    while (*numGridPoint == 0 &&
+           seek_resultFileBlock(fp, &f06Index, beginEigenLine, &block) == CAPS_SUCCESS) {
 
-            // Fast forward 3 lines
-            for (i = 0; i < 3; i++) {
-                status = getline(&line, &linecap, fp);
-                if (status < 0) break;
-            }
+        // Fast forward 3 lines
+        for (i = 0; i < 3; i++) {
+            status = getline(&line, &linecap, fp);
+            if (status < 0) break;
+        }
 
-            // Loop through lines counting the number of grid points
-            while (getline(&line, &linecap, fp) >= 0) {
+        // Loop through lines counting the number of grid points
+        while (getline(&line, &linecap, fp) >= 0) {
 
-                if (strncmp(endEigenLine, line, strlen(endEigenLine)) == 0) break;
+            if (strncmp(endEigenLine, line, strlen(endEigenLine)) == 0) break;
 
-                *numGridPoint +=1;
-            }
+            *numGridPoint +=1;
         }
     }
 
@@ -2995,9 +3019,6 @@ int nastran_readF06EigenVector(FILE *fp, int *numEigenVector, int *numGridPoint,
     printf("\tNumber of Grid Points = %d for each Eigen-Vector\n", *numGridPoint);
     if (*numGridPoint == 0) return CAPS_NOTFOUND;
 
-    // Rewind the file
-    rewind(fp);
-
     // Allocate dataMatrix array
     if (*dataMatrix != NULL) EG_free(*dataMatrix);
 
@@ -3020,48 +3041,39 @@ int nastran_readF06EigenVector(FILE *fp, int *numEigenVector, int *numGridPoint,
         }
     }
 
-    // Loop through the file again and pull out data
-    while (getline(&line, &linecap, fp) >= 0) {
-
-        // Look for start of Eigen-Vector
-        if (strncmp(beginEigenLine, line, strlen(beginEigenLine)) == 0) {
+    // Go to each Eigen-Vector block and pull out data
+    block = -1;
+    while (eigenValue < *numEigenVector &&
+           seek_resultFileBlock(fp, &f06Index, beginEigenLine, &block) == CAPS_SUCCESS) {
 
-            printf("\tLoading Eigen-Vector = %d\n", eigenValue+1);
+        printf("\tLoading Eigen-Vector = %d\n", eigenValue+1);
 
-            // Fast forward 3 lines
-            for (i = 0; i < 3; i++) {
-                status = getline(&line, &linecap, fp);
-                if (status < 0) break;
-            }
+        // Fast forward 3 lines
+        for (i = 0; i < 3; i++) {
+            status = getline(&line, &linecap, fp);
+            if (status < 0) break;
+        }
 
-            if (line != NULL) EG_free(line);
-            line = NULL;
+        // Loop through the file and fill up the data matrix
+        for (i = 0; i < *numGridPoint; i++) {
+            for (j = 0; j < numVariable; j++) {
 
-            // Loop through the file and fill up the data matrix
-            for (i = 0; i < *numGridPoint; i++) {
-                for (j = 0; j < numVariable; j++) {
-
-                    if (j == 0) {
-                        fscanf(fp, "%lf", &(*dataMatrix)[eigenValue][j+numVariable*i]);
-                        //printf("Data (i,j) = (%d, %d) = %f\n", i,j, (*dataMatrix)[eigenValue][j+numVariable*i]);
-                        fscanf(fp, "%s", tempString);
-                        //printf("String = %s\n", tempString);
-                        j = j + 1;
-                        (*dataMatrix)[eigenValue][j+numVariable*i] = 0.0;
-                    } else fscanf(fp, "%lf", &(*dataMatrix)[eigenValue][j+numVariable*i]);
-
-                    //printf("Data (i,j) = (%d, %d) = %f\n", i,j, (*dataMatrix)[eigenValue][j+numVariable*i]);
-                }
+                if (j == 0) {
+                    fscanf(fp, "%lf", &(*dataMatrix)[eigenValue][j+numVariable*i]);
+                    fscanf(fp, "%s", tempString);
+                    j = j + 1;
+                    (*dataMatrix)[eigenValue][j+numVariable*i] = 0.0;
+                } else fscanf(fp, "%lf", &(*dataMatrix)[eigenValue][j+numVariable*i]);
             }
-
-            eigenValue += 1;
         }
 
-        if (eigenValue == *numEigenVector) break;
+        eigenValue += 1;
     }
 
     if (line != NULL) EG_free(line);
 
+    rewind(fp);
+
     return CAPS_SUCCESS;
 }
 
@@ -3072,6 +3084,7 @@ int nastran_readF06EigenValue(FILE *fp, int *numEigenVector, double ***dataMatri
     int status; // Function return
 
     int i, j;// Indexing
+    int block = -1;
 
     int tempInt, eigenValue =0;
 
@@ -3079,7 +3092,7 @@ int nastran_readF06EigenValue(FILE *fp, int *numEigenVector, double ***dataMatri
 
     char *line = NULL; // Temporary line holder
 
-    char *beginEigenLine = "                                              R E A L   E I G E N V A L U E S";
+    const char *beginEigenLine = f06EigenValueLine;
     //char *endEigenLine = "1";
 
     int numVariable = 5; // EigenValue, eigenValue(radians), eigenValue(cycles), generalized mass, and generalized stiffness.
@@ -3117,40 +3130,35 @@ int nastran_readF06EigenValue(FILE *fp, int *numEigenVector, double ***dataMatri
         }
     }
 
-    // Loop through the file again and pull out data
-    while (eigenValue != *numEigenVector) {
-
-        // Get line from file
-        status = getline(&line, &linecap, fp);
-        if (status < 0) break;
-
-        // Look for start of Eigen-Vector
-        if (strncmp(beginEigenLine, line, strlen(beginEigenLine)) == 0) {
+    // Go to the Eigen-Value table(s) and pull out data
+    while (eigenValue != *numEigenVector &&
+           seek_resultFileBlock(fp, &f06Index, beginEigenLine, &block) == CAPS_SUCCESS) {
 
-            // Fast forward 2 lines
-            for (i = 0; i < 2; i++) {
-                status = getline(&line, &linecap, fp);
-                if (status < 0) break;
-            }
+        // Fast forward 2 lines
+        for (i = 0; i < 2; i++) {
+            status = getline(&line, &linecap, fp);
+            if (status < 0) break;
+        }
 
-            for (i = 0; i < *numEigenVector; i++) {
-                fscanf(fp, "%d", &eigenValue);
-                printf("\tLoading Eigen-Value = %d\n", eigenValue);
+        for (i = 0; i < *numEigenVector; i++) {
+            fscanf(fp, "%d", &eigenValue);
+            printf("\tLoading Eigen-Value = %d\n", eigenValue);
 
-                fscanf(fp, "%d", &tempInt);
+            fscanf(fp, "%d", &tempInt);
 
-                // Loop through the file and fill up the data matrix
-                for (j = 0; j < numVariable; j++) {
+            // Loop through the file and fill up the data matrix
+            for (j = 0; j < numVariable; j++) {
 
-                    fscanf(fp, "%lf", &(*dataMatrix)[i][j]);
+                fscanf(fp, "%lf", &(*dataMatrix)[i][j]);
 
-                }
             }
         }
     }
 
     if (line != NULL) EG_free(line);
 
+    rewind(fp);
+
     return CAPS_SUCCESS;
 }
 
@@ -3161,13 +3169,14 @@ int nastran_readF06Displacement(FILE *fp, int subcaseId, int *numGridPoint, doub
     int status; // Function return
 
     int i, j; // Indexing
+    int block = -1;
 
     size_t linecap = 0;
 
     char *line = NULL; // Temporary line holder
 
-    char *outputSubcaseLine = "0                                                                                                            SUBCASE ";
-    char *displacementLine ="                                             D I S P L A C E M E N T   V E C T O R";
+    const char *outputSubcaseLine = f06SubcaseLine;
+    const char *displacementLine = f06DisplacementLine;
     char *beginSubcaseLine=NULL;
     char *endSubcaseLine = "1";
     char tempString[30];
@@ -3182,8 +3191,8 @@ int nastran_readF06Displacement(FILE *fp, int subcaseId, int *numGridPoint, doub
 
     if (fp == NULL) return CAPS_IOERR;
 
-    // Rewind the file
-    rewind(fp);
+    status = nastran_indexF06(fp);
+    if (status != CAPS_SUCCESS) return status;
 
     if      (subcaseId >= 1000) intLength = 4;
     else if (subcaseId >= 100) intLength = 3;
@@ -3207,38 +3216,26 @@ int nastran_readF06Displacement(FILE *fp, int subcaseId, int *numGridPoint, doub
         if (beginSubcaseLine == NULL) return EGADS_MALLOC;
         sprintf(beginSubcaseLine,"%s",displacementLine);
 
-        //beginSubcaseLine[strlen(displacementLine)] = '\0';
-
         lineFastForward = 2;
     }
 
-    // Loop through file line by line until we have determined how many grid points we have
-    while (*numGridPoint == 0) {
-
-        // Get line from file
-        status = getline(&line, &linecap, fp);
-        if (status < 0) break;
+    // Loop through the matching blocks until we have determined how many grid points we have
+    while (*numGridPoint == 0 &&
+           seek_resultFileBlock(fp, &f06Index, beginSubcaseLine, &block) == CAPS_SUCCESS) {
 
-        // Look for start of subcaseId
-        if (strncmp(beginSubcaseLine, line, strlen(beginSubcaseLine)) == 0) {
-
-            // Fast forward lines
-            for (i = 0; i < lineFastForward; i++) {
-                status = getline(&line, &linecap, fp);
-                if (status < 0) break;
-            }
+        // Fast forward lines
+        for (i = 0; i < lineFastForward; i++) {
+            status = getline(&line, &linecap, fp);
+            if (status < 0) break;
+        }
 
-            // Loop through lines counting the number of grid points
-            while (getline(&line, &linecap, fp) >= 0) {
+        // Loop through lines counting the number of grid points
+        while (getline(&line, &linecap, fp) >= 0) {
 
-                if (strncmp(endSubcaseLine, line,strlen(endSubcaseLine)) == 0)break;
-                *numGridPoint +=1;
-            }
+            if (strncmp(endSubcaseLine, line,strlen(endSubcaseLine)) == 0)break;
+            *numGridPoint +=1;
         }
     }
-    if (line != NULL) EG_free(line);
-    line = NULL;
-    linecap = 0;
 
     printf("Number of Grid Points = %d\n", *numGridPoint);
 
@@ -3246,18 +3243,18 @@ int nastran_readF06Displacement(FILE *fp, int subcaseId, int *numGridPoint, doub
         printf("Either data points  = 0 and/or subcase wasn't found\n");
 
         if (beginSubcaseLine != NULL) EG_free(beginSubcaseLine);
+        if (line != NULL) EG_free(line);
+        rewind(fp);
         return CAPS_NOTFOUND;
     }
 
-    // Rewind the file
-    rewind(fp);
-
     // Allocate dataMatrix array
     //if (*dataMatrix != NULL) EG_free(*dataMatrix);
 
     *dataMatrix = (double **) EG_alloc(*numGridPoint *sizeof(double *));
     if (*dataMatrix == NULL) {
         if (beginSubcaseLine != NULL) EG_free(beginSubcaseLine);
+        if (line != NULL) EG_free(line);
         return EGADS_MALLOC; // If allocation failed ....
     }
 
@@ -3274,50 +3271,47 @@ int nastran_readF06Displacement(FILE *fp, int subcaseId, int *numGridPoint, doub
             if ((*dataMatrix) != NULL) EG_free((*dataMatrix));
 
             if (beginSubcaseLine != NULL) EG_free(beginSubcaseLine);
+            if (line != NULL) EG_free(line);
 
             return EGADS_MALLOC;
         }
     }
 
-    // Loop through the file again and pull out data
-    while (getline(&line, &linecap, fp) >= 0) {
+    // Go back to the block the grid points were counted in and pull out data
+    block -= 1;
+    status = seek_resultFileBlock(fp, &f06Index, beginSubcaseLine, &block);
+    if (status == CAPS_SUCCESS) {
 
-        // Look for start of Displacement
-        if (strncmp(beginSubcaseLine, line, strlen(beginSubcaseLine)) == 0) {
+        printf("Loading displacements for Subcase = %d\n", subcaseId);
 
-            printf("Loading displacements for Subcase = %d\n", subcaseId);
-
-            // Fast forward lines
-            for (i = 0; i < lineFastForward; i++) {
-                status = getline(&line, &linecap, fp);
-                //printf("Line - %s\n", line);
-                if (status < 0) {
-                    printf("Unable to fast forward through file- status %d\n", status);
-                    break;
-                }
+        // Fast forward lines
+        for (i = 0; i < lineFastForward; i++) {
+            status = getline(&line, &linecap, fp);
+            if (status < 0) {
+                printf("Unable to fast forward through file- status %d\n", status);
+                break;
             }
+        }
 
+        // Loop through the file and fill up the data matrix
+        for (i = 0; i < (*numGridPoint); i++) {
+            for (j = 0; j < numVariable; j++) {
 
-            // Loop through the file and fill up the data matrix
-            for (i = 0; i < (*numGridPoint); i++) {
-                for (j = 0; j < numVariable; j++) {
-
-                    if (j == 0){// || j % numVariable+1 == 0) {
-                        fscanf(fp, "%lf", &(*dataMatrix)[i][j]);
-                        fscanf(fp, "%s", tempString);
-                        j = j + 1;
-                        (*dataMatrix)[i][j] = 0.0;
-                    } else fscanf(fp, "%lf", &(*dataMatrix)[i][j]);
-                }
+                if (j == 0){// || j % numVariable+1 == 0) {
+                    fscanf(fp, "%lf", &(*dataMatrix)[i][j]);
+                    fscanf(fp, "%s", tempString);
+                    j = j + 1;
+                    (*dataMatrix)[i][j] = 0.0;
+                } else fscanf(fp, "%lf", &(*dataMatrix)[i][j]);
             }
-
-            break;
         }
     }
 
     if (beginSubcaseLine != NULL) EG_free(beginSubcaseLine);
     if (line != NULL) EG_free(line);
 
+    rewind(fp);
+
     printf("Done reading displacements for Subcase = %d\n", subcaseId);
     return CAPS_SUCCESS;
 }
@@ -86,6 +86,9 @@ int nastran_readF06EigenValue(FILE *fp, int *numEigenVector, double ***dataMatri
 // where variables are Grid Id, Coord Id, T1, T2, T3, R1, R2, R3
 int nastran_readF06Displacement(FILE *fp, int subcaseId, int *numGridPoint, double ***dataMatrix);
 
+// Free the index kept of the last F06 file read
+int nastran_freeF06Index(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -135,6 +135,9 @@ __ProtoExt__ int
 __ProtoExt__ int
   caps_dirtyAnalysis( capsObj pobj, int *nAobj, capsObj **aobjs );
   
+__ProtoExt__ int
+  caps_analysisOrder( capsObj pobj, int *nAobj, capsObj **aobjs, int **levels );
+  
 __ProtoExt__ int
   caps_analysisInfo( const capsObj aobject, char **apath, char **unitSys,
                      char **intents, int *nparent, capsObj **parents,
@@ -312,6 +312,8 @@ typedef struct {
   void       *utsystem;          /* the units system */
   aimContext aimFPTR;            /* the aim Function Pointers */
   char       *pfile;             /* problem file name */
+  char       *sfile;             /* file holding the saved DataSet data */
+  CAPSLONG   sfileLen;           /* length of sfile after the last save */
   char       *filename;          /* Problem original geometry file name */
   char       *file;              /* a copy of the actual file */
   CAPSLONG   fileLen;            /* number of bytes in the file */
@@ -423,6 +425,9 @@ typedef struct {
   double  *data;                /* data -- rank*npts in length */
   char    *units;               /* the units for the data */
   double  *startup;             /* the startup values for cyclic situations */
+  CAPSLONG fileOff;             /* offset of the data in the saved file
+                                   (0 - not saved) */
+  CAPSLONG fileSum;             /* checksum of the data at fileOff */
 } capsDataSet;
 
 #endif
@@ -161,6 +161,8 @@ cdef extern from "caps.h":
     
     int caps_dirtyAnalysis( capsObj pobj, int *nAobj, capsObj **aobjs )
     
+    int caps_analysisOrder( capsObj pobj, int *nAobj, capsObj **aobjs, int **levels )
+    
     int caps_analysisInfo( const capsObj aobject, char **apath, char **unitSys,
                            char **intent, int *nparent, capsObj **parents, 
                            int *nField, char ***fnames, int **ranks, 
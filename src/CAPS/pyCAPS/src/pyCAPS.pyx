@@ -65,6 +65,21 @@ except:
     print "Error: Unable to import libc.stdio"
     raise ImportError
 
+# C-string memcpy
+try:
+    from libc.string cimport memcpy
+except:
+    print "Error: Unable to import libc.string"
+    raise ImportError
+
+# Buffer protocol and Cython arrays (used to expose CAPS buffers without copying)
+try:
+    from cpython.buffer cimport PyObject_CheckBuffer
+    from cython.view cimport array as cvarray
+except:
+    print "Error: Unable to import cpython.buffer/cython.view"
+    raise ImportError
+
 # JSON string conversion       
 try: 
     from json import dumps as jsonDumps
@@ -205,6 +220,46 @@ cpdef _strify(data,ignore_dicts = False):
                     }
     return data
 
+# Is the object an array (e.g. a NumPy array, array.array or memoryview) exposing the buffer protocol
+cdef bint isBufferObj(object obj):
+    
+    if isinstance(obj, (list, tuple, bytes, str, unicode)):
+        return False
+    
+    return PyObject_CheckBuffer(obj)
+
+# Wrap numRow x numCol items at data in a read-only memoryview (a flat view if numCol == 1). 
+# If copy is False no data is copied and the view is only valid as long as CAPS keeps the buffer 
+# (i.e. until the owning CAPS object is updated or deleted); otherwise the data is copied into 
+# memory owned by the view. Without memoryview.toreadonly (Python < 3.8) a view over the CAPS 
+# buffer would be writable, so the data is always copied.
+cdef object bufferView(const void *data, int numRow, int numCol, object dataFormat, Py_ssize_t itemSize, bint copy):
+    
+    cdef:
+        cvarray array
+    
+    if data == NULL or numRow <= 0 or numCol <= 0:
+        return memoryview(bytes())
+    
+    if not copy and not hasattr(memoryview, "toreadonly"):
+        copy = True
+    
+    if numCol == 1:
+        array = cvarray(shape=(numRow,), itemsize=itemSize, format=dataFormat, mode="c", allocate_buffer=copy)
+    else:
+        array = cvarray(shape=(numRow, numCol), itemsize=itemSize, format=dataFormat, mode="c", allocate_buffer=copy)
+    
+    if copy:
+        memcpy(<void *> array.data, data, numRow*numCol*itemSize)
+    else:
+        array.data = <char *> data
+    
+    view = memoryview(array)
+    if hasattr(view, "toreadonly"):
+        view = view.toreadonly()
+        
+    return view
+
 # Convert a returned CAPS value (void *) to an appropriate Python object
 cdef object castValue2PythonObj(const void *data, 
                                 cCAPS.capsvType valueType, 
@@ -212,6 +267,7 @@ cdef object castValue2PythonObj(const void *data,
                                 int numCol):
     
     cdef:
+        int i, j
         int length = 0
         object valueOut, valueTemp
         cCAPS.capsTuple tupleTemp
@@ -333,6 +389,12 @@ cdef void * castValue2VoidP(object data,
         object tempJSON = [] # List of temporary JSON strings 
         
     
+    # Contiguous numeric arrays are copied in one block
+    if isBufferObj(data) and (valueType == cCAPS.Integer or 
+                              valueType == cCAPS.Boolean or 
+                              valueType == cCAPS.Double):
+        return castBuffer2VoidP(data, valueType)
+    
     # Convert data to list 
     if not isinstance(data, list):
         data = [data] # Convert to list
@@ -455,6 +517,55 @@ cdef void * castValue2VoidP(object data,
         print "Can not convert Python object to type", valueType
         raise TypeError
 
+# Copy a 1D or 2D (row major) numeric array (e.g. a NumPy array) into a CAPS value buffer - 
+# the returned buffer must be freed 
+cdef void * castBuffer2VoidP(object data, cCAPS.capsvType valueType):
+    
+    cdef:
+        double[::1] doubleView
+        double[:, ::1] doubleView2
+        int[::1] intView
+        int[:, ::1] intView2
+        
+        const void *source = NULL
+        size_t length, itemSize
+        void *buffer = NULL
+    
+    numRow, numCol = getPythonObjShape(data)
+    
+    if valueType == cCAPS.Double:
+        itemSize = sizeof(double)
+    else:
+        itemSize = sizeof(int)
+    length = <size_t> numRow*numCol*itemSize
+    
+    # Get the address of the contiguous data - arrays of another type or layout are converted element wise
+    try:
+        if numRow*numCol > 0:
+            if valueType == cCAPS.Double and memoryview(data).ndim == 1:
+                doubleView = data
+                source = <const void *> &doubleView[0]
+            elif valueType == cCAPS.Double:
+                doubleView2 = data
+                source = <const void *> &doubleView2[0, 0]
+            elif memoryview(data).ndim == 1:
+                intView = data
+                source = <const void *> &intView[0]
+            else:
+                intView2 = data
+                source = <const void *> &intView2[0, 0]
+    except (ValueError, TypeError, BufferError):
+        return castValue2VoidP(data.tolist(), [], valueType)
+    
+    buffer = malloc(length if length > 0 else 1)
+    if not buffer:
+        raise MemoryError()
+    
+    if source != NULL:
+        memcpy(buffer, source, length)
+    
+    return buffer
+
 # Determine the equivalent CAPS value object type for a Python object     
 cdef cCAPS.capsvType sortPythonObjType(object obj):
 
@@ -462,6 +573,24 @@ cdef cCAPS.capsvType sortPythonObjType(object obj):
     if isinstance(obj, list):
         return sortPythonObjType(obj[0]) 
    
+    # Arrays exposing the buffer protocol (e.g. NumPy arrays) are sorted by their item format
+    if isBufferObj(obj):
+        dataFormat = memoryview(obj).format.lstrip("@=<>!")
+        
+        if dataFormat in ("d", "f", "e"):
+            return cCAPS.Double
+        
+        if dataFormat in ("b", "B", "h", "H", "i", "I", "l", "L", "q", "Q", "n", "N"):
+            return cCAPS.Integer
+        
+        if dataFormat == "?":
+            return cCAPS.Boolean
+        
+        if hasattr(obj, "tolist"):
+            return sortPythonObjType(obj.tolist())
+        
+        return sortPythonObjType(memoryview(obj).tolist())
+    
     if isinstance(obj, bool) and (str(obj) == 'True' or str(obj) == 'False'):
         return cCAPS.Boolean
     
@@ -483,6 +612,19 @@ cdef object getPythonObjShape(object obj):
     numRow = 0
     numCol = 0
     
+    # Arrays exposing the buffer protocol (e.g. NumPy arrays) 
+    if isBufferObj(dataValue):
+        shape = memoryview(dataValue).shape
+        
+        if len(shape) == 0:
+            return 1, 1
+        elif len(shape) == 1:
+            return shape[0], 1
+        elif len(shape) == 2:
+            return shape[0], shape[1]
+        
+        raise ValueError("Only 1D and 2D arrays are supported!")
+    
     if not isinstance(dataValue, list):
         dataValue = [dataValue] # Convert to list
             
@@ -1412,6 +1554,42 @@ cdef class capsProblem:
         
         return dirtyAnalysis
 
+    ## Order the analyses loaded into the problem by their dependencies. An analysis depends on another 
+    # if the other is one of its parents, if one of its inputs is linked to an output of the other, or 
+    # if it receives data from the other through a data transfer. 
+    #
+    # \return List of levels, where each level is a list of analysis names (\ref analysis dictionary keys). 
+    # The analyses of a level only depend on analyses of earlier levels, so they may be executed concurrently. 
+    # A CAPSError (CAPS_CIRCULARLINK) is raised if the dependencies are circular.
+    def analysisOrder(self):
+        
+        cdef:
+            int i
+            int nAobj = 0
+            cCAPS.capsObj *aobjs = NULL
+            int *levels = NULL
+        
+        self.status = cCAPS.caps_analysisOrder(self.problemObj, &nAobj, &aobjs, &levels)
+        self.checkStatus(msg = "while ordering the analyses (during a call to caps_analysisOrder)")
+        
+        order = []
+        try:
+            for i in range(nAobj):
+                while len(order) <= levels[i]:
+                    order.append([])
+                
+                for name in self.analysis.keys():
+                    if (<_capsAnalysis> self.analysis[name]).__analysisObj() == aobjs[i]:
+                        order[levels[i]].append(name)
+                        break
+        finally:
+            if aobjs != NULL:
+                cEGADS.EG_free(aobjs)
+            if levels != NULL:
+                cEGADS.EG_free(levels)
+        
+        return order
+
     ## Load an AIM (Analysis Interface Module) into the problem. See 
     # examples \ref problem3.py and  \ref problem4.py for typical representative use cases. 
     # 
@@ -2460,6 +2638,51 @@ cdef class _capsAnalysis:
         self.capsProblem.checkStatus(msg = "while setting analysis variable - " + str(varname) 
                                          + " (during a call to caps_setValue)")
 
+    ## Links an ANALYSISIN variable of the analysis object to an ANALYSISOUT variable of another analysis. 
+    # The input then depends on the other analysis (see \ref capsProblem.analysisOrder).
+    # \param varname Name of the ANALYSISIN variable of the analysis object.
+    # \param aimSrc Name of the source analysis (\ref capsProblem.analysis dictionary key).
+    # \param srcVarname Name of the ANALYSISOUT variable of the source analysis (default - varname).
+    def linkAnalysisVal(self, varname, aimSrc, srcVarname = None):
+        
+        cdef:
+            cCAPS.capsObj tempObj
+            cCAPS.capsObj srcObj
+            cCAPS.capsObj aObj
+        
+        if srcVarname is None:
+            srcVarname = varname
+        
+        if aimSrc not in self.capsProblem.analysis.keys():
+            print "Unable to find", aimSrc, "in the analysis dictionary!"
+            self.capsProblem.status = cCAPS.CAPS_NOTFOUND
+            self.capsProblem.checkStatus(msg = "while linking analysis variable - " + str(varname))
+        
+        aObj = (<_capsAnalysis> self.capsProblem.analysis[aimSrc]).__analysisObj()
+        
+        varname    = _byteify(varname)
+        srcVarname = _byteify(srcVarname)
+        
+        self.capsProblem.status = cCAPS.caps_childByName(self.analysisObj,
+                                                         cCAPS.VALUE,
+                                                         cCAPS.ANALYSISIN,
+                                                         <char *> varname,
+                                                         &tempObj)
+        self.capsProblem.checkStatus(msg = "while linking analysis variable - " + _strify(varname) 
+                                         + " (during a call to caps_childByName)")
+        
+        self.capsProblem.status = cCAPS.caps_childByName(aObj,
+                                                         cCAPS.VALUE,
+                                                         cCAPS.ANALYSISOUT,
+                                                         <char *> srcVarname,
+                                                         &srcObj)
+        self.capsProblem.checkStatus(msg = "while linking analysis variable - " + _strify(srcVarname) 
+                                         + " (during a call to caps_childByName)")
+        
+        self.capsProblem.status = cCAPS.caps_makeLinkage(srcObj, cCAPS.Copy, tempObj)
+        self.capsProblem.checkStatus(msg = "while linking analysis variable - " + _strify(varname) 
+                                         + " (during a call to caps_makeLinkage)")
+
     ## Gets an ANALYSISIN variable for the analysis object.
     # \param varname Name of CAPS value to retrieve from the AIM. If no name is provided a dictionary
     # containing all ANALYSISIN values is returned. See example \ref analysis4.py for a representative 
@@ -5141,10 +5364,18 @@ cdef class _capsDataSet:
                                      + " (during a call to caps_iniDataSet)")
 
     ## Executes caps_getData on data set object to retrieve data set variable, \ref dataSetName. 
+    # \param asBuffer Return a read-only memoryview (numPoint x rank, or flat if rank is 1) over the CAPS data 
+    # instead of a list - no data is copied (default - False). The view is only valid until the data set is 
+    # updated (e.g. by caps_preAnalysis/caps_postAnalysis, a data transfer or setData) or the problem is closed; 
+    # use numpy.asarray(view) for a NumPy array or numpy.array(view) for a copy. 
     # \return Optionally returns a list of data values. Data with a rank greater than 1 returns a list of lists (e.g. 
     # data representing a displacement would return [ [Node1_xDisplacement, Node1_yDisplacement, Node1_zDisplacement], 
     # [Node2_xDisplacement, Node2_yDisplacement, Node2_zDisplacement], etc. ]   
-    def getData(self):
+    def getData(self, asBuffer = False):
+        
+        cdef:
+            int i, j
+            
         self.capsProblem.status = cCAPS.caps_getData(self.dataSetObj, 
                                                      &self.dataNumPoint, 
                                                      &self.dataRank, 
@@ -5153,6 +5384,9 @@ cdef class _capsDataSet:
         self.capsProblem.checkStatus(msg = "while getting data set - " + str(self.dataSetName) 
                                      + " (during a call to caps_getData)")
         
+        if asBuffer:
+            return bufferView(self.dataValue, self.dataNumPoint, self.dataRank, "d", sizeof(double), False)
+        
         dataOut = []
         for i in range(self.dataNumPoint):
             
@@ -5168,11 +5402,14 @@ cdef class _capsDataSet:
         return dataOut
     
     ## Executes caps_getData on data set object to retrieve XYZ coordinates of the data set. 
+    # \param asBuffer Return a read-only numNode x 3 memoryview over the CAPS coordinates instead of a list - no 
+    # data is copied (default - False). The view has the same lifetime as the one returned by \ref getData. 
     # \return Optionally returns a list of lists of x,y, z values (e.g. [ [x2, y2, z2], [x2, y2, z2],  
     # [x3, y3, z3], etc. ] )      
-    def getDataXYZ(self):
+    def getDataXYZ(self, asBuffer = False):
         
         cdef:
+            int i, j
             int tempRank
             cCAPS.capsObj tempDataObj
             
@@ -5192,6 +5429,9 @@ cdef class _capsDataSet:
         
         self.capsProblem.checkStatus(msg = "while getting XYZ associated with data set - " + str(self.dataSetName) 
                                      + " (during a call to caps_getData)")
+        
+        if asBuffer:
+            return bufferView(self.xyz, self.numNode, tempRank, "d", sizeof(double), False)
       
         return [[self.xyz[tempRank*i + j] for j in range(tempRank)] for i in range(self.numNode)]
     
@@ -5200,8 +5440,11 @@ cdef class _capsDataSet:
     # \return Optionally returns a list of lists of connectivity values 
     # (e.g. [ [node1, node2, node3], [node2, node3, node7], etc. ] ) and a list of lists of data connectivity (not this is    
     # an empty list if the data is node-based) (eg. [ [node1, node2, node3], [node2, node3, node7], etc. ]
-    def getDataConnect(self):
+    # \param asBuffer Return the connectivities as numTri x 3 and numData x 3 memoryviews instead of lists 
+    # (default - False). CAPS does not keep the triangulation, so the views own a copy of the data. 
+    def getDataConnect(self, asBuffer = False):
         cdef:
+            int i, j
             int numTri, numData
             int *triConn = NULL 
             int *dataConn = NULL
@@ -5214,12 +5457,16 @@ cdef class _capsDataSet:
         self.capsProblem.checkStatus(msg = "while getting data connectivity associated with data set - " + str(self.dataSetName) 
                                      + " (during a call to caps_triangulate)")
         
-        connectivity = [[triConn[3*i + j] for j in range(3)] for i in range(numTri)]
-        
-        if numData == 0:
-            dconnectivity = []
+        if asBuffer:
+            connectivity  = bufferView(triConn,  numTri,  3, "i", sizeof(int), True)
+            dconnectivity = bufferView(dataConn, numData, 3, "i", sizeof(int), True)
         else:
-            dconnectivity = [[dataConn[3*i + j] for j in range(3)] for i in range(numData)]
+            connectivity = [[triConn[3*i + j] for j in range(3)] for i in range(numTri)]
+            
+            if numData == 0:
+                dconnectivity = []
+            else:
+                dconnectivity = [[dataConn[3*i + j] for j in range(3)] for i in range(numData)]
             
         if triConn:
             cEGADS.EG_free(triConn)
@@ -225,34 +225,44 @@ cdef object convertUnitPythonObj(cCAPS.capsObj valueObj,
     if valueType != cCAPS.Double and valueType != cCAPS.Integer: # We only want to convert doubles and integers
         return cCAPS.CAPS_SUCCESS, data
     
-    numRow, numCol = getPythonObjShape(data)
+    # Convert into new objects - the caller's data (e.g. a read-only NumPy array) is not modified
+    if isBufferObj(data):
+        if hasattr(data, "tolist"):
+            data = data.tolist()
+        else:
+            data = memoryview(data).tolist()
     
-    for i in range(numCol): # Loop data through matrix 
+    if not isinstance(data, list):
         
-        for j in range(numRow):
+        status = cCAPS.caps_convert(valueObj, <char *> dataUnit, <double> data, &valueOut)
+        if status != cCAPS.CAPS_SUCCESS: 
+            return status, data
         
-            if numCol == 1 and numRow == 1:
-                
-                status = cCAPS.caps_convert(valueObj, <char *> dataUnit, <double> data, &valueOut)
+        return cCAPS.CAPS_SUCCESS, <object> valueOut
+    
+    getPythonObjShape(data) # Make sure the shape is consistent
+    
+    dataOut = []
+    for row in data: # Loop data through matrix 
+        
+        if isinstance(row, list):
+            
+            rowOut = []
+            for item in row:
+                status = cCAPS.caps_convert(valueObj, <char *> dataUnit, <double> item, &valueOut)
                 if status != cCAPS.CAPS_SUCCESS: 
                     return status, data
                 
-                data = <object> valueOut
-                
-            elif numCol == 1:
-                
-                status = cCAPS.caps_convert(valueObj, <char *> dataUnit, <double> data[j], &valueOut)
-                if status != cCAPS.CAPS_SUCCESS: 
-                    return  status, data
-                
-                data[j] = <object> valueOut
-                
-            else:
-                
-                status = cCAPS.caps_convert(valueObj, <char *> dataUnit, <double> data[j][i], &valueOut)
-                if status != cCAPS.CAPS_SUCCESS: 
-                    return status, data
+                rowOut.append(<object> valueOut)
                 
-                data[j][i] = <object> valueOut
+            dataOut.append(rowOut)
+            
+        else:
+            
+            status = cCAPS.caps_convert(valueObj, <char *> dataUnit, <double> row, &valueOut)
+            if status != cCAPS.CAPS_SUCCESS: 
+                return  status, data
+            
+            dataOut.append(<object> valueOut)
     
-    return cCAPS.CAPS_SUCCESS, data
\ No newline at end of file
+    return cCAPS.CAPS_SUCCESS, dataOut
\ No newline at end of file
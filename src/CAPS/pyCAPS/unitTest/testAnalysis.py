@@ -7,6 +7,11 @@ from sys import version_info
 
 import pyCAPS
 
+try:
+    import numpy
+except ImportError:
+    numpy = None
+
 class TestAnalysis(unittest.TestCase):
 
     @classmethod
@@ -29,7 +34,7 @@ class TestAnalysis(unittest.TestCase):
         if os.path.exists(cls.analysisDir):
             os.rmdir(cls.analysisDir)
 
-        for i in range(11):
+        for i in range(12):
             if os.path.exists(cls.analysisDir+str(i)):
                 os.rmdir(cls.analysisDir+str(i))
 
@@ -277,5 +282,25 @@ class TestAnalysis(unittest.TestCase):
         self.myAnalysis.saveGeometry("myAnalysisGeometry")
         self.assertTrue(os.path.isfile("myAnalysisGeometry.egads"))
 
+    # NumPy arrays as analysis inputs
+    @unittest.skipIf(numpy is None, "NumPy is not available")
+    def test_numpyAnalysisVal(self):
+
+        myAnalysis = self.myProblem.loadAIM(aim = "fun3dAIM",
+                                            analysisDir = self.analysisDir + "11")
+
+        myAnalysis.setAnalysisVal("NonInertial_Rotation_Rate", numpy.array([1.0, 2.0, 3.0]))
+        self.assertEqual(myAnalysis.getAnalysisVal("NonInertial_Rotation_Rate"), [1.0, 2.0, 3.0])
+
+        myAnalysis.setAnalysisVal("CFL_Schedule_Iter", numpy.array([1, 40], dtype=numpy.int32))
+        self.assertEqual(myAnalysis.getAnalysisVal("CFL_Schedule_Iter"), [1, 40])
+
+        # Unit conversion must not write into the (read-only) array
+        alpha = numpy.array(numpy.pi/2.0)
+        alpha.setflags(write=False)
+        myAnalysis.setAnalysisVal("Alpha", alpha, units="radian")
+        self.assertAlmostEqual(myAnalysis.getAnalysisVal("Alpha"), 90.0)
+        self.assertEqual(float(alpha), numpy.pi/2.0)
+
 if __name__ == '__main__':
     unittest.main()
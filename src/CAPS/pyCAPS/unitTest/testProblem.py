@@ -28,6 +28,10 @@ class TestProblem(unittest.TestCase):
         if os.path.exists(cls.analysisDir):
             os.rmdir(cls.analysisDir)
 
+        for i in ["A", "B", "C"]:
+            if os.path.exists(cls.analysisDir+i):
+                os.rmdir(cls.analysisDir+i)
+
         # Remove created files
         if os.path.isfile("myProblem.html"):
             os.remove("myProblem.html")
@@ -117,6 +121,42 @@ class TestProblem(unittest.TestCase):
         myValue = self.myProblem.createValue("Alpha", 10, units="degree")
         self.assertEqual(myValue.name, "Alpha")
 
+    # Order analyses by their dependencies
+    def test_analysisOrder(self):
+
+        myProblem = pyCAPS.capsProblem()
+        myProblem.loadCAPS(self.file, "basicTest", verbosity=0)
+
+        myProblem.loadAIM(aim = "fun3dAIM",
+                          altName = "fun3dA",
+                          analysisDir = self.analysisDir + "A")
+
+        myProblem.loadAIM(aim = "fun3dAIM",
+                          altName = "fun3dB",
+                          analysisDir = self.analysisDir + "B",
+                          parents = "fun3dA")
+
+        myProblem.loadAIM(aim = "fun3dAIM",
+                          altName = "fun3dC",
+                          analysisDir = self.analysisDir + "C")
+
+        # fun3dB needs its parent, fun3dC is independent
+        self.assertEqual(myProblem.analysisOrder(), [["fun3dA", "fun3dC"], ["fun3dB"]])
+
+        # Linking an input to an output also makes a dependency
+        myProblem.analysis["fun3dC"].linkAnalysisVal("Mach", "fun3dB", "CLtot")
+        self.assertEqual(myProblem.analysisOrder(), [["fun3dA"], ["fun3dB"], ["fun3dC"]])
+
+        # Close the loop
+        myProblem.analysis["fun3dA"].linkAnalysisVal("Mach", "fun3dC", "CLtot")
+
+        with self.assertRaises(pyCAPS.CAPSError) as e:
+            myProblem.analysisOrder()
+
+        self.assertEqual(e.exception.errorName, "CAPS_CIRCULARLINK")
+
+        myProblem.closeCAPS()
+
     # Save CAPS and reload
     def test_saveCAPS(self):
 
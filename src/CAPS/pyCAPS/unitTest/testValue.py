@@ -4,6 +4,11 @@ import os
 
 import pyCAPS
 
+try:
+    import numpy
+except ImportError:
+    numpy = None
+
 class TestValue(unittest.TestCase):
 
     @classmethod
@@ -156,5 +161,25 @@ class TestValue(unittest.TestCase):
         with self.assertRaises(ValueError):
             value = self.myProblem.createValue("inconValue", [[1,2,3], [0]])
 
+    # NumPy arrays as values
+    @unittest.skipIf(numpy is None, "NumPy is not available")
+    def test_numpyValue(self):
+
+        value = self.myProblem.createValue("numpyDouble", numpy.array([1.0, 2.0, 3.0]))
+        self.assertEqual(value.value, [1.0, 2.0, 3.0])
+
+        value = self.myProblem.createValue("numpyInteger", numpy.array([1, 2, 3], dtype=numpy.int32))
+        self.assertEqual(value.value, [1, 2, 3])
+
+        value = self.myProblem.createValue("numpyMatrix", numpy.array([[1.0, 2.0], [3.0, 4.0], [5.0, 6.0]]))
+        self.assertEqual(value.value, [[1.0, 2.0], [3.0, 4.0], [5.0, 6.0]])
+
+        # The value holds a copy of the array
+        data = numpy.array([7.0, 8.0, 9.0])
+        value = self.myProblem.createValue("numpyCopy", [0.0, 0.0, 0.0])
+        value.value = data
+        data[0] = 10.0
+        self.assertEqual(value.value, [7.0, 8.0, 9.0])
+
 if __name__ == '__main__':
     unittest.main()
@@ -3999,3 +3999,135 @@ caps_dirtyAnalysis(capsObject *object, int *nAobj, capsObject ***aobjs)
   
   return CAPS_SUCCESS;
 }
+
+
+static int
+caps_linkedAnalysis(capsObject *aobject, capsObject *oobject)
+{
+  int          i;
+  capsAnalysis *analysis;
+  capsObject   *source, *object;
+  capsValue    *value;
+
+  analysis = (capsAnalysis *) aobject->blind;
+  for (i = 0; i < analysis->nAnalysisIn; i++) {
+    source = object = analysis->analysisIn[i];
+    do {
+      if (source->magicnumber != CAPSMAGIC) return CAPS_BADOBJECT;
+      if (source->type        != VALUE)     return CAPS_BADTYPE;
+      if (source->blind       == NULL)      return CAPS_NULLBLIND;
+      if ((source->subtype == ANALYSISOUT) &&
+          (source->parent  == oobject))     return CAPS_SUCCESS;
+      value = (capsValue *) source->blind;
+      if (value->link == object)            return CAPS_CIRCULARLINK;
+      source = value->link;
+    } while (value->link != NULL);
+  }
+
+  return CAPS_NOTFOUND;
+}
+
+
+int
+caps_analysisOrder(capsObject *pobject, int *nAobj, capsObject ***aobjs,
+                   int **levels)
+{
+  int          i, j, k, n, stat, change, *depend, *level, *order;
+  capsProblem  *problem;
+  capsAnalysis *analysis;
+  capsObject   **objs;
+
+  *nAobj  = 0;
+  *aobjs  = NULL;
+  *levels = NULL;
+  if (pobject              == NULL)      return CAPS_NULLOBJ;
+  if (pobject->magicnumber != CAPSMAGIC) return CAPS_BADOBJECT;
+  if (pobject->type        != PROBLEM)   return CAPS_BADTYPE;
+  if (pobject->blind       == NULL)      return CAPS_NULLBLIND;
+  problem = (capsProblem *) pobject->blind;
+  n       = problem->nAnalysis;
+  if (n == 0) return CAPS_SUCCESS;
+
+  for (i = 0; i < n; i++) {
+    if (problem->analysis[i]              == NULL)      return CAPS_NULLOBJ;
+    if (problem->analysis[i]->magicnumber != CAPSMAGIC) return CAPS_BADOBJECT;
+    if (problem->analysis[i]->type        != ANALYSIS)  return CAPS_BADTYPE;
+    if (problem->analysis[i]->blind       == NULL)      return CAPS_NULLBLIND;
+  }
+
+  depend = (int *) EG_alloc((n*n + 2*n)*sizeof(int));
+  if (depend == NULL) return EGADS_MALLOC;
+  level = &depend[n*n];
+  order = &level[n];
+
+  /* depend[i*n+j] is set when Analysis i needs the results of Analysis j:
+     j is a parent of i, an input of i is linked to an output of j, or i
+     gets DataSet values from j through a Bound */
+  for (i = 0; i < n*n; i++) depend[i] = 0;
+  for (i = 0; i < n; i++) {
+    analysis = (capsAnalysis *) problem->analysis[i]->blind;
+    for (j = 0; j < n; j++) {
+      if (i == j) continue;
+      for (k = 0; k < analysis->nParent; k++)
+        if (analysis->parents[k] == problem->analysis[j]) depend[i*n+j] = 1;
+      if (depend[i*n+j] == 1) continue;
+      stat = caps_linkedAnalysis(problem->analysis[i], problem->analysis[j]);
+      if (stat == CAPS_SUCCESS) {
+        depend[i*n+j] = 1;
+        continue;
+      }
+      if (stat != CAPS_NOTFOUND) {
+        EG_free(depend);
+        return stat;
+      }
+      stat = caps_boundDependent(problem, problem->analysis[i],
+                                 problem->analysis[j]);
+      if (stat == CAPS_SUCCESS) depend[i*n+j] = 1;
+    }
+  }
+
+  /* level is the longest chain of Analyses that must be done first */
+  for (i = 0; i < n; i++) level[i] = 0;
+  for (k = 0; k <= n; k++) {
+    change = 0;
+    for (i = 0; i < n; i++)
+      for (j = 0; j < n; j++)
+        if ((depend[i*n+j] == 1) && (level[i] <= level[j])) {
+          level[i] = level[j] + 1;
+          change++;
+        }
+    if (change == 0) break;
+  }
+  if (k > n) {
+    printf(" CAPS Error: Analysis dependencies are circular (caps_analysisOrder)!\n");
+    EG_free(depend);
+    return CAPS_CIRCULARLINK;
+  }
+
+  /* sort by level -- Analyses within a level keep the order of the Problem */
+  for (k = i = 0; k < n; k++)
+    for (j = 0; j < n; j++)
+      if (level[j] == k) {
+        order[i] = j;
+        i++;
+      }
+
+  objs  = (capsObject **) EG_alloc(n*sizeof(capsObject *));
+  *levels = (int *) EG_alloc(n*sizeof(int));
+  if ((objs == NULL) || (*levels == NULL)) {
+    if (objs    != NULL) EG_free(objs);
+    if (*levels != NULL) EG_free(*levels);
+    *levels = NULL;
+    EG_free(depend);
+    return EGADS_MALLOC;
+  }
+  for (i = 0; i < n; i++) {
+    objs[i]      = problem->analysis[order[i]];
+    (*levels)[i] = level[order[i]];
+  }
+  EG_free(depend);
+
+  *nAobj = n;
+  *aobjs = objs;
+  return CAPS_SUCCESS;
+}
@@ -489,6 +489,8 @@ caps_makeDataSet(capsObject *vobject, const char *dname, enum capsdMethod meth,
   dataset->data    = NULL;
   dataset->units   = NULL;
   dataset->startup = NULL;
+  dataset->fileOff = 0;
+  dataset->fileSum = 0;
   if ((meth == Interpolate) || (meth == Conserve)) {
     status = aim_UsesDataSet(problem->aimFPTR, analysis->loadName,
                              analysis->instance, &analysis->info,
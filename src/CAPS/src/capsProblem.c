@@ -44,6 +44,53 @@ extern int  caps_analysisInfo(const capsObj aobject, char **apath, char **unSys,
                               int *nField, char ***fnames, int **ranks,
                               int *execution, int *status);
 
+/* stdio buffer size used when reading and writing CAPS files */
+#define CAPSIOBUF 1048576
+
+/* 64-bit file positioning */
+#ifdef WIN32
+#define CAPSSEEK  _fseeki64
+#define CAPSTELL  _ftelli64
+#else
+#define CAPSSEEK  fseeko
+#define CAPSTELL  ftello
+#endif
+
+
+static int
+caps_fileLength(const char *filename, CAPSLONG *fileLen)
+{
+  int  stat;
+  FILE *fp;
+
+  *fileLen = 0;
+  fp = fopen(filename, "rb");
+  if (fp == NULL) return CAPS_NOTFOUND;
+  stat = CAPSSEEK(fp, 0, SEEK_END);
+  if (stat == 0) *fileLen = CAPSTELL(fp);
+  fclose(fp);
+  if (stat != 0) return CAPS_IOERR;
+
+  return CAPS_SUCCESS;
+}
+
+
+static CAPSLONG
+caps_checksum(int len, const double *reals)
+{
+  int                i;
+  unsigned long long sum, word;
+
+  /* FNV-1a on the 64-bit words (seeded with the length) */
+  sum = 14695981039346656037ULL ^ (unsigned long long) len;
+  for (i = 0; i < len; i++) {
+    memcpy(&word, &reals[i], sizeof(double));
+    sum = (sum ^ word)*1099511628211ULL;
+  }
+
+  return (CAPSLONG) sum;
+}
+
 
 
 static int
@@ -414,10 +461,67 @@ caps_writeDataSet(FILE *fp, capsOwn writer, capsDataSet *ds)
     if (stat != CAPS_SUCCESS) return stat;
   }
 
+  /* the data itself is in a block written by caps_writeDataBlock */
   i = ds->npts*ds->rank;
   if (i > 0) {
-    stat = caps_writeDoubles(fp, i, ds->data);
-    if (stat != CAPS_SUCCESS) return stat;
+    n = fwrite(&ds->fileOff, sizeof(CAPSLONG), 1, fp);
+    if (n != 1) return CAPS_IOERR;
+    n = fwrite(&ds->fileSum, sizeof(CAPSLONG), 1, fp);
+    if (n != 1) return CAPS_IOERR;
+  }
+
+  return CAPS_SUCCESS;
+}
+
+
+static int
+caps_writeDataBlock(FILE *fp, int keep, capsDataSet *ds)
+{
+  int      len;
+  size_t   n;
+  CAPSLONG sum;
+
+  len = ds->npts*ds->rank;
+  if (len <= 0) return CAPS_SUCCESS;
+  if (ds->data == NULL) return CAPS_NULLVALUE;
+
+  /* skip the write if the block already in the file holds this data */
+  sum = caps_checksum(len, ds->data);
+  if ((keep == 1) && (ds->fileOff != 0) && (ds->fileSum == sum))
+    return CAPS_SUCCESS;
+
+  ds->fileOff = CAPSTELL(fp);
+  ds->fileSum = sum;
+  n = fwrite(ds->data, sizeof(double), len, fp);
+  if (n != len) return CAPS_IOERR;
+
+  return CAPS_SUCCESS;
+}
+
+
+static int
+caps_readDataBlock(FILE *fp, int len, capsDataSet *ds)
+{
+  size_t   n;
+  CAPSLONG pos;
+
+  n = fread(&ds->fileOff, sizeof(CAPSLONG), 1, fp);
+  if (n != 1) return CAPS_IOERR;
+  n = fread(&ds->fileSum, sizeof(CAPSLONG), 1, fp);
+  if (n != 1) return CAPS_IOERR;
+
+  ds->data = (double *) EG_alloc(len*sizeof(double));
+  if (ds->data == NULL) return EGADS_MALLOC;
+
+  pos = CAPSTELL(fp);
+  if (CAPSSEEK(fp, ds->fileOff, SEEK_SET) != 0) return CAPS_IOERR;
+  n = fread(ds->data, sizeof(double), len, fp);
+  if (n != len) return CAPS_IOERR;
+  if (CAPSSEEK(fp, pos, SEEK_SET) != 0) return CAPS_IOERR;
+
+  if (caps_checksum(len, ds->data) != ds->fileSum) {
+    printf(" CAPS Error: DataSet checksum mismatch!\n");
+    return CAPS_IOERR;
   }
 
   return CAPS_SUCCESS;
@@ -448,7 +552,7 @@ caps_freeDataSet(capsDataSet *ds)
 
 
 static int
-caps_readDataSet(FILE *fp, capsDataSet *ds)
+caps_readDataSet(FILE *fp, int rev, capsDataSet *ds)
 {
   int    stat, i;
   size_t n;
@@ -461,6 +565,8 @@ caps_readDataSet(FILE *fp, capsDataSet *ds)
   ds->npts    = 0;
   ds->rank    = 0;
   ds->dflag   = 0;
+  ds->fileOff = 0;
+  ds->fileSum = 0;
   n = fread(&ds->method, sizeof(int), 1, fp);
   if (n != 1) return CAPS_IOERR;
   n = fread(&ds->nHist,  sizeof(int), 1, fp);
@@ -499,7 +605,11 @@ caps_readDataSet(FILE *fp, capsDataSet *ds)
 
   i = ds->npts*ds->rank;
   if (i > 0) {
-    stat = caps_readDoubles(fp, &i, &ds->data);
+    if (rev == 1) {
+      stat = caps_readDoubles(fp, &i, &ds->data);
+    } else {
+      stat = caps_readDataBlock(fp, i, ds);
+    }
     if (stat != CAPS_SUCCESS) {
       caps_freeDataSet(ds);
       return stat;
@@ -539,9 +649,9 @@ caps_writeVertexSet(FILE *fp, capsOwn writer, capsVertexSet *vs)
 
   n = fwrite(&vs->discr->nVerts, sizeof(int), 1, fp);
   if (n != 1) return CAPS_IOERR;
-  for (i = 0; i < vs->discr->nVerts; i++) {
-    n = fwrite(&vs->discr->verts[3*i], sizeof(double), 3, fp);
-    if (n != 3) return CAPS_IOERR;
+  if (vs->discr->nVerts > 0) {
+    n = fwrite(vs->discr->verts, sizeof(double), 3*vs->discr->nVerts, fp);
+    if (n != 3*vs->discr->nVerts) return CAPS_IOERR;
   }
 
   return CAPS_SUCCESS;
@@ -569,7 +679,7 @@ caps_freeVertexSet(capsVertexSet *vs)
 
 
 static int
-caps_readVertexSet(FILE *fp, capsObject **lookup, capsVertexSet *vs)
+caps_readVertexSet(FILE *fp, int rev, capsObject **lookup, capsVertexSet *vs)
 {
   int          i, dim, oIndex, status;
   size_t       n;
@@ -600,7 +710,8 @@ caps_readVertexSet(FILE *fp, capsObject **lookup, capsVertexSet *vs)
         caps_freeVertexSet(vs);
         return EGADS_MALLOC;
       }
-      status = caps_readDataSet(fp, (capsDataSet *) vs->dataSets[i]->blind);
+      status = caps_readDataSet(fp, rev,
+                                (capsDataSet *) vs->dataSets[i]->blind);
       if (status != CAPS_SUCCESS) {
         printf(" CAPS Error: DataSet %d readDataSet = %d\n", i, status);
         caps_freeVertexSet(vs);
@@ -649,14 +760,12 @@ caps_readVertexSet(FILE *fp, capsObject **lookup, capsVertexSet *vs)
       caps_freeVertexSet(vs);
       return EGADS_MALLOC;
     }
-    for (i = 0; i < vs->discr->nVerts; i++) {
-      n = fread(&vs->discr->verts[3*i], sizeof(double), 3, fp);
-      if (n != 3) {
-        EG_free(vs->discr->verts);
-        EG_free(vs->discr);
-        caps_freeVertexSet(vs);
-        return CAPS_IOERR;
-      }
+    n = fread(vs->discr->verts, sizeof(double), 3*vs->discr->nVerts, fp);
+    if (n != 3*vs->discr->nVerts) {
+      EG_free(vs->discr->verts);
+      EG_free(vs->discr);
+      caps_freeVertexSet(vs);
+      return CAPS_IOERR;
     }
   } else {
     analysis = (capsAnalysis *) vs->analysis->blind;
@@ -776,7 +885,7 @@ caps_freeBound(capsBound *bound)
 
 
 static int
-caps_readBound(FILE *fp, capsObject **lookup, capsBound *bound)
+caps_readBound(FILE *fp, int rev, capsObject **lookup, capsBound *bound)
 {
   int    i, nc, status, oIndex;
   size_t n;
@@ -932,7 +1041,7 @@ caps_readBound(FILE *fp, capsObject **lookup, capsBound *bound)
       return EGADS_MALLOC;
     }
 
-    status = caps_readVertexSet(fp, lookup,
+    status = caps_readVertexSet(fp, rev, lookup,
                                 (capsVertexSet *) bound->vertexSet[i]->blind);
     if (status != CAPS_SUCCESS) {
       printf(" CAPS Error: VertexSet %d readVertexSet = %d\n", i, status);
@@ -1707,6 +1816,7 @@ caps_close(capsObject *pobject)
     closeEGADS = 1;
   }
   if (problem->pfile    != NULL) EG_free(problem->pfile);
+  if (problem->sfile    != NULL) EG_free(problem->sfile);
   if (problem->file     != NULL) EG_free(problem->file);
   if (problem->lunits   != NULL) {
     for (i = 0; i < problem->nBodies; i++)
@@ -1792,7 +1902,7 @@ caps_close(capsObject *pobject)
 
 
 static int
-caps_readProblem(FILE *fp, capsObject **lookup, capsObject *pobject)
+caps_readProblem(FILE *fp, int rev, capsObject **lookup, capsObject *pobject)
 {
   int          i, stat, oIndex, oclass, mtype, *senses;
   size_t       n;
@@ -2015,7 +2125,7 @@ caps_readProblem(FILE *fp, capsObject **lookup, capsObject *pobject)
       caps_close(pobject);
       return EGADS_MALLOC;
     }
-    stat = caps_readBound(fp, lookup, bound);
+    stat = caps_readBound(fp, rev, lookup, bound);
     if (stat != CAPS_SUCCESS) {
       printf(" CAPS Error: Bound %d readBound = %d\n", i, stat);
       EG_free(bound);
@@ -2058,9 +2168,10 @@ caps_countValueObjs(capsObject *vobject, int *nobj,
 int
 caps_save(capsObject *pobject, /*@null@*/ const char *filename)
 {
-  int           i, j, k, stat, nobj, sizes[2], gstatus, rev[2] = {1, 1};
-  int           execute, nparent, nField, *ranks;
+  int           i, j, k, stat, nobj, sizes[2], gstatus, rev[2] = {1, 2};
+  int           execute, nparent, nField, *ranks, keep;
   size_t        n;
+  CAPSLONG      live, offset, fileLen;
   char          *apath, *unitSys, *intents, **fnames;
   const char    *name;
   capsObject    **lookup, *object, *source, *last, **parents;
@@ -2069,6 +2180,7 @@ caps_save(capsObject *pobject, /*@null@*/ const char *filename)
   capsBound     *bound;
   capsValue     *value;
   capsVertexSet *vs;
+  capsDataSet   *ds;
   FILE          *fp;
 
   if (pobject == NULL)                   return CAPS_NULLOBJ;
@@ -2234,27 +2346,97 @@ caps_save(capsObject *pobject, /*@null@*/ const char *filename)
     }
   }
 
-  /* write the file */
-  fp = fopen(name, "wb");
+  /* the DataSet blocks already in the file can be kept if it is the file
+     we last saved (and is untouched) and is not mostly stale blocks */
+  keep = 0;
+  if ((problem->sfile != NULL) && (strcmp(problem->sfile, name) == 0)) {
+    stat = caps_fileLength(name, &fileLen);
+    if ((stat == CAPS_SUCCESS) && (fileLen == problem->sfileLen)) {
+      live = 0;
+      for (i = 0; i < problem->nBound; i++) {
+        bound = (capsBound *) problem->bounds[i]->blind;
+        if (bound == NULL) continue;
+        for (j = 0; j < bound->nVertexSet; j++) {
+          vs = (capsVertexSet *) bound->vertexSet[j]->blind;
+          if (vs == NULL) continue;
+          for (k = 0; k < vs->nDataSets; k++) {
+            ds    = (capsDataSet *) vs->dataSets[k]->blind;
+            live += ds->npts*ds->rank*sizeof(double);
+          }
+        }
+      }
+      if (fileLen <= 2*live + CAPSIOBUF) keep = 1;
+    }
+  }
+  if (problem->sfile != NULL) EG_free(problem->sfile);
+  problem->sfile    = NULL;
+  problem->sfileLen = 0;
+
+  /* write the file -- revision 1.2 is the header, the offset to the
+     object info, the DataSet blocks and then the object info */
+  if (keep == 1) {
+    fp = fopen(name, "r+b");
+  } else {
+    fp = fopen(name, "wb");
+  }
   if (fp == NULL) {
     EG_free(lookup);
     return CAPS_NOTFOUND;
   }
+  setvbuf(fp, NULL, _IOFBF, CAPSIOBUF);
 
-  /* output the header info */
-  i = CAPSMAGIC;
-  n = fwrite(&i,                  sizeof(int), 1, fp);
-  if (n != 1) {
-    fclose(fp);
-    EG_free(lookup);
-    return CAPS_IOERR;
+  if (keep == 1) {
+    /* new and changed blocks are appended */
+    if (CAPSSEEK(fp, 0, SEEK_END) != 0) {
+      fclose(fp);
+      EG_free(lookup);
+      return CAPS_IOERR;
+    }
+  } else {
+    /* output the header info */
+    i = CAPSMAGIC;
+    n = fwrite(&i,                sizeof(int),      1, fp);
+    if (n != 1) {
+      fclose(fp);
+      EG_free(lookup);
+      return CAPS_IOERR;
+    }
+    n = fwrite(rev,               sizeof(int),      2, fp);
+    if (n != 2) {
+      fclose(fp);
+      EG_free(lookup);
+      return CAPS_IOERR;
+    }
+    offset = 0;
+    n = fwrite(&offset,           sizeof(CAPSLONG), 1, fp);
+    if (n != 1) {
+      fclose(fp);
+      EG_free(lookup);
+      return CAPS_IOERR;
+    }
   }
-  n = fwrite(rev,                 sizeof(int), 2, fp);
-  if (n != 2) {
-    fclose(fp);
-    EG_free(lookup);
-    return CAPS_IOERR;
+
+  /* output the DataSet blocks */
+  for (i = 0; i < problem->nBound; i++) {
+    bound = (capsBound *) problem->bounds[i]->blind;
+    if (bound == NULL) continue;
+    for (j = 0; j < bound->nVertexSet; j++) {
+      vs = (capsVertexSet *) bound->vertexSet[j]->blind;
+      if (vs == NULL) continue;
+      for (k = 0; k < vs->nDataSets; k++) {
+        ds   = (capsDataSet *) vs->dataSets[k]->blind;
+        stat = caps_writeDataBlock(fp, keep, ds);
+        if (stat != CAPS_SUCCESS) {
+          fclose(fp);
+          EG_free(lookup);
+          return stat;
+        }
+      }
+    }
   }
+
+  /* output the object info */
+  offset = CAPSTELL(fp);
   n = fwrite(&nobj,               sizeof(int), 1, fp);
   if (n != 1) {
     fclose(fp);
@@ -2353,9 +2535,33 @@ caps_save(capsObject *pobject, /*@null@*/ const char *filename)
 
   /* write the data within the objects */
   stat = caps_writeProblem(fp, problem);
-  fclose(fp);
+  if (stat != CAPS_SUCCESS) {
+    fclose(fp);
+    return stat;
+  }
+  fileLen = CAPSTELL(fp);
 
-  return stat;
+  /* point the header at the new object info (last, so that an incomplete
+     save leaves the previous contents of an appended file readable) */
+  if (fflush(fp) != 0) {
+    fclose(fp);
+    return CAPS_IOERR;
+  }
+  if (CAPSSEEK(fp, 3*sizeof(int), SEEK_SET) != 0) {
+    fclose(fp);
+    return CAPS_IOERR;
+  }
+  n = fwrite(&offset, sizeof(CAPSLONG), 1, fp);
+  if (n != 1) {
+    fclose(fp);
+    return CAPS_IOERR;
+  }
+  if (fclose(fp) != 0) return CAPS_IOERR;
+
+  problem->sfile    = EG_strdup(name);
+  problem->sfileLen = fileLen;
+
+  return CAPS_SUCCESS;
 }
 
 
@@ -2364,6 +2570,7 @@ caps_readFile(capsObject *pobject)
 {
   int         stat, i, j, nobj, iobj, *asizes, sizes[2], rev[2];
   size_t      n;
+  CAPSLONG    offset;
   capsProblem *problem;
   capsObject  **lookup;
   FILE        *fp;
@@ -2372,6 +2579,7 @@ caps_readFile(capsObject *pobject)
 
   fp = fopen(problem->pfile, "rb");
   if (fp == NULL) return CAPS_NOTFOUND;
+  setvbuf(fp, NULL, _IOFBF, CAPSIOBUF);
 
   /* get header */
   n = fread(&i,                  sizeof(int), 1, fp);
@@ -2389,11 +2597,23 @@ caps_readFile(capsObject *pobject)
     fclose(fp);
     return CAPS_IOERR;
   }
-  if ((rev[0] != 1) || (rev[1] != 1)) {
+  if ((rev[0] != 1) || ((rev[1] != 1) && (rev[1] != 2))) {
     printf(" CAPS Error: CAPS file revision = %d %d!\n", rev[0], rev[1]);
     fclose(fp);
     return CAPS_MISMATCH;
   }
+  if (rev[1] == 2) {
+    /* skip over the DataSet blocks to the object info */
+    n = fread(&offset,           sizeof(CAPSLONG), 1, fp);
+    if (n != 1) {
+      fclose(fp);
+      return CAPS_IOERR;
+    }
+    if (CAPSSEEK(fp, offset, SEEK_SET) != 0) {
+      fclose(fp);
+      return CAPS_IOERR;
+    }
+  }
   n = fread(&nobj,               sizeof(int), 1, fp);
   if (n != 1) {
     fclose(fp);
@@ -2603,11 +2823,17 @@ caps_readFile(capsObject *pobject)
   }
 
   /* read object data */
-  stat = caps_readProblem(fp, lookup, pobject);
+  stat = caps_readProblem(fp, rev[1], lookup, pobject);
   fclose(fp);
   EG_free(lookup);
+  if (stat != CAPS_SUCCESS) return stat;
 
-  return stat;
+  /* the DataSet blocks can be kept by the next save to this file */
+  if (rev[1] == 2)
+    if (caps_fileLength(problem->pfile, &problem->sfileLen) == CAPS_SUCCESS)
+      problem->sfile = EG_strdup(problem->pfile);
+
+  return CAPS_SUCCESS;
 }
 
 
@@ -2617,7 +2843,7 @@ caps_open(const char *filename, const char *pname, capsObject **pobject)
   int           i, j, k, n, len, status, oclass, mtype, idot, *senses;
   int           type, class, actv, ichld, ileft, irite, nattr, ngIn, ngOut;
   int           narg, nrow, ncol, nbrch, npmtr, buildTo, builtTo, ibody, nbody;
-  char          byte, *units, *env;
+  char          *units, *env;
   char          name[MAX_NAME_LEN], bname[MAX_STRVAL_LEN], line[129];
   CAPSLONG      fileLen, ret;
   double        dot, lower, upper, data[4], *reals;
@@ -2642,15 +2868,8 @@ caps_open(const char *filename, const char *pname, capsObject **pobject)
   *pobject = NULL;
 
   /* does file exist? */
-  fp = fopen(filename, "rb");
-  if (fp == NULL) return CAPS_NOTFOUND;
-  fileLen = 0;
-  do {
-    ret = fread(&byte, sizeof(char), 1, fp);
-    fileLen++;
-  } while (ret != 0);
-  fclose(fp);
-  if (fileLen >  0) fileLen--;
+  status = caps_fileLength(filename, &fileLen);
+  if (status != CAPS_SUCCESS) return status;
   if (fileLen == 0) return CAPS_BADVALUE;
 
   /* find the file extension */
@@ -2672,6 +2891,8 @@ caps_open(const char *filename, const char *pname, capsObject **pobject)
   problem->context        = NULL;
   problem->utsystem       = NULL;
   problem->pfile          = NULL;
+  problem->sfile          = NULL;
+  problem->sfileLen       = 0;
   problem->filename       = NULL;
   problem->file           = NULL;
   problem->fileLen        = 0;
@@ -3347,18 +3568,11 @@ caps_open(const char *filename, const char *pname, capsObject **pobject)
       caps_close(object);
       return status;
     }
-    fp = fopen("capsTmp.cpc", "rb");
-    if (fp == NULL) {
+    status = caps_fileLength("capsTmp.cpc", &fileLen);
+    if (status != CAPS_SUCCESS) {
       caps_close(object);
-      return CAPS_NOTFOUND;
+      return status;
     }
-    fileLen = 0;
-    do {
-      ret = fread(&byte, sizeof(char), 1, fp);
-      fileLen++;
-    } while (ret != 0);
-    fclose(fp);
-    if (fileLen >  0) fileLen--;
     if (fileLen == 0) {
       caps_close(object);
       printf(" CAPS Error: capsTmp.cpc has zero length!\n");
@@ -3645,6 +3859,8 @@ caps_start(ego model, const char *pname, capsObject **pobject)
   problem->context        = NULL;
   problem->utsystem       = NULL;
   problem->pfile          = NULL;
+  problem->sfile          = NULL;
+  problem->sfileLen       = 0;
   problem->filename       = NULL;
   problem->file           = NULL;
   problem->fileLen        = 0;
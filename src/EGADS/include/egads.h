@@ -96,6 +96,13 @@ __ProtoExt__ int  EG_invEvaluate( const ego geom, double *xyz, double *param,
                                   double *results );
 __ProtoExt__ int  EG_invEvaluateGuess( const ego geom, double *xyz, 
                                        double *param, double *results );
+/* batched inverse evaluation -- seeded/guessed points converge to a local
+   foot point, which may differ from the global result of EG_invEvaluate */
+__ProtoExt__ int  EG_invEvaluateMany( const ego geom, int npts,
+                                      const double *xyz,
+                                      /*@null@*/ const double *guess,
+                                      double *params,
+                                      /*@null@*/ double *results );
 __ProtoExt__ int  EG_arcLength( const ego geom, double t1, double t2,
                                 double *alen );
 __ProtoExt__ int  EG_curvature( const ego geom, const double *param, 
@@ -227,6 +234,8 @@ __ProtoExt__ int  EG_getGlobal( const ego tess, int global, int *ptype,
                                 int *pindex, /*@null@*/ double *xyz );
   
 __ProtoExt__ int  EG_tessMassProps( const ego tess, double *props );
+__ProtoExt__ int  EG_tessMassPropsBatch( int ntess, const ego *tess,
+                                         double *props );
 
 /* high level functions */
 
@@ -55,6 +55,9 @@ __ProtoExt__ int  EG_makeSolidBody_dot( ego body, int stype, const double *rvec,
 
 __ProtoExt__ int  EG_tessMassProps_dot( const ego tess, double *xyz_dot,
                                         double *props, double *props_dot );
+__ProtoExt__ int  EG_tessMassPropsBatch_dot( int ntess, const ego *tess,
+                                             double **xyz_dot, double *props,
+                                             double *props_dot );
 
 /* high level functions */
 
@@ -28,6 +28,7 @@ extern "C" {
 
            int   EMP_Init          __ProtoGlarp__(( /*@null@*/ long *start ));
            long  EMP_Done          __ProtoGlarp__(( /*@null@*/ long *start ));
+           double EMP_Clock        __ProtoGlarp__((  ));
 
 /*@null@*/ void *EMP_ThreadCreate  __ProtoGlarp__(( void (*entry)(void *),
                                                     /*@null@*/ void *arg ));
@@ -725,6 +725,45 @@ EG_invEvaluateGuess(const egObject *geom, double *xyz,
 }
 
 
+int
+EG_invEvaluateMany(const egObject *geom, int npts, const double *xyz,
+                   /*@null@*/ const double *guess, double *params,
+                   /*@null@*/ double *results)
+{
+  int    i, j, stat, nparam, ndim;
+  double pnt[3], result[3];
+
+  if  (geom == NULL)               return EGADS_NULLOBJ;
+  if  (geom->magicnumber != MAGIC) return EGADS_NOTOBJ;
+  if ((geom->oclass != PCURVE) &&
+      (geom->oclass != CURVE)  && (geom->oclass != SURFACE) &&
+      (geom->oclass != EDGE)   && (geom->oclass != FACE))
+                                   return EGADS_NOTGEOM;
+  if (npts <= 0)                   return EGADS_RANGERR;
+  if ((xyz == NULL) || (params == NULL)) return EGADS_NODATA;
+
+  nparam = 1;
+  ndim   = 3;
+  if ((geom->oclass == SURFACE) || (geom->oclass == FACE)) nparam = 2;
+  if  (geom->oclass == PCURVE) ndim = 2;
+
+  for (i = 0; i < npts; i++) {
+    for (j = 0; j < ndim; j++) pnt[j] = xyz[ndim*i+j];
+    if (guess == NULL) {
+      stat = EG_invEvaluate(geom, pnt, &params[nparam*i], result);
+    } else {
+      for (j = 0; j < nparam; j++) params[nparam*i+j] = guess[nparam*i+j];
+      stat = EG_invEvaluateGuess(geom, pnt, &params[nparam*i], result);
+    }
+    if (stat != EGADS_SUCCESS) return stat;
+    if (results != NULL)
+      for (j = 0; j < ndim; j++) results[ndim*i+j] = result[j];
+  }
+
+  return EGADS_SUCCESS;
+}
+
+
 int
 EG_arcLength(const egObject *geom, double t1, double t2, double *alen)
 {
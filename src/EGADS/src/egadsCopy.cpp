@@ -1314,6 +1314,28 @@ EG_edgeBBox(TopoDS_Edge edge, double *ebx)
 #endif
 
 
+static void
+EG_nodeBBox(const TopTools_IndexedMapOfShape &nmap, double *nbx)
+{
+  /* bbox of the Nodes followed by the largest Node tolerance */
+  nbx[0] = nbx[1] = nbx[2] =  1.e200;
+  nbx[3] = nbx[4] = nbx[5] = -1.e200;
+  nbx[6] = 0.0;
+  for (int k = 0; k < nmap.Extent(); k++) {
+    TopoDS_Vertex vert = TopoDS::Vertex(nmap(k+1));
+    gp_Pnt pv          = BRep_Tool::Pnt(vert);
+    double tol         = BRep_Tool::Tolerance(vert);
+    if (pv.X() < nbx[0]) nbx[0] = pv.X();
+    if (pv.X() > nbx[3]) nbx[3] = pv.X();
+    if (pv.Y() < nbx[1]) nbx[1] = pv.Y();
+    if (pv.Y() > nbx[4]) nbx[4] = pv.Y();
+    if (pv.Z() < nbx[2]) nbx[2] = pv.Z();
+    if (pv.Z() > nbx[5]) nbx[5] = pv.Z();
+    if (tol    > nbx[6]) nbx[6] = tol;
+  }
+}
+
+
 int
 EG_matchBodyEdges(const egObject *body1, const egObject *body2, double toler,
                   int *nmatch, int **match)
@@ -1349,6 +1371,29 @@ EG_matchBodyEdges(const egObject *body1, const egObject *body2, double toler,
   if (map1 == NULL) return EGADS_MALLOC;
   for (i = 0; i < nedge1; i++) map1[i] = -1;
   
+  /* get the info for the edges in body2 once -- bbox, tolerance, length
+     and number of nodes (-1 for degenerate) */
+  int       *nnod2 = (int *)    EG_alloc(nedge2*sizeof(int));
+  double    *info2 = (double *) EG_alloc(8*nedge2*sizeof(double));
+  if ((nnod2 == NULL) || (info2 == NULL)) {
+    if (nnod2 != NULL) EG_free(nnod2);
+    if (info2 != NULL) EG_free(info2);
+    EG_free(map1);
+    return EGADS_MALLOC;
+  }
+  for (j = 0; j < nedge2; j++) {
+    TopTools_IndexedMapOfShape nmap2;
+    TopoDS_Shape shape2 = pbod2->edges.map(j+1);
+    TopoDS_Edge  edge2  = TopoDS::Edge(shape2);
+    nnod2[j] = -1;
+    if (BRep_Tool::Degenerated(edge2)) continue;
+    TopExp::MapShapes(shape2, TopAbs_VERTEX, nmap2);
+    nnod2[j]     = nmap2.Extent();
+    EG_edgeBBox(edge2, &info2[8*j]);
+    info2[8*j+6] = BRep_Tool::Tolerance(edge2);
+    info2[8*j+7] = -1.0;                  /* length is filled when needed */
+  }
+  
   /* check each edge in body1 against all of body2 */
   for (i = 0; i < nedge1; i++) {
     TopTools_IndexedMapOfShape nmap1;
@@ -1361,14 +1406,23 @@ EG_matchBodyEdges(const egObject *body1, const egObject *body2, double toler,
     TopExp::MapShapes(shape1, TopAbs_VERTEX, nmap1);
     
     for (j = 0; j < nedge2; j++) {
+      if (nnod2[j] < 0) continue;
+      
+      /* cheap rejection on the bounding boxes before looking at the
+         topology (same test as below) */
+      etol = info2[8*j+6];
+      if (etol < etol1) etol = etol1;
+      if (toler != 0.0) etol = toler;
+      if (fabs(info2[8*j  ]-ebx1[0]) > etol) continue;
+      if (fabs(info2[8*j+3]-ebx1[3]) > etol) continue;
+      if (nmap1.Extent() != nnod2[j]) continue;
+
       TopTools_IndexedMapOfShape nmap2;
       TopoDS_Shape shape2 = pbod2->edges.map(j+1);
       TopoDS_Edge  edge2  = TopoDS::Edge(shape2);
-      if (BRep_Tool::Degenerated(edge2)) continue;
       
       /* nodes */
       TopExp::MapShapes(shape2, TopAbs_VERTEX, nmap2);
-      if (nmap1.Extent() != nmap2.Extent()) continue;
       if (outLevel > 1)
         printf(" EGADS Info: Edges %d and %d pass #Nodes check!\n",
                i+1, j+1);
@@ -1395,11 +1449,7 @@ EG_matchBodyEdges(const egObject *body1, const egObject *body2, double toler,
       if (outLevel > 1)
         printf(" EGADS Info: Edge %d and %d pass  Node  check!\n", i+1, j+1);
       
-      etol = BRep_Tool::Tolerance(edge2);
-      if (etol < etol1) etol = etol1;
-      if (toler != 0.0) etol = toler;
-      BProps.LinearProperties(edge2, SProps2);
-      EG_edgeBBox(edge2, ebx2);
+      for (k = 0; k < 6; k++) ebx2[k] = info2[8*j+k];
       double ll = sqrt((ebx2[0]-ebx1[0])*(ebx2[0]-ebx1[0]) +
                        (ebx2[1]-ebx1[1])*(ebx2[1]-ebx1[1]) +
                        (ebx2[2]-ebx1[2])*(ebx2[2]-ebx1[2]));
@@ -1407,7 +1457,11 @@ EG_matchBodyEdges(const egObject *body1, const egObject *body2, double toler,
                        (ebx2[4]-ebx1[4])*(ebx2[4]-ebx1[4]) +
                        (ebx2[5]-ebx1[5])*(ebx2[5]-ebx1[5]));
       if ((ll > etol) || (ur > etol)) continue;
-      if (fabs(SProps1.Mass()-SProps2.Mass()) > etol) continue;
+      if (info2[8*j+7] < 0.0) {
+        BProps.LinearProperties(edge2, SProps2);
+        info2[8*j+7] = SProps2.Mass();
+      }
+      if (fabs(SProps1.Mass()-info2[8*j+7]) > etol) continue;
       if (outLevel > 1)
         printf(" EGADS Info: Edges %d and %d pass  Edge  checks!\n", i+1, j+1);
       
@@ -1415,6 +1469,8 @@ EG_matchBodyEdges(const egObject *body1, const egObject *body2, double toler,
       break;
     }
   }
+  EG_free(info2);
+  EG_free(nnod2);
   
   /* collect the results and return */
   for (n = i = 0; i < nedge1; i++)
@@ -1473,6 +1529,26 @@ EG_matchBodyFaces(const egObject *body1, const egObject *body2, double toler,
   if (map1 == NULL) return EGADS_MALLOC;
   for (i = 0; i < nface1; i++) map1[i] = -1;
   
+  /* get the info for the faces in body2 once -- number of loops and
+     nodes, the bbox of the nodes and the largest node tolerance */
+  int       *nlp2  = (int *)    EG_alloc(2*nface2*sizeof(int));
+  double    *info2 = (double *) EG_alloc(7*nface2*sizeof(double));
+  if ((nlp2 == NULL) || (info2 == NULL)) {
+    if (nlp2  != NULL) EG_free(nlp2);
+    if (info2 != NULL) EG_free(info2);
+    EG_free(map1);
+    return EGADS_MALLOC;
+  }
+  for (j = 0; j < nface2; j++) {
+    TopTools_IndexedMapOfShape nmap2, lmap2;
+    TopoDS_Shape shape2 = pbod2->faces.map(j+1);
+    TopExp::MapShapes(shape2, TopAbs_VERTEX, nmap2);
+    TopExp::MapShapes(shape2, TopAbs_WIRE,   lmap2);
+    nlp2[2*j  ] = lmap2.Extent();
+    nlp2[2*j+1] = nmap2.Extent();
+    EG_nodeBBox(nmap2, &info2[7*j]);
+  }
+  
   /* check each face in body1 against all of body2 */
   for (i = 0; i < nface1; i++) {
     TopTools_IndexedMapOfShape nmap1, emap1, lmap1;
@@ -1481,6 +1557,8 @@ EG_matchBodyFaces(const egObject *body1, const egObject *body2, double toler,
     TopExp::MapShapes(shape1, TopAbs_VERTEX, nmap1);
     TopExp::MapShapes(shape1, TopAbs_EDGE,   emap1);
     TopExp::MapShapes(shape1, TopAbs_WIRE,   lmap1);
+    double nbx1[7];
+    EG_nodeBBox(nmap1, nbx1);
 #ifdef BBOX
     double ftol1        = BRep_Tool::Tolerance(face1);
     Bnd_Box fbox1;
@@ -1490,6 +1568,21 @@ EG_matchBodyFaces(const egObject *body1, const egObject *body2, double toler,
 #endif
 
     for (j = 0; j < nface2; j++) {
+      /* cheap rejection before looking at the topology -- the Node check
+         below needs at least one pair of Nodes within tolerance, so the
+         Node bboxes (grown by the tolerance) must overlap */
+      if (lmap1.Extent() != nlp2[2*j  ]) continue;
+      if (nmap1.Extent() != nlp2[2*j+1]) continue;
+      if (nlp2[2*j+1] > 0) {
+        double ntol = info2[7*j+6];
+        if (ntol < nbx1[6]) ntol = nbx1[6];
+        if (toler != 0.0)   ntol = toler;
+        for (k = 0; k < 3; k++)
+          if ((info2[7*j+k  ] > nbx1[k+3]+ntol) ||
+              (info2[7*j+k+3] < nbx1[k  ]-ntol)) break;
+        if (k != 3) continue;
+      }
+
       TopTools_IndexedMapOfShape nmap2, emap2, lmap2;
       TopoDS_Shape shape2 = pbod2->faces.map(j+1);
       TopoDS_Face  face2  = TopoDS::Face(shape2);
@@ -1611,6 +1704,8 @@ EG_matchBodyFaces(const egObject *body1, const egObject *body2, double toler,
       break;
     }
   }
+  EG_free(info2);
+  EG_free(nlp2);
   
   /* collect the results and return */
   for (n = i = 0; i < nface1; i++)
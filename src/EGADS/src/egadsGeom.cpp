@@ -15,6 +15,7 @@
 #include "egadsTypes.h"
 #include "egadsInternals.h"
 #include "egadsClasses.h"
+#include "emp.h"
 #define TEMPLATE template<class TT>
 #define DOUBLE TT
 #define CROSS(a,b,c)       a[0] = (b[1]*c[2]) - (b[2]*c[1]);\
@@ -25,6 +26,8 @@
 
 #define PARAMACC 1.0e-4         // parameter accuracy
 #define KNACC    1.0e-12	// knot accuracy
+#define NSEED    16             // seed grid size (per direction) for invEvals
+#define INVCHUNK 64             // points per thread request in invEvals
 
 /* OCC can change p-curves through transformations...
  * so sensitivities for p-curves is optional for now.
@@ -108,6 +111,11 @@
                                   double *param, double *result );
   extern "C" int  EG_invEvaluateGuess( const egObject *geom, double *xyz,
                                        double *param, double *result );
+  extern "C" int  EG_invEvaluateMany( const egObject *geom, int npts,
+                                      const double *xyz,
+                                      /*@null@*/ const double *guess,
+                                      double *params,
+                                      /*@null@*/ double *results );
   extern "C" int  EG_arcLength( const egObject *geom, double t1, double t2,
                                 double *alen );
   extern "C" int  EG_approximate( egObject *context, int maxdeg, double tol,
@@ -6229,6 +6237,270 @@ EG_invEvaluateGuess(const egObject *geom, double *xyz,
 }
 
 
+typedef struct {
+  void           *mutex;        // the mutex or NULL for single thread
+  long           master;        // master thread ID
+  int            end;           // end of loop
+  int            index;         // current loop index
+  int            stat;          // first error -- stops the dispatch
+  int            nparam;        // 1 -- curves & Edges, 2 -- surfaces & Faces
+  int            ndim;          // 2 -- PCurves, 3 -- all others
+  int            nseed;         // number of seed samples
+  double         range[4];      // parameter limits for the guesses
+  const double   *seeds;        // seed parameters then coordinates (or NULL)
+  const double   *xyz;          // the points to project
+  const double   *guess;        // the starting parameters (or NULL)
+  double         *params;       // the returned parameters
+  double         *results;      // the returned closest points (or NULL)
+  const egObject *geom;         // the object to project onto
+} EMPinvEval;
+
+
+static int
+EG_invEvalPoint(EMPinvEval *inv, int i)
+{
+  int    j, k, stat, nparam, ndim;
+  double d, dist, pnt[3], *param, result[3];
+
+  dist   = -1.0;
+  nparam = inv->nparam;
+  ndim   = inv->ndim;
+  param  = &inv->params[nparam*i];
+  for (j = 0; j < ndim; j++) pnt[j] = inv->xyz[ndim*i+j];
+
+  // get the starting parameters -- given or nearest seed sample
+  if (inv->guess != NULL) {
+    for (j = 0; j < nparam; j++) param[j] = inv->guess[nparam*i+j];
+  } else if (inv->seeds != NULL) {
+    dist = 1.e308;
+    for (k = 0; k < inv->nseed; k++) {
+      const double *sxyz = &inv->seeds[nparam*inv->nseed + ndim*k];
+      for (d = 0.0, j = 0; j < ndim; j++)
+        d += (pnt[j]-sxyz[j])*(pnt[j]-sxyz[j]);
+      if (d >= dist) continue;
+      dist = d;
+      for (j = 0; j < nparam; j++) param[j] = inv->seeds[nparam*k+j];
+    }
+  } else {
+    stat = EG_invEvaluate(inv->geom, pnt, param, result);
+    if ((stat == EGADS_SUCCESS) && (inv->results != NULL))
+      for (j = 0; j < ndim; j++) inv->results[ndim*i+j] = result[j];
+    return stat;
+  }
+
+  // warm-started Newton -- fall back to the full projection if it fails,
+  // leaves the range, ends up farther away than the nearest seed sample
+  // (a poorer local minimum) or lands outside the trimmed Face
+  stat = EG_invEvaluateGuess(inv->geom, pnt, param, result);
+  if (stat == EGADS_SUCCESS)
+    if ((param[0] < inv->range[0]-PARAMACC) ||
+        (param[0] > inv->range[1]+PARAMACC) ||
+        ((nparam == 2) && ((param[1] < inv->range[2]-PARAMACC) ||
+                           (param[1] > inv->range[3]+PARAMACC))))
+      stat = EGADS_RANGERR;
+  if ((stat == EGADS_SUCCESS) && (dist >= 0.0)) {
+    for (j = 0; j < ndim; j++) pnt[j] = inv->xyz[ndim*i+j];
+    for (d = 0.0, j = 0; j < ndim; j++)
+      d += (pnt[j]-result[j])*(pnt[j]-result[j]);
+    if (d > dist) stat = EGADS_NOTFOUND;
+  }
+  if ((stat == EGADS_SUCCESS) && (inv->geom->oclass == FACE))
+    stat = EG_inFaceX(inv->geom, param, NULL, NULL);
+  if (stat != EGADS_SUCCESS) {
+    for (j = 0; j < ndim; j++) pnt[j] = inv->xyz[ndim*i+j];
+    stat = EG_invEvaluate(inv->geom, pnt, param, result);
+  }
+  if ((stat == EGADS_SUCCESS) && (inv->results != NULL))
+    for (j = 0; j < ndim; j++) inv->results[ndim*i+j] = result[j];
+
+  return stat;
+}
+
+
+static void
+EG_invEvalThread(void *struc)
+{
+  int        i, index, end, stat;
+  long       ID;
+  EMPinvEval *inv;
+
+  inv = (EMPinvEval *) struc;
+
+  // get our identifier
+  ID = EMP_ThreadID();
+
+  // look for work
+  for (;;) {
+
+    // only one thread at a time here -- controlled by a mutex!
+    if (inv->mutex != NULL) EMP_LockSet(inv->mutex);
+    index = inv->index;
+    if (inv->stat != EGADS_SUCCESS) index = inv->end;
+    inv->index = index + INVCHUNK;
+    if (inv->mutex != NULL) EMP_LockRelease(inv->mutex);
+    if (index >= inv->end) break;
+
+    // do the work -- a chunk of points at a time
+    end = index + INVCHUNK;
+    if (end > inv->end) end = inv->end;
+    for (i = index; i < end; i++) {
+      stat = EG_invEvalPoint(inv, i);
+      if (stat == EGADS_SUCCESS) continue;
+      if (inv->mutex != NULL) EMP_LockSet(inv->mutex);
+      if (inv->stat == EGADS_SUCCESS) inv->stat = stat;
+      if (inv->mutex != NULL) EMP_LockRelease(inv->mutex);
+      break;
+    }
+  }
+
+  // exhausted all work -- exit
+  if (ID != inv->master) EMP_ThreadExit();
+}
+
+
+int
+EG_invEvaluateMany(const egObject *geom, int npts, const double *xyz,
+                   /*@null@*/ const double *guess, double *params,
+                   /*@null@*/ double *results)
+{
+  int        i, j, k, n, stat, per, outLevel, np;
+  long       start;
+  double     result[18], *seeds = NULL;
+  void       **threads = NULL;
+  EMPinvEval inv;
+
+  if  (geom == NULL)               return EGADS_NULLOBJ;
+  if  (geom->magicnumber != MAGIC) return EGADS_NOTOBJ;
+  if ((geom->oclass != PCURVE) &&
+      (geom->oclass != CURVE)  && (geom->oclass != SURFACE) &&
+      (geom->oclass != EDGE)   && (geom->oclass != FACE))
+                                   return EGADS_NOTGEOM;
+  if (geom->blind == NULL)         return EGADS_NODATA;
+  if (npts <= 0)                   return EGADS_RANGERR;
+  if ((xyz == NULL) || (params == NULL)) return EGADS_NODATA;
+  if ((geom->oclass == EDGE) && (geom->mtype == DEGENERATE))
+                                   return EGADS_DEGEN;
+  outLevel = EG_outLevel(geom);
+
+  inv.mutex   = NULL;
+  inv.master  = EMP_ThreadID();
+  inv.end     = npts;
+  inv.index   = 0;
+  inv.stat    = EGADS_SUCCESS;
+  inv.nparam  = 1;
+  inv.ndim    = 3;
+  inv.nseed   = 0;
+  inv.seeds   = NULL;
+  inv.xyz     = xyz;
+  inv.guess   = guess;
+  inv.params  = params;
+  inv.results = results;
+  inv.geom    = geom;
+  if ((geom->oclass == SURFACE) || (geom->oclass == FACE)) inv.nparam = 2;
+  if  (geom->oclass == PCURVE) inv.ndim = 2;
+
+  stat = EG_getRange(geom, inv.range, &per);
+  if (stat != EGADS_SUCCESS) {
+    if (outLevel > 0)
+      printf(" EGADS Warning: getRange = %d (EG_invEvaluateMany)!\n", stat);
+    return stat;
+  }
+
+  // sample the object to seed the Newton iterations (bounded only) --
+  // note that a seeded or guessed point is the foot nearest its start, so
+  // where several local minima lie within a sample spacing the answer can
+  // differ from the global search done by EG_invEvaluate
+  if (guess == NULL) {
+    n = NSEED;
+    if (inv.nparam == 1) n = NSEED*NSEED;
+    for (j = 0; j < 2*inv.nparam; j++)
+      if (fabs(inv.range[j]) > 1.e20) n = 0;
+    k = n;
+    if (inv.nparam == 2) k = n*n;
+    if (k != 0)
+      seeds = (double *) EG_alloc((inv.nparam+inv.ndim)*k*sizeof(double));
+    if (seeds != NULL) {
+      inv.nseed = k;
+      for (k = 0; k < inv.nseed; k++) {
+        if (inv.nparam == 1) {
+          seeds[k]     = inv.range[0] + (k+0.5)*(inv.range[1]-inv.range[0])/n;
+        } else {
+          i            = k/n;
+          j            = k%n;
+          seeds[2*k  ] = inv.range[0] + (i+0.5)*(inv.range[1]-inv.range[0])/n;
+          seeds[2*k+1] = inv.range[2] + (j+0.5)*(inv.range[3]-inv.range[2])/n;
+        }
+        stat = EG_evaluate(geom, &seeds[inv.nparam*k], result);
+        if (stat != EGADS_SUCCESS) {
+          if (outLevel > 1)
+            printf(" EGADS Info: seed evaluate = %d (EG_invEvaluateMany)!\n",
+                   stat);
+          EG_free(seeds);
+          seeds     = NULL;
+          inv.nseed = 0;
+          break;
+        }
+        for (j = 0; j < inv.ndim; j++)
+          seeds[inv.nparam*inv.nseed + inv.ndim*k + j] = result[j];
+      }
+    }
+    inv.seeds = seeds;
+  }
+
+  // project the points
+  np = EMP_Init(&start);
+  if (np > (npts+INVCHUNK-1)/INVCHUNK) np = (npts+INVCHUNK-1)/INVCHUNK;
+  if (np > 1) {
+    // create the mutex to handle list synchronization
+    inv.mutex = EMP_LockCreate();
+    if (inv.mutex == NULL) {
+      printf(" EMP Error: mutex creation = NULL!\n");
+      np = 1;
+    } else {
+      // get storage for our extra threads
+      threads = (void **) malloc((np-1)*sizeof(void *));
+      if (threads == NULL) {
+        EMP_LockDestroy(inv.mutex);
+        inv.mutex = NULL;
+        np = 1;
+      }
+    }
+  }
+
+  // create the threads and get going!
+  if (threads != NULL)
+    for (i = 0; i < np-1; i++) {
+      threads[i] = EMP_ThreadCreate(EG_invEvalThread, &inv);
+      if (threads[i] == NULL)
+        printf(" EMP Error Creating Thread #%d!\n", i+1);
+    }
+  // now run the thread block from the original thread
+  EG_invEvalThread(&inv);
+
+  // wait for all others to return
+  if (threads != NULL)
+    for (i = 0; i < np-1; i++)
+      if (threads[i] != NULL) EMP_ThreadWait(threads[i]);
+
+  // thread cleanup
+  if (threads != NULL)
+    for (i = 0; i < np-1; i++)
+      if (threads[i] != NULL) EMP_ThreadDestroy(threads[i]);
+  if (inv.mutex != NULL) EMP_LockDestroy(inv.mutex);
+  if (threads != NULL) free(threads);
+  if (outLevel > 1)
+    printf(" EMP Number of Seconds on invEval Thread Block = %ld\n",
+           EMP_Done(&start));
+
+  if (seeds != NULL) EG_free(seeds);
+  if ((inv.stat != EGADS_SUCCESS) && (outLevel > 0))
+    printf(" EGADS Warning: invEvaluate = %d (EG_invEvaluateMany)!\n",
+           inv.stat);
+
+  return inv.stat;
+}
+
+
 int
 EG_arcLength(const egObject *geom, double t1, double t2, double *alen)
 {
@@ -16,6 +16,7 @@
 #include "egadsTypes.h"
 #include "egadsInternals.h"
 #include "egadsStack.h"
+#include "emp.h"
 
 
 //#define DEBUG
@@ -75,6 +76,21 @@
     egObject **ents;
   } splitEnts;
 
+  /* structure to pass data to the thread for the Face splitting block */
+  typedef struct {
+    void      *mutex;           /* the mutex or NULL for single thread */
+    void      *lock;            /* serializes Object creation in the context */
+    long      master;           /* master thread ID */
+    int       end;              /* end of loop */
+    int       index;            /* current loop index */
+    int       status;           /* first non-success status */
+    int       *eface;           /* first segment in each Face (-1 no split) */
+    egObject  *context;         /* the context */
+    edgeInfo  *fe;              /* the segment info */
+    splitEnts *sFaces;          /* the split Faces -- indexed by Face */
+    objStack  *stack;           /* the cleanup stack */
+  } EMPsplit;
+
 
   extern int  EG_getBody( const egObject *obj, egObject **body );
   extern int  EG_outLevel( const egObject *object );
@@ -104,6 +120,7 @@
   extern int  EG_getRange( const egObject *geom, double *range, int *pflg );
   extern int  EG_getUVinfo( egObject *face, egObject *loop, double *box,
                             double *area );
+  extern int  EG_updateThread( egObject *context );
 #ifdef WRITERESULT
   extern int  EG_saveModel( const egObject *model, const char *name );
   extern int  EG_copyObject( const egObject *object, /*@null@*/ void *ptr,
@@ -144,6 +161,27 @@ EG_splitFree(int num, splitEnts **splits)
 }
 
 
+/* Object creation is only allowed from the thread that owns the context --
+   the Face splitting threads take turns owning it under a lock */
+
+static void
+EG_splitLock(egObject *context, /*@null@*/ void *lock)
+{
+  if (lock == NULL) return;
+  EMP_LockSet(lock);
+  EG_updateThread(context);
+}
+
+
+static void
+EG_splitUnlock(/*@null@*/ void *lock)
+{
+  if (lock != NULL) EMP_LockRelease(lock);
+}
+
+
+/* each index is only touched by the thread that splits that entity */
+
 static int
 EG_splitAlloc(int index, splitEnts *splits, int num)
 {
@@ -374,9 +412,9 @@ EG_adjustPeriod(double *param, double *srange, int sper)
 }
 
 static int
-EG_traceLoops(egObject *context, const egObject *face, int nEdges,
-              egObject **edges, int *senses, /*@null@*/ egObject **pcurves,
-              int *nLoops, egObject ***loops)
+EG_traceLoops(egObject *context, /*@null@*/ void *lock, const egObject *face,
+              int nEdges, egObject **edges, int *senses,
+              /*@null@*/ egObject **pcurves, int *nLoops, egObject ***loops)
 {
   int      i, n, cnt, oclass, mtype, stat, fsense, outLevel, first, next, nNode;
   int      j0, j1, sper, *sens, *sen, *ints;
@@ -801,6 +839,7 @@ EG_traceLoops(egObject *context, const egObject *face, int nEdges,
     printf(" EG_traceLoops: making %d Loop w/ %d of %d Edges!\n",
            *nLoops+1, n, nEdges);
 #endif
+    EG_splitLock(context, lock);
     if (pcurves != NULL) {
       for (i = 0; i < n; i++) objs[i+n] = objs[i+nEdges];
       stat = EG_makeTopology(context, surf, LOOP, CLOSED, NULL, n, objs, sens,
@@ -809,6 +848,7 @@ EG_traceLoops(egObject *context, const egObject *face, int nEdges,
       stat = EG_makeTopology(context, NULL, LOOP, CLOSED, NULL, n, objs, sens,
                              &list[*nLoops]);
     }
+    EG_splitUnlock(lock);
     if (stat != EGADS_SUCCESS) {
       printf(" EGADS Error: makeTopology %d = %d (EG_traceLoops)!\n",
              *nLoops+1, stat);
@@ -834,9 +874,12 @@ EG_traceLoops(egObject *context, const egObject *face, int nEdges,
 bail:
   if (stat != EGADS_SUCCESS) {
     list = *loops;
-    if (list != NULL)
+    if (list != NULL) {
+      EG_splitLock(context, lock);
       for (i = 0; i < *nLoops; i++)
         EG_deleteObject(list[i]);
+      EG_splitUnlock(lock);
+    }
     if (*loops != NULL) EG_free(*loops);
     *loops  = NULL;
     *nLoops = 0;
@@ -905,11 +948,11 @@ EG_cutDegenerate(int iSeg, edgeInfo *fe, egObject *edge)
 
 
 static int
-EG_splitFace(egObject *context, int iFace, int iSeg, edgeInfo *fe,
-             /*@unused@*/ splitEnts *sFaces, objStack *stack)
+EG_splitFace(egObject *context, /*@null@*/ void *lock, int iFace, int iSeg,
+             edgeInfo *fe, splitEnts *sFaces, objStack *stack)
 {
   int       i, j, k, m, n, stat, oclass, mtype, nLoop, nEdge, fsense, nFace, ol;
-  int       nDegen, iper, *sens, *senses, *mark;
+  int       nDegen, iper, i1, *sens, *senses, *mark;
   double    t, tol, toler, area, oarea;
   double    uvbox[4], box[4], obox[4], uvs[6], d[2], trang[2], trange[2];
   egObject  *ref, *surf, *pcurve, *face, **objs, **edges, **pcurves, **loops;
@@ -1109,12 +1152,15 @@ EG_splitFace(egObject *context, int iFace, int iSeg, edgeInfo *fe,
     }
     if ((pcurves != NULL) && (pcurve == NULL)) {
       toler = tol;
+      EG_splitLock(context, lock);
       ol    = EG_outLevel(context);
       EG_setOutLevel(context, 0);
       for (i = 0; i < 5; i++) {
         stat = EG_otherCurve(surf, fe[j].ent, toler, &pcurve);
         if (stat == EGADS_SUCCESS) break;
         if (stat != EGADS_CONSTERR) {
+          EG_setOutLevel(context, ol);
+          EG_splitUnlock(lock);
           printf(" EGADS Internal: Face %d -- EG_otherCurve = %d with tol = %le %d!\n",
                  iFace+1, stat, toler, i);
           if (pcurves != NULL) EG_free(pcurves);
@@ -1129,6 +1175,8 @@ EG_splitFace(egObject *context, int iFace, int iSeg, edgeInfo *fe,
         toler *= 10.0;
       }
       if (i == 5) {
+        EG_setOutLevel(context, ol);
+        EG_splitUnlock(lock);
         printf(" EGADS Internal: Face %d -- Cannot create PCurve!\n", iFace+1);
         if (pcurves != NULL) EG_free(pcurves);
         EG_free(senses);
@@ -1137,15 +1185,14 @@ EG_splitFace(egObject *context, int iFace, int iSeg, edgeInfo *fe,
         return stat;
       }
       EG_setOutLevel(context, ol);
-      if (pcurve != NULL) {
-        stat = EG_stackPush(stack, pcurve);
-        if (stat != EGADS_SUCCESS) {
-          if (pcurves != NULL) EG_free(pcurves);
-          EG_free(senses);
-          EG_free(edges);
-          EG_free(degenCnt);
-          return stat;
-        }
+      if (pcurve != NULL) stat = EG_stackPush(stack, pcurve);
+      EG_splitUnlock(lock);
+      if (stat != EGADS_SUCCESS) {
+        if (pcurves != NULL) EG_free(pcurves);
+        EG_free(senses);
+        EG_free(edges);
+        EG_free(degenCnt);
+        return stat;
       }
       pcurves[nEdge  ] = pcurve;
       pcurves[nEdge+1] = pcurve;
@@ -1270,9 +1317,23 @@ EG_splitFace(egObject *context, int iFace, int iSeg, edgeInfo *fe,
       for (j = 0; j < degenCnt[k].cnt-1; j++) {
         d[0] = degenCnt[k].ts[j];
         d[1] = degenCnt[k].ts[j+1];
+        EG_splitLock(context, lock);
         stat = EG_makeTopology(context, NULL, EDGE, DEGENERATE, d, 1,
                                &degenCnt[k].node, NULL, &ref);
-        if (stat != EGADS_SUCCESS) {
+        if (stat == EGADS_SUCCESS) {
+          stat = EG_stackPush(stack, ref);
+          EG_splitUnlock(lock);
+          if (stat != EGADS_SUCCESS) {
+            printf(" EGADS Error: Face %d -- EG_stackPush = %d Degen Edge!\n",
+                   iFace+1, stat);
+            if (pcurves != NULL) EG_free(pcurves);
+            EG_free(senses);
+            EG_free(edges);
+            EG_free(degenCnt);
+            return stat;
+          }
+        } else {
+          EG_splitUnlock(lock);
           printf(" EGADS Error: Face %d -- EG_makeTopology = %d Degen Edge!\n",
                  iFace+1, stat);
           if (pcurves != NULL) EG_free(pcurves);
@@ -1281,16 +1342,6 @@ EG_splitFace(egObject *context, int iFace, int iSeg, edgeInfo *fe,
           EG_free(degenCnt);
           return stat;
         }
-        stat = EG_stackPush(stack, ref);
-        if (stat != EGADS_SUCCESS) {
-          printf(" EGADS Error: Face %d -- EG_stackPush = %d Degen Edge!\n",
-                 iFace+1, stat);
-          if (pcurves != NULL) EG_free(pcurves);
-          EG_free(senses);
-          EG_free(edges);
-          EG_free(degenCnt);
-          return stat;
-        }
         edges[nEdge]  = ref;
         senses[nEdge] = degenCnt[k].sense;
         if (pcurves != NULL) pcurves[nEdge] = degenCnt[k].pcurve;
@@ -1300,8 +1351,8 @@ EG_splitFace(egObject *context, int iFace, int iSeg, edgeInfo *fe,
   }
   if (degenCnt != NULL) EG_free(degenCnt);
   
-  stat = EG_traceLoops(context, fe[iSeg].face, nEdge, edges, senses, pcurves,
-                       &nLoop, &loops);
+  stat = EG_traceLoops(context, lock, fe[iSeg].face, nEdge, edges, senses,
+                       pcurves, &nLoop, &loops);
 #ifdef DEBUG
   printf(" EGADS Info: traceLoops = %d, returns %d loops!\n", stat, nLoop);
 #endif
@@ -1312,8 +1363,10 @@ EG_splitFace(egObject *context, int iFace, int iSeg, edgeInfo *fe,
     if (mark == NULL) {
       printf(" EGADS Error: Face %d -- Malloc of %d Loop Table!\n",
              iFace+1, nLoop);
+      EG_splitLock(context, lock);
       for (i = 0; i < nLoop; i++)
         EG_deleteObject(loops[i]);
+      EG_splitUnlock(lock);
       EG_free(loops);
       if (pcurves != NULL) EG_free(pcurves);
       EG_free(senses);
@@ -1324,11 +1377,15 @@ EG_splitFace(egObject *context, int iFace, int iSeg, edgeInfo *fe,
     for (nFace = i = 0; i < nLoop; i++) {
       
       /* put the loops on the stack for cleanup later */
+      EG_splitLock(context, lock);
       stat = EG_stackPush(stack, loops[i]);
+      EG_splitUnlock(lock);
       if (stat != EGADS_SUCCESS) {
         printf(" EGADS Error: Face %d -- EG_stackPush from Loop %d = %d!\n",
                iFace+1, stat, i+1);
+        EG_splitLock(context, lock);
         for (j = i; j < nLoop; j++) EG_deleteObject(loops[j]);
+        EG_splitUnlock(lock);
         EG_free(mark);
         EG_free(loops);
         if (pcurves != NULL) EG_free(pcurves);
@@ -1341,7 +1398,9 @@ EG_splitFace(egObject *context, int iFace, int iSeg, edgeInfo *fe,
       if (stat != EGADS_SUCCESS) {
         printf(" EGADS Error: Face %d -- EG_getUVinfo from Loop %d = %d!\n",
                iFace+1, i+1, stat);
+        EG_splitLock(context, lock);
         for (j = i+1; j < nLoop; j++) EG_deleteObject(loops[j]);
+        EG_splitUnlock(lock);
         EG_free(mark);
         EG_free(loops);
         if (pcurves != NULL) EG_free(pcurves);
@@ -1438,6 +1497,7 @@ EG_splitFace(egObject *context, int iFace, int iSeg, edgeInfo *fe,
           k++;
         }
       /* make the Face -- first try without paying attention to PCurves */
+      EG_splitLock(context, lock);
       ol   = EG_outLevel(context);
       EG_setOutLevel(context, 0);
       stat = EG_makeTopology(context, surf, FACE, PCURVE*fsense, NULL,
@@ -1446,6 +1506,11 @@ EG_splitFace(egObject *context, int iFace, int iSeg, edgeInfo *fe,
       if (stat == EGADS_CONSTERR)
         stat = EG_makeTopology(context, surf, FACE, fsense, NULL,
                                k, objs, sens, &face);
+      if (stat == EGADS_SUCCESS) {
+        i1   = EG_stackPush(stack, face);
+        if (i1 == EGADS_SUCCESS) EG_attributeDup(fe[iSeg].face, face);
+      }
+      EG_splitUnlock(lock);
 #ifdef DEBUG
       EG_tolerance(face, &t);
       printf(" %d: newFace (%d Loops) status = %d  toler = %le\n",
@@ -1463,8 +1528,8 @@ EG_splitFace(egObject *context, int iFace, int iSeg, edgeInfo *fe,
         EG_free(edges);
         return stat;
       }
-      stat = EG_stackPush(stack, face);
-      if (stat != EGADS_SUCCESS) {
+      if (i1 != EGADS_SUCCESS) {
+        stat = i1;
         printf(" EGADS Error: Face %d -- subFace %d pushStack = %d\n",
                iFace+1, i+1, stat);
         EG_free(sens);
@@ -1476,7 +1541,6 @@ EG_splitFace(egObject *context, int iFace, int iSeg, edgeInfo *fe,
         EG_free(edges);
         return stat;
       }
-      EG_attributeDup(fe[iSeg].face, face);
       sFaces[iFace].ents[i] = face;
     }
     
@@ -1493,13 +1557,58 @@ EG_splitFace(egObject *context, int iFace, int iSeg, edgeInfo *fe,
 }
 
 
+static void
+EG_splitThread(void *struc)
+{
+  int      index, stat;
+  long     ID;
+  EMPsplit *sthread;
+  
+  sthread = (EMPsplit *) struc;
+  
+  /* get our identifier */
+  ID = EMP_ThreadID();
+  
+  /* look for work */
+  for (;;) {
+    
+    /* only one thread at a time here -- controlled by a mutex! */
+    if (sthread->mutex != NULL) EMP_LockSet(sthread->mutex);
+    for (index = sthread->index; index < sthread->end; index++)
+      if (sthread->eface[index] != -1) break;
+    if (sthread->status != EGADS_SUCCESS) index = sthread->end;
+    sthread->index = index+1;
+    if (sthread->mutex != NULL) EMP_LockRelease(sthread->mutex);
+    if (index >= sthread->end) break;
+    
+    /* do the work */
+    stat = EG_splitFace(sthread->context, sthread->lock, index,
+                        sthread->eface[index], sthread->fe, sthread->sFaces,
+                        sthread->stack);
+#ifdef DEBUG
+    printf(" EG_splitFace %d = %d\n", index+1, stat);
+#endif
+    if (stat != EGADS_SUCCESS) {
+      if (sthread->mutex != NULL) EMP_LockSet(sthread->mutex);
+      if (sthread->status == EGADS_SUCCESS) sthread->status = stat;
+      if (sthread->mutex != NULL) EMP_LockRelease(sthread->mutex);
+    }
+  }
+  
+  /* exhausted all work -- exit */
+  if (ID != sthread->master) EMP_ThreadExit();
+}
+
+
 int
 EG_splitBody(const egObject *body, int nseg, const egObject **facEdg,
              egObject **result)
 {
   int       i, j, jj, k, kk, l, m, n, *senses, *sen, *newSen, *eface = NULL;
   int       oclass, mtype, oc, mt, len, per, outLevel, status = EGADS_SUCCESS;
-  int        nnodes,  nedges,  nfaces,  nshells;
+  int        nnodes,  nedges,  nfaces,  nshells, np, nsplit;
+  long      start;
+  void      **threads = NULL;
   egObject  **nodes, **edges, **faces, **shells, **newObjs, **newFaces;
   egObject  *context, *ref, *lnodes[2], **children, **dum, **objs, *geom, *obj;
   egObject  *newBody;
@@ -1508,6 +1617,7 @@ EG_splitBody(const egObject *body, int nseg, const egObject **facEdg,
   edgeInfo  *fe;
   objStack  stack;
   splitEnts *sEdges = NULL, *sFaces = NULL;
+  EMPsplit  sthread;
 #ifdef WRITERESULT
   egObject    *model;
   static char fname[13] = "body_a.egads";
@@ -2302,17 +2412,79 @@ EG_splitBody(const egObject *body, int nseg, const egObject **facEdg,
   
   EG_splitInit(nfaces, &sFaces);
   if (sFaces == NULL) goto cleanup;
-
-  for (i = 0; i < nfaces; i++) {
-    j = eface[i];
-    if (j == -1) continue;
-    status = EG_splitFace(context, i, j, fe, sFaces, &stack);
-#ifdef DEBUG
-    printf(" EG_splitFace = %d\n", status);
-#endif
-    if (status != EGADS_SUCCESS) goto cleanup;
+  
+  /* set up for explicit multithreading -- the Faces are independent */
+  sthread.mutex   = NULL;
+  sthread.lock    = NULL;
+  sthread.master  = EMP_ThreadID();
+  sthread.index   = 0;
+  sthread.end     = nfaces;
+  sthread.status  = EGADS_SUCCESS;
+  sthread.eface   = eface;
+  sthread.context = context;
+  sthread.fe      = fe;
+  sthread.sFaces  = sFaces;
+  sthread.stack   = &stack;
+  for (nsplit = i = 0; i < nfaces; i++)
+    if (eface[i] != -1) nsplit++;
+  
+  np = EMP_Init(&start);
+  if (np > nsplit) np = nsplit;
+  if (outLevel > 1) printf(" EMP NumProcs = %d!\n", np);
+  
+  if (np > 1) {
+    /* create the mutexes to handle list & context synchronization */
+    sthread.mutex = EMP_LockCreate();
+    sthread.lock  = EMP_LockCreate();
+    if ((sthread.mutex == NULL) || (sthread.lock == NULL)) {
+      printf(" EMP Error: mutex creation = NULL!\n");
+      if (sthread.mutex != NULL) EMP_LockDestroy(sthread.mutex);
+      if (sthread.lock  != NULL) EMP_LockDestroy(sthread.lock);
+      sthread.mutex = sthread.lock = NULL;
+      np = 1;
+    } else {
+      /* get storage for our extra threads */
+      threads = (void **) malloc((np-1)*sizeof(void *));
+      if (threads == NULL) {
+        EMP_LockDestroy(sthread.mutex);
+        EMP_LockDestroy(sthread.lock);
+        sthread.mutex = sthread.lock = NULL;
+        np = 1;
+      }
+    }
   }
   
+  /* create the threads and get going! */
+  if (threads != NULL)
+    for (i = 0; i < np-1; i++) {
+      threads[i] = EMP_ThreadCreate(EG_splitThread, &sthread);
+      if (threads[i] == NULL)
+        printf(" EMP Error Creating Thread #%d!\n", i+1);
+    }
+  /* now run the thread block from the original thread */
+  EG_splitThread(&sthread);
+  
+  /* wait for all others to return */
+  if (threads != NULL)
+    for (i = 0; i < np-1; i++)
+      if (threads[i] != NULL) EMP_ThreadWait(threads[i]);
+  
+  /* cleanup & take back ownership of the context */
+  if (threads != NULL)
+    for (i = 0; i < np-1; i++)
+      if (threads[i] != NULL) EMP_ThreadDestroy(threads[i]);
+  if (sthread.mutex != NULL) EMP_LockDestroy(sthread.mutex);
+  if (sthread.lock  != NULL) EMP_LockDestroy(sthread.lock);
+  if (threads != NULL) free(threads);
+  EG_updateThread(context);
+  if (outLevel > 1)
+    printf(" EMP Number of Seconds on Split Thread Block = %ld\n",
+           EMP_Done(&start));
+  
+  /* the split Faces are stored by Face index -- reassembly is ordered */
+  status = sthread.status;
+  if (status != EGADS_SUCCESS) goto cleanup;
+  
   /* make the new body by rebuilding Shells */
   
   newBody = (egObject *) body;
@@ -10,13 +10,16 @@
  */
 
 #include "egads.h"
+#include "emp.h"
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <math.h>
 
 extern int EG_sameThread( const ego object );
 
-#define EPS 1.E-08
+#define EPS   1.E-08
+#define EPS12 1.E-12
 #define PI  3.1415926535897931159979635
 
 
@@ -65,6 +68,93 @@ OneBasisFun (int p, int m, double U[], int i, double u)
 }
 
 
+/* Computes the p+1 nonvanishing Bspline values at u in span (no allocation)
+   N, left & right should be at least dim = p+1 */
+static void
+BasisFuns(int span, double u, int p, double *U, double *N, double *left,
+          double *right)
+{
+  int    j, r;
+  double saved, temp;
+  
+  N[0] = 1.0;
+  for (j = 1; j <= p; ++j) {
+    left[j]  = u - U[span+1-j];
+    right[j] = U[span+j] - u;
+    saved    = 0.0;
+    for (r = 0; r < j; ++r) {
+      temp  = N[r]/(right[r+1] + left[j-r]);
+      N[r]  = saved + right[r+1]*temp;
+      saved = left[j-r]*temp;
+    }
+    N[j] = saved;
+  }
+}
+
+
+/* LU factorization (in place, no pivoting) of a banded matrix with lower and
+   upper bandwidth p -- row i is stored as Ab[i*(2p+1)+j-i+p] for |j-i| <= p
+   Note: Bspline collocation matrices are totally positive so no pivoting is
+         required when the Schoenberg-Whitney conditions are met */
+static int
+bandFactor(int n, int p, double *Ab)
+{
+  int    i, j, k, w, iend;
+  double piv, fact;
+  
+  w = 2*p + 1;
+  for (k = 0; k < n; k++) {
+    piv = Ab[k*w+p];
+    if (fabs(piv) < EPS12) return EGADS_DEGEN;
+    iend = k + p;
+    if (iend > n-1) iend = n-1;
+    for (i = k+1; i <= iend; i++) {
+      fact = Ab[i*w+k-i+p];
+      if (fact == 0.0) continue;
+      fact /= piv;
+      Ab[i*w+k-i+p] = fact;
+      for (j = k+1; j <= iend; j++) Ab[i*w+j-i+p] -= fact*Ab[k*w+j-k+p];
+    }
+  }
+  
+  return EGADS_SUCCESS;
+}
+
+
+/* solves all nrhs right-hand sides (stored rowwise in B) with the factored
+   banded matrix -- B is overwritten with the solution */
+static void
+bandSolve(int n, int p, const double *Ab, int nrhs, double *B)
+{
+  int    i, j, k, w, jend;
+  double fact;
+  
+  w = 2*p + 1;
+  /* forward elimination (unit lower) */
+  for (i = 1; i < n; i++) {
+    j = i - p;
+    if (j < 0) j = 0;
+    for (; j < i; j++) {
+      fact = Ab[i*w+j-i+p];
+      if (fact == 0.0) continue;
+      for (k = 0; k < nrhs; k++) B[i*nrhs+k] -= fact*B[j*nrhs+k];
+    }
+  }
+  /* back substitution */
+  for (i = n-1; i >= 0; i--) {
+    jend = i + p;
+    if (jend > n-1) jend = n-1;
+    for (j = i+1; j <= jend; j++) {
+      fact = Ab[i*w+j-i+p];
+      if (fact == 0.0) continue;
+      for (k = 0; k < nrhs; k++) B[i*nrhs+k] -= fact*B[j*nrhs+k];
+    }
+    fact = 1.0/Ab[i*w+p];
+    for (k = 0; k < nrhs; k++) B[i*nrhs+k] *= fact;
+  }
+}
+
+
 static int
 matsol(double    A[],           /* (in)  matrix to be solved (stored rowwise) */
                                 /* (out) upper-triangular form of matrix */
@@ -76,7 +166,6 @@ matsol(double    A[],           /* (in)  matrix to be solved (stored rowwise) */
 
   int    ir, jc, kc, imax;
   double amax, swap, fact;
-  double EPS12=1.E-12;
 
   /* --------------------------------------------------------------- */
 
@@ -154,6 +243,20 @@ FindSpan(int n, int p, double u, double *U)
 }
 
 
+/* Are the two knot sequences the same? */
+static int
+sameKnots(int dim1, double *k1, int dim2, double *k2)
+{
+  int i;
+  
+  if (dim1 != dim2) return 0;
+  for (i = 0; i < dim1; i++)
+    if (k1[i] != k2[i]) return 0;
+  
+  return 1;
+}
+
+
 /* Finds the knot multiplicity */
 static int
 getMultiplicity(double *vector, int idx, int size)
@@ -271,7 +374,7 @@ findMissingKnots (int dimUold,   double *Uold, int dimUnew, double *Unew,
       mu_new = getMultiplicity(Unew, j, dimUnew);
       if ( mu_new > mu_old )	{
         for ( k = 0; k < mu_new - mu_old; ++k )	{
-          Udiff[idx] = Unew[k];
+          Udiff[idx] = Unew[j];
           ++idx;
         }
       }
@@ -366,20 +469,146 @@ RefineKnotVectCurve (int n, int p, double *splineData, int r, double *insertKnot
   return EGADS_SUCCESS;
 }
 
+/* structure to pass data to the thread for the section refinement block */
+typedef struct {
+  void   *mutex;              /* the mutex or NULL for single thread */
+  long   master;              /* master thread ID */
+  int    end;                 /* end of loop */
+  int    index;               /* current loop index */
+  int    status;              /* first non-success status */
+  int    degree;              /* the common degree */
+  int    nPts;                /* the number of control points per section */
+  int    dimMerged;           /* the length of the common knot sequence */
+  double *merged;             /* the common knot sequence */
+  int    **splineInfo;        /* the section header data */
+  double **splineData;        /* the section spline data */
+  double *cp;                 /* the resultant control points */
+} EMPskin;
+
+
+/* Makes a single section compatible with the common knot sequence.
+   The control points are placed in cp[c*nPts*3] which is only touched here */
+static int
+compatSection(int c, int deg, int nPts, int dimMerged, double *merged,
+              int *info, double *data, double *cp)
+{
+  int    d, k, p, stat, nNew, dimInsert, dimCheck;
+  double *knotInsert, *knotCheck;
+
+  if (sameKnots(info[3], data, dimMerged, merged) == 1) {
+    // no new knots for this curve so copy directly from spline data
+    for ( p = 0; p < nPts; ++p )
+      for ( d = 0 ; d < 3 ; ++ d)
+        cp[ d + p*3 + c*nPts*3 ] = data[ info[3]+d+p*3 ];
+    return EGADS_SUCCESS;
+  }
+  
+  knotInsert = (double *) EG_alloc(dimMerged        *sizeof(double));
+  knotCheck  = (double *) EG_alloc((info[3]+dimMerged)*sizeof(double));
+  if ( knotInsert == NULL || knotCheck == NULL ) {
+    EG_free(knotCheck);
+    EG_free(knotInsert);
+    return EGADS_MALLOC;
+  }
+  stat = findMissingKnots(info[3], data, dimMerged, merged, &dimInsert,
+                          knotInsert);
+  if (stat != EGADS_SUCCESS) {
+    printf(" EG_skinning: findMissingKnots %d = %d\n", c, stat);
+    goto cleanup;
+  }
+  if ( info[2]+dimInsert != nPts ) {
+    printf(" EG_skinning: Knot Refinement has the wrong dimension!!\n");
+    stat = EGADS_GEOMERR;
+    goto cleanup;
+  }
+  if ( dimInsert == 0 ) {
+    for ( p = 0; p < nPts; ++p )
+      for ( d = 0 ; d < 3 ; ++ d)
+        cp[ d + p*3 + c*nPts*3 ] = data[ info[3]+d+p*3 ];
+    goto cleanup;
+  }
+
+  // there are new knots in this sequence: refine directly into our slot
+  stat = RefineKnotVectCurve (info[2]-1, deg, data, dimInsert-1, knotInsert,
+                              &nNew, &cp[c*nPts*3], &dimCheck, knotCheck);
+  if (stat != EGADS_SUCCESS) goto cleanup;
+  // knotcheck is a vector which should coincide with the mergedKnot sequence
+  if (dimCheck != dimMerged) {
+    printf(" EG_skinning: Knot Refinement has the wrong dimension!!\n");
+    stat = EGADS_GEOMERR;
+    goto cleanup;
+  }
+  for ( k = 0; k < dimCheck; ++k ) {
+    if (fabs( knotCheck[k] - merged[k] ) > EPS) {
+      printf(" EG_skinning: Knot Refinement has the wrong sequence!!\n");
+      stat = EGADS_GEOMERR;
+      goto cleanup;
+    }
+  }
+  
+cleanup:
+  EG_free(knotCheck);
+  EG_free(knotInsert);
+  return stat;
+}
+
+
+static void
+compatThread(void *struc)
+{
+  int     index, stat;
+  long    ID;
+  EMPskin *sthread;
+  
+  sthread = (EMPskin *) struc;
+  
+  /* get our identifier */
+  ID = EMP_ThreadID();
+  
+  /* look for work */
+  for (;;) {
+    
+    /* only one thread at a time here -- controlled by a mutex! */
+    if (sthread->mutex != NULL) EMP_LockSet(sthread->mutex);
+    index = sthread->index;
+    if (sthread->status != EGADS_SUCCESS) index = sthread->end;
+    sthread->index = index+1;
+    if (sthread->mutex != NULL) EMP_LockRelease(sthread->mutex);
+    if (index >= sthread->end) break;
+    
+    /* do the work */
+    stat = compatSection(index, sthread->degree, sthread->nPts,
+                         sthread->dimMerged, sthread->merged,
+                         sthread->splineInfo[index],
+                         sthread->splineData[index], sthread->cp);
+    if (stat != EGADS_SUCCESS) {
+      if (sthread->mutex != NULL) EMP_LockSet(sthread->mutex);
+      if (sthread->status == EGADS_SUCCESS) sthread->status = stat;
+      if (sthread->mutex != NULL) EMP_LockRelease(sthread->mutex);
+    }
+  }
+  
+  /* exhausted all work -- exit */
+  if (ID != sthread->master) EMP_ThreadExit();
+}
+
+
 /*  Assuming all curves have equal degree, makes the curves compatible:  
 	- creates a common (unique) knot vector.
-	- creates new control points for each curve. 
+	- creates new control points for each curve (in parallel). 
 */
 static int 
 makeCurvesCompatible(int nC, ego *splineCurves, int *nP, double **controlPoints,
                      double **knotVector, int *dimKnotVector, int *degree)
 {
-  int    c = 0, k = 0, p = 0, d = 0, oclass, ctype, stat, offset, dimMergedKnots;
-  int    dimKnotIsert = 0, dimKnotCheck = 0, nPts = 0,  deg = 0, knotSum = 0;
-  int    **splineInfo = NULL;
-  double **splineData = NULL, *cp = NULL, *mergedKnots = NULL;
-  double *knotInsert = NULL,  *knotCheck = NULL, *newCtrlPts = NULL;
-  ego    geom;
+  int     i, c = 0, k = 0, p = 0, d = 0, oclass, ctype, stat, offset, np;
+  int     dimMergedKnots, nPts = 0,  deg = 0, knotSum = 0;
+  int     **splineInfo = NULL;
+  long    start;
+  double  **splineData = NULL, *cp = NULL, *mergedKnots = NULL;
+  void    **threads = NULL;
+  ego     geom;
+  EMPskin sthread;
   
   *controlPoints = NULL;
   *knotVector    = NULL;
@@ -391,6 +620,10 @@ makeCurvesCompatible(int nC, ego *splineCurves, int *nP, double **controlPoints,
     EG_free(splineData);
     return  EGADS_MALLOC;
   }
+  for ( c = 0; c < nC; ++c ) {
+    splineInfo[c] = NULL;
+    splineData[c] = NULL;
+  }
   
   for ( c = 0; c < nC; ++c ) {
     stat = EG_getGeometry(splineCurves[c], &oclass, &ctype, &geom,
@@ -428,30 +661,29 @@ makeCurvesCompatible(int nC, ego *splineCurves, int *nP, double **controlPoints,
   dimMergedKnots = splineInfo[0][3];
   stat = 0;
   // Check if knot sequences are different
-  for ( c = 1; c < nC; ++c ) {
-    if ( nPts != splineInfo[c][2] ) {
+  for ( c = 1; c < nC; ++c )
+    if ( nPts != splineInfo[c][2] ||
+         sameKnots(splineInfo[c][3], splineData[c],
+                   dimMergedKnots,   splineData[0]) == 0 ) {
       stat = 1;
       break;
     }
-    if ( dimMergedKnots != splineInfo[c][3] ) {
-      stat = 1;
-      break;
-    }
-    for ( k = 0; k < dimMergedKnots; ++k ) {
-      if ( splineData[c][k] != splineData[0][k] )
-        stat = 1;
-      break;
-    }
-    if ( stat == 1 ) break;
-  }
   if (stat == 1) {   // Create Common Knot Sequence
     knotSum = 0;
     for ( c = 0 ; c < nC ; ++c )
       knotSum += splineInfo[c][3]; // maximum size= all knots are different
     mergedKnots = (double *) EG_alloc(knotSum *sizeof(double));
-    if ( mergedKnots == NULL ) goto bail;
+    if ( mergedKnots == NULL ) {
+      stat = EGADS_MALLOC;
+      goto bail;
+    }
     dimMergedKnots = 0;
     for ( c = 0 ; c < nC ; ++c ) {
+      // sections often share knots -- only merge the new sequences
+      for ( i = 0; i < c; ++i )
+        if ( sameKnots(splineInfo[c][3], splineData[c],
+                       splineInfo[i][3], splineData[i]) == 1 ) break;
+      if ( i != c ) continue;
       stat = mergeKnotVectors( splineInfo[c][3], splineData[c],
                                &dimMergedKnots, mergedKnots);
       if ( stat != EGADS_SUCCESS)  {
@@ -459,59 +691,70 @@ makeCurvesCompatible(int nC, ego *splineCurves, int *nP, double **controlPoints,
         goto bail;
       }
     }
-    knotSum = 0;
-    for ( c = 0 ; c < nC ; ++c )
-      knotSum += splineInfo[c][3]; // maximum size= all knots are different
-    cp         = (double*) EG_alloc(knotSum*3*nC  *sizeof(double));  // max size of control points
-    knotInsert = (double*) EG_alloc(dimMergedKnots*sizeof(double));
-    knotCheck  = (double*) EG_alloc(knotSum 	  *sizeof(double));
-    newCtrlPts = (double*) EG_alloc(knotSum*3     *sizeof(double));
-    if ( cp == NULL  || knotInsert == NULL || newCtrlPts == NULL ||
-        knotCheck == NULL )  {
+    nPts = dimMergedKnots - deg - 1;
+    cp   = (double*) EG_alloc(nPts*3*nC*sizeof(double));
+    if ( cp == NULL ) {
       stat = EGADS_MALLOC;
       goto bail;
     }
-    dimKnotIsert = 0;
-    for ( c = 0; c < nC; ++c ) {
-      stat = findMissingKnots(splineInfo[c][3], splineData[c], dimMergedKnots, mergedKnots,
-                              &dimKnotIsert, knotInsert);
-      if (stat != EGADS_SUCCESS) {
-        printf(" EG_skinning: findMissingKnots %d = %d\n", c, stat);
-        goto bail;
-      }
-      if ( dimKnotIsert > 0 ) {
-        // there are new knots in this sequence: collect knots and control points.
-        stat = RefineKnotVectCurve (splineInfo[c][2]-1, deg, splineData[c],
-                                    dimKnotIsert-1, knotInsert, &nPts, newCtrlPts,
-                                    &dimKnotCheck, knotCheck);
-        if (stat != EGADS_SUCCESS) goto bail;
-        // knotcheck is a vector which should coincide with the mergedKnot sequence that we found
-        if (dimKnotCheck != dimMergedKnots)	{
-          printf(" EG_skinning: Knot Refinement has the wrong dimension!!\n");
-          stat = EGADS_GEOMERR;
-          goto bail;
-        }
-        for( k = 0; k< dimKnotCheck; ++k) {
-          if (fabs( knotCheck[k] - mergedKnots[k] ) > EPS) {
-            printf(" EG_skinning: Knot Refinement has the wrong sequence!!\n");
-            stat = EGADS_GEOMERR;
-            goto bail;
-          }
-        }
+    
+    /* set up for explicit multithreading -- the sections are independent */
+    sthread.mutex      = NULL;
+    sthread.master     = EMP_ThreadID();
+    sthread.index      = 0;
+    sthread.end        = nC;
+    sthread.status     = EGADS_SUCCESS;
+    sthread.degree     = deg;
+    sthread.nPts       = nPts;
+    sthread.dimMerged  = dimMergedKnots;
+    sthread.merged     = mergedKnots;
+    sthread.splineInfo = splineInfo;
+    sthread.splineData = splineData;
+    sthread.cp         = cp;
+    
+    np = EMP_Init(&start);
+    if (np > nC) np = nC;
+    if (np > 1) {
+      /* create the mutex to handle list synchronization */
+      sthread.mutex = EMP_LockCreate();
+      if (sthread.mutex == NULL) {
+        printf(" EMP Error: mutex creation = NULL!\n");
+        np = 1;
       } else {
-        // no new knots for this curve so copy directly from spline data
-        nPts   = splineInfo[c][2];
-        offset = splineInfo[c][3];
-        for ( p = 0; p < nPts; ++p ) {
-          for ( d = 0 ; d < 3 ; ++ d)
-            newCtrlPts[ p*3 + d ] = splineData[c][ offset+d+p*3 ];
+        /* get storage for our extra threads */
+        threads = (void **) malloc((np-1)*sizeof(void *));
+        if (threads == NULL) {
+          EMP_LockDestroy(sthread.mutex);
+          sthread.mutex = NULL;
+          np = 1;
         }
-      }  // add curve control points to global pointer cp
-      for ( p = 0; p < nPts ; ++p ) {
-        for ( d = 0; d < 3; ++d )
-          cp[ d + p*3 + c*nPts*3 ] = newCtrlPts[ d + p*3 ];
       }
     }
+    
+    /* create the threads and get going! */
+    if (threads != NULL)
+      for (i = 0; i < np-1; i++) {
+        threads[i] = EMP_ThreadCreate(compatThread, &sthread);
+        if (threads[i] == NULL)
+          printf(" EMP Error Creating Thread #%d!\n", i+1);
+      }
+    /* now run the thread block from the original thread */
+    compatThread(&sthread);
+    
+    /* wait for all others to return */
+    if (threads != NULL)
+      for (i = 0; i < np-1; i++)
+        if (threads[i] != NULL) EMP_ThreadWait(threads[i]);
+    
+    /* cleanup */
+    if (threads != NULL)
+      for (i = 0; i < np-1; i++)
+        if (threads[i] != NULL) EMP_ThreadDestroy(threads[i]);
+    if (sthread.mutex != NULL) EMP_LockDestroy(sthread.mutex);
+    if (threads != NULL) free(threads);
+    
+    stat = sthread.status;
+    if (stat != EGADS_SUCCESS) goto bail;
   } else {
     // All knots are the same. Copy directly from spline data
     deg            = splineInfo[0][1];
@@ -533,28 +776,15 @@ makeCurvesCompatible(int nC, ego *splineCurves, int *nP, double **controlPoints,
       }
     }
   }
-  // Copy all data to input variables & leave
+  // Hand all data to input variables & leave
   *degree        = deg;  // Assuming that one day degree elevation function will be implemented, *degree will update
   *dimKnotVector = dimMergedKnots;
-  *knotVector    = (double *) EG_alloc( dimMergedKnots*sizeof(double));
-  if ( *knotVector == NULL ) {
-    stat = EGADS_MALLOC;
-    goto bail;
-  }
-  for ( k = 0; k < dimMergedKnots ; ++k )
-    (*knotVector)[k] = mergedKnots[k];
-  *controlPoints = (double *) EG_alloc(nPts*nC*3*sizeof(double));
-  if( *controlPoints == NULL ) {
-    stat = EGADS_MALLOC;
-    goto bail ;
-  }
-  *nP = nPts ;
-  for (c = 0; c < nC; ++c) {
-    for ( p = 0;p < nPts ; ++p) {
-      for (d = 0 ; d < 3 ; ++ d)
-        (*controlPoints)[ d + p*3 + c*nPts*3 ] = cp[ d + p*3 + c*nPts*3 ];
-    }
-  }
+  *knotVector    = mergedKnots;
+  *controlPoints = cp;
+  *nP            = nPts;
+  mergedKnots    = NULL;
+  cp             = NULL;
+  stat           = EGADS_SUCCESS;
   
 bail:
   for (c = 0; c < nC; ++c) {
@@ -565,14 +795,50 @@ bail:
   EG_free(splineInfo);
   EG_free(mergedKnots);
   EG_free(cp);
-  EG_free(knotCheck);
-  EG_free(knotInsert);
-  EG_free(newCtrlPts);
 
   return stat;
 }
 
 
+/* Dense fallback: interpolates all control-point columns with the full
+   collocation matrix and partial pivoting -- solution replaces P */
+static int
+denseSkinSolve(int nC, int degree, int dimVknots, double *vKnots,
+               double *v_param, int nrhs, double *P)
+{
+  int    i, j, n, it, col, stat = EGADS_SUCCESS;
+  double *A, *A_aux, *b, *x;
+
+  A     = (double *) EG_alloc(nC*nC*sizeof(double));
+  A_aux = (double *) EG_alloc(nC*nC*sizeof(double));
+  b     = (double *) EG_alloc(2*nC *sizeof(double));
+  if ( (A == NULL) || (A_aux == NULL) || (b == NULL) ) {
+    EG_free(b);
+    EG_free(A_aux);
+    EG_free(A);
+    return EGADS_MALLOC;
+  }
+  x = &b[nC];
+  for ( it = i = 0; i < nC; ++i )
+    for ( j = 0; j < nC; ++j, ++it )
+      A[it] = OneBasisFun(degree, dimVknots-1, vKnots, j, v_param[i]);
+
+  for ( col = 0; col < nrhs; ++col ) {
+    for ( n = 0; n < nC;    ++n ) b[n] = P[ n*nrhs+col ];
+    for ( n = 0; n < nC*nC; ++n ) A_aux[n] = A[n];
+    // Finds the Control Points such that the curve interpolates the original control points.
+    stat = matsol(A_aux, b, nC, x);
+    if (stat != EGADS_SUCCESS) break;
+    for ( n = 0; n < nC;    ++n ) P[ n*nrhs+col ] = x[n];
+  }
+  
+  EG_free(b);
+  EG_free(A_aux);
+  EG_free(A);
+  return stat;
+}
+
+
 #ifdef STANDALONE
 static
 #endif
@@ -581,10 +847,10 @@ int EG_skinning (ego context, int nC, ego *sectionCurves, int skinning_degree,
 {
   double *P_cross, *Uknots; // ptr to control points and commont knot vector
   int    c = 0, d = 0, i = 0, j = 0, n=0, it = 0, stat = 1, dimVknots = 0;
-  int    nP = 0, dimUknots = 0, degree = 0;
-  int    blend = 0, dataLength = 0, offset = 0, splineInfo[7];
+  int    nP = 0, dimUknots = 0, degree = 0, span = 0, w = 0;
+  int    dataLength = 0, offset = 0, splineInfo[7];
   double sumVal, diam, dist, locCord;
-  double *A = NULL, *A_aux = NULL, *net[3] , *b = NULL, *splineData = NULL;
+  double *A = NULL, *N = NULL, *splineData = NULL;
   double *v_param = NULL , *vKnots = NULL;
   
   *surface = NULL;
@@ -646,57 +912,48 @@ int EG_skinning (ego context, int nC, ego *sectionCurves, int skinning_degree,
     vKnots[skinning_degree+j]  /= (double) skinning_degree;
   }
   // FIND SURFACE CONTROL NET ----> INTERPOLATING CROSS CURVES + SOLVING LINEAR SYSTEMS
-  A      = (double *) EG_alloc(nC*nC*sizeof(double));
-  A_aux  = (double *) EG_alloc(nC*nC*sizeof(double));
-  net[0] = (double *) EG_alloc(nP*nC*sizeof(double));
-  net[1] = (double *) EG_alloc(nP*nC*sizeof(double));
-  net[2] = (double *) EG_alloc(nP*nC*sizeof(double));
-  b      = (double *) EG_alloc(   nC*sizeof(double));
-  if ( (A == NULL) || (A_aux == NULL) || (net[0] == NULL) || (net[1] == NULL) ||
-       (net[2] == NULL) || (b == NULL) ) {
-    if (b      != NULL) EG_free(b);
-    if (net[2] != NULL) EG_free(net[2]);
-    if (net[1] != NULL) EG_free(net[1]);
-    if (net[0] != NULL) EG_free(net[0]);
-    if (A_aux  != NULL) EG_free(A_aux);
-    if (A      != NULL) EG_free(A);
+  //   The collocation matrix is banded (width = 2*skinning_degree+1) so factor
+  //   it once and back-substitute all 3*nP control-point columns together.
+  //   P_cross is stored [section][point][xyz] -- i.e. rowwise with 3*nP columns
+  w = 2*skinning_degree + 1;
+  A = (double *) EG_alloc((nC*w + 3*(skinning_degree+1))*sizeof(double));
+  if (A == NULL) {
     EG_free(vKnots);
     EG_free(v_param);
     EG_free(P_cross);
     EG_free(Uknots);
     return EGADS_MALLOC;
   }
-  for ( it = i = 0; i < nC; ++i )
-    for ( j = 0; j < nC; ++j, ++it )
-      A[it] = OneBasisFun(skinning_degree, dimVknots-1, vKnots, j, v_param[i]);
-
-  for ( blend = 0; blend < nP; ++blend ) {
-    for ( d = 0; d < 3; ++d ) {
-      for ( n = 0; n < nC;    ++n ) b[n] = P_cross[ d+blend*3+n*3*nP ];
-      for ( n = 0; n < nC*nC; ++n ) A_aux[n] = A[n];
-      // Finds the Control Points such that the curve interpolates the original control points.
-      stat = matsol(A_aux, b, nC, &net[d][blend*nC]);
-      if (stat != EGADS_SUCCESS) {
-        printf(" EGADS Error: Solving Linear System = %d!!\n", stat);
-        EG_free(b);
-        EG_free(net[2]);
-        EG_free(net[1]);
-        EG_free(net[0]);
-        EG_free(A_aux);
-        EG_free(A);
-        EG_free(vKnots);
-        EG_free(v_param);
-        EG_free(P_cross);
-        EG_free(Uknots);
-        return stat;
-      }
+  N = &A[nC*w];
+  for ( i = 0; i < nC*w; ++i ) A[i] = 0.0;
+  for ( i = 0; i < nC; ++i ) {
+    span = FindSpan(nC-1, skinning_degree, v_param[i], vKnots);
+    BasisFuns(span, v_param[i], skinning_degree, vKnots, N,
+              &N[skinning_degree+1], &N[2*skinning_degree+2]);
+    for ( j = 0; j <= skinning_degree; ++j ) {
+      it = span - skinning_degree + j - i;           // column offset from diagonal
+      if ( (it < -skinning_degree) || (it > skinning_degree) ) break;
+      A[i*w+it+skinning_degree] = N[j];
     }
+    if ( j <= skinning_degree ) break;
+  }
+  stat = EGADS_DEGEN;
+  if ( i == nC ) stat = bandFactor(nC, skinning_degree, A);
+  if ( stat == EGADS_SUCCESS ) {
+    bandSolve(nC, skinning_degree, A, 3*nP, P_cross);
+  } else {
+    stat = denseSkinSolve(nC, skinning_degree, dimVknots, vKnots, v_param,
+                          3*nP, P_cross);
   }
-  EG_free(b);
-  EG_free(A_aux);
   EG_free(A);
   EG_free(v_param);
-  EG_free(P_cross);
+  if (stat != EGADS_SUCCESS) {
+    printf(" EGADS Error: Solving Linear System = %d!!\n", stat);
+    EG_free(vKnots);
+    EG_free(P_cross);
+    EG_free(Uknots);
+    return stat;
+  }
 
   /* SURFACE BSPLINES */
   splineInfo[0] = 0;
@@ -709,9 +966,7 @@ int EG_skinning (ego context, int nC, ego *sectionCurves, int skinning_degree,
   dataLength    = splineInfo[3] + nC*nP*3 + splineInfo[6];
   splineData    = (double *) EG_alloc(dataLength *sizeof(double));
   if (splineData == NULL ) {
-    EG_free(net[2]);
-    EG_free(net[1]);
-    EG_free(net[0]);
+    EG_free(P_cross);
     EG_free(vKnots);
     EG_free(Uknots);
     return EGADS_MALLOC;
@@ -722,16 +977,10 @@ int EG_skinning (ego context, int nC, ego *sectionCurves, int skinning_degree,
   /* KNOT SEQUENCE  (skinning direction) */
   for ( i = 0; i < dimVknots; ++i ) splineData[dimUknots+i] = vKnots[i];
   EG_free(vKnots);
-  /* CONTOL NET */
+  /* CONTOL NET -- same ordering as the solution */
   offset = dimVknots + dimUknots;
-  for (c = 0; c < nC; ++c)
-    for (n = 0; n < nP; ++n) {
-      for (d = 0; d < 3; d++) splineData[offset+d] = net[d][n*nC+c];
-      offset+=3;
-    }
-  EG_free(net[2]);
-  EG_free(net[1]);
-  EG_free(net[0]);
+  for (i = 0; i < nC*nP*3; ++i) splineData[offset+i] = P_cross[i];
+  EG_free(P_cross);
   stat = EG_makeGeometry(context, SURFACE, BSPLINE,
                          NULL, splineInfo, splineData, surface);
   EG_free(splineData);
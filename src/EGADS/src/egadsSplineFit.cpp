@@ -75,6 +75,30 @@ FindSpan(int nKnots, int degree, T2 u, T *U)
 }
 
 
+/* BasisFuns with the degree known at compile time (the common cubic case) */
+
+template<int P, class T, class T2>
+static void
+BasisFunsP(int span, T2 u, T *U, T *N)
+{
+  int j, r;
+  T   saved, temp, left[P+1], right[P+1];
+
+  N[0] = 1.0;
+  for (j = 1; j <= P; j++) {
+    left[j]  = u - U[span+1-j];
+    right[j] = U[span+j] - u;
+    saved    = 0.0;
+    for (r = 0; r < j; r++) {
+      temp  = N[r]/(right[r+1]+left[j-r]);
+      N[r]  = saved + right[r+1]*temp;
+      saved = left[j-r]*temp;
+    }
+    N[j] = saved;
+  }
+}
+
+
 template<class T, class T2>
 static void
 BasisFuns(int span, int degree, T2 u, T *U, T *N)
@@ -82,6 +106,11 @@ BasisFuns(int span, int degree, T2 u, T *U, T *N)
   int j, r;
   T   saved, temp, left[MAXDEG], right[MAXDEG];
 
+  if (degree == 3) {
+    BasisFunsP<3>(span, u, U, N);
+    return;
+  }
+
   N[0] = 1.0;
   for (j = 1; j <= degree; j++) {
     left[j]  = u - U[span+1-j];
@@ -162,6 +191,51 @@ DersBasisFuns(int i, int p, T2 u, T *knot, int der, T **ders)
 }
 
 
+/* spans and basis functions for a set of parameters
+ * (N is blocked by degree+1 for each parameter) */
+
+template<class T, class T2>
+static void
+BasisTable(int nKnots, int degree, int n, const T2 *us, T *U, int *spans,
+           T *N)
+{
+  int i;
+
+  if (degree == 3) {
+    for (i = 0; i < n; i++) {
+      spans[i] = FindSpan(nKnots, 3, us[i], U);
+      BasisFunsP<3>(spans[i], us[i], U, &N[4*i]);
+    }
+  } else {
+    for (i = 0; i < n; i++) {
+      spans[i] = FindSpan(nKnots, degree, us[i], U);
+      BasisFuns(spans[i], degree, us[i], U, &N[(degree+1)*i]);
+    }
+  }
+}
+
+
+/* cubic curve (and derivatives) from tabulated basis functions
+ * (same sums as EG_spline1dDeriv_impl -- N is blocked by 4 per derivative) */
+
+template<class T>
+static void
+EG_cubicTableEval(int span, int der, const T *N, const T *CP, T *deriv)
+{
+  int i, j, k;
+
+  for (k = 0; k <= der; k++) deriv[3*k  ] = deriv[3*k+1] = deriv[3*k+2] = 0.0;
+
+  for (k = 0; k <= der; k++)
+    for (j = 0; j <= 3; j++) {
+      i             = span-3+j;
+      deriv[3*k  ] += N[4*k+j]*CP[3*i  ];
+      deriv[3*k+1] += N[4*k+j]*CP[3*i+1];
+      deriv[3*k+2] += N[4*k+j]*CP[3*i+2];
+    }
+}
+
+
 /* ************************** Curve Functions ****************************** */
 
 template<class T, class T2>
@@ -438,10 +512,11 @@ static int
 EG_spline1dFit_impl(int endx, int imaxx, const T *xyz, const double *kn,
                     double tol, int *header, T *rdata)
 {
-    int i, kk, iknot, icp, iter, endc, imax, *mdata;
+    int i, j, k, kk, iknot, icp, iter, endc, imax, *mdata, *spans, span[2];
     T   du, dx, dy, dz, dxyzmax, rj[3], u21, u20, data[9];
     T   d2xdt2L, d2ydt2L, d2zdt2L, d2sdt2L, d2xdt2R, d2ydt2R, d2zdt2R, d2sdt2R;
-    T   *cp, *knots, *cps;
+    T   *cp, *knots, *cps, *Ntab, Nend[2][12];
+    T   Nders[MAXDEG+1][MAXDEG+1], *Nder[MAXDEG+1];
 
     endc = endx;
     imax = imaxx;
@@ -655,12 +730,34 @@ EG_spline1dFit_impl(int endx, int imaxx, const T *xyz, const double *kn,
     cps[kk++] = xyz[3*(imax-1)+1];
     cps[kk++] = xyz[3*(imax-1)+2];
 
+    /* the knots do not move -- tabulate the spans & basis functions at the
+       interior data points and the 2nd derivative bases at the ends */
+    spans = (int *) EG_alloc(imax*sizeof(int));
+    Ntab  = new T[4*imax];
+    if ((spans == NULL) || (Ntab == NULL)) {
+        if (Ntab != NULL) delete [] Ntab;
+        EG_free(spans);
+        EG_free(mdata);
+        return EGADS_MALLOC;
+    }
+    if (imax > 2)
+        BasisTable(iknot, 3, imax-2, &knots[4], knots, &spans[1], &Ntab[4]);
+    for (i = 0; i <= 3; i++) Nder[i] = &Nders[i][0];
+    for (k = 0; k < 2; k++) {
+        du      = knots[3];
+        if (k == 1) du = knots[imax+2];
+        span[k] = FindSpan(iknot, 3, du, knots);
+        DersBasisFuns(span[k], 3, du, knots, 2, Nder);
+        for (i = 0; i <= 2; i++)
+            for (j = 0; j <= 3; j++) Nend[k][4*i+j] = Nders[i][j];
+    }
+
     /* iterate to have knot evaluations match data points */
     for (iter = 0; iter < NITER; iter++) {
         dxyzmax = 0.0;
 
         /* condition at beginning */
-        EG_spline1dDeriv_impl(header, rdata, 2, knots[3], data);
+        EG_cubicTableEval(span[0], 2, Nend[0], cps, data);
         du = knots[4] - knots[3];
         if (endc == 0) {
             /* natural end */
@@ -734,7 +831,7 @@ EG_spline1dFit_impl(int endx, int imaxx, const T *xyz, const double *kn,
                 continue;
             }
 
-            EG_spline1dEval_impl(header, rdata, knots[i+3], data);
+            EG_cubicTableEval(spans[i], 0, &Ntab[4*i], cps, data);
             dx = xyz[3*i  ] - data[0];
             dy = xyz[3*i+1] - data[1];
             dz = xyz[3*i+2] - data[2];
@@ -747,7 +844,7 @@ EG_spline1dFit_impl(int endx, int imaxx, const T *xyz, const double *kn,
         }
 
         /* condition at end */
-        EG_spline1dDeriv_impl(header, rdata, 2, knots[imax+2], data);
+        EG_cubicTableEval(span[1], 2, Nend[1], cps, data);
         du = knots[imax+2] - knots[imax+1];
         if (endc == 0) {
             /* natural end */
@@ -797,6 +894,8 @@ EG_spline1dFit_impl(int endx, int imaxx, const T *xyz, const double *kn,
     if (dxyzmax >= tol)
         printf(" Warning: Not Converged (EG_spline1dFit)!\n");
 
+    delete [] Ntab;
+    EG_free(spans);
     EG_free(mdata);
     return EGADS_SUCCESS;
 }
@@ -29,6 +29,7 @@
     egTessel *ntess;              /* tessellation structure */
     /*@dependent@*/
     bodyQuad *bodydata;           /* the quad storage */
+    int      *order;              /* Face order -- NULL is natural order */
   } EMPquad;
 
 
@@ -39,6 +40,34 @@
   } midside;
 
 
+  typedef struct {
+    int    npts;                  /* number of vertices in the new Face */
+    int    ntris;                 /* number of triangles in the new Face */
+    double *coords;               /* the vertices -- NULL if not filled */
+    double *parms;                /* the parameters (in coords storage) */
+    int    *tris;                 /* the triangle indices */
+    double time;                  /* wall clock seconds spent on the Face */
+  } quadFace;
+
+
+  typedef struct {
+    void           *mutex;        /* the mutex or NULL for single thread */
+    long           master;        /* master thread ID */
+    int            end;           /* end of loop */
+    int            index;         /* current loop index */
+    int            stat;          /* first error -- stops the dispatch */
+    int            outLevel;      /* the output level */
+    int            *order;        /* Face indices -- most costly first */
+    const egObject *tess;         /* the source tessellation */
+    const egTessel *btess;        /* the source tessellation structure */
+    egObject       *body;         /* the Body */
+    egObject       **edges;       /* the Body's Edges */
+    egObject       **faces;       /* the Body's Faces */
+    egTessel       *ntess;        /* the new tessellation (Edges filled) */
+    quadFace       *qfaces;       /* the Face results */
+  } EMPqface;
+
+
 #define CRXSS(a,b,c)      c[0] = ((a)[1]*(b)[2]) - ((a)[2]*(b)[1]);\
                           c[1] = ((a)[2]*(b)[0]) - ((a)[0]*(b)[2]);\
                           c[2] = ((a)[0]*(b)[1]) - ((a)[1]*(b)[0])
@@ -78,6 +107,7 @@
                               double *param, double *result );
   extern int  EG_invEvaluateGuess( const egObject *geom, double *xyz,
                                    double *param, double *result );
+  extern int  EG_inFace( const egObject *face, const double *uv );
   extern int  EG_getEdgeUV( const egObject *face, const egObject *edge,
                             int sense, double t, double *result );
   extern int  EG_getEdgeUVeval( const egObject *face, const egObject *topo,
@@ -2621,6 +2651,28 @@ EG_getEdgepoint(const ego edge, double w, double tm, double tp, double *tOUT)
 }
 
 
+/* inverse evaluation warm-started from the neighboring vertices -- the
+   full (clipped) inverse is used if the result leaves the trimmed Face */
+
+static int
+EG_invEvalSide(const ego face, double fact, const double *uvm,
+               const double *uvp, const double *range, double *xyz,
+               double *uv, double *result)
+{
+  int stat;
+
+  uv[0] = fact*uvp[0] + (1.0-fact)*uvm[0];
+  uv[1] = fact*uvp[1] + (1.0-fact)*uvm[1];
+  stat  = EG_invEvaluateGuess(face, xyz, uv, result);
+  if ((stat == EGADS_SUCCESS) &&
+      (uv[0] >= range[0]) && (uv[0] <= range[1]) &&
+      (uv[1] >= range[2]) && (uv[1] <= range[3]))
+    if (EG_inFace(face, uv) == EGADS_SUCCESS) return stat;
+
+  return EG_invEvaluate(face, xyz, uv, result);
+}
+
+
 /* Find the point P = S(u,v) midpoint of uv0 and uv1 that minimizes the distance
    between min 1/2 ( l_0 ^ 2 + l_1 ^ 2) + lambda * (l_1 - l_0) = L(u, v, lambda)
    grad(L) = (L_1, L_2, L_3) = (0, 0, 0) -->
@@ -2825,7 +2877,8 @@ EG_getSidepoint(const ego face, double fact, const double *uvm,
           pIT[0] = fact*pP[0] + (1.0-fact)*pM[0];
           pIT[1] = fact*pP[1] + (1.0-fact)*pM[1];
           pIT[2] = fact*pP[2] + (1.0-fact)*pM[2];
-          stat   = EG_invEvaluate(face, pIT, uvOUT, xyz);
+          stat   = EG_invEvalSide(face, fact, uvm, uvp, range, pIT, uvOUT,
+                                  xyz);
           if (stat != EGADS_SUCCESS ||
               uvOUT[0] < range[0] || uvOUT[0] > range[1] ||
               uvOUT[1] < range[2] || uvOUT[1] > range[3]) {
@@ -2875,7 +2928,7 @@ EG_getSidepoint(const ego face, double fact, const double *uvm,
       pIT[0] = fact*pP[0] + (1.0-fact)*pM[0];
       pIT[1] = fact*pP[1] + (1.0-fact)*pM[1];
       pIT[2] = fact*pP[2] + (1.0-fact)*pM[2];
-      stat   = EG_invEvaluate(face, pIT, uvOUT, xyz);
+      stat   = EG_invEvalSide(face, fact, uvm, uvp, range, pIT, uvOUT, xyz);
       if (stat != EGADS_SUCCESS ||
           uvOUT[0] < range[0] || uvOUT[0] > range[1] ||
           uvOUT[1] < range[2] || uvOUT[1] > range[3]) {
@@ -3022,7 +3075,7 @@ EG_getSidepoint(const ego face, double fact, const double *uvm,
     pIT[0] = fact*pP[0] + (1.0-fact)*pM[0];
     pIT[1] = fact*pP[1] + (1.0-fact)*pM[1];
     pIT[2] = fact*pP[2] + (1.0-fact)*pM[2];
-    stat   = EG_invEvaluate(face, pIT, uvIT, xyz);
+    stat   = EG_invEvalSide(face, fact, uvm, uvp, range, pIT, uvIT, xyz);
     if (stat != EGADS_SUCCESS ||
         uvIT[0] < range[0] || uvIT[0] > range[1] ||
         uvIT[1] < range[2] || uvIT[1] > range[3]) {
@@ -3038,7 +3091,7 @@ EG_getSidepoint(const ego face, double fact, const double *uvm,
 static void
 EG_quadThread(void *struc)
 {
-  int     index, stat;
+  int     index, iface, stat;
   long    ID;
   EMPquad *qthread;
 
@@ -3053,9 +3106,11 @@ EG_quadThread(void *struc)
     /* only one thread at a time here -- controlled by a mutex! */
     if (qthread->mutex != NULL) EMP_LockSet(qthread->mutex);
     for (index = qthread->index; index < qthread->end; index++) {
-      if (qthread->ntess->tess2d[index].tfi ==    1) continue;
-      if (qthread->bodydata->qm[index]      == NULL) continue;
-      if (qthread->bodydata->qm[index]->fID ==    0) continue;
+      iface = index;
+      if (qthread->order != NULL) iface = qthread->order[index];
+      if (qthread->ntess->tess2d[iface].tfi ==    1) continue;
+      if (qthread->bodydata->qm[iface]      == NULL) continue;
+      if (qthread->bodydata->qm[iface]->fID ==    0) continue;
       break;
     }
     qthread->index = index+1;
@@ -3063,10 +3118,10 @@ EG_quadThread(void *struc)
     if (index >= qthread->end) break;
 
     /* do the work */
-    stat = EG_meshRegularization(qthread->bodydata->qm[index]);
+    stat = EG_meshRegularization(qthread->bodydata->qm[iface]);
     if (stat != EGADS_SUCCESS)
       printf(" EGADS Warning: EG_fullMeshRegularization %d = %d (EG_quadTess)!\n",
-             index+1, stat);
+             iface+1, stat);
   }
 
   /* exhausted all work -- exit */
@@ -3074,341 +3129,133 @@ EG_quadThread(void *struc)
 }
 
 
-int
-EG_quadTess(const egObject *tess, egObject **quadTess)
+/* fill in the quads (or split tris) for a single Face */
+
+static int
+EG_quadTessFace(EMPqface *qface, int i)
 {
-  int          i, j, k, m, n, nedges, nfaces, stat, npts, ntris, nside, alen;
-  int          outLevel, iv, np, nt, is, ie, ien, oclass, mtype, atype;
-  int          sum[2], side[4], degens[2], iuv[2], *table, *tris, *senses;
-  int          i0, i1, i2, i3, otri, flip;
-  const int    *ptype, *pindex, *trs, *trc, *ints;
-  double       result[18], xyz[3], uv[2], uvm[2], uvp[2], trange[2], t;
-  double       *coords, *parms;
-  long         start;
-  const double *xyzs, *ts, *uvs, *reals;
-  const char   *str;
-  egTessel     *btess, *ntess;
-  egObject     *obj, *geom, *newTess, **nodes, **edges, **faces, **objs;
-  midside      *mid;
-  bodyQuad     bodydata;
-  EMPquad      qthread;
-  void         **threads = NULL;
+  int            j, k, m, n, stat, np, nt, nside, is, ie, ien, oclass, mtype;
+  int            iv, outLevel, sum[2], side[4], degens[2], iuv[2], *senses;
+  int            i0, i1, i2, i3, otri, flip, *table = NULL, *tris = NULL;
+  const int      *ptype, *pindex, *trs, *trc;
+  double         result[18], xyz[3], uv[2], uvm[2], uvp[2], trange[2], t;
+  double         *coords = NULL, *parms;
+  const double   *xyzs, *uvs;
+  const egObject *tess;
+  egTessel       *ntess;
+  egObject       *obj, *geom, **nodes, **edges, **faces, **objs;
+  midside        *mid = NULL;
+  quadFace       *qf;
 #ifdef TRIOUT
-  FILE         *fp;
-  char         filename[100];
+  FILE           *fp;
+  char           filename[100];
 #endif
-  static int   sides[3][2] = {{1,2}, {2,0}, {0,1}       };
-  static int   sideq[4][2] = {{1,2}, {2,5}, {5,0}, {0,1}};
-  static int   neigq[4]    = { 0,     3,     4,     2   };
-
-  *quadTess = NULL;
-  if (tess == NULL)                 return EGADS_NULLOBJ;
-  if (tess->magicnumber != MAGIC)   return EGADS_NOTOBJ;
-  if (tess->oclass != TESSELLATION) return EGADS_NOTTESS;
-  if (EG_sameThread(tess))          return EGADS_CNTXTHRD;
-  outLevel = EG_outLevel(tess);
-
-  btess = (egTessel *) tess->blind;
-  if (btess == NULL) {
-    if (outLevel > 0)
-      printf(" EGADS Error: NULL Blind Object (EG_quadTess)!\n");
-    return EGADS_NOTFOUND;
-  }
-  if (btess->done == 0) {
-    if (outLevel > 0)
-      printf(" EGADS Error: Tessellation is open (EG_quadTess)!\n");
-    return EGADS_TESSTATE;
-  }
-  obj = btess->src;
-  if (obj == NULL) {
-    if (outLevel > 0)
-      printf(" EGADS Error: NULL Source Object (EG_quadTess)!\n");
-    return EGADS_NULLOBJ;
-  }
-  if (obj->magicnumber != MAGIC) {
-    if (outLevel > 0)
-      printf(" EGADS Error: Source Not an Object (EG_quadTess)!\n");
-    return EGADS_NOTOBJ;
-  }
-  if (obj->oclass != BODY) {
-    if (outLevel > 0)
-      printf(" EGADS Error: Source Not Body (EG_quadTess)!\n");
-    return EGADS_NOTBODY;
-  }
-  if (btess->tess1d == NULL) {
-    if (outLevel > 0)
-      printf(" EGADS Error: No Edge Tessellations (EG_quadTess)!\n");
-    return EGADS_NODATA;
-  }
-  if ((btess->tess2d == NULL) && (btess->nFace != 0)) {
-    if (outLevel > 0)
-      printf(" EGADS Error: No Face Tessellations (EG_quadTess)!\n");
-    return EGADS_NODATA;
-  }
-
-  /* initialize the new tessellation object */
-  stat = EG_initTessBody(obj, &newTess);
-  if (stat != EGADS_SUCCESS) {
+  static int     sides[3][2] = {{1,2}, {2,0}, {0,1}       };
+  static int     sideq[4][2] = {{1,2}, {2,5}, {5,0}, {0,1}};
+  static int     neigq[4]    = { 0,     3,     4,     2   };
+
+  tess     = qface->tess;
+  obj      = qface->body;
+  edges    = qface->edges;
+  faces    = qface->faces;
+  ntess    = qface->ntess;
+  outLevel = qface->outLevel;
+  qf       = &qface->qfaces[i];
+
+  stat = EG_getTessFace(tess, i+1, &np, &xyzs, &uvs, &ptype, &pindex,
+                        &nt, &trs, &trc);
+  if (stat != EGADS_SUCCESS) return EGADS_SUCCESS;
+
+  /* size and allocate temporary arrays for this Face */
+  for (sum[0] = sum[1] = j = 0; j < nt; j++)
+    for (k = 0; k < 3; k++)
+      if (trc[3*j+k] > 0) {
+        sum[0]++;
+      } else {
+        sum[1]++;
+      }
+  nside  = sum[0]/2 + sum[1];
+  k      = np + nt + nside;
+  coords = (double *)  EG_alloc(5*k*sizeof(double));
+  tris   = (int *)     EG_alloc(6*3*nt*sizeof(int));
+  mid    = (midside *) EG_alloc(nside*sizeof(midside));
+  table  = (int *)     EG_alloc(np*sizeof(int));
+  if ((coords == NULL) || (tris == NULL) || (mid == NULL) || (table == NULL)) {
     if (outLevel > 0)
-      printf(" EGADS Error: EG_initTessBody = %d (EG_quadTess)!\n", stat);
-    return stat;
+      printf(" EGADS Error: Malloc for Face %d (EG_quadTess)!\n", i+1);
+    stat = EGADS_MALLOC;
+    goto bail;
   }
+  parms = &coords[3*k];
 
-  stat = EG_getBodyTopos(obj, NULL, EDGE, &nedges, &edges);
+  /* find degenerate nodes (if any) */
+  degens[0] = degens[1] = 0;
+  iuv[0]    = iuv[1]    = 0;
+  stat      = EG_getBodyTopos(obj, faces[i], EDGE, &k, &objs);
   if (stat != EGADS_SUCCESS) {
-    if (outLevel > 0)
-      printf(" EGADS Error: EG_getBodyTopos E = %d (EG_quadTess)!\n", stat);
-    EG_deleteObject(newTess);
-    return stat;
-  }
-
-  /* rebuild the Edges */
-
-  for (j = i = 0; i < nedges; i++) {
-    if (edges[i]->mtype == DEGENERATE) continue;
-    stat = EG_getTessEdge(tess, i+1, &npts, &xyzs, &ts);
-    if (stat != EGADS_SUCCESS) {
-      if (outLevel > 0)
-        printf(" EGADS Error: EG_getTessEdge %d = %d (EG_quadTess)!\n",
-               i+1, stat);
-      EG_free(edges);
-      EG_deleteObject(newTess);
-      return stat;
-    }
-    if (npts == 0) {
-      if (outLevel > 0)
-        printf(" EGADS Error: EG_getTessEdge %d -- no points (EG_quadTess)!\n",
-               i+1);
-      EG_free(edges);
-      EG_deleteObject(newTess);
-      return EGADS_INDEXERR;
-    }
-    if (npts > j) j = npts;
-  }
-  /* allocate to the maximum length */
-  coords = (double *) EG_alloc(4*(2*j-1)*sizeof(double));
-  if (coords == NULL) {
-    if (outLevel > 0)
-      printf(" EGADS Error: Malloc for %d points (EG_quadTess)!\n", j);
-    EG_free(edges);
-    EG_deleteObject(newTess);
-    return EGADS_MALLOC;
-  }
-  parms = &coords[3*(2*j-1)];
-
-  for (i = 0; i < nedges; i++) {
-    if (edges[i]->mtype == DEGENERATE) continue;
-    stat = EG_getTessEdge(tess, i+1, &npts, &xyzs, &ts);
-    if (stat != EGADS_SUCCESS) continue;
-
-    for (j = 0; j < npts-1; j++) {
-      parms[2*j  ] = ts[j];
-/*    parms[2*j+1] = 0.5*(ts[j] + ts[j+1]);  */
-      EG_getEdgepoint(edges[i], 0.5, ts[j], ts[j+1], &parms[2*j+1]);
-      stat = EG_evaluate(edges[i], &parms[2*j+1], result);
+    printf(" EGADS Internal: EG_getBodyTopos on Face %d = %d\n", i+1, stat);
+  } else {
+    for (j = 0; j < k; j++) {
+      stat = EG_getTopology(objs[j], &geom, &oclass, &mtype,
+                            trange, &n, &nodes, &senses);
       if (stat != EGADS_SUCCESS) {
-        if (outLevel > 0)
-          printf(" EGADS Error: EG_evaluate Edge %d/%d = %d (EG_quadTess)!\n",
-                 i+1, j+1, stat);
-        EG_free(coords);
-        EG_free(edges);
-        EG_deleteObject(newTess);
-        return stat;
+        printf(" EGADS Internal: EG_getTopology on Edge = %d\n", stat);
+        continue;
       }
-      coords[6*j  ] = xyzs[3*j  ];
-      coords[6*j+1] = xyzs[3*j+1];
-      coords[6*j+2] = xyzs[3*j+2];
-      coords[6*j+3] = result[0];
-      coords[6*j+4] = result[1];
-      coords[6*j+5] = result[2];
-    }
-    j = npts-1;
-    parms[2*j  ]  = ts[j];
-    coords[6*j  ] = xyzs[3*j  ];
-    coords[6*j+1] = xyzs[3*j+1];
-    coords[6*j+2] = xyzs[3*j+2];
-
-    stat = EG_setTessEdge(newTess, i+1, 2*npts-1, coords, parms);
-    if (stat != EGADS_SUCCESS) {
-      if (outLevel > 0)
-        printf(" EGADS Error: EG_setTessEdge %d = %d (EG_quadTess)!\n",
-               i+1, stat);
-      EG_free(coords);
-      EG_free(edges);
-      EG_deleteObject(newTess);
-      return stat;
-    }
-  }
-  EG_free(coords);
-  ntess = (egTessel *) newTess->blind;
-
-  /* size and allocate temporary arrays */
-
-  stat = EG_getBodyTopos(obj, NULL, FACE, &nfaces, &faces);
-  if (stat != EGADS_SUCCESS) {
-    if (outLevel > 0)
-      printf(" EGADS Error: EG_getBodyTopos F = %d (EG_quadTess)!\n", stat);
-    EG_free(edges);
-    EG_deleteObject(newTess);
-    return stat;
-  }
-  for (nside = npts = ntris = i = 0; i < nfaces; i++) {
-    stat = EG_getTessFace(tess, i+1, &np, &xyzs, &uvs, &ptype, &pindex,
-                          &nt, &trs, &trc);
-    if ((stat != EGADS_SUCCESS) || (nt == 0)) {
-      if (outLevel > 0)
-        if (stat != EGADS_SUCCESS) {
-          printf(" EGADS Error: EG_getTessFace %d = %d (EG_quadTess)!\n",
-                 i+1, stat);
+      if (mtype != DEGENERATE) continue;
+      stat = EG_getEdgeUVeval(faces[i], objs[j], 0, trange[0], result);
+      if (stat != EGADS_SUCCESS) {
+        printf(" EGADS Internal: EG_getEdgeUVeval = %d\n", stat);
+        continue;
+      }
+      n = EG_indexBodyTopo(obj, nodes[0]);
+      if (n > 0) {
+        if (degens[0] == 0) {
+          degens[0] = n;
+          if (result[3] != 0.0) iuv[0] = 1;
+        } else if (degens[1] == 0) {
+          degens[1] = n;
+          if (result[3] != 0.0) iuv[1] = 1;
         } else {
-          printf(" EGADS Error: Face %d has no tessellation (EG_quadTess)!\n",
-                 i+1);
+          printf(" EGADS Info: More than 2 Degen Nodes in Face %d!\n", i+1);
         }
-      EG_free(faces);
-      EG_free(edges);
-      EG_deleteObject(newTess);
-      return stat;
+      }
     }
-    for (sum[0] = sum[1] = j = 0; j < nt; j++)
-      for (k = 0; k < 3; k++)
-        if (trc[3*j+k] > 0) {
-          sum[0]++;
-        } else {
-          sum[1]++;
-        }
-    k = sum[0]/2 + sum[1];
-    if (k  > nside) nside = k;
-    if (np > npts)  npts  = np;
-    if (nt > ntris) ntris = nt;
-  }
-  k      = npts + ntris + nside;
-  coords = (double *) EG_alloc(5*k*sizeof(double));
-  if (coords == NULL) {
-    if (outLevel > 0)
-      printf(" EGADS Error: Malloc for %d Face points (EG_quadTess)!\n", k);
-    EG_free(faces);
-    EG_free(edges);
-    EG_deleteObject(newTess);
-    return EGADS_MALLOC;
-  }
-  parms = &coords[3*k];
-  tris  = (int *) EG_alloc(6*3*ntris*sizeof(int));
-  if (tris == NULL) {
-    if (outLevel > 0)
-      printf(" EGADS Error: Malloc for %d Face tris (EG_quadTess)!\n", 3*ntris);
-    EG_free(coords);
-    EG_free(faces);
-    EG_free(edges);
-    EG_deleteObject(newTess);
-    return EGADS_MALLOC;
-  }
-  mid = (midside *) EG_alloc(nside*sizeof(midside));
-  if (mid == NULL) {
-    if (outLevel > 0)
-      printf(" EGADS Error: Malloc for %d Face mids (EG_quadTess)!\n", nside);
-    EG_free(tris);
-    EG_free(coords);
-    EG_free(faces);
-    EG_free(edges);
-    EG_deleteObject(newTess);
-    return EGADS_MALLOC;
+    EG_free(objs);
   }
-  table = (int *) EG_alloc(npts*sizeof(int));
-  if (table == NULL) {
-    if (outLevel > 0)
-      printf(" EGADS Error: Malloc for %d Face table (EG_quadTess)!\n", npts);
-    EG_free(mid);
-    EG_free(tris);
-    EG_free(coords);
-    EG_free(faces);
-    EG_free(edges);
-    EG_deleteObject(newTess);
-    return EGADS_MALLOC;
-  }
-
-  /* fill in the tris, a Face at a time */
 
-  for (i = 0; i < nfaces; i++) {
-    if (btess->tess2d[i].tfi == 1) continue;
-    stat = EG_getTessFace(tess, i+1, &np, &xyzs, &uvs, &ptype, &pindex,
-                          &nt, &trs, &trc);
-    if (stat != EGADS_SUCCESS) continue;
-
-    /* find degenerate nodes (if any) */
-    degens[0] = degens[1] = 0;
-    iuv[0]    = iuv[1]    = 0;
-    stat      = EG_getBodyTopos(obj, faces[i], EDGE, &k, &objs);
-    if (stat != EGADS_SUCCESS) {
-      printf(" EGADS Internal: EG_getBodyTopos on Face %d = %d\n", i+1, stat);
-    } else {
-      for (j = 0; j < k; j++) {
-        stat = EG_getTopology(objs[j], &geom, &oclass, &mtype,
-                              trange, &n, &nodes, &senses);
-        if (stat != EGADS_SUCCESS) {
-          printf(" EGADS Internal: EG_getTopology on Edge = %d\n", stat);
-          continue;
-        }
-        if (mtype != DEGENERATE) continue;
-        stat = EG_getEdgeUVeval(faces[i], objs[j], 0, trange[0], result);
-        if (stat != EGADS_SUCCESS) {
-          printf(" EGADS Internal: EG_getEdgeUVeval = %d\n", stat);
-          continue;
-        }
-        n = EG_indexBodyTopo(obj, nodes[0]);
-        if (n > 0) {
-          if (degens[0] == 0) {
-            degens[0] = n;
-            if (result[3] != 0.0) iuv[0] = 1;
-          } else if (degens[1] == 0) {
-            degens[1] = n;
-            if (result[3] != 0.0) iuv[1] = 1;
-          } else {
-            printf(" EGADS Info: More than 2 Degen Nodes in Face %d!\n", i+1);
-          }
-        }
-      }
-      EG_free(objs);
-    }
+  /* make the vertices */
+  for (j = 0; j < np; j++) {
+    coords[3*j  ] = xyzs[3*j  ];
+    coords[3*j+1] = xyzs[3*j+1];
+    coords[3*j+2] = xyzs[3*j+2];
+    parms[2*j  ]  = uvs[2*j  ];
+    parms[2*j+1]  = uvs[2*j+1];
+    table[j]      = NOTFILLED;
+  }
+  iv = np;
 
-    /* make the vertices */
-    for (j = 0; j < np; j++) {
-      coords[3*j  ] = xyzs[3*j  ];
-      coords[3*j+1] = xyzs[3*j+1];
-      coords[3*j+2] = xyzs[3*j+2];
-      parms[2*j  ]  = uvs[2*j  ];
-      parms[2*j+1]  = uvs[2*j+1];
-      table[j]      = NOTFILLED;
-    }
-    iv = np;
+  if (qface->btess->tess2d[i].tfi == 1) {
 
-    /* get triangle side midpoint insertions */
-    for (is = j = 0; j < nt; j++)
-      for (k = 0; k < 3; k++) {
-        i1   = trs[3*j+sides[k][0]] - 1;
-        i2   = trs[3*j+sides[k][1]] - 1;
-        flip = 0;
+    /* get quad side midpoint insertions */
+    for (is = j = 0; j < nt/2; j++)
+      for (k = 0; k < 4; k++) {
+        i1 = trs[6*j+sideq[k][0]] - 1;
+        i2 = trs[6*j+sideq[k][1]] - 1;
         if (i2 < i1) {
           stat = i1;
           i1   = i2;
           i2   = stat;
-          flip = 1;
         }
         m = EG_findMidSide(i1, i2, table, mid);
         if (m > 0) continue;
-        uvm[0] = uvs[2*i1  ];
-        uvm[1] = uvs[2*i1+1];
-        uvp[0] = uvs[2*i2  ];
-        uvp[1] = uvs[2*i2+1];
-        if (trc[3*j+k] > 0) {
+        ie = trc[6*j+neigq[k]];
+        if (ie > 0) {
           /* Interior side */
-          otri = trc[3*j+k] - 1;
-          i0   = trs[3*j+k] - 1;
-          i3   = trs[3*otri] + trs[3*otri+1] + trs[3*otri+2] - i1 - i2 - 3;
-          if (flip == 1) {
-            stat = i0;
-            i0   = i3;
-            i3   = stat;
-          }
+          uvm[0] = uvs[2*i1  ];
+          uvm[1] = uvs[2*i1+1];
+          uvp[0] = uvs[2*i2  ];
+          uvp[1] = uvs[2*i2+1];
           if ((ptype[i1] == 0) && (pindex[i1] == degens[0])) {
             if (iuv[0] == 0) {
               uvm[0] = uvs[2*i2  ];
@@ -3434,62 +3281,36 @@ EG_quadTess(const egObject *tess, egObject **quadTess)
               uvp[1] = uvs[2*i1+1];
             }
           }
-          EG_getSidepoint(faces[i], 0.5, uvm, uvp, &uvs[2*i0], &uvs[2*i3], uv);
+          /* could add the opposing triangles */
+          EG_getSidepoint(faces[i], 0.5, uvm, uvp, NULL, NULL, uv);
           stat = EG_evaluate(faces[i], uv, result);
         } else {
           /* Edge side */
-          ie   = -trc[3*j+k] - 1;
+          ie   = -ie - 1;
           stat = EG_getTopology(edges[ie], &geom, &oclass, &mtype,
                                 trange, &n, &objs, &senses);
           if (stat != EGADS_SUCCESS) {
             if (outLevel > 0)
               printf(" EGADS Error: EG_getTopology %d/%d = %d (EG_quadTess)!\n",
                      i+1, ie+1, stat);
-            EG_free(table);
-            EG_free(mid);
-            EG_free(tris);
-            EG_free(coords);
-            EG_free(faces);
-            EG_free(edges);
-            EG_deleteObject(newTess);
-            return stat;
+            goto bail;
           }
           n = EG_indexBodyTopo(obj, objs[0]);
           if ((ptype[i1] == 0) && (ptype[i2] == 0)) {
             ien = 1;
           } else if (ptype[i1] == 0) {
-            if (mtype == ONENODE) {
-              if ((xyzs[3*i2  ] == ntess->tess1d[ie].xyz[6]) &&
-                  (xyzs[3*i2+1] == ntess->tess1d[ie].xyz[7]) &&
-                  (xyzs[3*i2+2] == ntess->tess1d[ie].xyz[8])) {
-                ien = 1;
-              } else {
-                ien = ntess->tess1d[ie].npts - 2;
-              }
+            if (pindex[i1] == n) {
+              ien = 1;
             } else {
-              if (pindex[i1] == n) {
-                ien = 1;
-              } else {
-                ien = 2*ptype[i2] - 1;
-              }
+              ien = 2*ptype[i2] - 1;
             }
             if (ie+1 != pindex[i2])
               printf(" EGADS Info: Edge mismatch %d %d\n", ie+1, pindex[i2]);
           } else if (ptype[i2] == 0) {
-            if (mtype == ONENODE) {
-              if ((xyzs[3*i1  ] == ntess->tess1d[ie].xyz[6]) &&
-                  (xyzs[3*i1+1] == ntess->tess1d[ie].xyz[7]) &&
-                  (xyzs[3*i1+2] == ntess->tess1d[ie].xyz[8])) {
-                ien = 1;
-              } else {
-                ien = ntess->tess1d[ie].npts - 2;
-              }
+            if (pindex[i2] == n) {
+              ien = 1;
             } else {
-              if (pindex[i2] == n) {
-                ien = 1;
-              } else {
-                ien = 2*ptype[i1] - 1;
-              }
+              ien = 2*ptype[i1] - 1;
             }
             if (ie+1 != pindex[i1])
               printf(" EGADS Info: Edge mismatch %d %d\n", ie+1, pindex[i1]);
@@ -3534,14 +3355,7 @@ EG_quadTess(const egObject *tess, egObject **quadTess)
             if (outLevel > 0)
               printf(" EGADS Error: EG_getEdgeUV %d/%d = %d (EG_quadTess)!\n",
                      i+1, ie+1, stat);
-            EG_free(table);
-            EG_free(mid);
-            EG_free(tris);
-            EG_free(coords);
-            EG_free(faces);
-            EG_free(edges);
-            EG_deleteObject(newTess);
-            return stat;
+            goto bail;
           }
           result[0] = ntess->tess1d[ie].xyz[3*ien  ];
           result[1] = ntess->tess1d[ie].xyz[3*ien+1];
@@ -3551,14 +3365,7 @@ EG_quadTess(const egObject *tess, egObject **quadTess)
           if (outLevel > 0)
             printf(" EGADS Error: EG_evaluate %d %d/%d = %d (EG_quadTess)!\n",
                    i+1, j+1, k+1, stat);
-          EG_free(table);
-          EG_free(mid);
-          EG_free(tris);
-          EG_free(coords);
-          EG_free(faces);
-          EG_free(edges);
-          EG_deleteObject(newTess);
-          return stat;
+          goto bail;
         }
         if (m == 0) {
           table[i1]      = is;
@@ -3577,11 +3384,11 @@ EG_quadTess(const egObject *tess, egObject **quadTess)
         iv++;
       }
 
-    /* fill in the new triangulation */
-    for (j = 0; j < nt; j++) {
-      for (k = 0; k < 3; k++) {
-        i1 = trs[3*j+sides[k][0]] - 1;
-        i2 = trs[3*j+sides[k][1]] - 1;
+    /* fill in the new triangulation based on Quads */
+    for (j = 0; j < nt/2; j++) {
+      for (k = 0; k < 4; k++) {
+        i1 = trs[6*j+sideq[k][0]] - 1;
+        i2 = trs[6*j+sideq[k][1]] - 1;
         if (i2 < i1) {
           stat = i1;
           i1   = i2;
@@ -3592,47 +3399,20 @@ EG_quadTess(const egObject *tess, egObject **quadTess)
           if (outLevel > 0)
             printf(" EGADS Error: findMidSide %d = %d (EG_quadTess)!\n",
                    i+1, side[k]);
-          EG_free(table);
-          EG_free(mid);
-          EG_free(tris);
-          EG_free(coords);
-          EG_free(faces);
-          EG_free(edges);
-          EG_deleteObject(newTess);
-          return stat;
+          stat = EGADS_INDEXERR;
+          goto bail;
         }
       }
       /* get middle vertex based on mid-sides */
-      t    = 1.0/3.0;
-      stat = EG_baryInsert(faces[i], t, t, t, &parms[2*(side[0]-1)],
-                           &parms[2*(side[1]-1)], &parms[2*(side[2]-1)], uv);
-      if (stat != EGADS_SUCCESS) {
-        printf(" EGADS Info: EG_baryInsert = %d (EG_quadTess)!\n", stat);
-        xyz[0] = (coords[3*(side[0]-1)  ] + coords[3*(side[1]-1)  ] +
-                  coords[3*(side[2]-1)  ])/3.0;
-        xyz[1] = (coords[3*(side[0]-1)+1] + coords[3*(side[1]-1)+1] +
-                  coords[3*(side[2]-1)+1])/3.0;
-        xyz[2] = (coords[3*(side[0]-1)+2] + coords[3*(side[1]-1)+2] +
-                  coords[3*(side[2]-1)+2])/3.0;
-        uv[0]  = (parms[2*(side[0]-1)  ]  + parms[2*(side[1]-1)  ] +
-                  parms[2*(side[2]-1)  ])/3.0;
-        uv[1]  = (parms[2*(side[0]-1)+1]  + parms[2*(side[1]-1)+1] +
-                  parms[2*(side[2]-1)+1])/3.0;
-        EG_getInterior(faces[i], xyz, uv);
-      }
-      stat = EG_evaluate(faces[i], uv, result);
+      EG_minArc4(faces[i], 0.5, 0.5,
+                 &parms[2*(side[3]-1)], &parms[2*(side[0]-1)],
+                 &parms[2*(side[1]-1)], &parms[2*(side[2]-1)], uv);
+      stat  = EG_evaluate(faces[i], uv, result);
       if (stat != EGADS_SUCCESS) {
         if (outLevel > 0)
           printf(" EGADS Error: EG_evaluate %d %d = %d (EG_quadTess)!\n",
                  i+1, j+1, stat);
-        EG_free(table);
-        EG_free(mid);
-        EG_free(tris);
-        EG_free(coords);
-        EG_free(faces);
-        EG_free(edges);
-        EG_deleteObject(newTess);
-        return stat;
+        goto bail;
       }
       coords[3*iv  ] = result[0];
       coords[3*iv+1] = result[1];
@@ -3641,131 +3421,65 @@ EG_quadTess(const egObject *tess, egObject **quadTess)
       parms[2*iv+1]  = uv[1];
       iv++;
 
-      tris[18*j   ] = trs[3*j  ];
-      tris[18*j+ 1] = side[2];
-      tris[18*j+ 2] = iv;
-      tris[18*j+ 3] = trs[3*j  ];
-      tris[18*j+ 4] = iv;
-      tris[18*j+ 5] = side[1];
-
-      tris[18*j+ 6] = trs[3*j+1];
-      tris[18*j+ 7] = side[0];
-      tris[18*j+ 8] = iv;
-      tris[18*j+ 9] = trs[3*j+1];
-      tris[18*j+10] = iv;
-      tris[18*j+11] = side[2];
-
-      tris[18*j+12] = trs[3*j+2];
-      tris[18*j+13] = side[1];
-      tris[18*j+14] = iv;
-      tris[18*j+15] = trs[3*j+2];
-      tris[18*j+16] = iv;
-      tris[18*j+17] = side[0];
-    }
-
-    stat = EG_setTessFace(newTess, i+1, iv, coords, parms, 6*nt, tris);
-    if (stat != EGADS_SUCCESS) {
-      if (outLevel > 0)
-        printf(" EGADS Error: EG_setTessFace %d = %d (EG_quadTess)!\n",
-               i+1, stat);
-      EG_free(table);
-      EG_free(mid);
-      EG_free(tris);
-      EG_free(coords);
-      EG_free(faces);
-      EG_free(edges);
-      EG_deleteObject(newTess);
-      return stat;
-    }
-#ifdef TRIOUT
-    sprintf(filename, "Components.%d.i.tri", i+1);
-    fp = fopen(filename, "w");
-    fprintf(fp," %d %d\n", iv, 6*nt);
-    for (j = 0; j < iv; j++)
-      fprintf(fp, " %lf %lf %lf\n",coords[3*j  ],coords[3*j+1],coords[3*j+2]);
-    for (j = 0; j < 6*nt; j++)
-      fprintf(fp, " %d %d %d\n", tris[3*j  ], tris[3*j+1], tris[3*j+2]);
-    for (j = 0; j < 6*nt; j++)
-      fprintf(fp, " 1\n");
-    fclose(fp);
-#endif
-  }
+      tris[24*j   ] = trs[6*j  ];
+      tris[24*j+ 1] = side[3];
+      tris[24*j+ 2] = iv;
+      tris[24*j+ 3] = trs[6*j  ];
+      tris[24*j+ 4] = iv;
+      tris[24*j+ 5] = side[2];
 
-  /* fill in the quads from TFI Faces */
+      tris[24*j+ 6] = trs[6*j+1];
+      tris[24*j+ 7] = side[0];
+      tris[24*j+ 8] = iv;
+      tris[24*j+ 9] = trs[6*j+1];
+      tris[24*j+10] = iv;
+      tris[24*j+11] = side[3];
 
-  for (i = 0; i < nfaces; i++) {
-    if (btess->tess2d[i].tfi != 1) continue;
-    stat = EG_getTessFace(tess, i+1, &np, &xyzs, &uvs, &ptype, &pindex,
-                          &nt, &trs, &trc);
-    if (stat != EGADS_SUCCESS) continue;
+      tris[24*j+12] = trs[6*j+2];
+      tris[24*j+13] = side[1];
+      tris[24*j+14] = iv;
+      tris[24*j+15] = trs[6*j+2];
+      tris[24*j+16] = iv;
+      tris[24*j+17] = side[0];
 
-    /* find degenerate nodes (if any) */
-    degens[0] = degens[1] = 0;
-    iuv[0]    = iuv[1]    = 0;
-    stat = EG_getBodyTopos(obj, faces[i], EDGE, &k, &objs);
-    if (stat != EGADS_SUCCESS) {
-      printf(" EGADS Internal: EG_getBodyTopos on Face %d = %d\n", i+1, stat);
-    } else {
-      for (j = 0; j < k; j++) {
-        stat = EG_getTopology(objs[j], &geom, &oclass, &mtype,
-                              trange, &n, &nodes, &senses);
-        if (stat != EGADS_SUCCESS) {
-          printf(" EGADS Internal: EG_getTopology on Edge = %d\n", stat);
-          continue;
-        }
-        if (mtype != DEGENERATE) continue;
-        stat = EG_getEdgeUVeval(faces[i], objs[j], 0, trange[0], result);
-        if (stat != EGADS_SUCCESS) {
-          printf(" EGADS Internal: EG_getEdgeUVeval = %d\n", stat);
-          continue;
-        }
-        n = EG_indexBodyTopo(obj, nodes[0]);
-        if (n > 0) {
-          if (degens[0] == 0) {
-            degens[0] = n;
-            if (result[3] != 0.0) iuv[0] = 1;
-          } else if (degens[1] == 0) {
-            degens[1] = n;
-            if (result[3] != 0.0) iuv[1] = 1;
-          } else {
-            printf(" EGADS Info: More than 2 Degen Nodes in Face %d!\n",
-                   i+1);
-          }
-        }
-      }
-      EG_free(objs);
+      tris[24*j+18] = trs[6*j+5];
+      tris[24*j+19] = side[2];
+      tris[24*j+20] = iv;
+      tris[24*j+21] = trs[6*j+5];
+      tris[24*j+22] = iv;
+      tris[24*j+23] = side[1];
     }
 
-    /* make the vertices */
-    for (j = 0; j < np; j++) {
-      coords[3*j  ] = xyzs[3*j  ];
-      coords[3*j+1] = xyzs[3*j+1];
-      coords[3*j+2] = xyzs[3*j+2];
-      parms[2*j  ]  = uvs[2*j  ];
-      parms[2*j+1]  = uvs[2*j+1];
-      table[j]      = NOTFILLED;
-    }
-    iv = np;
+  } else {
 
-    /* get quad side midpoint insertions */
-    for (is = j = 0; j < nt/2; j++)
-      for (k = 0; k < 4; k++) {
-        i1 = trs[6*j+sideq[k][0]] - 1;
-        i2 = trs[6*j+sideq[k][1]] - 1;
+    /* get triangle side midpoint insertions */
+    for (is = j = 0; j < nt; j++)
+      for (k = 0; k < 3; k++) {
+        i1   = trs[3*j+sides[k][0]] - 1;
+        i2   = trs[3*j+sides[k][1]] - 1;
+        flip = 0;
         if (i2 < i1) {
           stat = i1;
           i1   = i2;
           i2   = stat;
+          flip = 1;
         }
         m = EG_findMidSide(i1, i2, table, mid);
         if (m > 0) continue;
-        ie = trc[6*j+neigq[k]];
-        if (ie > 0) {
+        uvm[0] = uvs[2*i1  ];
+        uvm[1] = uvs[2*i1+1];
+        uvp[0] = uvs[2*i2  ];
+        uvp[1] = uvs[2*i2+1];
+        if (trc[3*j+k] > 0) {
           /* Interior side */
-          uvm[0] = uvs[2*i1  ];
-          uvm[1] = uvs[2*i1+1];
-          uvp[0] = uvs[2*i2  ];
-          uvp[1] = uvs[2*i2+1];
+          otri = trc[3*j+k] - 1;
+          i0   = trs[3*j+k] - 1;
+          i3   = trs[3*otri] + trs[3*otri+1] + trs[3*otri+2] - i1 - i2 - 3;
+          if (flip == 1) {
+            stat = i0;
+            i0   = i3;
+            i3   = stat;
+          }
           if ((ptype[i1] == 0) && (pindex[i1] == degens[0])) {
             if (iuv[0] == 0) {
               uvm[0] = uvs[2*i2  ];
@@ -3791,43 +3505,55 @@ EG_quadTess(const egObject *tess, egObject **quadTess)
               uvp[1] = uvs[2*i1+1];
             }
           }
-          /* could add the opposing triangles */
-          EG_getSidepoint(faces[i], 0.5, uvm, uvp, NULL, NULL, uv);
+          EG_getSidepoint(faces[i], 0.5, uvm, uvp, &uvs[2*i0], &uvs[2*i3], uv);
           stat = EG_evaluate(faces[i], uv, result);
         } else {
           /* Edge side */
-          ie   = -ie - 1;
+          ie   = -trc[3*j+k] - 1;
           stat = EG_getTopology(edges[ie], &geom, &oclass, &mtype,
                                 trange, &n, &objs, &senses);
           if (stat != EGADS_SUCCESS) {
             if (outLevel > 0)
               printf(" EGADS Error: EG_getTopology %d/%d = %d (EG_quadTess)!\n",
                      i+1, ie+1, stat);
-            EG_free(table);
-            EG_free(mid);
-            EG_free(tris);
-            EG_free(coords);
-            EG_free(faces);
-            EG_free(edges);
-            EG_deleteObject(newTess);
-            return stat;
+            goto bail;
           }
           n = EG_indexBodyTopo(obj, objs[0]);
           if ((ptype[i1] == 0) && (ptype[i2] == 0)) {
             ien = 1;
           } else if (ptype[i1] == 0) {
-            if (pindex[i1] == n) {
-              ien = 1;
+            if (mtype == ONENODE) {
+              if ((xyzs[3*i2  ] == ntess->tess1d[ie].xyz[6]) &&
+                  (xyzs[3*i2+1] == ntess->tess1d[ie].xyz[7]) &&
+                  (xyzs[3*i2+2] == ntess->tess1d[ie].xyz[8])) {
+                ien = 1;
+              } else {
+                ien = ntess->tess1d[ie].npts - 2;
+              }
             } else {
-              ien = 2*ptype[i2] - 1;
+              if (pindex[i1] == n) {
+                ien = 1;
+              } else {
+                ien = 2*ptype[i2] - 1;
+              }
             }
             if (ie+1 != pindex[i2])
               printf(" EGADS Info: Edge mismatch %d %d\n", ie+1, pindex[i2]);
           } else if (ptype[i2] == 0) {
-            if (pindex[i2] == n) {
-              ien = 1;
+            if (mtype == ONENODE) {
+              if ((xyzs[3*i1  ] == ntess->tess1d[ie].xyz[6]) &&
+                  (xyzs[3*i1+1] == ntess->tess1d[ie].xyz[7]) &&
+                  (xyzs[3*i1+2] == ntess->tess1d[ie].xyz[8])) {
+                ien = 1;
+              } else {
+                ien = ntess->tess1d[ie].npts - 2;
+              }
             } else {
-              ien = 2*ptype[i1] - 1;
+              if (pindex[i2] == n) {
+                ien = 1;
+              } else {
+                ien = 2*ptype[i1] - 1;
+              }
             }
             if (ie+1 != pindex[i1])
               printf(" EGADS Info: Edge mismatch %d %d\n", ie+1, pindex[i1]);
@@ -3872,14 +3598,7 @@ EG_quadTess(const egObject *tess, egObject **quadTess)
             if (outLevel > 0)
               printf(" EGADS Error: EG_getEdgeUV %d/%d = %d (EG_quadTess)!\n",
                      i+1, ie+1, stat);
-            EG_free(table);
-            EG_free(mid);
-            EG_free(tris);
-            EG_free(coords);
-            EG_free(faces);
-            EG_free(edges);
-            EG_deleteObject(newTess);
-            return stat;
+            goto bail;
           }
           result[0] = ntess->tess1d[ie].xyz[3*ien  ];
           result[1] = ntess->tess1d[ie].xyz[3*ien+1];
@@ -3889,14 +3608,7 @@ EG_quadTess(const egObject *tess, egObject **quadTess)
           if (outLevel > 0)
             printf(" EGADS Error: EG_evaluate %d %d/%d = %d (EG_quadTess)!\n",
                    i+1, j+1, k+1, stat);
-          EG_free(table);
-          EG_free(mid);
-          EG_free(tris);
-          EG_free(coords);
-          EG_free(faces);
-          EG_free(edges);
-          EG_deleteObject(newTess);
-          return stat;
+          goto bail;
         }
         if (m == 0) {
           table[i1]      = is;
@@ -3915,48 +3627,49 @@ EG_quadTess(const egObject *tess, egObject **quadTess)
         iv++;
       }
 
-    /* fill in the new triangulation based on Quads */
-    for (j = 0; j < nt/2; j++) {
-      for (k = 0; k < 4; k++) {
-        i1 = trs[6*j+sideq[k][0]] - 1;
-        i2 = trs[6*j+sideq[k][1]] - 1;
-        if (i2 < i1) {
-          stat = i1;
-          i1   = i2;
-          i2   = stat;
+    /* fill in the new triangulation */
+    for (j = 0; j < nt; j++) {
+      for (k = 0; k < 3; k++) {
+        i1 = trs[3*j+sides[k][0]] - 1;
+        i2 = trs[3*j+sides[k][1]] - 1;
+        if (i2 < i1) {
+          stat = i1;
+          i1   = i2;
+          i2   = stat;
         }
         side[k] = EG_findMidSide(i1, i2, table, mid);
         if (side[k] <= 0) {
           if (outLevel > 0)
             printf(" EGADS Error: findMidSide %d = %d (EG_quadTess)!\n",
                    i+1, side[k]);
-          EG_free(table);
-          EG_free(mid);
-          EG_free(tris);
-          EG_free(coords);
-          EG_free(faces);
-          EG_free(edges);
-          EG_deleteObject(newTess);
-          return stat;
+          stat = EGADS_INDEXERR;
+          goto bail;
         }
       }
       /* get middle vertex based on mid-sides */
-      EG_minArc4(faces[i], 0.5, 0.5,
-                 &parms[2*(side[3]-1)], &parms[2*(side[0]-1)],
-                 &parms[2*(side[1]-1)], &parms[2*(side[2]-1)], uv);
-      stat  = EG_evaluate(faces[i], uv, result);
+      t    = 1.0/3.0;
+      stat = EG_baryInsert(faces[i], t, t, t, &parms[2*(side[0]-1)],
+                           &parms[2*(side[1]-1)], &parms[2*(side[2]-1)], uv);
+      if (stat != EGADS_SUCCESS) {
+        printf(" EGADS Info: EG_baryInsert = %d (EG_quadTess)!\n", stat);
+        xyz[0] = (coords[3*(side[0]-1)  ] + coords[3*(side[1]-1)  ] +
+                  coords[3*(side[2]-1)  ])/3.0;
+        xyz[1] = (coords[3*(side[0]-1)+1] + coords[3*(side[1]-1)+1] +
+                  coords[3*(side[2]-1)+1])/3.0;
+        xyz[2] = (coords[3*(side[0]-1)+2] + coords[3*(side[1]-1)+2] +
+                  coords[3*(side[2]-1)+2])/3.0;
+        uv[0]  = (parms[2*(side[0]-1)  ]  + parms[2*(side[1]-1)  ] +
+                  parms[2*(side[2]-1)  ])/3.0;
+        uv[1]  = (parms[2*(side[0]-1)+1]  + parms[2*(side[1]-1)+1] +
+                  parms[2*(side[2]-1)+1])/3.0;
+        EG_getInterior(faces[i], xyz, uv);
+      }
+      stat = EG_evaluate(faces[i], uv, result);
       if (stat != EGADS_SUCCESS) {
         if (outLevel > 0)
           printf(" EGADS Error: EG_evaluate %d %d = %d (EG_quadTess)!\n",
                  i+1, j+1, stat);
-        EG_free(table);
-        EG_free(mid);
-        EG_free(tris);
-        EG_free(coords);
-        EG_free(faces);
-        EG_free(edges);
-        EG_deleteObject(newTess);
-        return stat;
+        goto bail;
       }
       coords[3*iv  ] = result[0];
       coords[3*iv+1] = result[1];
@@ -3965,72 +3678,424 @@ EG_quadTess(const egObject *tess, egObject **quadTess)
       parms[2*iv+1]  = uv[1];
       iv++;
 
-      tris[24*j   ] = trs[6*j  ];
-      tris[24*j+ 1] = side[3];
-      tris[24*j+ 2] = iv;
-      tris[24*j+ 3] = trs[6*j  ];
-      tris[24*j+ 4] = iv;
-      tris[24*j+ 5] = side[2];
+      tris[18*j   ] = trs[3*j  ];
+      tris[18*j+ 1] = side[2];
+      tris[18*j+ 2] = iv;
+      tris[18*j+ 3] = trs[3*j  ];
+      tris[18*j+ 4] = iv;
+      tris[18*j+ 5] = side[1];
 
-      tris[24*j+ 6] = trs[6*j+1];
-      tris[24*j+ 7] = side[0];
-      tris[24*j+ 8] = iv;
-      tris[24*j+ 9] = trs[6*j+1];
-      tris[24*j+10] = iv;
-      tris[24*j+11] = side[3];
+      tris[18*j+ 6] = trs[3*j+1];
+      tris[18*j+ 7] = side[0];
+      tris[18*j+ 8] = iv;
+      tris[18*j+ 9] = trs[3*j+1];
+      tris[18*j+10] = iv;
+      tris[18*j+11] = side[2];
 
-      tris[24*j+12] = trs[6*j+2];
-      tris[24*j+13] = side[1];
-      tris[24*j+14] = iv;
-      tris[24*j+15] = trs[6*j+2];
-      tris[24*j+16] = iv;
-      tris[24*j+17] = side[0];
+      tris[18*j+12] = trs[3*j+2];
+      tris[18*j+13] = side[1];
+      tris[18*j+14] = iv;
+      tris[18*j+15] = trs[3*j+2];
+      tris[18*j+16] = iv;
+      tris[18*j+17] = side[0];
+    }
 
-      tris[24*j+18] = trs[6*j+5];
-      tris[24*j+19] = side[2];
-      tris[24*j+20] = iv;
-      tris[24*j+21] = trs[6*j+5];
-      tris[24*j+22] = iv;
-      tris[24*j+23] = side[1];
+  }
+  EG_free(table);
+  EG_free(mid);
+
+  qf->npts   = iv;
+  qf->ntris  = 6*nt;
+  if (qface->btess->tess2d[i].tfi == 1) qf->ntris = 4*nt;
+  qf->coords = coords;
+  qf->parms  = parms;
+  qf->tris   = tris;
+#ifdef TRIOUT
+  sprintf(filename, "Components.%d.i.tri", i+1);
+  fp = fopen(filename, "w");
+  fprintf(fp," %d %d\n", iv, qf->ntris);
+  for (j = 0; j < iv; j++)
+    fprintf(fp, " %lf %lf %lf\n",coords[3*j  ],coords[3*j+1],coords[3*j+2]);
+  for (j = 0; j < qf->ntris; j++)
+    fprintf(fp, " %d %d %d\n", tris[3*j  ], tris[3*j+1], tris[3*j+2]);
+  for (j = 0; j < qf->ntris; j++)
+    fprintf(fp, " 1\n");
+  fclose(fp);
+#endif
+
+  return EGADS_SUCCESS;
+
+bail:
+  EG_free(table);
+  EG_free(mid);
+  EG_free(tris);
+  EG_free(coords);
+  return stat;
+}
+
+
+static void
+EG_quadFaceThread(void *struc)
+{
+  int      index, stat;
+  long     ID;
+  double   t0;
+  EMPqface *qface;
+
+  qface = (EMPqface *) struc;
+
+  /* get our identifier */
+  ID = EMP_ThreadID();
+
+  /* look for work */
+  for (;;) {
+
+    /* only one thread at a time here -- controlled by a mutex! */
+    if (qface->mutex != NULL) EMP_LockSet(qface->mutex);
+    index = qface->index;
+    if (qface->stat != EGADS_SUCCESS) index = qface->end;
+    qface->index = index+1;
+    if (qface->mutex != NULL) EMP_LockRelease(qface->mutex);
+    if (index >= qface->end) break;
+
+    /* do the work -- most expensive Faces are first in the queue */
+    index = qface->order[index];
+    t0    = EMP_Clock();
+    stat  = EG_quadTessFace(qface, index);
+    qface->qfaces[index].time = EMP_Clock() - t0;
+    if (stat != EGADS_SUCCESS) {
+      if (qface->mutex != NULL) EMP_LockSet(qface->mutex);
+      if (qface->stat == EGADS_SUCCESS) qface->stat = stat;
+      if (qface->mutex != NULL) EMP_LockRelease(qface->mutex);
     }
+  }
+
+  /* exhausted all work -- exit */
+  if (ID != qface->master) EMP_ThreadExit();
+}
+
+
+/* order the Faces by decreasing cost */
 
-    stat = EG_setTessFace(newTess, i+1, iv, coords, parms, 4*nt, tris);
+static int
+EG_quadCost(const void *a, const void *b)
+{
+  const int *ia = (const int *) a;
+  const int *ib = (const int *) b;
+
+  if (ia[0] != ib[0]) return ib[0] - ia[0];
+  return ia[1] - ib[1];
+}
+
+
+int
+EG_quadTess(const egObject *tess, egObject **quadTess)
+{
+  int          i, j, nedges, nfaces, stat, npts, alen, outLevel, np, nt;
+  int          atype, *table, *order;
+  const int    *ptype, *pindex, *trs, *trc, *ints;
+  double       result[18], *coords, *parms;
+  long         start;
+  const double *xyzs, *ts, *uvs, *reals;
+  const char   *str;
+  egTessel     *btess, *ntess;
+  egObject     *obj, *newTess, **edges, **faces;
+  quadFace     *qfaces;
+  bodyQuad     bodydata;
+  EMPqface     qface;
+  EMPquad      qthread;
+  void         **threads = NULL;
+
+  *quadTess = NULL;
+  if (tess == NULL)                 return EGADS_NULLOBJ;
+  if (tess->magicnumber != MAGIC)   return EGADS_NOTOBJ;
+  if (tess->oclass != TESSELLATION) return EGADS_NOTTESS;
+  if (EG_sameThread(tess))          return EGADS_CNTXTHRD;
+  outLevel = EG_outLevel(tess);
+
+  btess = (egTessel *) tess->blind;
+  if (btess == NULL) {
+    if (outLevel > 0)
+      printf(" EGADS Error: NULL Blind Object (EG_quadTess)!\n");
+    return EGADS_NOTFOUND;
+  }
+  if (btess->done == 0) {
+    if (outLevel > 0)
+      printf(" EGADS Error: Tessellation is open (EG_quadTess)!\n");
+    return EGADS_TESSTATE;
+  }
+  obj = btess->src;
+  if (obj == NULL) {
+    if (outLevel > 0)
+      printf(" EGADS Error: NULL Source Object (EG_quadTess)!\n");
+    return EGADS_NULLOBJ;
+  }
+  if (obj->magicnumber != MAGIC) {
+    if (outLevel > 0)
+      printf(" EGADS Error: Source Not an Object (EG_quadTess)!\n");
+    return EGADS_NOTOBJ;
+  }
+  if (obj->oclass != BODY) {
+    if (outLevel > 0)
+      printf(" EGADS Error: Source Not Body (EG_quadTess)!\n");
+    return EGADS_NOTBODY;
+  }
+  if (btess->tess1d == NULL) {
+    if (outLevel > 0)
+      printf(" EGADS Error: No Edge Tessellations (EG_quadTess)!\n");
+    return EGADS_NODATA;
+  }
+  if ((btess->tess2d == NULL) && (btess->nFace != 0)) {
+    if (outLevel > 0)
+      printf(" EGADS Error: No Face Tessellations (EG_quadTess)!\n");
+    return EGADS_NODATA;
+  }
+
+  /* initialize the new tessellation object */
+  stat = EG_initTessBody(obj, &newTess);
+  if (stat != EGADS_SUCCESS) {
+    if (outLevel > 0)
+      printf(" EGADS Error: EG_initTessBody = %d (EG_quadTess)!\n", stat);
+    return stat;
+  }
+
+  stat = EG_getBodyTopos(obj, NULL, EDGE, &nedges, &edges);
+  if (stat != EGADS_SUCCESS) {
+    if (outLevel > 0)
+      printf(" EGADS Error: EG_getBodyTopos E = %d (EG_quadTess)!\n", stat);
+    EG_deleteObject(newTess);
+    return stat;
+  }
+
+  /* rebuild the Edges */
+
+  for (j = i = 0; i < nedges; i++) {
+    if (edges[i]->mtype == DEGENERATE) continue;
+    stat = EG_getTessEdge(tess, i+1, &npts, &xyzs, &ts);
     if (stat != EGADS_SUCCESS) {
       if (outLevel > 0)
-        printf(" EGADS Error: EG_setTessFace %d = %d (EG_quadTess)!\n",
+        printf(" EGADS Error: EG_getTessEdge %d = %d (EG_quadTess)!\n",
+               i+1, stat);
+      EG_free(edges);
+      EG_deleteObject(newTess);
+      return stat;
+    }
+    if (npts == 0) {
+      if (outLevel > 0)
+        printf(" EGADS Error: EG_getTessEdge %d -- no points (EG_quadTess)!\n",
+               i+1);
+      EG_free(edges);
+      EG_deleteObject(newTess);
+      return EGADS_INDEXERR;
+    }
+    if (npts > j) j = npts;
+  }
+  /* allocate to the maximum length */
+  coords = (double *) EG_alloc(4*(2*j-1)*sizeof(double));
+  if (coords == NULL) {
+    if (outLevel > 0)
+      printf(" EGADS Error: Malloc for %d points (EG_quadTess)!\n", j);
+    EG_free(edges);
+    EG_deleteObject(newTess);
+    return EGADS_MALLOC;
+  }
+  parms = &coords[3*(2*j-1)];
+
+  for (i = 0; i < nedges; i++) {
+    if (edges[i]->mtype == DEGENERATE) continue;
+    stat = EG_getTessEdge(tess, i+1, &npts, &xyzs, &ts);
+    if (stat != EGADS_SUCCESS) continue;
+
+    for (j = 0; j < npts-1; j++) {
+      parms[2*j  ] = ts[j];
+/*    parms[2*j+1] = 0.5*(ts[j] + ts[j+1]);  */
+      EG_getEdgepoint(edges[i], 0.5, ts[j], ts[j+1], &parms[2*j+1]);
+      stat = EG_evaluate(edges[i], &parms[2*j+1], result);
+      if (stat != EGADS_SUCCESS) {
+        if (outLevel > 0)
+          printf(" EGADS Error: EG_evaluate Edge %d/%d = %d (EG_quadTess)!\n",
+                 i+1, j+1, stat);
+        EG_free(coords);
+        EG_free(edges);
+        EG_deleteObject(newTess);
+        return stat;
+      }
+      coords[6*j  ] = xyzs[3*j  ];
+      coords[6*j+1] = xyzs[3*j+1];
+      coords[6*j+2] = xyzs[3*j+2];
+      coords[6*j+3] = result[0];
+      coords[6*j+4] = result[1];
+      coords[6*j+5] = result[2];
+    }
+    j = npts-1;
+    parms[2*j  ]  = ts[j];
+    coords[6*j  ] = xyzs[3*j  ];
+    coords[6*j+1] = xyzs[3*j+1];
+    coords[6*j+2] = xyzs[3*j+2];
+
+    stat = EG_setTessEdge(newTess, i+1, 2*npts-1, coords, parms);
+    if (stat != EGADS_SUCCESS) {
+      if (outLevel > 0)
+        printf(" EGADS Error: EG_setTessEdge %d = %d (EG_quadTess)!\n",
                i+1, stat);
-      EG_free(table);
-      EG_free(mid);
-      EG_free(tris);
       EG_free(coords);
+      EG_free(edges);
+      EG_deleteObject(newTess);
+      return stat;
+    }
+  }
+  EG_free(coords);
+  ntess = (egTessel *) newTess->blind;
+
+  /* check the Face tessellations and order the work */
+
+  stat = EG_getBodyTopos(obj, NULL, FACE, &nfaces, &faces);
+  if (stat != EGADS_SUCCESS) {
+    if (outLevel > 0)
+      printf(" EGADS Error: EG_getBodyTopos F = %d (EG_quadTess)!\n", stat);
+    EG_free(edges);
+    EG_deleteObject(newTess);
+    return stat;
+  }
+  qfaces = (quadFace *) EG_alloc(nfaces*sizeof(quadFace));
+  order  = (int *)      EG_alloc(2*nfaces*sizeof(int));
+  if ((qfaces == NULL) || (order == NULL)) {
+    if (outLevel > 0)
+      printf(" EGADS Error: Malloc for %d Faces (EG_quadTess)!\n", nfaces);
+    EG_free(order);
+    EG_free(qfaces);
+    EG_free(faces);
+    EG_free(edges);
+    EG_deleteObject(newTess);
+    return EGADS_MALLOC;
+  }
+  for (i = 0; i < nfaces; i++) {
+    qfaces[i].npts   = 0;
+    qfaces[i].ntris  = 0;
+    qfaces[i].coords = NULL;
+    qfaces[i].parms  = NULL;
+    qfaces[i].tris   = NULL;
+    qfaces[i].time   = 0.0;
+    stat = EG_getTessFace(tess, i+1, &np, &xyzs, &uvs, &ptype, &pindex,
+                          &nt, &trs, &trc);
+    if ((stat != EGADS_SUCCESS) || (nt == 0)) {
+      if (outLevel > 0)
+        if (stat != EGADS_SUCCESS) {
+          printf(" EGADS Error: EG_getTessFace %d = %d (EG_quadTess)!\n",
+                 i+1, stat);
+        } else {
+          printf(" EGADS Error: Face %d has no tessellation (EG_quadTess)!\n",
+                 i+1);
+        }
+      EG_free(order);
+      EG_free(qfaces);
       EG_free(faces);
       EG_free(edges);
       EG_deleteObject(newTess);
       return stat;
     }
+    order[2*i  ] = nt;
+    order[2*i+1] = i;
+  }
+  qsort(order, nfaces, 2*sizeof(int), EG_quadCost);
+  for (i = 0; i < nfaces; i++) order[i] = order[2*i+1];
+
+  /* fill in the Faces */
+  qface.mutex    = NULL;
+  qface.master   = EMP_ThreadID();
+  qface.end      = nfaces;
+  qface.index    = 0;
+  qface.stat     = EGADS_SUCCESS;
+  qface.outLevel = outLevel;
+  qface.order    = order;
+  qface.tess     = tess;
+  qface.btess    = btess;
+  qface.body     = obj;
+  qface.edges    = edges;
+  qface.faces    = faces;
+  qface.ntess    = ntess;
+  qface.qfaces   = qfaces;
+
+  np = EMP_Init(&start);
+  if (outLevel > 1) printf(" EMP NumProcs = %d!\n", np);
+  if (np > nfaces) np = nfaces;
+
+  if (np > 1) {
+    /* create the mutex to handle list synchronization */
+    qface.mutex = EMP_LockCreate();
+    if (qface.mutex == NULL) {
+      printf(" EMP Error: mutex creation = NULL!\n");
+      np = 1;
+    } else {
+      /* get storage for our extra threads */
+      threads = (void **) malloc((np-1)*sizeof(void *));
+      if (threads == NULL) {
+        EMP_LockDestroy(qface.mutex);
+        qface.mutex = NULL;
+        np = 1;
+      }
+    }
+  }
+
+  /* create the threads and get going! */
+  if (threads != NULL)
+    for (i = 0; i < np-1; i++) {
+      threads[i] = EMP_ThreadCreate(EG_quadFaceThread, &qface);
+      if (threads[i] == NULL)
+        printf(" EMP Error Creating Thread #%d!\n", i+1);
+    }
+  /* now run the thread block from the original thread */
+  EG_quadFaceThread(&qface);
+
+  /* wait for all others to return */
+  if (threads != NULL)
+    for (i = 0; i < np-1; i++)
+      if (threads[i] != NULL) EMP_ThreadWait(threads[i]);
+
+  /* thread cleanup */
+  if (threads != NULL)
+    for (i = 0; i < np-1; i++)
+      if (threads[i] != NULL) EMP_ThreadDestroy(threads[i]);
+  if (qface.mutex != NULL) EMP_LockDestroy(qface.mutex);
+  if (threads != NULL) free(threads);
+  threads = NULL;
+  if (outLevel > 1)
+    printf(" EMP Number of Seconds on Face Quad Thread Block = %ld\n",
+           EMP_Done(&start));
+
+  /* set the Faces in the new tessellation */
+  stat = qface.stat;
+  for (i = 0; i < nfaces; i++) {
+    if (stat != EGADS_SUCCESS) break;
+    if (qfaces[i].coords == NULL) continue;
+    stat = EG_setTessFace(newTess, i+1, qfaces[i].npts, qfaces[i].coords,
+                          qfaces[i].parms, qfaces[i].ntris, qfaces[i].tris);
+    if (stat != EGADS_SUCCESS) {
+      if (outLevel > 0)
+        printf(" EGADS Error: EG_setTessFace %d = %d (EG_quadTess)!\n",
+               i+1, stat);
+      break;
+    }
     /* set tfi flag in new tessellation */
-    ntess->tess2d[i].tfi = 1;
-#ifdef TRIOUT
-    sprintf(filename, "Components.%d.i.tri", i+1);
-    fp = fopen(filename, "w");
-    fprintf(fp," %d %d\n", iv, 4*nt);
-    for (j = 0; j < iv; j++)
-      fprintf(fp, " %lf %lf %lf\n",coords[3*j  ],coords[3*j+1],coords[3*j+2]);
-    for (j = 0; j < 4*nt; j++)
-      fprintf(fp, " %d %d %d\n", tris[3*j  ], tris[3*j+1], tris[3*j+2]);
-    for (j = 0; j < 4*nt; j++)
-      fprintf(fp, " 1\n");
-    fclose(fp);
-#endif
+    if (btess->tess2d[i].tfi == 1) ntess->tess2d[i].tfi = 1;
+    if (outLevel > 1)
+      printf(" EGADS Info: Face %d -- %d tris in %lf seconds (EG_quadTess)\n",
+             i+1, qfaces[i].ntris, qfaces[i].time);
   }
 
   /* clean up temp storage */
-  EG_free(table);
-  EG_free(mid);
-  EG_free(tris);
-  EG_free(coords);
+  for (i = 0; i < nfaces; i++) {
+    EG_free(qfaces[i].tris);
+    EG_free(qfaces[i].coords);
+  }
+  EG_free(qfaces);
+  EG_free(order);
   EG_free(faces);
   EG_free(edges);
+  if (stat != EGADS_SUCCESS) {
+    EG_deleteObject(newTess);
+    return stat;
+  }
 
   /* close up the open tessellation */
   stat = EG_statusTessBody(newTess, &obj, &i, &npts);
@@ -4105,6 +4170,17 @@ EG_quadTess(const egObject *tess, egObject **quadTess)
     return EGADS_SUCCESS;
   }
 
+  /* regularize the biggest Faces first */
+  order = (int *) EG_alloc(2*bodydata.nfaces*sizeof(int));
+  if (order != NULL) {
+    for (i = 0; i < bodydata.nfaces; i++) {
+      order[2*i  ] = ntess->tess2d[i].ntris;
+      order[2*i+1] = i;
+    }
+    qsort(order, bodydata.nfaces, 2*sizeof(int), EG_quadCost);
+    for (i = 0; i < bodydata.nfaces; i++) order[i] = order[2*i+1];
+  }
+
   /* set the thread storage */
   qthread.mutex    = NULL;
   qthread.master   = EMP_ThreadID();
@@ -4112,6 +4188,7 @@ EG_quadTess(const egObject *tess, egObject **quadTess)
   qthread.index    = 0;
   qthread.ntess    = ntess;
   qthread.bodydata = &bodydata;
+  qthread.order    = order;
 
   np = EMP_Init(&start);
   if (outLevel > 1) printf(" EMP NumProcs = %d!\n", np);
@@ -4153,6 +4230,7 @@ EG_quadTess(const egObject *tess, egObject **quadTess)
       if (threads[i] != NULL) EMP_ThreadDestroy(threads[i]);
   if (qthread.mutex != NULL) EMP_LockDestroy(qthread.mutex);
   if (threads != NULL) free(threads);
+  EG_free(order);
   if (outLevel > 1)
     printf(" EMP Number of Seconds on Quad Thread Block = %ld\n",
            EMP_Done(&start));
@@ -14,169 +14,342 @@
 
 #include "Surreal/SurrealS.h"
 
+#include "emp.h"
+
+#define NMASSSUM   11           /* area/len, vol, xyz cg, Ixx-Izz, Ixy-Iyz */
+#define MASSTHREAD 20000        /* fewer triangles are not worth threads   */
+
 
 extern "C" int EG_sameThread( const ego object );
 
 
+/* the sums are kept by Face and added in Face order after the threads
+ * finish, so the properties do not depend on the number of threads */
 
-extern "C" int EG_tessMassProps(const ego tess, double *props)
-{
-  int      iedge, iface, ipnt, itri, ip0, ip1, ip2, *tris;
-  double   len1, area1, xa, ya, za, xb, yb, zb;
-  double   xbar, ybar, zbar, areax, areay, areaz, *xyz;
-  double   len=0.0, area=0.0, vol=0.0, xcg=0.0, ycg=0.0, zcg=0.0;
-  double   Ixx=0.0, Ixy=0.0,  Ixz=0.0, Iyy=0.0, Iyz=0.0, Izz=0.0;
-  ego      body;
-  egTessel *btess;
+template<class T>
+struct EMPmass {
+  void           *mutex;        /* the mutex or NULL for single thread */
+  long           master;        /* master thread ID */
+  int            end;           /* number of Faces */
+  int            index;         /* next entry in order */
+  int            *order;        /* Faces in the order to be done */
+  int            *tindex;       /* tessellation for each Face */
+  int            *findex;       /* Face index (bias-0) for each Face */
+  int            *stat;         /* status for each Face */
+  const egTessel **btess;       /* the tessellations */
+  double         **xyz_dot;     /* global sensitivities -- NULL for none */
+  T              *sums;         /* NMASSSUM for each Face */
+};
 
-  if (tess == NULL)                 return EGADS_NULLOBJ;
-  if (tess->magicnumber != MAGIC)   return EGADS_NOTOBJ;
-  if (tess->oclass != TESSELLATION) return EGADS_NOTTESS;
-  if (EG_sameThread(tess))          return EGADS_CNTXTHRD;
-  btess = (egTessel *) tess->blind;
-  if (btess == NULL) {
-    printf(" EGADS Error: NULL Blind Object (EG_tessMassProps)!\n");
-    return EGADS_NOTFOUND;
+
+static int
+EG_local2Global(const egTessel *btess, int index, int local)
+{
+  if (index < 0) {
+    if (btess->tess1d[-index-1].global == NULL) return EGADS_DEGEN;
+    if (local > btess->tess1d[-index-1].npts) return EGADS_RANGERR;
+    return btess->tess1d[-index-1].global[local] - 1;
+  } else {
+    if (btess->tess2d[ index-1].global == NULL) return EGADS_DEGEN;
+    if (local > btess->tess2d[ index-1].npts) return EGADS_RANGERR;
+    return btess->tess2d[ index-1].global[local] - 1;
   }
-  body = btess->src;
-  if (body == NULL) {
-    printf(" EGADS Error: NULL Source Object (EG_tessMassProps)!\n");
-    return EGADS_NULLOBJ;
+}
+
+
+static inline void
+EG_massPoint(double *xyz0, const double *xyz, /*@unused@*/ const double *dxyz,
+             int ip)
+{
+  xyz0[0] = xyz[3*ip  ];
+  xyz0[1] = xyz[3*ip+1];
+  xyz0[2] = xyz[3*ip+2];
+}
+
+
+static inline void
+EG_massPoint(SurrealS<1> *xyz0, const double *xyz, const double *dxyz, int ip)
+{
+  xyz0[0]         = xyz[3*ip  ];
+  xyz0[1]         = xyz[3*ip+1];
+  xyz0[2]         = xyz[3*ip+2];
+  xyz0[0].deriv() = dxyz[3*ip  ];
+  xyz0[1].deriv() = dxyz[3*ip+1];
+  xyz0[2].deriv() = dxyz[3*ip+2];
+}
+
+
+/* gather the sensitivities of an Edge (index < 0) or Face (index > 0) */
+static int
+EG_massDots(const egTessel *btess, int index, const double *xyz_dot,
+            double **dxyz)
+{
+  int i, npts, global;
+
+  *dxyz = NULL;
+  if (xyz_dot == NULL) return EGADS_SUCCESS;
+
+  if (index < 0) {
+    npts = btess->tess1d[-index-1].npts;
+  } else {
+    npts = btess->tess2d[ index-1].npts;
   }
-  if (body->magicnumber != MAGIC) {
-    printf(" EGADS Error: Source Not an Object (EG_tessMassProps)!\n");
-    return EGADS_NOTOBJ;
+  if (npts <= 0) return EGADS_SUCCESS;
+
+  *dxyz = (double *) EG_alloc(3*npts*sizeof(double));
+  if (*dxyz == NULL) return EGADS_MALLOC;
+
+  for (i = 0; i < npts; i++) {
+    global = EG_local2Global(btess, index, i);
+    if (global < EGADS_SUCCESS) {
+      printf(" EGADS Error: %d %d EG_local2Global = %d (EG_tessMassProps)!\n",
+             index, i+1, global);
+      EG_free(*dxyz);
+      *dxyz = NULL;
+      return global;
+    }
+    (*dxyz)[3*i  ] = xyz_dot[3*global  ];
+    (*dxyz)[3*i+1] = xyz_dot[3*global+1];
+    (*dxyz)[3*i+2] = xyz_dot[3*global+2];
   }
-  if (body->oclass != BODY) {
-    printf(" EGADS Error: Source Not Body (EG_tessMassProps)!\n");
-    return EGADS_NOTBODY;
+
+  return EGADS_SUCCESS;
+}
+
+
+/* accumulate the length and cg sums for the segments of an Edge */
+template<class T>
+static void
+EG_massEdge(const egTess1D *tess1d, /*@null@*/ const double *dxyz, T *sums)
+{
+  int ipnt;
+  T   len1, xyz0[3], xyz1[3];
+  T   len=0.0, xcg=0.0, ycg=0.0, zcg=0.0;
+
+  for (ipnt = 1; ipnt < tess1d->npts; ipnt++) {
+    EG_massPoint(xyz0, tess1d->xyz, dxyz, ipnt-1);
+    EG_massPoint(xyz1, tess1d->xyz, dxyz, ipnt  );
+
+    len1 = sqrt((xyz1[0]-xyz0[0]) * (xyz1[0]-xyz0[0]) +
+                (xyz1[1]-xyz0[1]) * (xyz1[1]-xyz0[1]) +
+                (xyz1[2]-xyz0[2]) * (xyz1[2]-xyz0[2]));
+
+    len += len1;
+    xcg += (xyz1[0] + xyz0[0]) * len1 / 2;
+    ycg += (xyz1[1] + xyz0[1]) * len1 / 2;
+    zcg += (xyz1[2] + xyz0[2]) * len1 / 2;
   }
-  
-  if (body->mtype == WIREBODY) {
-    
-    for (iedge = 0; iedge < btess->nEdge; iedge++) {
-      xyz = btess->tess1d[iedge].xyz;
-      for (ipnt = 1; ipnt < btess->tess1d[iedge].npts; ipnt++) {
-        ip0 = 3 * (ipnt - 1);
-        ip1 = 3 * (ipnt    );
-        
-        len1 = sqrt((xyz[ip1  ]-xyz[ip0  ]) * (xyz[ip1  ]-xyz[ip0  ]) +
-                    (xyz[ip1+1]-xyz[ip0+1]) * (xyz[ip1+1]-xyz[ip0+1]) +
-                    (xyz[ip1+2]-xyz[ip0+2]) * (xyz[ip1+2]-xyz[ip0+2]));
-        
-        len += len1;
-        xcg += (xyz[ip1  ] + xyz[ip0  ]) * len1 / 2;
-        ycg += (xyz[ip1+1] + xyz[ip0+1]) * len1 / 2;
-        zcg += (xyz[ip1+2] + xyz[ip0+2]) * len1 / 2;
-      }
-    }
-    
-    xcg /= len;
-    ycg /= len;
-    zcg /= len;
-    
-    area = len;
-    
-  } else if (body->mtype != SOLIDBODY) {
-    
+
+  sums[0] += len;
+  sums[2] += xcg;
+  sums[3] += ycg;
+  sums[4] += zcg;
+}
+
+
+/* the sums for the triangles of a Face -- no calls or checks in the loops
+ * so that the compiler can keep everything in registers and vectorize */
+template<class T>
+static void
+EG_massFace(const egTess2D *tess2d, int solid, /*@null@*/ const double *dxyz,
+            T *sums)
+{
+  int       itri, *tris;
+  T         xa, ya, za, xb, yb, zb, area1;
+  T         xbar, ybar, zbar, areax, areay, areaz, xyz0[3], xyz1[3], xyz2[3];
+  T         area=0.0, vol=0.0, xcg=0.0, ycg=0.0, zcg=0.0;
+  T         Ixx=0.0, Ixy=0.0,  Ixz=0.0, Iyy=0.0, Iyz=0.0, Izz=0.0;
+  double    *xyz;
+
+  xyz  = tess2d->xyz;
+  tris = tess2d->tris;
+
+  if (solid == 0) {
+
     /* FaceBody & SheetBody */
-    for (iface = 0; iface < btess->nFace; iface++) {
-      xyz  = btess->tess2d[iface].xyz;
-      tris = btess->tess2d[iface].tris;
-      
-      for (itri = 0; itri < btess->tess2d[iface].ntris; itri++) {
-        ip0 = 3 * (tris[3*itri  ] - 1);
-        ip1 = 3 * (tris[3*itri+1] - 1);
-        ip2 = 3 * (tris[3*itri+2] - 1);
-        
-        xa = xyz[ip1  ] - xyz[ip0  ];
-        ya = xyz[ip1+1] - xyz[ip0+1];
-        za = xyz[ip1+2] - xyz[ip0+2];
-        
-        xb = xyz[ip2  ] - xyz[ip0  ];
-        yb = xyz[ip2+1] - xyz[ip0+1];
-        zb = xyz[ip2+2] - xyz[ip0+2];
-        
-        xbar = xyz[ip0  ] + xyz[ip1  ] + xyz[ip2  ];
-        ybar = xyz[ip0+1] + xyz[ip1+1] + xyz[ip2+1];
-        zbar = xyz[ip0+2] + xyz[ip1+2] + xyz[ip2+2];
-        
-        areax = ya * zb - za * yb;
-        areay = za * xb - xa * zb;
-        areaz = xa * yb - ya * xb;
-        area1 = sqrt(areax*areax + areay*areay + areaz*areaz) / 2;
-        
-        area += area1;
-        xcg  += (xbar * area1) / 3;
-        ycg  += (ybar * area1) / 3;
-        zcg  += (zbar * area1) / 3;
-      }
+    for (itri = 0; itri < tess2d->ntris; itri++) {
+      EG_massPoint(xyz0, xyz, dxyz, tris[3*itri  ]-1);
+      EG_massPoint(xyz1, xyz, dxyz, tris[3*itri+1]-1);
+      EG_massPoint(xyz2, xyz, dxyz, tris[3*itri+2]-1);
+
+      xa = xyz1[0] - xyz0[0];
+      ya = xyz1[1] - xyz0[1];
+      za = xyz1[2] - xyz0[2];
+
+      xb = xyz2[0] - xyz0[0];
+      yb = xyz2[1] - xyz0[1];
+      zb = xyz2[2] - xyz0[2];
+
+      xbar = xyz0[0] + xyz1[0] + xyz2[0];
+      ybar = xyz0[1] + xyz1[1] + xyz2[1];
+      zbar = xyz0[2] + xyz1[2] + xyz2[2];
+
+      areax = ya * zb - za * yb;
+      areay = za * xb - xa * zb;
+      areaz = xa * yb - ya * xb;
+      area1 = sqrt(areax*areax + areay*areay + areaz*areaz) / 2;
+
+      area += area1;
+      xcg  += (xbar * area1) / 3;
+      ycg  += (ybar * area1) / 3;
+      zcg  += (zbar * area1) / 3;
     }
-    
+
+  } else {
+
+    /* SolidBody */
+    for (itri = 0; itri < tess2d->ntris; itri++) {
+      EG_massPoint(xyz0, xyz, dxyz, tris[3*itri  ]-1);
+      EG_massPoint(xyz1, xyz, dxyz, tris[3*itri+1]-1);
+      EG_massPoint(xyz2, xyz, dxyz, tris[3*itri+2]-1);
+
+      xa = xyz1[0] - xyz0[0];
+      ya = xyz1[1] - xyz0[1];
+      za = xyz1[2] - xyz0[2];
+
+      xb = xyz2[0] - xyz0[0];
+      yb = xyz2[1] - xyz0[1];
+      zb = xyz2[2] - xyz0[2];
+
+      xbar = xyz0[0] + xyz1[0] + xyz2[0];
+      ybar = xyz0[1] + xyz1[1] + xyz2[1];
+      zbar = xyz0[2] + xyz1[2] + xyz2[2];
+
+      areax = ya * zb - za * yb;
+      areay = za * xb - xa * zb;
+      areaz = xa * yb - ya * xb;
+
+      area += sqrt(areax*areax + areay*areay + areaz*areaz) / 2;
+      vol  += (       xbar*areax +        ybar*areay +        zbar*areaz)/18;
+      xcg  += (xbar/2*xbar*areax + xbar  *ybar*areay + xbar  *zbar*areaz)/54;
+      ycg  += (ybar  *xbar*areax + ybar/2*ybar*areay + ybar  *zbar*areaz)/54;
+      zcg  += (zbar  *xbar*areax + zbar  *ybar*areay + zbar/2*zbar*areaz)/54;
+      Ixx  += (ybar*ybar*ybar*areay + zbar*zbar*zbar*areaz)/162;
+      Iyy  += (xbar*xbar*xbar*areax + zbar*zbar*zbar*areaz)/162;
+      Izz  += (xbar*xbar*xbar*areax + ybar*ybar*ybar*areay)/162;
+
+      Ixy  -= (xbar*ybar*xbar*areax/2 + ybar*xbar*ybar*areay/2 +
+               xbar*ybar*zbar*areaz  )/162;
+      Ixz  -= (xbar*zbar*xbar*areax/2 + xbar*zbar*ybar*areay   +
+               zbar*xbar*zbar*areaz/2)/162;
+      Iyz  -= (ybar*zbar*xbar*areax   + ybar*zbar*ybar*areay/2 +
+               zbar*ybar*zbar*areaz/2)/162;
+    }
+
+  }
+
+  sums[ 0] = area;
+  sums[ 1] = vol;
+  sums[ 2] = xcg;
+  sums[ 3] = ycg;
+  sums[ 4] = zcg;
+  sums[ 5] = Ixx;
+  sums[ 6] = Iyy;
+  sums[ 7] = Izz;
+  sums[ 8] = Ixy;
+  sums[ 9] = Ixz;
+  sums[10] = Iyz;
+}
+
+
+template<class T>
+static void
+EG_massThread(void *struc)
+{
+  int        index, itess, iface, stat;
+  long       ID;
+  double     *dxyz;
+  EMPmass<T> *mass;
+
+  mass = (EMPmass<T> *) struc;
+
+  /* get our identifier */
+  ID = EMP_ThreadID();
+
+  /* look for work */
+  for (;;) {
+
+    /* only one thread at a time here -- controlled by a mutex! */
+    if (mass->mutex != NULL) EMP_LockSet(mass->mutex);
+    index = mass->index;
+    mass->index = index+1;
+    if (mass->mutex != NULL) EMP_LockRelease(mass->mutex);
+    if (index >= mass->end) break;
+
+    /* do the work -- biggest Faces are first in the queue */
+    index = mass->order[index];
+    itess = mass->tindex[index];
+    iface = mass->findex[index];
+    stat  = EG_massDots(mass->btess[itess], iface+1,
+                        mass->xyz_dot == NULL ? NULL : mass->xyz_dot[itess],
+                        &dxyz);
+    if (stat == EGADS_SUCCESS)
+      EG_massFace(&mass->btess[itess]->tess2d[iface],
+                  mass->btess[itess]->src->mtype == SOLIDBODY, dxyz,
+                  &mass->sums[NMASSSUM*index]);
+    if (dxyz != NULL) EG_free(dxyz);
+    mass->stat[index] = stat;
+  }
+
+  /* exhausted all work -- exit */
+  if (ID != mass->master) EMP_ThreadExit();
+}
+
+
+/* order the Faces by decreasing number of triangles */
+static int
+EG_massCost(const void *a, const void *b)
+{
+  const int *ia = (const int *) a;
+  const int *ib = (const int *) b;
+
+  if (ia[0] != ib[0]) return ib[0] - ia[0];
+  return ia[1] - ib[1];
+}
+
+
+/* fill in the 14 properties from the sums */
+template<class T>
+static void
+EG_massFinish(int mtype, T *sums, T *props)
+{
+  T vol, area, xcg, ycg, zcg, Ixx, Ixy, Ixz, Iyy, Iyz, Izz;
+
+  area = sums[ 0];
+  vol  = sums[ 1];
+  xcg  = sums[ 2];
+  ycg  = sums[ 3];
+  zcg  = sums[ 4];
+  Ixx  = sums[ 5];
+  Iyy  = sums[ 6];
+  Izz  = sums[ 7];
+  Ixy  = sums[ 8];
+  Ixz  = sums[ 9];
+  Iyz  = sums[10];
+
+  if (mtype != SOLIDBODY) {
+
+    /* WireBody (area is the length), FaceBody & SheetBody */
     xcg /= area;
     ycg /= area;
     zcg /= area;
-    
+
   } else {
-    
-    /* SolidBody */
-    for (iface = 0; iface < btess->nFace; iface++) {
-      xyz  = btess->tess2d[iface].xyz;
-      tris = btess->tess2d[iface].tris;
-      
-      for (itri = 0; itri < btess->tess2d[iface].ntris; itri++) {
-        ip0 = 3 * (tris[3*itri  ] - 1);
-        ip1 = 3 * (tris[3*itri+1] - 1);
-        ip2 = 3 * (tris[3*itri+2] - 1);
-        
-        xa = xyz[ip1  ] - xyz[ip0  ];
-        ya = xyz[ip1+1] - xyz[ip0+1];
-        za = xyz[ip1+2] - xyz[ip0+2];
-        
-        xb = xyz[ip2  ] - xyz[ip0  ];
-        yb = xyz[ip2+1] - xyz[ip0+1];
-        zb = xyz[ip2+2] - xyz[ip0+2];
-        
-        xbar = xyz[ip0  ] + xyz[ip1  ] + xyz[ip2  ];
-        ybar = xyz[ip0+1] + xyz[ip1+1] + xyz[ip2+1];
-        zbar = xyz[ip0+2] + xyz[ip1+2] + xyz[ip2+2];
-        
-        areax = ya * zb - za * yb;
-        areay = za * xb - xa * zb;
-        areaz = xa * yb - ya * xb;
-        
-        area += sqrt(areax*areax + areay*areay + areaz*areaz) / 2;
-        vol  += (       xbar*areax +        ybar*areay +        zbar*areaz)/18;
-        xcg  += (xbar/2*xbar*areax + xbar  *ybar*areay + xbar  *zbar*areaz)/54;
-        ycg  += (ybar  *xbar*areax + ybar/2*ybar*areay + ybar  *zbar*areaz)/54;
-        zcg  += (zbar  *xbar*areax + zbar  *ybar*areay + zbar/2*zbar*areaz)/54;
-        Ixx  += (ybar*ybar*ybar*areay + zbar*zbar*zbar*areaz)/162;
-        Iyy  += (xbar*xbar*xbar*areax + zbar*zbar*zbar*areaz)/162;
-        Izz  += (xbar*xbar*xbar*areax + ybar*ybar*ybar*areay)/162;
-        
-        Ixy  -= (xbar*ybar*xbar*areax/2 + ybar*xbar*ybar*areay/2 +
-                 xbar*ybar*zbar*areaz  )/162;
-        Ixz  -= (xbar*zbar*xbar*areax/2 + xbar*zbar*ybar*areay   +
-                 zbar*xbar*zbar*areaz/2)/162;
-        Iyz  -= (ybar*zbar*xbar*areax   + ybar*zbar*ybar*areay/2 +
-                 zbar*ybar*zbar*areaz/2)/162;
-      }
-    }
-    
+
     xcg /= vol;
     ycg /= vol;
     zcg /= vol;
-    
+
     /* parallel-axis theorem */
     Ixx -= vol * (            ycg * ycg + zcg * zcg);
     Iyy -= vol * (xcg * xcg             + zcg * zcg);
     Izz -= vol * (xcg * xcg + ycg * ycg            );
-    
+
     Ixy += vol * (xcg * ycg      );
     Ixz += vol * (xcg *       zcg);
     Iyz += vol * (      ycg * zcg);
   }
-  
+
   /* store the properties in the array */
   props[ 0] = vol;
   props[ 1] = area;
@@ -192,48 +365,167 @@ extern "C" int EG_tessMassProps(const ego tess, double *props)
   props[11] = Ixz;
   props[12] = Iyz;
   props[13] = Izz;
-  
-  return EGADS_SUCCESS;
 }
 
 
+/* the mass properties of a set of tessellations -- the Faces of all of
+ * the Bodys are spread over the threads */
+template<class T>
 static int
-EG_local2Global(const egTessel *btess, int index, int local)
+EG_massProps(int ntess, const egTessel **btess, /*@null@*/ double **xyz_dot,
+             T *props)
 {
-  if (index < 0) {
-    if (btess->tess1d[-index-1].global == NULL) return EGADS_DEGEN;
-    if (local > btess->tess1d[-index-1].npts) return EGADS_RANGERR;
-    return btess->tess1d[-index-1].global[local] - 1;
-  } else {
-    if (btess->tess2d[ index-1].global == NULL) return EGADS_DEGEN;
-    if (local > btess->tess2d[ index-1].npts) return EGADS_RANGERR;
-    return btess->tess2d[ index-1].global[local] - 1;
+  int        i, j, k, np, nface, ntris, stat;
+  int        *order = NULL, *tindex = NULL, *findex = NULL, *fstat = NULL;
+  double     *dxyz;
+  void       **threads = NULL;
+  T          *sums = NULL, tsums[NMASSSUM];
+  EMPmass<T> mass;
+
+  nface = ntris = 0;
+  for (i = 0; i < ntess; i++) {
+    if (btess[i]->src->mtype == WIREBODY) continue;
+    for (j = 0; j < btess[i]->nFace; j++) {
+      if (btess[i]->tess2d[j].ntris <= 0) continue;
+      nface++;
+      ntris += btess[i]->tess2d[j].ntris;
+    }
   }
+
+  if (nface > 0) {
+    order  = (int *) EG_alloc(2*nface*sizeof(int));
+    tindex = (int *) EG_alloc(  nface*sizeof(int));
+    findex = (int *) EG_alloc(  nface*sizeof(int));
+    fstat  = (int *) EG_alloc(  nface*sizeof(int));
+    sums   = new T[NMASSSUM*nface];
+    if ((order == NULL) || (tindex == NULL) || (findex == NULL) ||
+        (fstat == NULL)) {
+      stat = EGADS_MALLOC;
+      goto cleanup;
+    }
+    for (k = i = 0; i < ntess; i++) {
+      if (btess[i]->src->mtype == WIREBODY) continue;
+      for (j = 0; j < btess[i]->nFace; j++) {
+        if (btess[i]->tess2d[j].ntris <= 0) continue;
+        tindex[k]    = i;
+        findex[k]    = j;
+        fstat[k]     = EGADS_SUCCESS;
+        order[2*k  ] = btess[i]->tess2d[j].ntris;
+        order[2*k+1] = k;
+        k++;
+      }
+    }
+    qsort(order, nface, 2*sizeof(int), EG_massCost);
+    for (k = 0; k < nface; k++) order[k] = order[2*k+1];
+
+    mass.mutex   = NULL;
+    mass.end     = nface;
+    mass.index   = 0;
+    mass.order   = order;
+    mass.tindex  = tindex;
+    mass.findex  = findex;
+    mass.stat    = fstat;
+    mass.btess   = btess;
+    mass.xyz_dot = xyz_dot;
+    mass.sums    = sums;
+
+    /* create the threads and get going! */
+    np = EMP_Init(NULL);
+    if (np > nface) np = nface;
+    if (ntris < MASSTHREAD) np = 1;
+    if (np > 1) {
+      /* create the mutex to handle list synchronization */
+      mass.mutex = EMP_LockCreate();
+      if (mass.mutex == NULL) {
+        printf(" EMP Error: mutex creation = NULL (EG_tessMassProps)!\n");
+        np = 1;
+      } else {
+        /* get storage for our extra threads */
+        threads = (void **) EG_alloc((np-1)*sizeof(void *));
+        if (threads == NULL) {
+          EMP_LockDestroy(mass.mutex);
+          mass.mutex = NULL;
+          np = 1;
+        }
+      }
+    }
+    mass.master = EMP_ThreadID();
+    if (threads != NULL)
+      for (i = 0; i < np-1; i++) {
+        threads[i] = EMP_ThreadCreate(EG_massThread<T>, &mass);
+        if (threads[i] == NULL)
+          printf(" EMP Error Creating Thread #%d (EG_tessMassProps)!\n", i+1);
+      }
+    /* now run the thread block from the original thread */
+    EG_massThread<T>(&mass);
+
+    /* wait for all others to return */
+    if (threads != NULL)
+      for (i = 0; i < np-1; i++)
+        if (threads[i] != NULL) EMP_ThreadWait(threads[i]);
+
+    /* cleanup */
+    if (threads != NULL)
+      for (i = 0; i < np-1; i++)
+        if (threads[i] != NULL) EMP_ThreadDestroy(threads[i]);
+    if (mass.mutex != NULL) EMP_LockDestroy(mass.mutex);
+    if (threads != NULL) EG_free(threads);
+
+    for (k = 0; k < nface; k++)
+      if (fstat[k] != EGADS_SUCCESS) {
+        stat = fstat[k];
+        goto cleanup;
+      }
+  }
+
+  /* add up the sums in Face order (Edges for WireBodies) */
+  for (k = i = 0; i < ntess; i++) {
+    for (j = 0; j < NMASSSUM; j++) tsums[j] = 0.0;
+    if (btess[i]->src->mtype == WIREBODY) {
+      for (j = 0; j < btess[i]->nEdge; j++) {
+        stat = EG_massDots(btess[i], -j-1,
+                           xyz_dot == NULL ? NULL : xyz_dot[i], &dxyz);
+        if (stat != EGADS_SUCCESS) goto cleanup;
+        EG_massEdge(&btess[i]->tess1d[j], dxyz, tsums);
+        if (dxyz != NULL) EG_free(dxyz);
+      }
+    } else {
+      for (; k < nface; k++) {
+        if (tindex[k] != i) break;
+        for (j = 0; j < NMASSSUM; j++) tsums[j] += sums[NMASSSUM*k+j];
+      }
+    }
+    EG_massFinish(btess[i]->src->mtype, tsums, &props[14*i]);
+  }
+  stat = EGADS_SUCCESS;
+
+cleanup:
+  if (order  != NULL) EG_free(order);
+  if (tindex != NULL) EG_free(tindex);
+  if (findex != NULL) EG_free(findex);
+  if (fstat  != NULL) EG_free(fstat);
+  if (sums   != NULL) delete [] sums;
+  return stat;
 }
 
 
-extern "C" int EG_tessMassProps_dot(const ego tess, double *xyz_dot,
-                                    double *props, double *props_dot)
+static int
+EG_massTessel(const ego tess, const egTessel **btess)
 {
-  int         iedge, iface, ipnt, itri, ip0, ip1, ip2, global, *tris;
-  SurrealS<1> len1, area1, xa, ya, za, xb, yb, zb;
-  SurrealS<1> xbar, ybar, zbar, areax, areay, areaz, xyz0[3], xyz1[3], xyz2[3];
-  SurrealS<1> len=0.0, area=0.0, vol=0.0, xcg=0.0, ycg=0.0, zcg=0.0;
-  SurrealS<1> Ixx=0.0, Ixy=0.0,  Ixz=0.0, Iyy=0.0, Iyz=0.0, Izz=0.0;
-  double      *xyz;
-  ego         body;
-  egTessel    *btess;
-  
+  ego      body;
+  egTessel *bt;
+
+  *btess = NULL;
   if (tess == NULL)                 return EGADS_NULLOBJ;
   if (tess->magicnumber != MAGIC)   return EGADS_NOTOBJ;
   if (tess->oclass != TESSELLATION) return EGADS_NOTTESS;
   if (EG_sameThread(tess))          return EGADS_CNTXTHRD;
-  btess = (egTessel *) tess->blind;
-  if (btess == NULL) {
+  bt = (egTessel *) tess->blind;
+  if (bt == NULL) {
     printf(" EGADS Error: NULL Blind Object (EG_tessMassProps)!\n");
     return EGADS_NOTFOUND;
   }
-  body = btess->src;
+  body = bt->src;
   if (body == NULL) {
     printf(" EGADS Error: NULL Source Object (EG_tessMassProps)!\n");
     return EGADS_NULLOBJ;
@@ -246,257 +538,86 @@ extern "C" int EG_tessMassProps_dot(const ego tess, double *xyz_dot,
     printf(" EGADS Error: Source Not Body (EG_tessMassProps)!\n");
     return EGADS_NOTBODY;
   }
-  
-  if (body->mtype == WIREBODY) {
-    
-    for (iedge = 0; iedge < btess->nEdge; iedge++) {
-      xyz = btess->tess1d[iedge].xyz;
-      for (ipnt = 1; ipnt < btess->tess1d[iedge].npts; ipnt++) {
-        ip0             = ipnt - 1;
-        ip1             = ipnt;
-        global          = EG_local2Global(btess, -iedge-1, ip0);
-        if (global < EGADS_SUCCESS) {
-          printf(" EGADS Error: %d %d EG_local2Global = %d (EG_tessMassProps)!\n",
-                 -iedge-1, ip0+1, global);
-          return global;
-        }
-        xyz0[0]         = xyz[3*ip0  ];
-        xyz0[1]         = xyz[3*ip0+1];
-        xyz0[2]         = xyz[3*ip0+2];
-        xyz0[0].deriv() = xyz_dot[3*global  ];
-        xyz0[1].deriv() = xyz_dot[3*global+1];
-        xyz0[2].deriv() = xyz_dot[3*global+2];
-        global          = EG_local2Global(btess, -iedge-1, ip1);
-        if (global < EGADS_SUCCESS) {
-          printf(" EGADS Error: %d %d EG_local2Global = %d (EG_tessMassProps)!\n",
-                 -iedge-1, ip1+1, global);
-          return global;
-        }
-        xyz1[0]         = xyz[3*ip1  ];
-        xyz1[1]         = xyz[3*ip1+1];
-        xyz1[2]         = xyz[3*ip1+2];
-        xyz1[0].deriv() = xyz_dot[3*global  ];
-        xyz1[1].deriv() = xyz_dot[3*global+1];
-        xyz1[2].deriv() = xyz_dot[3*global+2];
-        
-        len1 = sqrt((xyz1[0]-xyz0[0]) * (xyz1[0]-xyz0[0]) +
-                    (xyz1[1]-xyz0[1]) * (xyz1[1]-xyz0[1]) +
-                    (xyz1[2]-xyz0[2]) * (xyz1[2]-xyz0[2]));
-        
-        len += len1;
-        xcg += (xyz1[0] + xyz0[0]) * len1 / 2;
-        ycg += (xyz1[1] + xyz0[1]) * len1 / 2;
-        zcg += (xyz1[2] + xyz0[2]) * len1 / 2;
-      }
+
+  *btess = bt;
+  return EGADS_SUCCESS;
+}
+
+
+extern "C" int EG_tessMassPropsBatch(int ntess, const ego *tess,
+                                     double *props)
+{
+  int            i, stat;
+  const egTessel **btess;
+
+  if (ntess <= 0)   return EGADS_RANGERR;
+  if (tess == NULL) return EGADS_NULLOBJ;
+  btess = (const egTessel **) EG_alloc(ntess*sizeof(egTessel *));
+  if (btess == NULL) return EGADS_MALLOC;
+
+  for (i = 0; i < ntess; i++) {
+    stat = EG_massTessel(tess[i], &btess[i]);
+    if (stat != EGADS_SUCCESS) {
+      EG_free(btess);
+      return stat;
     }
-    
-    xcg /= len;
-    ycg /= len;
-    zcg /= len;
-    
-    area = len;
-    
-  } else if (body->mtype != SOLIDBODY) {
-    
-    /* FaceBody & SheetBody */
-    for (iface = 0; iface < btess->nFace; iface++) {
-      xyz  = btess->tess2d[iface].xyz;
-      tris = btess->tess2d[iface].tris;
-      
-      for (itri = 0; itri < btess->tess2d[iface].ntris; itri++) {
-        ip0             = tris[3*itri  ] - 1;
-        ip1             = tris[3*itri+1] - 1;
-        ip2             = tris[3*itri+2] - 1;
-        global          = EG_local2Global(btess, iface+1, ip0);
-        if (global < EGADS_SUCCESS) {
-          printf(" EGADS Error: %d %d EG_local2Global = %d (EG_tessMassProps)!\n",
-                 iface+1, ip0+1, global);
-          return global;
-        }
-        xyz0[0]         = xyz[3*ip0  ];
-        xyz0[1]         = xyz[3*ip0+1];
-        xyz0[2]         = xyz[3*ip0+2];
-        xyz0[0].deriv() = xyz_dot[3*global  ];
-        xyz0[1].deriv() = xyz_dot[3*global+1];
-        xyz0[2].deriv() = xyz_dot[3*global+2];
-        global          = EG_local2Global(btess, iface+1, ip1);
-        if (global < EGADS_SUCCESS) {
-          printf(" EGADS Error: %d %d EG_local2Global = %d (EG_tessMassProps)!\n",
-                 iface+1, ip1+1, global);
-          return global;
-        }
-        xyz1[0]         = xyz[3*ip1  ];
-        xyz1[1]         = xyz[3*ip1+1];
-        xyz1[2]         = xyz[3*ip1+2];
-        xyz1[0].deriv() = xyz_dot[3*global  ];
-        xyz1[1].deriv() = xyz_dot[3*global+1];
-        xyz1[2].deriv() = xyz_dot[3*global+2];
-        global          = EG_local2Global(btess, iface+1, ip2);
-        if (global < EGADS_SUCCESS) {
-          printf(" EGADS Error: %d %d EG_local2Global = %d (EG_tessMassProps)!\n",
-                 iface+1, ip2+1, global);
-          return global;
-        }
-        xyz2[0]         = xyz[3*ip2  ];
-        xyz2[1]         = xyz[3*ip2+1];
-        xyz2[2]         = xyz[3*ip2+2];
-        xyz2[0].deriv() = xyz_dot[3*global  ];
-        xyz2[1].deriv() = xyz_dot[3*global+1];
-        xyz2[2].deriv() = xyz_dot[3*global+2];
-        
-        xa = xyz1[0] - xyz0[0];
-        ya = xyz1[1] - xyz0[1];
-        za = xyz1[2] - xyz0[2];
-        
-        xb = xyz2[0] - xyz0[0];
-        yb = xyz2[1] - xyz0[1];
-        zb = xyz2[2] - xyz0[2];
-        
-        xbar = xyz0[0] + xyz1[0] + xyz2[0];
-        ybar = xyz0[1] + xyz1[1] + xyz2[1];
-        zbar = xyz0[2] + xyz1[2] + xyz2[2];
-        
-        areax = ya * zb - za * yb;
-        areay = za * xb - xa * zb;
-        areaz = xa * yb - ya * xb;
-        area1 = sqrt(areax*areax + areay*areay + areaz*areaz) / 2;
-        
-        area += area1;
-        xcg  += (xbar * area1) / 3;
-        ycg  += (ybar * area1) / 3;
-        zcg  += (zbar * area1) / 3;
-      }
+  }
+
+  stat = EG_massProps<double>(ntess, btess, NULL, props);
+  EG_free(btess);
+  return stat;
+}
+
+
+extern "C" int EG_tessMassProps(const ego tess, double *props)
+{
+  return EG_tessMassPropsBatch(1, &tess, props);
+}
+
+
+extern "C" int EG_tessMassPropsBatch_dot(int ntess, const ego *tess,
+                                         double **xyz_dot, double *props,
+                                         double *props_dot)
+{
+  int            i, stat;
+  const egTessel **btess;
+  SurrealS<1>    *sprops;
+
+  if (ntess <= 0)      return EGADS_RANGERR;
+  if (tess == NULL)    return EGADS_NULLOBJ;
+  if (xyz_dot == NULL) return EGADS_NODATA;
+  btess = (const egTessel **) EG_alloc(ntess*sizeof(egTessel *));
+  if (btess == NULL) return EGADS_MALLOC;
+
+  for (i = 0; i < ntess; i++) {
+    stat = EG_massTessel(tess[i], &btess[i]);
+    if (stat != EGADS_SUCCESS) {
+      EG_free(btess);
+      return stat;
     }
-    
-    xcg /= area;
-    ycg /= area;
-    zcg /= area;
-    
-  } else {
-    
-    /* SolidBody */
-    for (iface = 0; iface < btess->nFace; iface++) {
-      xyz  = btess->tess2d[iface].xyz;
-      tris = btess->tess2d[iface].tris;
-      
-      for (itri = 0; itri < btess->tess2d[iface].ntris; itri++) {
-        ip0             = tris[3*itri  ] - 1;
-        ip1             = tris[3*itri+1] - 1;
-        ip2             = tris[3*itri+2] - 1;
-        global          = EG_local2Global(btess, iface+1, ip0);
-        if (global < EGADS_SUCCESS) {
-          printf(" EGADS Error: %d %d EG_local2Global = %d (EG_tessMassProps)!\n",
-                 iface+1, ip0+1, global);
-          return global;
-        }
-        xyz0[0]         = xyz[3*ip0  ];
-        xyz0[1]         = xyz[3*ip0+1];
-        xyz0[2]         = xyz[3*ip0+2];
-        xyz0[0].deriv() = xyz_dot[3*global  ];
-        xyz0[1].deriv() = xyz_dot[3*global+1];
-        xyz0[2].deriv() = xyz_dot[3*global+2];
-        global          = EG_local2Global(btess, iface+1, ip1);
-        if (global < EGADS_SUCCESS) {
-          printf(" EGADS Error: %d %d EG_local2Global = %d (EG_tessMassProps)!\n",
-                 iface+1, ip1+1, global);
-          return global;
-        }
-        xyz1[0]         = xyz[3*ip1  ];
-        xyz1[1]         = xyz[3*ip1+1];
-        xyz1[2]         = xyz[3*ip1+2];
-        xyz1[0].deriv() = xyz_dot[3*global  ];
-        xyz1[1].deriv() = xyz_dot[3*global+1];
-        xyz1[2].deriv() = xyz_dot[3*global+2];
-        global          = EG_local2Global(btess, iface+1, ip2);
-        if (global < EGADS_SUCCESS) {
-          printf(" EGADS Error: %d %d EG_local2Global = %d (EG_tessMassProps)!\n",
-                 iface+1, ip2+1, global);
-          return global;
-        }
-        xyz2[0]         = xyz[3*ip2  ];
-        xyz2[1]         = xyz[3*ip2+1];
-        xyz2[2]         = xyz[3*ip2+2];
-        xyz2[0].deriv() = xyz_dot[3*global  ];
-        xyz2[1].deriv() = xyz_dot[3*global+1];
-        xyz2[2].deriv() = xyz_dot[3*global+2];
-        
-        xa = xyz1[0] - xyz0[0];
-        ya = xyz1[1] - xyz0[1];
-        za = xyz1[2] - xyz0[2];
-        
-        xb = xyz2[0] - xyz0[0];
-        yb = xyz2[1] - xyz0[1];
-        zb = xyz2[2] - xyz0[2];
-        
-        xbar = xyz0[0] + xyz1[0] + xyz2[0];
-        ybar = xyz0[1] + xyz1[1] + xyz2[1];
-        zbar = xyz0[2] + xyz1[2] + xyz2[2];
-        
-        areax = ya * zb - za * yb;
-        areay = za * xb - xa * zb;
-        areaz = xa * yb - ya * xb;
-        
-        area += sqrt(areax*areax + areay*areay + areaz*areaz) / 2;
-        vol  += (       xbar*areax +        ybar*areay +        zbar*areaz)/18;
-        xcg  += (xbar/2*xbar*areax + xbar  *ybar*areay + xbar  *zbar*areaz)/54;
-        ycg  += (ybar  *xbar*areax + ybar/2*ybar*areay + ybar  *zbar*areaz)/54;
-        zcg  += (zbar  *xbar*areax + zbar  *ybar*areay + zbar/2*zbar*areaz)/54;
-        Ixx  += (ybar*ybar*ybar*areay + zbar*zbar*zbar*areaz)/162;
-        Iyy  += (xbar*xbar*xbar*areax + zbar*zbar*zbar*areaz)/162;
-        Izz  += (xbar*xbar*xbar*areax + ybar*ybar*ybar*areay)/162;
-        
-        Ixy  -= (xbar*ybar*xbar*areax/2 + ybar*xbar*ybar*areay/2 +
-                 xbar*ybar*zbar*areaz  )/162;
-        Ixz  -= (xbar*zbar*xbar*areax/2 + xbar*zbar*ybar*areay   +
-                 zbar*xbar*zbar*areaz/2)/162;
-        Iyz  -= (ybar*zbar*xbar*areax   + ybar*zbar*ybar*areay/2 +
-                 zbar*ybar*zbar*areaz/2)/162;
-      }
+    if (xyz_dot[i] == NULL) {
+      EG_free(btess);
+      return EGADS_NODATA;
     }
-    
-    xcg /= vol;
-    ycg /= vol;
-    zcg /= vol;
-    
-    /* parallel-axis theorem */
-    Ixx -= vol * (            ycg * ycg + zcg * zcg);
-    Iyy -= vol * (xcg * xcg             + zcg * zcg);
-    Izz -= vol * (xcg * xcg + ycg * ycg            );
-    
-    Ixy += vol * (xcg * ycg      );
-    Ixz += vol * (xcg *       zcg);
-    Iyz += vol * (      ycg * zcg);
   }
-  
-  /* store the properties in the array */
-  props[ 0]     = vol.value();
-  props[ 1]     = area.value();
-  props[ 2]     = xcg.value();
-  props[ 3]     = ycg.value();
-  props[ 4]     = zcg.value();
-  props[ 5]     = Ixx.value();
-  props[ 6]     = Ixy.value();
-  props[ 7]     = Ixz.value();
-  props[ 8]     = Ixy.value();
-  props[ 9]     = Iyy.value();
-  props[10]     = Iyz.value();
-  props[11]     = Ixz.value();
-  props[12]     = Iyz.value();
-  props[13]     = Izz.value();
-  
-  props_dot[ 0] = vol.deriv();
-  props_dot[ 1] = area.deriv();
-  props_dot[ 2] = xcg.deriv();
-  props_dot[ 3] = ycg.deriv();
-  props_dot[ 4] = zcg.deriv();
-  props_dot[ 5] = Ixx.deriv();
-  props_dot[ 6] = Ixy.deriv();
-  props_dot[ 7] = Ixz.deriv();
-  props_dot[ 8] = Ixy.deriv();
-  props_dot[10] = Iyz.deriv();
-  props_dot[11] = Ixz.deriv();
-  props_dot[12] = Iyz.deriv();
-  props_dot[13] = Izz.deriv();
-  
-  return EGADS_SUCCESS;
+
+  /* value and derivative in one pass */
+  sprops = new SurrealS<1>[14*ntess];
+  stat   = EG_massProps< SurrealS<1> >(ntess, btess, xyz_dot, sprops);
+  if (stat == EGADS_SUCCESS)
+    for (i = 0; i < 14*ntess; i++) {
+      props[i]     = sprops[i].value();
+      props_dot[i] = sprops[i].deriv();
+    }
+
+  delete [] sprops;
+  EG_free(btess);
+  return stat;
+}
+
+
+extern "C" int EG_tessMassProps_dot(const ego tess, double *xyz_dot,
+                                    double *props, double *props_dot)
+{
+  return EG_tessMassPropsBatch_dot(1, &tess, &xyz_dot, props, props_dot);
 }
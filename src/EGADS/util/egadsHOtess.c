@@ -10,6 +10,7 @@
  */
  
 #include "egads.h"
+#include "emp.h"
 #include <string.h>
 #include <math.h>
 
@@ -38,6 +39,62 @@
 #endif
 
 
+  typedef struct {
+    int    i0;                    /* lower vertex index of the side */
+    int    i1;                    /* higher vertex index of the side */
+    double w;                     /* position along the side from i0 */
+    double uv[2];                 /* the parameters of the side point */
+    int    next;                  /* next entry in the bucket (-1 is end) */
+  } sidePoint;
+
+
+  typedef struct {
+    int       nhash;              /* number of buckets (power of 2) */
+    int       *head;              /* first entry in each bucket -- NULL off */
+    int       n;                  /* number of entries */
+    int       m;                  /* allocated entries */
+    sidePoint *pts;               /* the entries */
+  } sideCache;
+
+
+  typedef struct {
+    int    npts;                  /* number of vertices in the new Face */
+    int    ntris;                 /* number of triangles in the new Face */
+    double *coords;               /* the vertices -- NULL if not filled */
+    double *parms;                /* the parameters (in coords storage) */
+    int    *tris;                 /* the triangle indices */
+    double time;                  /* wall clock seconds spent on the Face */
+  } hoFace;
+
+
+  typedef struct {
+    void           *mutex;        /* the mutex or NULL for single thread */
+    long           master;        /* master thread ID */
+    int            end;           /* end of loop */
+    int            index;         /* current loop index */
+    int            stat;          /* first error -- stops the dispatch */
+    int            outLevel;      /* the output level */
+    int            *order;        /* Face indices -- most costly first */
+    int            quad;          /* quads in */
+    int            nst;           /* number of positions per element */
+    int            nItri;         /* number of triangles per element */
+    int            nIns;          /* number of insertions per side */
+    int            nmid;          /* number of interior positions */
+    const int      *iTris;        /* the internal triangle indices */
+    const int      *type;         /* the position types */
+    const double   *st;           /* the position weights */
+    const double   *frac;         /* the position side fractions */
+    const double   *sinsert;      /* the side insertions (sorted) */
+    egObject       *tess;         /* the source tessellation */
+    const egTessel *btess;        /* the source tessellation structure */
+    const egTessel *tessel;       /* the new tessellation (Edges filled) */
+    egObject       *body;         /* the Body */
+    egObject       **edges;       /* the Body's Edges */
+    egObject       **faces;       /* the Body's Faces */
+    hoFace         *hofaces;      /* the Face results */
+  } EMPhoface;
+
+
 static void
 EG_mdTFI(double xi, double et, int dim, const double *xl, const double *xu,
          const double *el,  const double *eu,  const double *uv0,
@@ -77,6 +134,108 @@ EG_findSideIndex(int side, const double weight, int nst,
 }
 
 
+/* the side points used to position the interior vertices are kept so
+   that a side shared by two elements (or used again for another interior
+   position) is only done once -- the side is stored with the lower vertex
+   first so that both elements find it */
+
+static void
+EG_sideInit(sideCache *cache, int nelem)
+{
+  int i;
+  
+  cache->n   = cache->m = 0;
+  cache->pts = NULL;
+  for (cache->nhash = 64; cache->nhash < 4*nelem; cache->nhash *= 2);
+  cache->head = (int *) EG_alloc(cache->nhash*sizeof(int));
+  if (cache->head == NULL) return;
+  for (i = 0; i < cache->nhash; i++) cache->head[i] = -1;
+}
+
+
+static void
+EG_sideFree(sideCache *cache)
+{
+  if (cache->head != NULL) EG_free(cache->head);
+  if (cache->pts  != NULL) EG_free(cache->pts);
+  cache->head = NULL;
+  cache->pts  = NULL;
+}
+
+
+static int
+EG_sideHash(const sideCache *cache, int i0, int i1, double w)
+{
+  unsigned int h;
+  
+  h = ((unsigned int) i0 * 73856093u) ^ ((unsigned int) i1 * 19349663u) ^
+      ((unsigned int) floor(w*65536.0+0.5) * 83492791u);
+  
+  return (int) (h & (unsigned int) (cache->nhash-1));
+}
+
+
+static int
+EG_sideFind(const sideCache *cache, int i0, int i1, double w, double *uv)
+{
+  int i;
+  
+  if (cache->head == NULL) return EGADS_NOTFOUND;
+  if (i0 > i1) {
+    i  = i0;
+    i0 = i1;
+    i1 = i;
+    w  = 1.0 - w;
+  }
+  
+  for (i = cache->head[EG_sideHash(cache, i0, i1, w)]; i >= 0;
+       i = cache->pts[i].next) {
+    if ((cache->pts[i].i0 != i0) || (cache->pts[i].i1 != i1)) continue;
+    if (fabs(cache->pts[i].w-w) > FUZZ) continue;
+    uv[0] = cache->pts[i].uv[0];
+    uv[1] = cache->pts[i].uv[1];
+    return EGADS_SUCCESS;
+  }
+  
+  return EGADS_NOTFOUND;
+}
+
+
+static void
+EG_sideAdd(sideCache *cache, int i0, int i1, double w, const double *uv)
+{
+  int       i, ih;
+  sidePoint *tmp;
+  
+  if (cache->head == NULL) return;
+  if (i0 > i1) {
+    i  = i0;
+    i0 = i1;
+    i1 = i;
+    w  = 1.0 - w;
+  }
+  
+  if (cache->n >= cache->m) {
+    i   = cache->m + 64;
+    if (cache->m > 64) i = 2*cache->m;
+    tmp = (sidePoint *) EG_reall(cache->pts, i*sizeof(sidePoint));
+    if (tmp == NULL) return;
+    cache->pts = tmp;
+    cache->m   = i;
+  }
+  
+  ih                         = EG_sideHash(cache, i0, i1, w);
+  cache->pts[cache->n].i0    = i0;
+  cache->pts[cache->n].i1    = i1;
+  cache->pts[cache->n].w     = w;
+  cache->pts[cache->n].uv[0] = uv[0];
+  cache->pts[cache->n].uv[1] = uv[1];
+  cache->pts[cache->n].next  = cache->head[ih];
+  cache->head[ih]            = cache->n;
+  cache->n++;
+}
+
+
 #ifdef REPOSITION
 static void
 EG_correctEndPts(int i1, int i2, const int *degens, const int *iuv,
@@ -192,13 +351,13 @@ EG_correctUVq(double *u0, double *u1, double *u2, double *u3,
 }
 
 
-static void
+static int
 EG_evalEdgeSeg(const ego body, const ego face, const ego *edges,
                const egTessel *tessel, int ie, int i0, int i1, double weight,
                const double *uvs, const int *ptype, const int *pindex,
                const int *degens, double *uv)
 {
-  int    n, stat, oclass, mtype, pt0, pi0, pt1, pi1, nodes[2], *senses;
+  int    n, stat, ret, oclass, mtype, pt0, pi0, pt1, pi1, nodes[2], *senses;
   double t, t0, t1, uvm[2], uvp[2], uvx[2], result[18];
   ego    geom, *objs;
   
@@ -217,7 +376,7 @@ EG_evalEdgeSeg(const ego body, const ego face, const ego *edges,
                         &senses);
   if (stat != EGADS_SUCCESS) {
     printf(" EGADS Error: EG_getTopo %d = %d (EG_evalEdgeSeg)!\n", ie+1, stat);
-    return;
+    return stat;
   }
   nodes[0] = nodes[1] = EG_indexBodyTopo(body, objs[0]);
   if (mtype == TWONODE) nodes[1] = EG_indexBodyTopo(body, objs[1]);
@@ -272,7 +431,7 @@ EG_evalEdgeSeg(const ego body, const ego face, const ego *edges,
   } else  {
      printf(" EGADS Info:  Iedge = %d   %d/%d   %d/%d (EG_evalEdgeSeg)!\n",
             ie+1, pt0, pi0, pt1, pi1);
-    return;
+    return EGADS_INDEXERR;
   }
 
 #ifdef REPOSITION
@@ -284,9 +443,10 @@ EG_evalEdgeSeg(const ego body, const ego face, const ego *edges,
 #else
   t = (1.0-weight)*t0 + weight*t1;
 #endif
-  stat = EG_getEdgeUV(face, edges[ie], 0, t, uv);
+  stat = ret = EG_getEdgeUV(face, edges[ie], 0, t, uv);
   if (stat == EGADS_TOPOERR) {
     /* sense in Face twice! */
+    ret   = EGADS_SUCCESS;
     uv[0] = uvx[0];
     uv[1] = uvx[1];
     stat = EG_getEdgeUV(face, edges[ie], -1, t, uvm);
@@ -318,6 +478,39 @@ EG_evalEdgeSeg(const ego body, const ego face, const ego *edges,
   if (stat != EGADS_SUCCESS)
     printf(" EGADS Info:  EG_getEdgeUV = %d (EG_evalEdgeSeg)!", stat);
   
+  return ret;
+}
+
+
+/* the parameters at a position along a quad side -- on the Edge when the
+   side is part of an Edge (neighbor < 0) otherwise within the Face */
+
+static void
+EG_sideQuad(const ego body, const ego face, const ego *edges,
+            const egTessel *tessel, int neighbor, int ia, int ib, double s,
+            const int *degens, const int *iuv, const double *uvs,
+            const int *ptype, const int *pindex, sideCache *cache,
+            double *uv)
+{
+#ifdef REPOSITION
+  double uvm[2], uvp[2];
+#endif
+  
+  if (EG_sideFind(cache, ia, ib, s, uv) == EGADS_SUCCESS) return;
+  
+  if ((neighbor >= 0) ||
+      (EG_evalEdgeSeg(body, face, edges, tessel, -neighbor-1, ia, ib, s,
+                      uvs, ptype, pindex, degens, uv) != EGADS_SUCCESS)) {
+#ifdef REPOSITION
+    EG_correctEndPts(ia, ib, degens, iuv, uvs, ptype, pindex, uvm, uvp);
+    EG_getSidepoint(face, s, uvm, uvp, NULL, NULL, uv);
+#else
+    uv[0] = (1.0-s)*uvs[2*ia  ] + s*uvs[2*ib  ];
+    uv[1] = (1.0-s)*uvs[2*ia+1] + s*uvs[2*ib+1];
+    EG_correctUV(uv, ia, ib, degens, iuv, uvs, ptype, pindex);
+#endif
+  }
+  EG_sideAdd(cache, ia, ib, s, uv);
 }
 
 
@@ -326,7 +519,8 @@ EG_interiorTri(const ego body, const ego face, const ego *edges,
                const egTessel *tessel, const int *trs, const int *trc,
                const int *degens, const int *iuv,
                const double *uvs, const int *ptype, const int *pindex,
-               double *w, double *uv0, double *uv1, double *uv2)
+               sideCache *cache, double *w, double *uv0, double *uv1,
+               double *uv2)
 {
   int    ie;
   double dist, theta, suv[6];
@@ -338,58 +532,73 @@ EG_interiorTri(const ego body, const ego face, const ego *edges,
   theta = w[1] + w[2];
   if (theta == 0.0) theta = 1.0;
   dist  = w[2]/theta;
-  if (trc[0] > 0) {
+  if (EG_sideFind(cache, trs[1]-1, trs[2]-1, 1.0-dist,
+                  &suv[0]) != EGADS_SUCCESS) {
+    if (trc[0] > 0) {
 #ifdef REPOSITION
-    EG_correctEndPts(trs[1]-1, trs[2]-1, degens, iuv, uvs, ptype, pindex,
-                     uvm, uvp);
-    EG_getSidepoint(face, 1.0-dist, uvm, uvp, NULL, NULL, &suv[0]);
+      EG_correctEndPts(trs[1]-1, trs[2]-1, degens, iuv, uvs, ptype, pindex,
+                       uvm, uvp);
+      EG_getSidepoint(face, 1.0-dist, uvm, uvp, NULL, NULL, &suv[0]);
 #else
-    suv[0] = uv1[0]  + dist*(uv2[0]  - uv1[0]);
-    suv[1] = uv1[1]  + dist*(uv2[1]  - uv1[1]);
-    EG_correctUV(&suv[0], trs[1]-1, trs[2]-1, degens, iuv, uvs, ptype, pindex);
+      suv[0] = uv1[0]  + dist*(uv2[0]  - uv1[0]);
+      suv[1] = uv1[1]  + dist*(uv2[1]  - uv1[1]);
+      EG_correctUV(&suv[0], trs[1]-1, trs[2]-1, degens, iuv, uvs, ptype,
+                   pindex);
 #endif
-  } else {
-    ie = -trc[0]-1;
-    EG_evalEdgeSeg(body, face, edges, tessel, ie, trs[1]-1, trs[2]-1, 1.0-dist,
-                   uvs, ptype, pindex, degens, &suv[0]);
+    } else {
+      ie = -trc[0]-1;
+      EG_evalEdgeSeg(body, face, edges, tessel, ie, trs[1]-1, trs[2]-1,
+                     1.0-dist, uvs, ptype, pindex, degens, &suv[0]);
+    }
+    EG_sideAdd(cache, trs[1]-1, trs[2]-1, 1.0-dist, &suv[0]);
   }
   
   /* side 1 */
   theta = atan2(w[2], 1.0-w[1]);
   dist  = w[2]    + w[1]*tan(theta);
-  if (trc[1] > 0) {
+  if (EG_sideFind(cache, trs[0]-1, trs[2]-1, 1.0-dist,
+                  &suv[2]) != EGADS_SUCCESS) {
+    if (trc[1] > 0) {
 #ifdef REPOSITION
-    EG_correctEndPts(trs[0]-1, trs[2]-1, degens, iuv, uvs, ptype, pindex,
-                     uvm, uvp);
-    EG_getSidepoint(face, 1.0-dist, uvm, uvp, NULL, NULL, &suv[2]);
+      EG_correctEndPts(trs[0]-1, trs[2]-1, degens, iuv, uvs, ptype, pindex,
+                       uvm, uvp);
+      EG_getSidepoint(face, 1.0-dist, uvm, uvp, NULL, NULL, &suv[2]);
 #else
-    suv[2] = uv0[0]  + dist*(uv2[0]  - uv0[0]);
-    suv[3] = uv0[1]  + dist*(uv2[1]  - uv0[1]);
-    EG_correctUV(&suv[2], trs[0]-1, trs[2]-1, degens, iuv, uvs, ptype, pindex);
+      suv[2] = uv0[0]  + dist*(uv2[0]  - uv0[0]);
+      suv[3] = uv0[1]  + dist*(uv2[1]  - uv0[1]);
+      EG_correctUV(&suv[2], trs[0]-1, trs[2]-1, degens, iuv, uvs, ptype,
+                   pindex);
 #endif
-  } else {
-    ie = -trc[1]-1;
-    EG_evalEdgeSeg(body, face, edges, tessel, ie, trs[0]-1, trs[2]-1, 1.0-dist,
-                   uvs, ptype, pindex, degens, &suv[2]);
+    } else {
+      ie = -trc[1]-1;
+      EG_evalEdgeSeg(body, face, edges, tessel, ie, trs[0]-1, trs[2]-1,
+                     1.0-dist, uvs, ptype, pindex, degens, &suv[2]);
+    }
+    EG_sideAdd(cache, trs[0]-1, trs[2]-1, 1.0-dist, &suv[2]);
   }
   
   /* side 2 */
   theta = atan2(w[1], 1.0-w[2]);
   dist  = w[1] + w[2]*tan(theta);
-  if (trc[2] > 0) {
+  if (EG_sideFind(cache, trs[0]-1, trs[1]-1, 1.0-dist,
+                  &suv[4]) != EGADS_SUCCESS) {
+    if (trc[2] > 0) {
 #ifdef REPOSITION
-    EG_correctEndPts(trs[0]-1, trs[1]-1, degens, iuv, uvs, ptype, pindex,
-                     uvm, uvp);
-    EG_getSidepoint(face, 1.0-dist, uvm, uvp, NULL, NULL, &suv[4]);
+      EG_correctEndPts(trs[0]-1, trs[1]-1, degens, iuv, uvs, ptype, pindex,
+                       uvm, uvp);
+      EG_getSidepoint(face, 1.0-dist, uvm, uvp, NULL, NULL, &suv[4]);
 #else
-    suv[4] = uv0[0]  + dist*(uv1[0]  - uv0[0]);
-    suv[5] = uv0[1]  + dist*(uv1[1]  - uv0[1]);
-    EG_correctUV(&suv[4], trs[0]-1, trs[1]-1, degens, iuv, uvs, ptype, pindex);
+      suv[4] = uv0[0]  + dist*(uv1[0]  - uv0[0]);
+      suv[5] = uv0[1]  + dist*(uv1[1]  - uv0[1]);
+      EG_correctUV(&suv[4], trs[0]-1, trs[1]-1, degens, iuv, uvs, ptype,
+                   pindex);
 #endif
-  } else {
-    ie = -trc[2]-1;
-    EG_evalEdgeSeg(body, face, edges, tessel, ie, trs[0]-1, trs[1]-1, 1.0-dist,
-                   uvs, ptype, pindex, degens, &suv[4]);
+    } else {
+      ie = -trc[2]-1;
+      EG_evalEdgeSeg(body, face, edges, tessel, ie, trs[0]-1, trs[1]-1,
+                     1.0-dist, uvs, ptype, pindex, degens, &suv[4]);
+    }
+    EG_sideAdd(cache, trs[0]-1, trs[1]-1, 1.0-dist, &suv[4]);
   }
   
   /* set up smaller side-based triangle */
@@ -573,6 +782,560 @@ EG_fillEdgeSeg(const ego face, const ego *edges, const egTessel *tessel,
 }
 
 
+/* fills in the High-Order vertices for a single Face -- thread safe */
+
+static int
+EG_tessHOface(EMPhoface *hoface, int i)
+{
+  int            j, k, n, stat, np, nt, oclass, mtype, nei, nside, ntris;
+  int            i0, i1, i2, i3, quad, nst, nItri, nIns, nmid, outLevel;
+  int            sum[2], degens[2], iuv[2], corner[4], *senses;
+  int            *elems = NULL, *tris = NULL;
+  double         result[18], trange[2], uv[2], w[3], u0[2], u1[2], u2[2];
+  double         u3[2], *coords = NULL, *parms;
+#ifdef REPOSITION
+  double         uvm[2], uvp[2], xyz[3];
+  const double   *uvl, *uvr;
+#endif
+  const int      *ptype, *pindex, *trs, *trc, *iTris, *type;
+  const double   *xyzs, *uvs, *st, *frac, *sinsert;
+  const egTessel *btess, *tessel;
+  ego            body, geom, *objs, *nodes, *edges, *faces;
+  sideCache      cache;
+  hoFace         *hf;
+  static int     sidet[3][2] = {{1,2}, {2,0}, {0,1}};
+  static int     sideq[4][2] = {{1,2}, {2,5}, {5,0}, {0,1}};
+  static int     neigq[4]    = { 0,     3,     4,     2   };
+
+  quad     = hoface->quad;
+  nst      = hoface->nst;
+  nItri    = hoface->nItri;
+  nIns     = hoface->nIns;
+  nmid     = hoface->nmid;
+  iTris    = hoface->iTris;
+  type     = hoface->type;
+  st       = hoface->st;
+  frac     = hoface->frac;
+  sinsert  = hoface->sinsert;
+  btess    = hoface->btess;
+  tessel   = hoface->tessel;
+  body     = hoface->body;
+  edges    = hoface->edges;
+  faces    = hoface->faces;
+  outLevel = hoface->outLevel;
+  hf       = &hoface->hofaces[i];
+  cache.head = NULL;
+  cache.pts  = NULL;
+
+  stat = EG_getTessFace(hoface->tess, i+1, &np, &xyzs, &uvs, &ptype, &pindex,
+                        &nt, &trs, &trc);
+  if (stat != EGADS_SUCCESS) return EGADS_SUCCESS;
+  
+  /* size and allocate temporary arrays for this Face */
+  for (sum[0] = sum[1] = j = 0; j < nt; j++)
+    for (k = 0; k < 3; k++)
+      if (trc[3*j+k] > 0) {
+        sum[0]++;
+      } else {
+        sum[1]++;
+      }
+  nside = sum[0]/2 + sum[1];
+  if (quad == 1) nside -= nt/2;
+  if (quad == 0) {
+    k = np + 3*nIns*nside + nt*nmid;
+  } else {
+    k = np + 4*nIns*nside + nt*nmid/2;
+  }
+  coords = (double *) EG_alloc(5*k*sizeof(double));
+  tris   = (int *)    EG_alloc(nItri*3*nt*sizeof(int));
+  n      = nst*nt;
+  if (quad == 1) n /= 2;
+  elems  = (int *)    EG_alloc(n*sizeof(int));
+  if ((coords == NULL) || (tris == NULL) || (elems == NULL)) {
+    if (outLevel > 0)
+      printf(" EGADS Error: Malloc for Face %d (EG_tessHOverts)!\n", i+1);
+    stat = EGADS_MALLOC;
+    goto cleanup;
+  }
+  parms = &coords[3*k];
+  EG_sideInit(&cache, nt);
+  
+  /* find degenerate nodes (if any) */
+  degens[0] = degens[1] = 0;
+  iuv[0]    = iuv[1]    = 0;
+  stat      = EG_getBodyTopos(body, faces[i], EDGE, &k, &objs);
+  if (stat != EGADS_SUCCESS) {
+    printf(" EGADS Internal: EG_getBodyTopos on Face %d = %d\n", i+1, stat);
+  } else {
+    for (j = 0; j < k; j++) {
+      stat = EG_getTopology(objs[j], &geom, &oclass, &mtype,
+                            trange, &n, &nodes, &senses);
+      if (stat != EGADS_SUCCESS) {
+        printf(" EGADS Internal: EG_getTopology on Edge = %d\n", stat);
+        continue;
+      }
+      if (mtype != DEGENERATE) continue;
+      stat = EG_getEdgeUVeval(faces[i], objs[j], 0, trange[0], result);
+      if (stat != EGADS_SUCCESS) {
+        printf(" EGADS Internal: EG_getEdgeUVeval = %d\n", stat);
+        continue;
+      }
+      n = EG_indexBodyTopo(body, nodes[0]);
+      if (n > 0) {
+        if (degens[0] == 0) {
+          degens[0] = n;
+          if (result[3] != 0.0) iuv[0] = 1;
+        } else if (degens[1] == 0) {
+          degens[1] = n;
+          if (result[3] != 0.0) iuv[1] = 1;
+        } else {
+          printf(" EGADS Info: More than 2 Degen Nodes in Face %d!\n", i+1);
+        }
+      }
+    }
+    EG_free(objs);
+  }
+#ifdef DEBUG
+  if (degens[0] != 0)
+    printf(" EGADS Info: Face %d has degenerate Node(s) = %d (%d)  %d (%d)\n",
+           i+1, degens[0], iuv[0], degens[1], iuv[1]);
+#endif
+  
+  /* clear element vert positions */
+  for (i0 = j = 0; j < nt/(quad+1); j++)
+    for (k = 0; k < nst; k++, i0++) elems[i0] = 0;
+  
+  /* copy source verts */
+  for (j = 0; j < np; j++) {
+    coords[3*j  ] = xyzs[3*j  ];
+    coords[3*j+1] = xyzs[3*j+1];
+    coords[3*j+2] = xyzs[3*j+2];
+    parms[2*j  ]  = uvs[2*j  ];
+    parms[2*j+1]  = uvs[2*j+1];
+  }
+  
+  /* fill in corner verts */
+  if (quad == 0) {
+    for (i0 = j = 0; j < nt; j++)
+      for (k = 0; k < nst; k++, i0++)
+        if (type[k] > 0) elems[i0] = trs[3*j+type[k]-1];
+  } else {
+    for (i0 = j = 0; j < nt; j+=2) {
+      corner[0] = trs[3*j  ];
+      corner[1] = trs[3*j+1];
+      corner[2] = trs[3*j+2];
+      corner[3] = trs[3*j+5];
+      for (k = 0; k < nst; k++, i0++)
+        if (type[k] > 0) elems[i0] = corner[type[k]-1];
+    }
+  }
+  
+  /* fill in the side verts */
+  if (quad == 0) {
+    for (j = 0; j < nt; j++) {
+      for (k = 0; k < 3; k++) {
+        nei       = abs(trc[3*j+k]) - 1;
+        corner[0] = trs[3*j+sidet[k][0]];
+        corner[1] = trs[3*j+sidet[k][1]];
+        uvl = uvr = NULL;
+        if (trc[3*j+k] < 0) {
+          stat = EG_getTopology(edges[nei], &geom, &oclass, &mtype,
+                                trange, &n, &objs, &senses);
+          if (stat != EGADS_SUCCESS) {
+            if (outLevel > 0)
+              printf(" EGADS Error: EG_getTopo %d = %d (EG_tessHOverts)!\n",
+                     nei+1, stat);
+            goto cleanup;
+          }
+          corner[2] = corner[3] = EG_indexBodyTopo(body, objs[0]);
+          if (mtype == TWONODE) corner[3] = EG_indexBodyTopo(body, objs[1]);
+          stat = EG_fillEdgeSeg(faces[i], edges, tessel, nIns, corner,
+                                nei, xyzs, uvs, ptype, pindex, k, nst,
+                                type, frac, sinsert, degens, j*nst, elems,
+                                &np, coords, parms);
+          if (stat != EGADS_SUCCESS) {
+            if (outLevel > 0)
+              printf(" EGADS Error: EG_fillEdgeSeg %d %d/%d = %d (EG_tessHOverts)!\n",
+                     i+1, j+1, k+1, stat);
+            goto cleanup;
+          }
+        } else {
+          if (nei < j) continue;
+          uvl = &uvs[2*trs[3*j+k]-2];
+          i0  = trs[3*nei]+trs[3*nei+1]+trs[3*nei+2]-corner[0]-corner[1];
+          uvr = &uvs[2*i0-2];
+          i1  = -1;
+          if (trs[3*nei  ] == i0) i1 = 0;
+          if (trs[3*nei+1] == i0) i1 = 1;
+          if (trs[3*nei+2] == i0) i1 = 2;
+          if (i1 == -1) {
+            printf(" FATAL: *** Can't find other side! ***\n");
+            stat = EGADS_INDEXERR;
+            goto cleanup;
+          }
+#ifdef REPOSITION
+          EG_correctEndPts(corner[0]-1, corner[1]-1, degens, iuv, uvs, ptype,
+                           pindex, uvm, uvp);
+#endif
+          for (i0 = 0; i0 < nIns; i0++) {
+#ifdef REPOSITION
+            EG_getSidepoint(faces[i], sinsert[i0], uvm, uvp, uvl, uvr, uv);
+#else
+            uv[0] = (1.0-sinsert[i0])*uvs[2*corner[0]-2] +
+                         sinsert[i0] *uvs[2*corner[1]-2];
+            uv[1] = (1.0-sinsert[i0])*uvs[2*corner[0]-1] +
+                         sinsert[i0] *uvs[2*corner[1]-1];
+            EG_correctUV(uv, corner[0]-1, corner[1]-1, degens, iuv,
+                         uvs, ptype, pindex);
+#endif
+            stat = EG_evaluate(faces[i], uv, result);
+            if (stat != EGADS_SUCCESS) {
+              if (outLevel > 0)
+                printf(" EGADS Error: evaluate %d %d/%d = %d (EG_tessHOverts)!\n",
+                       i+1, j+1, k+1, stat);
+              goto cleanup;
+            }
+            coords[3*np  ] = result[0];
+            coords[3*np+1] = result[1];
+            coords[3*np+2] = result[2];
+            parms[2*np  ]  = uv[0];
+            parms[2*np+1]  = uv[1];
+            np++;
+            i2 = EG_findSideIndex(k, sinsert[i0], nst, type, frac);
+            if (i2 < 0) {
+              if (outLevel > 0)
+                printf(" EGADS Error: Cannot find %d %lf (EG_tessHOverts)!\n",
+                       k, sinsert[i0]);
+              stat = EGADS_INDEXERR;
+              goto cleanup;
+            }
+            elems[j*nst+i2] = np;
+            i2 = EG_findSideIndex(i1, 1.0-sinsert[i0], nst, type, frac);
+            if (i2 < 0) {
+              if (outLevel > 0)
+                printf(" EGADS Error: Cannot find %d %lf (EG_tessHOverts)!\n",
+                       k, sinsert[i0]);
+              stat = EGADS_INDEXERR;
+              goto cleanup;
+            }
+#ifdef DEBUG
+            if (elems[nei*nst+i2] != 0) printf(" double hit!\n");
+#endif
+            elems[nei*nst+i2] = np;
+          }
+        }
+      }
+    }
+  } else {
+    for (j = 0; j < nt; j+=2) {
+      for (k = 0; k < 4; k++) {
+        nei       = abs(trc[3*j+neigq[k]]) - 1;
+        corner[0] = trs[3*j+sideq[k][0]];
+        corner[1] = trs[3*j+sideq[k][1]];
+        if (trc[3*j+neigq[k]] < 0) {
+          stat = EG_getTopology(edges[nei], &geom, &oclass, &mtype,
+                                trange, &n, &objs, &senses);
+          if (stat != EGADS_SUCCESS) {
+            if (outLevel > 0)
+              printf(" EGADS Error: EG_getTopo %d = %d (EG_tessHOverts)!\n",
+                     nei+1, stat);
+            goto cleanup;
+          }
+          corner[2] = corner[3] = EG_indexBodyTopo(body, objs[0]);
+          if (mtype == TWONODE) corner[3] = EG_indexBodyTopo(body, objs[1]);
+          stat = EG_fillEdgeSeg(faces[i], edges, tessel, nIns, corner,
+                                nei, xyzs, uvs, ptype, pindex, k, nst,
+                                type, frac, sinsert, degens, j*nst/2, elems,
+                                &np, coords, parms);
+          if (stat != EGADS_SUCCESS) {
+            if (outLevel > 0)
+              printf(" EGADS Error: EG_fillEdgeSeg %d %d/%d = %d (EG_tessHOverts)!\n",
+                     i+1, j+1, k+1, stat);
+            goto cleanup;
+          }
+        } else {
+          if (nei < j) continue;
+          if (nei%2 == 1) nei--;
+          i1 = -1;
+          for (i0 = 0; i0 < 4; i0++) {
+            corner[2] = trs[3*nei+sideq[i0][0]];
+            corner[3] = trs[3*nei+sideq[i0][1]];
+            if ((corner[0] == corner[2]) && (corner[1] == corner[3])) {
+              i1 = i0;
+              break;
+            }
+            if ((corner[0] == corner[3]) && (corner[1] == corner[2])) {
+              i1 = i0;
+              break;
+            }
+          }
+          if (i1 == -1) {
+            printf(" FATAL: *** Can't find other Q side! ***\n");
+            stat = EGADS_INDEXERR;
+            goto cleanup;
+          }
+#ifdef REPOSITION
+          EG_correctEndPts(corner[0]-1, corner[1]-1, degens, iuv, uvs, ptype,
+                           pindex, uvm, uvp);
+#endif
+          for (i0 = 0; i0 < nIns; i0++) {
+#ifdef REPOSITION
+            EG_getSidepoint(faces[i], sinsert[i0], uvm, uvp, NULL, NULL, uv);
+#else
+            uv[0] = (1.0-sinsert[i0])*uvs[2*corner[0]-2] +
+                         sinsert[i0] *uvs[2*corner[1]-2];
+            uv[1] = (1.0-sinsert[i0])*uvs[2*corner[0]-1] +
+                         sinsert[i0] *uvs[2*corner[1]-1];
+            EG_correctUV(uv, corner[0]-1, corner[1]-1, degens, iuv,
+                         uvs, ptype, pindex);
+#endif
+            stat = EG_evaluate(faces[i], uv, result);
+            if (stat != EGADS_SUCCESS) {
+              if (outLevel > 0)
+                printf(" EGADS Error: Evaluate %d %d/%d = %d (EG_tessHOverts)!\n",
+                       i+1, j+1, k+1, stat);
+              goto cleanup;
+            }
+            coords[3*np  ] = result[0];
+            coords[3*np+1] = result[1];
+            coords[3*np+2] = result[2];
+            parms[2*np  ]  = uv[0];
+            parms[2*np+1]  = uv[1];
+            np++;
+            i2 = EG_findSideIndex(k, sinsert[i0], nst, type, frac);
+            if (i2 < 0) {
+              if (outLevel > 0)
+                printf(" EGADS Error: Cannot find %d %lf (EG_tessHOverts)!\n",
+                       k, sinsert[i0]);
+              stat = EGADS_INDEXERR;
+              goto cleanup;
+            }
+            elems[j*nst/2+i2] = np;
+            i2 = EG_findSideIndex(i1, 1.0-sinsert[i0], nst, type, frac);
+            if (i2 < 0) {
+              if (outLevel > 0)
+                printf(" EGADS Error: Cannot find %d %lf (EG_tessHOverts)!\n",
+                       k, sinsert[i0]);
+              stat = EGADS_INDEXERR;
+              goto cleanup;
+            }
+#ifdef DEBUG
+            if (elems[nei*nst/2+i2] != 0) printf(" double hit!\n");
+#endif
+            elems[nei*nst/2+i2] = np;
+          }
+        }
+      }
+    }
+  }
+  
+  /* fill in the interior verts */
+  if (nmid != 0)
+    if (quad == 0) {
+      double uv0[2], uv1[2], uv2[2];
+      for (k = 0; k < nst; k++) {
+        if (type[k] != 0) continue;
+        for (j = 0; j < nt; j++) {
+          w[1]    = st[2*k  ];
+          w[2]    = st[2*k+1];
+          w[0]    = 1.0 - w[1] - w[2];
+          i0      = trs[3*j  ] - 1;
+          i1      = trs[3*j+1] - 1;
+          i2      = trs[3*j+2] - 1;
+          uv0[0]  = uvs[2*i0  ];
+          uv0[1]  = uvs[2*i0+1];
+          uv1[0]  = uvs[2*i1  ];
+          uv1[1]  = uvs[2*i1+1];
+          uv2[0]  = uvs[2*i2  ];
+          uv2[1]  = uvs[2*i2+1];
+          EG_interiorTri(body, faces[i], edges, btess, &trs[3*j], &trc[3*j],
+                         degens, iuv, uvs, ptype, pindex, &cache, w, uv0, uv1,
+                         uv2);
+          uv[0]  = w[0]*uv0[0] + w[1]*uv1[0] + w[2]*uv2[0];
+          uv[1]  = w[0]*uv0[1] + w[1]*uv1[1] + w[2]*uv2[1];
+#ifdef REPOSITION
+          stat = EG_baryInsert(faces[i], w[0], w[1], w[2], uv0, uv1, uv2, uv);
+          if (stat != EGADS_SUCCESS) {
+            printf(" EGADS Info: EG_baryInsert = %d (EG_tessHOverts)!\n",
+                   stat);
+            uv[0]  = w[0]*uv0[0] + w[1]*uv1[0] + w[2]*uv2[0];
+            uv[1]  = w[0]*uv0[1] + w[1]*uv1[1] + w[2]*uv2[1];
+            xyz[0] = w[0]*xyzs[3*i0  ] + w[1]*xyzs[3*i1  ] + w[2]*xyzs[3*i2  ];
+            xyz[1] = w[0]*xyzs[3*i0+1] + w[1]*xyzs[3*i1+1] + w[2]*xyzs[3*i2+1];
+            xyz[2] = w[0]*xyzs[3*i0+2] + w[1]*xyzs[3*i1+2] + w[2]*xyzs[3*i2+2];
+            EG_getInterior(faces[i], xyz, uv);
+          }
+#endif
+          stat = EG_evaluate(faces[i], uv, result);
+          if (stat != EGADS_SUCCESS) {
+            if (outLevel > 0)
+              printf(" EGADS Error: eval %d %d/%d = %d (EG_tessHOverts)!\n",
+                     i+1, j+1, k+1, stat);
+            goto cleanup;
+          }
+          coords[3*np  ] = result[0];
+          coords[3*np+1] = result[1];
+          coords[3*np+2] = result[2];
+          parms[2*np  ]  = uv[0];
+          parms[2*np+1]  = uv[1];
+          np++;
+#ifdef DEBUG
+          if (elems[j*nst+k] != 0) printf(" double hit!\n");
+#endif
+          elems[j*nst+k] = np;
+        }
+      }
+    } else {
+      double el[3], eu[3], xl[3], xu[3];
+      for (k = 0; k < nst; k++) {
+        if (type[k] != 0) continue;
+        for (j = 0; j < nt; j+=2) {
+          i0    = trs[3*j  ] - 1;
+          i1    = trs[3*j+1] - 1;
+          i2    = trs[3*j+2] - 1;
+          i3    = trs[3*j+5] - 1;
+          u0[0] = uvs[2*i0  ];
+          u0[1] = uvs[2*i0+1];
+          u1[0] = uvs[2*i1  ];
+          u1[1] = uvs[2*i1+1];
+          u2[0] = uvs[2*i2  ];
+          u2[1] = uvs[2*i2+1];
+          u3[0] = uvs[2*i3  ];
+          u3[1] = uvs[2*i3+1];
+          /* the side points -- on the Edge if the side is on an Edge */
+          EG_sideQuad(body, faces[i], edges, btess, trc[3*j+2], i0, i1,
+                      st[2*k  ], degens, iuv, uvs, ptype, pindex, &cache,
+                      xl);
+          EG_sideQuad(body, faces[i], edges, btess, trc[3*j+3], i3, i2,
+                      st[2*k  ], degens, iuv, uvs, ptype, pindex, &cache,
+                      xu);
+          EG_sideQuad(body, faces[i], edges, btess, trc[3*j+4], i0, i3,
+                      st[2*k+1], degens, iuv, uvs, ptype, pindex, &cache,
+                      el);
+          EG_sideQuad(body, faces[i], edges, btess, trc[3*j  ], i1, i2,
+                      st[2*k+1], degens, iuv, uvs, ptype, pindex, &cache,
+                      eu);
+          EG_correctUVq(u0, u1, u2, u3, i0, i1, i2, i3, degens, iuv,
+                        ptype, pindex);
+          EG_mdTFI(st[2*k], st[2*k+1], 2, xl, xu, el, eu, u0, u1, u2, u3, uv);
+#ifdef REPOSITION
+/*
+          double xmid[4][18];
+          stat = EG_evaluate(faces[i], xl, xmid[0]);
+          stat = EG_evaluate(faces[i], xu, xmid[1]);
+          stat = EG_evaluate(faces[i], el, xmid[2]);
+          stat = EG_evaluate(faces[i], eu, xmid[3]);
+          EG_mdTFI(st[2*k], st[2*k+1], 3, xmid[0], xmid[1], xmid[2], xmid[3],
+                   &xyzs[3*i0], &xyzs[3*i1], &xyzs[3*i2], &xyzs[3*i3], xyz);
+          EG_getInterior(faces[i], xyz, uv);  */
+          EG_minArc4(faces[i], st[2*k], st[2*k+1], xl, eu, xu, el, uv);
+#endif
+          stat = EG_evaluate(faces[i], uv, result);
+          if (stat != EGADS_SUCCESS) {
+            if (outLevel > 0)
+              printf(" EGADS Error: eval %d %d/%d = %d (EG_tessHOverts)!\n",
+                     i+1, j+1, k+1, stat);
+            goto cleanup;
+          }
+          coords[3*np  ] = result[0];
+          coords[3*np+1] = result[1];
+          coords[3*np+2] = result[2];
+          parms[2*np  ]  = uv[0];
+          parms[2*np+1]  = uv[1];
+          np++;
+#ifdef DEBUG
+          if (elems[j*nst/2+k] != 0) printf(" double hit!\n");
+#endif
+          elems[j*nst/2+k] = np;
+        }
+      }
+    }
+  
+  /* fill up the triangles */
+  i1 = nt;
+  if (quad == 1) i1 /= 2;
+  for (ntris = i0 = j = 0; j < i1; j++, i0+=nst)
+    for (k = 0; k < nItri; k++, ntris++) {
+      tris[3*ntris  ] = elems[i0+iTris[3*k  ]-1];
+      tris[3*ntris+1] = elems[i0+iTris[3*k+1]-1];
+      tris[3*ntris+2] = elems[i0+iTris[3*k+2]-1];
+    }
+  
+#ifdef DEBUG
+  printf(" Face %d: npts = %d, ntris = %d\n", i+1, np, ntris);
+#endif
+  hf->npts   = np;
+  hf->ntris  = ntris;
+  hf->coords = coords;
+  hf->parms  = parms;
+  hf->tris   = tris;
+  coords     = NULL;
+  tris       = NULL;
+  stat       = EGADS_SUCCESS;
+
+cleanup:
+  EG_sideFree(&cache);
+  if (elems  != NULL) EG_free(elems);
+  if (tris   != NULL) EG_free(tris);
+  if (coords != NULL) EG_free(coords);
+  return stat;
+}
+
+
+static void
+EG_HOfaceThread(void *struc)
+{
+  int       index, stat;
+  long      ID;
+  double    t0;
+  EMPhoface *hoface;
+
+  hoface = (EMPhoface *) struc;
+
+  /* get our identifier */
+  ID = EMP_ThreadID();
+
+  /* look for work */
+  for (;;) {
+
+    /* only one thread at a time here -- controlled by a mutex! */
+    if (hoface->mutex != NULL) EMP_LockSet(hoface->mutex);
+    index = hoface->index;
+    if (hoface->stat != EGADS_SUCCESS) index = hoface->end;
+    hoface->index = index+1;
+    if (hoface->mutex != NULL) EMP_LockRelease(hoface->mutex);
+    if (index >= hoface->end) break;
+
+    /* do the work -- most expensive Faces are first in the queue */
+    index = hoface->order[index];
+    t0    = EMP_Clock();
+    stat  = EG_tessHOface(hoface, index);
+    hoface->hofaces[index].time = EMP_Clock() - t0;
+    if (stat != EGADS_SUCCESS) {
+      if (hoface->mutex != NULL) EMP_LockSet(hoface->mutex);
+      if (hoface->stat == EGADS_SUCCESS) hoface->stat = stat;
+      if (hoface->mutex != NULL) EMP_LockRelease(hoface->mutex);
+    }
+  }
+
+  /* exhausted all work -- exit */
+  if (ID != hoface->master) EMP_ThreadExit();
+}
+
+
+/* order the Faces by decreasing cost */
+
+static int
+EG_HOcost(const void *a, const void *b)
+{
+  const int *ia = (const int *) a;
+  const int *ib = (const int *) b;
+
+  if (ia[0] != ib[0]) return ib[0] - ia[0];
+  return ia[1] - ib[1];
+}
+
+
 /*
  * builds a new tessellation object that inserts the High Order vertices based
  *         the specified internal positions
@@ -595,25 +1358,20 @@ int
 EG_tessHOverts(const ego tess, int nstx, int nItrix, const int *iTris,
                const double *st, ego *nTess)
 {
-  int          i, j, k, n, stat, outLevel, nst, nItri, atype, alen, corner[4];
-  int          i0, i1, i2, i3, nIns, nedges, nfaces, sum[2], degens[2], iuv[2];
-  int          np, nt, npts, ntris, nside, nei, oclass, mtype, *senses, *type;
-  int          nmid = 0, quad = 0, qout = 0, *elems = NULL, *tris = NULL;
-  double       area, d, *parms, sinsert[MXSIDE], result[18], trange[2], uv[2];
-  double       w[3], u0[2], u1[2], u2[2], u3[2], *frac = NULL, *coords = NULL;
-#ifdef REPOSITION
-  double       uvm[2], uvp[2], xyz[3];
-  const double *uvl, *uvr;
-#endif
-  ego          body, context, geom, *objs, *nodes;
-  ego          *edges = NULL, *faces = NULL, newTess = NULL;
+  int          i, j, k, stat, outLevel, nst, nItri, atype, alen, corner[4];
+  int          i0, i1, i2, nIns, nedges, nfaces, np, nt, npts, *senses, *type;
+  int          nmid = 0, quad = 0, qout = 0, *order = NULL;
+  long         start;
+  double       area, d, *parms, sinsert[MXSIDE], result[18];
+  double       *frac = NULL, *coords = NULL;
+  void         **threads = NULL;
+  ego          body, context, geom, *edges = NULL, *faces = NULL, newTess = NULL;
   egTessel     *btess, *tessel;
+  hoFace       *hofaces = NULL;
+  EMPhoface    hoface;
   const int    *ints, *ptype, *pindex, *trs, *trc;
   const double *reals, *xyzs, *ts, *uvs;
   const char   *str;
-  static int   sidet[3][2] = {{1,2}, {2,0}, {0,1}};
-  static int   sideq[4][2] = {{1,2}, {2,5}, {5,0}, {0,1}};
-  static int   neigq[4]    = { 0,     3,     4,     2   };
 
   *nTess = NULL;
   if (tess == NULL)                 return EGADS_NULLOBJ;
@@ -1004,7 +1762,7 @@ EG_tessHOverts(const ego tess, int nstx, int nItrix, const int *iTris,
     }
 #endif
   
-  /* size and allocate temporary Face arrays */
+  /* order the Faces by decreasing cost */
   
   tessel = (egTessel *) newTess->blind;
   stat   = EG_getBodyTopos(body, NULL, FACE, &nfaces, &faces);
@@ -1014,7 +1772,23 @@ EG_tessHOverts(const ego tess, int nstx, int nItrix, const int *iTris,
     if (stat == EGADS_SUCCESS) stat = EGADS_TOPOERR;
     goto cleanup;
   }
-  for (nside = npts = ntris = i = 0; i < nfaces; i++) {
+  order   = (int *)    EG_alloc(2*nfaces*sizeof(int));
+  hofaces = (hoFace *) EG_alloc(nfaces*sizeof(hoFace));
+  if ((order == NULL) || (hofaces == NULL)) {
+    if (outLevel > 0)
+      printf(" EGADS Error: Malloc for %d Faces (EG_tessHOverts)!\n", nfaces);
+    stat = EGADS_MALLOC;
+    goto cleanup;
+  }
+  for (i = 0; i < nfaces; i++) {
+    hofaces[i].npts   = 0;
+    hofaces[i].ntris  = 0;
+    hofaces[i].coords = NULL;
+    hofaces[i].parms  = NULL;
+    hofaces[i].tris   = NULL;
+    hofaces[i].time   = 0.0;
+  }
+  for (i = 0; i < nfaces; i++) {
     stat = EG_getTessFace(tess, i+1, &np, &xyzs, &uvs, &ptype, &pindex,
                           &nt, &trs, &trc);
     if ((stat != EGADS_SUCCESS) || (nt == 0)) {
@@ -1028,494 +1802,100 @@ EG_tessHOverts(const ego tess, int nstx, int nItrix, const int *iTris,
         }
       goto cleanup;
     }
-    for (sum[0] = sum[1] = j = 0; j < nt; j++)
-      for (k = 0; k < 3; k++)
-        if (trc[3*j+k] > 0) {
-          sum[0]++;
-        } else {
-          sum[1]++;
-        }
-    k = sum[0]/2 + sum[1];
-    if (quad == 1) k -= nt/2;
-    if (k  > nside) nside = k;
-    if (np > npts)  npts  = np;
-    if (nt > ntris) ntris = nt;
-  }
-#ifdef DEBUG
-  printf(" Max npts = %d, nside = %d, ntris = %d\n", npts, nside, ntris);
-#endif
-  
-  if (quad == 0) {
-    k = npts + 3*nIns*nside + ntris*nmid;
-  } else {
-    k = npts + 4*nIns*nside + ntris*nmid/2;
-  }
-  coords = (double *) EG_alloc(5*k*sizeof(double));
-  if (coords == NULL) {
-    if (outLevel > 0)
-      printf(" EGADS Error: Malloc for %d Face points (EG_tessHOverts)!\n", k);
-    stat = EGADS_MALLOC;
-    goto cleanup;
-  }
-  parms = &coords[3*k];
-  tris  = (int *) EG_alloc(nItri*3*ntris*sizeof(int));
-  if (tris == NULL) {
-    if (outLevel > 0)
-      printf(" EGADS Error: Malloc for %d Face tris (EG_tessHOverts)!\n",
-             3*ntris);
-    stat = EGADS_MALLOC;
-    goto cleanup;
-  }
-  k = nst*ntris;
-  if (quad == 1) k /= 2;
-  elems  = (int *) EG_alloc(k*sizeof(int));
-  if (elems == NULL) {
-    if (outLevel > 0)
-      printf(" EGADS Error: Malloc for %d Face elems (EG_tessHOverts)!\n", k);
-    stat = EGADS_MALLOC;
-    goto cleanup;
+    order[2*i  ] = nt;
+    order[2*i+1] = i;
   }
+  qsort(order, nfaces, 2*sizeof(int), EG_HOcost);
+  for (i = 0; i < nfaces; i++) order[i] = order[2*i+1];
   
   /* fill in the Faces */
-  
-  for (i = 0; i < nfaces; i++) {
-    stat = EG_getTessFace(tess, i+1, &np, &xyzs, &uvs, &ptype, &pindex,
-                          &nt, &trs, &trc);
-    if (stat != EGADS_SUCCESS) continue;
-    
-    /* find degenerate nodes (if any) */
-    degens[0] = degens[1] = 0;
-    iuv[0]    = iuv[1]    = 0;
-    stat      = EG_getBodyTopos(body, faces[i], EDGE, &k, &objs);
-    if (stat != EGADS_SUCCESS) {
-      printf(" EGADS Internal: EG_getBodyTopos on Face %d = %d\n", i+1, stat);
-    } else {
-      for (j = 0; j < k; j++) {
-        stat = EG_getTopology(objs[j], &geom, &oclass, &mtype,
-                              trange, &n, &nodes, &senses);
-        if (stat != EGADS_SUCCESS) {
-          printf(" EGADS Internal: EG_getTopology on Edge = %d\n", stat);
-          continue;
-        }
-        if (mtype != DEGENERATE) continue;
-        stat = EG_getEdgeUVeval(faces[i], objs[j], 0, trange[0], result);
-        if (stat != EGADS_SUCCESS) {
-          printf(" EGADS Internal: EG_getEdgeUVeval = %d\n", stat);
-          continue;
-        }
-        n = EG_indexBodyTopo(body, nodes[0]);
-        if (n > 0) {
-          if (degens[0] == 0) {
-            degens[0] = n;
-            if (result[3] != 0.0) iuv[0] = 1;
-          } else if (degens[1] == 0) {
-            degens[1] = n;
-            if (result[3] != 0.0) iuv[1] = 1;
-          } else {
-            printf(" EGADS Info: More than 2 Degen Nodes in Face %d!\n", i+1);
-          }
-        }
-      }
-      EG_free(objs);
-    }
-#ifdef DEBUG
-    if (degens[0] != 0)
-      printf(" EGADS Info: Face %d has degenerate Node(s) = %d (%d)  %d (%d)\n",
-             i+1, degens[0], iuv[0], degens[1], iuv[1]);
-#endif
-    
-    /* clear element vert positions */
-    for (i0 = j = 0; j < nt/(quad+1); j++)
-      for (k = 0; k < nst; k++, i0++) elems[i0] = 0;
-    
-    /* copy source verts */
-    for (j = 0; j < np; j++) {
-      coords[3*j  ] = xyzs[3*j  ];
-      coords[3*j+1] = xyzs[3*j+1];
-      coords[3*j+2] = xyzs[3*j+2];
-      parms[2*j  ]  = uvs[2*j  ];
-      parms[2*j+1]  = uvs[2*j+1];
-    }
-    
-    /* fill in corner verts */
-    if (quad == 0) {
-      for (i0 = j = 0; j < nt; j++)
-        for (k = 0; k < nst; k++, i0++)
-          if (type[k] > 0) elems[i0] = trs[3*j+type[k]-1];
+  hoface.mutex    = NULL;
+  hoface.master   = EMP_ThreadID();
+  hoface.end      = nfaces;
+  hoface.index    = 0;
+  hoface.stat     = EGADS_SUCCESS;
+  hoface.outLevel = outLevel;
+  hoface.order    = order;
+  hoface.quad     = quad;
+  hoface.nst      = nst;
+  hoface.nItri    = nItri;
+  hoface.nIns     = nIns;
+  hoface.nmid     = nmid;
+  hoface.iTris    = iTris;
+  hoface.type     = type;
+  hoface.st       = st;
+  hoface.frac     = frac;
+  hoface.sinsert  = sinsert;
+  hoface.tess     = tess;
+  hoface.btess    = btess;
+  hoface.tessel   = tessel;
+  hoface.body     = body;
+  hoface.edges    = edges;
+  hoface.faces    = faces;
+  hoface.hofaces  = hofaces;
+
+  np = EMP_Init(&start);
+  if (outLevel > 1) printf(" EMP NumProcs = %d!\n", np);
+  if (np > nfaces) np = nfaces;
+
+  if (np > 1) {
+    /* create the mutex to handle list synchronization */
+    hoface.mutex = EMP_LockCreate();
+    if (hoface.mutex == NULL) {
+      printf(" EMP Error: mutex creation = NULL!\n");
+      np = 1;
     } else {
-      for (i0 = j = 0; j < nt; j+=2) {
-        corner[0] = trs[3*j  ];
-        corner[1] = trs[3*j+1];
-        corner[2] = trs[3*j+2];
-        corner[3] = trs[3*j+5];
-        for (k = 0; k < nst; k++, i0++)
-          if (type[k] > 0) elems[i0] = corner[type[k]-1];
+      /* get storage for our extra threads */
+      threads = (void **) malloc((np-1)*sizeof(void *));
+      if (threads == NULL) {
+        EMP_LockDestroy(hoface.mutex);
+        hoface.mutex = NULL;
+        np = 1;
       }
     }
-    
-    /* fill in the side verts */
-    if (quad == 0) {
-      for (j = 0; j < nt; j++) {
-        for (k = 0; k < 3; k++) {
-          nei       = abs(trc[3*j+k]) - 1;
-          corner[0] = trs[3*j+sidet[k][0]];
-          corner[1] = trs[3*j+sidet[k][1]];
-          uvl = uvr = NULL;
-          if (trc[3*j+k] < 0) {
-            stat = EG_getTopology(edges[nei], &geom, &oclass, &mtype,
-                                  trange, &n, &objs, &senses);
-            if (stat != EGADS_SUCCESS) {
-              if (outLevel > 0)
-                printf(" EGADS Error: EG_getTopo %d = %d (EG_tessHOverts)!\n",
-                       nei+1, stat);
-              goto cleanup;
-            }
-            corner[2] = corner[3] = EG_indexBodyTopo(body, objs[0]);
-            if (mtype == TWONODE) corner[3] = EG_indexBodyTopo(body, objs[1]);
-            stat = EG_fillEdgeSeg(faces[i], edges, tessel, nIns, corner,
-                                  nei, xyzs, uvs, ptype, pindex, k, nst,
-                                  type, frac, sinsert, degens, j*nst, elems,
-                                  &np, coords, parms);
-            if (stat != EGADS_SUCCESS) {
-              if (outLevel > 0)
-                printf(" EGADS Error: EG_fillEdgeSeg %d %d/%d = %d (EG_tessHOverts)!\n",
-                       i+1, j+1, k+1, stat);
-              goto cleanup;
-            }
-          } else {
-            if (nei < j) continue;
-            uvl = &uvs[2*trs[3*j+k]-2];
-            i0  = trs[3*nei]+trs[3*nei+1]+trs[3*nei+2]-corner[0]-corner[1];
-            uvr = &uvs[2*i0-2];
-            i1  = -1;
-            if (trs[3*nei  ] == i0) i1 = 0;
-            if (trs[3*nei+1] == i0) i1 = 1;
-            if (trs[3*nei+2] == i0) i1 = 2;
-            if (i1 == -1) {
-              printf(" FATAL: *** Can't find other side! ***\n");
-              stat = EGADS_INDEXERR;
-              goto cleanup;
-            }
-#ifdef REPOSITION
-            EG_correctEndPts(corner[0]-1, corner[1]-1, degens, iuv, uvs, ptype,
-                             pindex, uvm, uvp);
-#endif
-            for (i0 = 0; i0 < nIns; i0++) {
-#ifdef REPOSITION
-              EG_getSidepoint(faces[i], sinsert[i0], uvm, uvp, uvl, uvr, uv);
-#else
-              uv[0] = (1.0-sinsert[i0])*uvs[2*corner[0]-2] +
-                           sinsert[i0] *uvs[2*corner[1]-2];
-              uv[1] = (1.0-sinsert[i0])*uvs[2*corner[0]-1] +
-                           sinsert[i0] *uvs[2*corner[1]-1];
-              EG_correctUV(uv, corner[0]-1, corner[1]-1, degens, iuv,
-                           uvs, ptype, pindex);
-#endif
-              stat = EG_evaluate(faces[i], uv, result);
-              if (stat != EGADS_SUCCESS) {
-                if (outLevel > 0)
-                  printf(" EGADS Error: evaluate %d %d/%d = %d (EG_tessHOverts)!\n",
-                         i+1, j+1, k+1, stat);
-                goto cleanup;
-              }
-              coords[3*np  ] = result[0];
-              coords[3*np+1] = result[1];
-              coords[3*np+2] = result[2];
-              parms[2*np  ]  = uv[0];
-              parms[2*np+1]  = uv[1];
-              np++;
-              i2 = EG_findSideIndex(k, sinsert[i0], nst, type, frac);
-              if (i2 < 0) {
-                if (outLevel > 0)
-                  printf(" EGADS Error: Cannot find %d %lf (EG_tessHOverts)!\n",
-                         k, sinsert[i0]);
-                stat = EGADS_INDEXERR;
-                goto cleanup;
-              }
-              elems[j*nst+i2] = np;
-              i2 = EG_findSideIndex(i1, 1.0-sinsert[i0], nst, type, frac);
-              if (i2 < 0) {
-                if (outLevel > 0)
-                  printf(" EGADS Error: Cannot find %d %lf (EG_tessHOverts)!\n",
-                         k, sinsert[i0]);
-                stat = EGADS_INDEXERR;
-                goto cleanup;
-              }
-#ifdef DEBUG
-              if (elems[nei*nst+i2] != 0) printf(" double hit!\n");
-#endif
-              elems[nei*nst+i2] = np;
-            }
-          }
-        }
-      }
-    } else {
-      for (j = 0; j < nt; j+=2) {
-        for (k = 0; k < 4; k++) {
-          nei       = abs(trc[3*j+neigq[k]]) - 1;
-          corner[0] = trs[3*j+sideq[k][0]];
-          corner[1] = trs[3*j+sideq[k][1]];
-          if (trc[3*j+neigq[k]] < 0) {
-            stat = EG_getTopology(edges[nei], &geom, &oclass, &mtype,
-                                  trange, &n, &objs, &senses);
-            if (stat != EGADS_SUCCESS) {
-              if (outLevel > 0)
-                printf(" EGADS Error: EG_getTopo %d = %d (EG_tessHOverts)!\n",
-                       nei+1, stat);
-              goto cleanup;
-            }
-            corner[2] = corner[3] = EG_indexBodyTopo(body, objs[0]);
-            if (mtype == TWONODE) corner[3] = EG_indexBodyTopo(body, objs[1]);
-            stat = EG_fillEdgeSeg(faces[i], edges, tessel, nIns, corner,
-                                  nei, xyzs, uvs, ptype, pindex, k, nst,
-                                  type, frac, sinsert, degens, j*nst/2, elems,
-                                  &np, coords, parms);
-            if (stat != EGADS_SUCCESS) {
-              if (outLevel > 0)
-                printf(" EGADS Error: EG_fillEdgeSeg %d %d/%d = %d (EG_tessHOverts)!\n",
-                       i+1, j+1, k+1, stat);
-              goto cleanup;
-            }
-          } else {
-            if (nei < j) continue;
-            if (nei%2 == 1) nei--;
-            i1 = -1;
-            for (i0 = 0; i0 < 4; i0++) {
-              corner[2] = trs[3*nei+sideq[i0][0]];
-              corner[3] = trs[3*nei+sideq[i0][1]];
-              if ((corner[0] == corner[2]) && (corner[1] == corner[3])) {
-                i1 = i0;
-                break;
-              }
-              if ((corner[0] == corner[3]) && (corner[1] == corner[2])) {
-                i1 = i0;
-                break;
-              }
-            }
-            if (i1 == -1) {
-              printf(" FATAL: *** Can't find other Q side! ***\n");
-              stat = EGADS_INDEXERR;
-              goto cleanup;
-            }
-#ifdef REPOSITION
-            EG_correctEndPts(corner[0]-1, corner[1]-1, degens, iuv, uvs, ptype,
-                             pindex, uvm, uvp);
-#endif
-            for (i0 = 0; i0 < nIns; i0++) {
-#ifdef REPOSITION
-              EG_getSidepoint(faces[i], sinsert[i0], uvm, uvp, NULL, NULL, uv);
-#else
-              uv[0] = (1.0-sinsert[i0])*uvs[2*corner[0]-2] +
-                           sinsert[i0] *uvs[2*corner[1]-2];
-              uv[1] = (1.0-sinsert[i0])*uvs[2*corner[0]-1] +
-                           sinsert[i0] *uvs[2*corner[1]-1];
-              EG_correctUV(uv, corner[0]-1, corner[1]-1, degens, iuv,
-                           uvs, ptype, pindex);
-#endif
-              stat = EG_evaluate(faces[i], uv, result);
-              if (stat != EGADS_SUCCESS) {
-                if (outLevel > 0)
-                  printf(" EGADS Error: Evaluate %d %d/%d = %d (EG_tessHOverts)!\n",
-                         i+1, j+1, k+1, stat);
-                goto cleanup;
-              }
-              coords[3*np  ] = result[0];
-              coords[3*np+1] = result[1];
-              coords[3*np+2] = result[2];
-              parms[2*np  ]  = uv[0];
-              parms[2*np+1]  = uv[1];
-              np++;
-              i2 = EG_findSideIndex(k, sinsert[i0], nst, type, frac);
-              if (i2 < 0) {
-                if (outLevel > 0)
-                  printf(" EGADS Error: Cannot find %d %lf (EG_tessHOverts)!\n",
-                         k, sinsert[i0]);
-                stat = EGADS_INDEXERR;
-                goto cleanup;
-              }
-              elems[j*nst/2+i2] = np;
-              i2 = EG_findSideIndex(i1, 1.0-sinsert[i0], nst, type, frac);
-              if (i2 < 0) {
-                if (outLevel > 0)
-                  printf(" EGADS Error: Cannot find %d %lf (EG_tessHOverts)!\n",
-                         k, sinsert[i0]);
-                stat = EGADS_INDEXERR;
-                goto cleanup;
-              }
-#ifdef DEBUG
-              if (elems[nei*nst/2+i2] != 0) printf(" double hit!\n");
-#endif
-              elems[nei*nst/2+i2] = np;
-            }
-          }
-        }
-      }
+  }
+
+  /* create the threads and get going! */
+  if (threads != NULL)
+    for (i = 0; i < np-1; i++) {
+      threads[i] = EMP_ThreadCreate(EG_HOfaceThread, &hoface);
+      if (threads[i] == NULL)
+        printf(" EMP Error Creating Thread #%d!\n", i+1);
     }
-    
-    /* fill in the interior verts */
-    if (nmid != 0)
-      if (quad == 0) {
-        double uv0[2], uv1[2], uv2[2];
-        for (k = 0; k < nst; k++) {
-          if (type[k] != 0) continue;
-          for (j = 0; j < nt; j++) {
-            w[1]    = st[2*k  ];
-            w[2]    = st[2*k+1];
-            w[0]    = 1.0 - w[1] - w[2];
-            i0      = trs[3*j  ] - 1;
-            i1      = trs[3*j+1] - 1;
-            i2      = trs[3*j+2] - 1;
-            uv0[0]  = uvs[2*i0  ];
-            uv0[1]  = uvs[2*i0+1];
-            uv1[0]  = uvs[2*i1  ];
-            uv1[1]  = uvs[2*i1+1];
-            uv2[0]  = uvs[2*i2  ];
-            uv2[1]  = uvs[2*i2+1];
-            EG_interiorTri(body, faces[i], edges, btess, &trs[3*j], &trc[3*j],
-                           degens, iuv, uvs, ptype, pindex, w, uv0, uv1, uv2);
-            uv[0]  = w[0]*uv0[0] + w[1]*uv1[0] + w[2]*uv2[0];
-            uv[1]  = w[0]*uv0[1] + w[1]*uv1[1] + w[2]*uv2[1];
-#ifdef REPOSITION
-            stat = EG_baryInsert(faces[i], w[0], w[1], w[2], uv0, uv1, uv2, uv);
-            if (stat != EGADS_SUCCESS) {
-              printf(" EGADS Info: EG_baryInsert = %d (EG_tessHOverts)!\n",
-                     stat);
-              uv[0]  = w[0]*uv0[0] + w[1]*uv1[0] + w[2]*uv2[0];
-              uv[1]  = w[0]*uv0[1] + w[1]*uv1[1] + w[2]*uv2[1];
-              xyz[0] = w[0]*xyzs[3*i0  ] + w[1]*xyzs[3*i1  ] + w[2]*xyzs[3*i2  ];
-              xyz[1] = w[0]*xyzs[3*i0+1] + w[1]*xyzs[3*i1+1] + w[2]*xyzs[3*i2+1];
-              xyz[2] = w[0]*xyzs[3*i0+2] + w[1]*xyzs[3*i1+2] + w[2]*xyzs[3*i2+2];
-              EG_getInterior(faces[i], xyz, uv);
-            }
-#endif
-            stat = EG_evaluate(faces[i], uv, result);
-            if (stat != EGADS_SUCCESS) {
-              if (outLevel > 0)
-                printf(" EGADS Error: eval %d %d/%d = %d (EG_tessHOverts)!\n",
-                       i+1, j+1, k+1, stat);
-              goto cleanup;
-            }
-            coords[3*np  ] = result[0];
-            coords[3*np+1] = result[1];
-            coords[3*np+2] = result[2];
-            parms[2*np  ]  = uv[0];
-            parms[2*np+1]  = uv[1];
-            np++;
-#ifdef DEBUG
-            if (elems[j*nst+k] != 0) printf(" double hit!\n");
-#endif
-            elems[j*nst+k] = np;
-          }
-        }
-      } else {
-        double el[3], eu[3], xl[3], xu[3];
-        for (k = 0; k < nst; k++) {
-          if (type[k] != 0) continue;
-          for (j = 0; j < nt; j+=2) {
-            i0    = trs[3*j  ] - 1;
-            i1    = trs[3*j+1] - 1;
-            i2    = trs[3*j+2] - 1;
-            i3    = trs[3*j+5] - 1;
-            u0[0] = uvs[2*i0  ];
-            u0[1] = uvs[2*i0+1];
-            u1[0] = uvs[2*i1  ];
-            u1[1] = uvs[2*i1+1];
-            u2[0] = uvs[2*i2  ];
-            u2[1] = uvs[2*i2+1];
-            u3[0] = uvs[2*i3  ];
-            u3[1] = uvs[2*i3+1];
-#ifdef REPOSITION
-            EG_correctEndPts(i0, i1, degens, iuv, uvs, ptype, pindex, uvm, uvp);
-            EG_getSidepoint(faces[i], st[2*k  ], uvm, uvp, NULL, NULL, xl);
-            EG_correctEndPts(i3, i2, degens, iuv, uvs, ptype, pindex, uvm, uvp);
-            EG_getSidepoint(faces[i], st[2*k  ], uvm, uvp, NULL, NULL, xu);
-            EG_correctEndPts(i0, i3, degens, iuv, uvs, ptype, pindex, uvm, uvp);
-            EG_getSidepoint(faces[i], st[2*k+1], uvm, uvp, NULL, NULL, el);
-            EG_correctEndPts(i1, i2, degens, iuv, uvs, ptype, pindex, uvm, uvp);
-            EG_getSidepoint(faces[i], st[2*k+1], uvm, uvp, NULL, NULL, eu);
-#else
-            xl[0] = (1.0-st[2*k  ])*u0[0]  + st[2*k  ]*u1[0];
-            xl[1] = (1.0-st[2*k  ])*u0[1]  + st[2*k  ]*u1[1];
-            EG_correctUV(xl, i0, i1, degens, iuv, uvs, ptype, pindex);
-            xu[0] = (1.0-st[2*k  ])*u3[0]  + st[2*k  ]*u2[0];
-            xu[1] = (1.0-st[2*k  ])*u3[1]  + st[2*k  ]*u2[1];
-            EG_correctUV(xu, i3, i2, degens, iuv, uvs, ptype, pindex);
-            el[0] = (1.0-st[2*k+1])*u0[0]  + st[2*k+1]*u3[0];
-            el[1] = (1.0-st[2*k+1])*u0[1]  + st[2*k+1]*u3[1];
-            EG_correctUV(el, i0, i3, degens, iuv, uvs, ptype, pindex);
-            eu[0] = (1.0-st[2*k+1])*u1[0]  + st[2*k+1]*u2[0];
-            eu[1] = (1.0-st[2*k+1])*u1[1]  + st[2*k+1]*u2[1];
-            EG_correctUV(eu, i1, i2, degens, iuv, uvs, ptype, pindex);
-#endif
-            EG_correctUVq(u0, u1, u2, u3, i0, i1, i2, i3, degens, iuv,
-                          ptype, pindex);
-            /* side(s) on Edge(s)? */
-            if (trc[3*j  ] < 0)
-              EG_evalEdgeSeg(body, faces[i], edges, btess, -trc[3*j  ]-1,
-                             i1, i2, st[2*k+1], uvs, ptype, pindex, degens, eu);
-            if (trc[3*j+3] < 0)
-              EG_evalEdgeSeg(body, faces[i], edges, btess, -trc[3*j+3]-1,
-                             i3, i2, st[2*k  ], uvs, ptype, pindex, degens, xu);
-            if (trc[3*j+4] < 0)
-              EG_evalEdgeSeg(body, faces[i], edges, btess, -trc[3*j+4]-1,
-                             i0, i3, st[2*k+1], uvs, ptype, pindex, degens, el);
-            if (trc[3*j+2] < 0)
-              EG_evalEdgeSeg(body, faces[i], edges, btess, -trc[3*j+2]-1,
-                             i0, i1, st[2*k  ], uvs, ptype, pindex, degens, xl);
-            EG_mdTFI(st[2*k], st[2*k+1], 2, xl, xu, el, eu, u0, u1, u2, u3, uv);
-#ifdef REPOSITION
-/*
-            double xmid[4][18];
-            stat = EG_evaluate(faces[i], xl, xmid[0]);
-            stat = EG_evaluate(faces[i], xu, xmid[1]);
-            stat = EG_evaluate(faces[i], el, xmid[2]);
-            stat = EG_evaluate(faces[i], eu, xmid[3]);
-            EG_mdTFI(st[2*k], st[2*k+1], 3, xmid[0], xmid[1], xmid[2], xmid[3],
-                     &xyzs[3*i0], &xyzs[3*i1], &xyzs[3*i2], &xyzs[3*i3], xyz);
-            EG_getInterior(faces[i], xyz, uv);  */
-            EG_minArc4(faces[i], st[2*k], st[2*k+1], xl, eu, xu, el, uv);
-#endif
-            stat = EG_evaluate(faces[i], uv, result);
-            if (stat != EGADS_SUCCESS) {
-              if (outLevel > 0)
-                printf(" EGADS Error: eval %d %d/%d = %d (EG_tessHOverts)!\n",
-                       i+1, j+1, k+1, stat);
-              goto cleanup;
-            }
-            coords[3*np  ] = result[0];
-            coords[3*np+1] = result[1];
-            coords[3*np+2] = result[2];
-            parms[2*np  ]  = uv[0];
-            parms[2*np+1]  = uv[1];
-            np++;
-#ifdef DEBUG
-            if (elems[j*nst/2+k] != 0) printf(" double hit!\n");
-#endif
-            elems[j*nst/2+k] = np;
-          }
-        }
-      }
-    
-    /* fill up the triangles */
-    i1 = nt;
-    if (quad == 1) i1 /= 2;
-    for (ntris = i0 = j = 0; j < i1; j++, i0+=nst)
-      for (k = 0; k < nItri; k++, ntris++) {
-        tris[3*ntris  ] = elems[i0+iTris[3*k  ]-1];
-        tris[3*ntris+1] = elems[i0+iTris[3*k+1]-1];
-        tris[3*ntris+2] = elems[i0+iTris[3*k+2]-1];
-      }
-    
-#ifdef DEBUG
-    printf(" Face %d: npts = %d, ntris = %d\n", i+1, np, ntris);
-#endif
-    stat = EG_setTessFace(newTess, i+1, np, coords, parms, ntris, tris);
+  /* now run the thread block from the original thread */
+  EG_HOfaceThread(&hoface);
+
+  /* wait for all others to return */
+  if (threads != NULL)
+    for (i = 0; i < np-1; i++)
+      if (threads[i] != NULL) EMP_ThreadWait(threads[i]);
+
+  /* thread cleanup */
+  if (threads != NULL)
+    for (i = 0; i < np-1; i++)
+      if (threads[i] != NULL) EMP_ThreadDestroy(threads[i]);
+  if (hoface.mutex != NULL) EMP_LockDestroy(hoface.mutex);
+  if (threads != NULL) free(threads);
+  if (outLevel > 1)
+    printf(" EMP Number of Seconds on Face HO Thread Block = %ld\n",
+           EMP_Done(&start));
+
+  /* set the Faces in the new tessellation */
+  stat = hoface.stat;
+  if (stat != EGADS_SUCCESS) goto cleanup;
+  for (i = 0; i < nfaces; i++) {
+    if (hofaces[i].coords == NULL) continue;
+    stat = EG_setTessFace(newTess, i+1, hofaces[i].npts, hofaces[i].coords,
+                          hofaces[i].parms, hofaces[i].ntris, hofaces[i].tris);
     if (stat != EGADS_SUCCESS) {
       if (outLevel > 0)
         printf(" EGADS Error: EG_setTessFace %d = %d (EG_tessHOverts)!\n",
                i+1, stat);
       goto cleanup;
     }
+    if (outLevel > 1)
+      printf(" EGADS Info: Face %d -- %d tris in %lf seconds (EG_tessHOverts)\n",
+             i+1, hofaces[i].ntris, hofaces[i].time);
   }
   
   /* close up the open tessellation */
@@ -1560,8 +1940,14 @@ EG_tessHOverts(const ego tess, int nstx, int nItrix, const int *iTris,
 cleanup:
   EG_free(type);
   if (frac    != NULL) EG_free(frac);
-  if (elems   != NULL) EG_free(elems);
-  if (tris    != NULL) EG_free(tris);
+  if (hofaces != NULL) {
+    for (i = 0; i < nfaces; i++) {
+      if (hofaces[i].tris   != NULL) EG_free(hofaces[i].tris);
+      if (hofaces[i].coords != NULL) EG_free(hofaces[i].coords);
+    }
+    EG_free(hofaces);
+  }
+  if (order   != NULL) EG_free(order);
   if (faces   != NULL) EG_free(faces);
   if (coords  != NULL) EG_free(coords);
   if (edges   != NULL) EG_free(edges);
@@ -63,6 +63,18 @@ long EMP_Done(long *start)
 }
 
 
+/* wall clock in seconds -- for timing pieces of a thread block */
+
+double EMP_Clock()
+{
+  LARGE_INTEGER freq, count;
+
+  if (QueryPerformanceFrequency(&freq) == 0) return EMP_getseconds();
+  QueryPerformanceCounter(&count);
+  return (double) count.QuadPart / (double) freq.QuadPart;
+}
+
+
 /* Waste a little time */
 
 void EMP_ThreadSpin()
@@ -239,6 +251,17 @@ long EMP_Done(long *start)
 }
 
 
+/* Wall clock in seconds -- for timing pieces of a thread block */
+
+double EMP_Clock()
+{
+  struct timeval tv;
+
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec + 1.e-6*tv.tv_usec;
+}
+
+
 /* Waste a little time -- yeild */
 
 void EMP_ThreadSpin()
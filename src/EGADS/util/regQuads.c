@@ -1,4 +1,5 @@
 #include "egads.h"
+#include "emp.h"
 #include "regQuads.h"
 
 //#define DEBUG
@@ -50,6 +51,17 @@ EG_getSidepoint(const ego face, double fac, const double *uvm,
                 /*@null@*/ const double *uvr, double *uv);
 
 
+typedef struct {
+  void     *mutex;       /* the mutex or NULL for single thread */
+  long     master;       /* master thread ID */
+  int      end;          /* end of loop */
+  int      index;        /* current loop index */
+  int      *order;       /* Face order -- biggest first (can be NULL) */
+  egTessel *btess;       /* the tessellation structure */
+  bodyQuad *bodydata;    /* the body quad data */
+} EMPmap;
+
+
 /* BASE-LEVEL FUNCTION */
 static int inList(int n, int *list, int p)
 {
@@ -62,6 +74,20 @@ static int inList(int n, int *list, int p)
 }
 
 
+/* returns a new tag for marking vertices/quads in the tagV/tagQ scratch */
+static int newTag(meshMap *qm)
+{
+  int i;
+
+  if (qm->tag == 2147483647) {
+      for (i = 0; i < qm->sizeV; i++) qm->tagV[i] = 0;
+      for (i = 0; i < qm->sizeQ; i++) qm->tagQ[i] = 0;
+      qm->tag = 0;
+  }
+  return ++qm->tag;
+}
+
+
 /* IO FUNCTIONS */
 static void meshCount(meshMap *qm, int *nI, int *nV, int *nQ)
 {
@@ -499,12 +525,11 @@ static int EG_buildStar(meshMap *qm, vStar **star, int vID)
       it = 0, it2 = 0, adj[2], *vertex = NULL, *quads = NULL;
   int qLoop[8] = {0, 1, 2, 3, 0, 1, 2, 3};
 
-  vertex = (int *) EG_alloc(qm->totV * sizeof(int));
-  quads  = (int *) EG_alloc(qm->totQ * sizeof(int));
+  // the Face's scratch -- nothing called from here uses it
+  vertex = qm->bufV;
+  quads  = qm->bufQ;
   if (vertex == NULL || quads == NULL) {
       printf(" EG_buildStar MALLOC at quads & verts!!\n ");
-      if (vertex != NULL) EG_free(vertex);
-      if (quads  != NULL) EG_free(quads);
       return EGADS_MALLOC;
   }
   // quads are -1 bias
@@ -519,8 +544,6 @@ static int EG_buildStar(meshMap *qm, vStar **star, int vID)
 #ifdef DEBUG
           printQuad(qm, quadID + 1);
 #endif
-          EG_free(vertex);
-          EG_free(quads);
           return EGADS_INDEXERR;
       }
       for (i = 1; i <= 2; ++i)
@@ -544,16 +567,12 @@ static int EG_buildStar(meshMap *qm, vStar **star, int vID)
 #ifdef DEBUG
                   printQuad(qm, quadID + 1);
 #endif
-                  EG_free(vertex);
-                  EG_free(quads);
                   return EGADS_INDEXERR;
               }
               auxV = qm->qIdx[4 * auxQ + qLoop[i + 1]];
               it2++;
               if (it2 > 200) {
                   printf(" stuck in interior loop of build star!!!!!!!!\n");
-                  EG_free(quads);
-                  EG_free(vertex);
                   return EGADS_RANGERR;
               }
           } while (adj[1] != - 1);
@@ -563,45 +582,41 @@ static int EG_buildStar(meshMap *qm, vStar **star, int vID)
       }
       if (quadID < 0) {
           printf(" I am stuck in build star. Pointing a NULL quad \n");
-          EG_free(vertex);
-          EG_free(quads);
           return EGADS_INDEXERR;
       }
       it++;
       if (it > 200) {
           printf(" EG_buildStar:: stuck in outer loop of build star!!!!!!!!\n");
-          EG_free(vertex);
-          EG_free(quads);
           return EGADS_RANGERR;
       }
   } while (quadID + 1 != quads[0]);
 
-  if (*star != NULL) EG_freeStar(&(*star));
-  *star = (vStar *) EG_alloc(sizeof(vStar));
-  if ((*star) == NULL) {
-      EG_free(vertex);
-      EG_free(quads);
-      return EGADS_MALLOC;
+  // rebuild in place if the old star is big enough
+  if (*star != NULL && ((*star)->mV < v || (*star)->mQ < q))
+      EG_freeStar(&(*star));
+  if (*star == NULL) {
+      *star = (vStar *) EG_alloc(sizeof(vStar));
+      if ((*star) == NULL) return EGADS_MALLOC;
+      (*star)->mV    = v;
+      (*star)->mQ    = q;
+      (*star)->verts = (int    *) EG_alloc(    v * sizeof(int));
+      (*star)->quads = (int    *) EG_alloc(    q * sizeof(int));
+      (*star)->idxV  = (int    *) EG_alloc(2 * v * sizeof(int));
+      (*star)->idxQ  = (int    *) EG_alloc(2 * q * sizeof(int));
+      (*star)->area  = (int    *) EG_alloc(    q * sizeof(int));
+      (*star)->ratio = (double *) EG_alloc(    q * sizeof(double));
+      (*star)->angle = (double *) EG_alloc(    q * sizeof(double));
+      if ((*star)->verts == NULL || (*star)->quads == NULL ||
+          (*star)->idxV  == NULL || (*star)->idxQ  == NULL ||
+          (*star)->area  == NULL || (*star)->ratio == NULL ||
+          (*star)->angle == NULL ) {
+          EG_freeStar(&(*star));
+          return EGADS_MALLOC;
+      }
   }
   (*star)->nQ    = q;
   (*star)->nV    = v;
   (*star)->type  = -1;
-  (*star)->verts = (int    *) EG_alloc(    v * sizeof(int));
-  (*star)->quads = (int    *) EG_alloc(    q * sizeof(int));
-  (*star)->idxV  = (int    *) EG_alloc(2 * v * sizeof(int));
-  (*star)->idxQ  = (int    *) EG_alloc(2 * q * sizeof(int));
-  (*star)->area  = (int    *) EG_alloc(    q * sizeof(int));
-  (*star)->ratio = (double *) EG_alloc(    q * sizeof(double));
-  (*star)->angle = (double *) EG_alloc(    q * sizeof(double));
-  if ((*star)->verts == NULL || (*star)->quads == NULL ||
-      (*star)->idxV  == NULL || (*star)->idxQ  == NULL ||
-      (*star)->area  == NULL || (*star)->ratio == NULL ||
-      (*star)->angle == NULL ) {
-      EG_free((*star));
-      EG_free(vertex);
-      EG_free( quads);
-      return EGADS_MALLOC;
-  }
   for (i = 0; i < q; ++i) {
       (*star)->quads[i    ] = quads[i];
       (*star)->idxQ [i    ] = i;
@@ -612,8 +627,6 @@ static int EG_buildStar(meshMap *qm, vStar **star, int vID)
       (*star)->idxV [i    ] = i;
       (*star)->idxV [v + i] = i + 1;
   }
-  EG_free (vertex);
-  EG_free (quads);
   return EGADS_SUCCESS;
 }
 
@@ -675,36 +688,29 @@ static int EG_setValence(meshMap *qm, int vID)
 
 static int EG_backupQuads(meshMap *qm, int *nq, int *qlist, Quad **quad)
 {
-  int   i, j, q, v, qcount, *qaux = NULL, k, add = 0;
+  int   i, j, q, v, qcount, *qaux = NULL, tag;
 
-  qaux      = (int *) EG_alloc(qm->totQ * sizeof(int));
+  qaux      = qm->lstQ;
   if (qaux == NULL) return EGADS_MALLOC;
+  tag       = newTag(qm);
   for (qcount = q = 0; q < *nq; q++) {
       if (qlist[q] == -1) continue;
       for (i = 0; i < 4; i++) {
           v    = qm->qIdx[4 * (qlist[q] - 1) + i] - 1;
           if (qm->star[v] == NULL) {
-              EG_free (qaux);
               printf("Star for vertex %d is NULL !!\n ", v+ 1);
               return EGADS_MALLOC;
           }
           for (j = 0; j < qm->star[v]->nQ; j++) {
               if (qm->star[v]->quads[j] == -1) continue;
-              for (add = k = 0; k < qcount; k++) {
-                  if (qaux[k] == qm->star[v]->quads[j]) {
-                      add = 1;
-                      break;
-                  }
-              }
-              if (add == 0 || qcount == 0) qaux[qcount++] = qm->star[v]->quads[j];
+              if (qm->tagQ[qm->star[v]->quads[j] - 1] == tag) continue;
+              qm->tagQ[qm->star[v]->quads[j] - 1] = tag;
+              qaux[qcount++] = qm->star[v]->quads[j];
           }
       }
   }
   (*quad)      = (Quad *) EG_alloc(qcount * sizeof(Quad));
-  if ((*quad) == NULL) {
-      EG_free(qaux);
-      return EGADS_MALLOC;
-  }
+  if ((*quad) == NULL) return EGADS_MALLOC;
   for (q = 0; q < qcount; q++) {
       (*quad)[q].id = qaux[q];
       for (j = 0; j < 4; j++) {
@@ -712,7 +718,6 @@ static int EG_backupQuads(meshMap *qm, int *nq, int *qlist, Quad **quad)
           (*quad)[q].verts[j] = qm->qIdx[4 * (qaux[q] - 1) + j];
       }
   }
-  EG_free(qaux);
   *nq = qcount;
   return EGADS_SUCCESS;
 }
@@ -720,17 +725,19 @@ static int EG_backupQuads(meshMap *qm, int *nq, int *qlist, Quad **quad)
 
 static int EG_restoreQuads(meshMap *qm, Quad *quad, int nq)
 {
-  int i, j, *vid = NULL, k, stat;
+  int i, j, *vid = NULL, k, stat, tag;
 
-  vid      = (int *) EG_alloc(qm->totV * sizeof(int));
+  vid      = qm->lstV;
   if (vid == NULL) return EGADS_MALLOC;
+  tag      = newTag(qm);
   for (k  = i = 0; i < nq; i++) {
       if (quad[i].id == -1) continue;
       for (j = 0; j < 4; j++) {
           qm->qAdj[4 * (quad[i].id - 1) + j] = quad[i].qadj [j];
           qm->qIdx[4 * (quad[i].id - 1) + j] = quad[i].verts[j];
           if (k == qm->totV) continue;
-          if (inList(k, vid, quad[i].verts[j]) == -1) {
+          if (qm->tagV[quad[i].verts[j] - 1] != tag) {
+              qm->tagV[quad[i].verts[j] - 1] = tag;
               qm->valence[quad[i].verts[j] - 1][0] = quad[i].id;
               vid[k++] = quad[i].verts[j];
           }
@@ -741,11 +748,9 @@ static int EG_restoreQuads(meshMap *qm, Quad *quad, int nq)
       if (stat != EGADS_SUCCESS) {
           printf(" EG_restoreQuads failed at setting valence for %d \n",
                  vid[i]);
-          EG_free(vid);
           return stat;
       }
   }
-  EG_free(vid);
   return EGADS_SUCCESS;
 }
 
@@ -1719,17 +1724,340 @@ printf(" DOMINANT ANGLE %lf MAX ANGLE %lf\n", errbd, auxd);
   return ta[0];
 }
 
-int EG_createMeshMap(bodyQuad *bodydata)
+/* builds the quad map for a single Face -- problems deactivate the Face */
+static void EG_faceMeshMap(bodyQuad *bodydata, const egTessel *btess, int f)
 {
-  int          f, stat = 0, j, q, k, kk, kOK, len, iA, iB, iC;
-  int          ntri, nquad, e4[4] ;
+  int          stat = 0, j, q, k, kk, len, iA, iB, iC, a, b, c, d;
+  int          ntri, nquad, e4[4], *off = NULL, *pos = NULL, *vq = NULL;
   const int    *tris, *tric, *ptype, *pindex;
   double       angle, xyz[18], norm1, norm2, u01[3], u02[3], v01[3], v02[3], uC[3], vC[3];
   const double *xyzs, *uvs;
   int          qV[6]    = { 0, 1, 2, 5, 0, 1};
   int          qLoop[5] = { 0, 1, 2, 3, 0   };
+  meshMap      *qm;
+
+  qm   = bodydata->qm[f];
+  /* Edges associated to face */
+  stat = EG_getTessFace(bodydata->tess, f + 1, &len,
+                        &xyzs, &uvs, &ptype, &pindex, &ntri,
+                        &tris, &tric);
+  if (stat != EGADS_SUCCESS) {
+      printf("EG_createMeshMap :: EG_getTessFace %d = %d !!\n",f + 1, stat);
+      qm->fID = 0;
+      return;
+  }
+  // CHECK TESSELATION IS WELL CONSTRUCTED
+  for (q = 0; q < ntri; q++) {
+     iA     = tris[3 * q     ] - 1;
+     iB     = tris[3 * q  + 1] - 1;
+     iC     = tris[3 * q  + 2] - 1;
+
+     u01[0] = xyzs[3 * iB    ] - xyzs[3 * iA    ];
+     u01[1] = xyzs[3 * iB + 1] - xyzs[3 * iA + 1];
+     u01[2] = xyzs[3 * iB + 2] - xyzs[3 * iA + 2];
+
+     u02[0] = xyzs[3 * iC    ] - xyzs[3 * iA    ];
+     u02[1] = xyzs[3 * iC + 1] - xyzs[3 * iA + 1];
+     u02[2] = xyzs[3 * iC + 2] - xyzs[3 * iA + 2];
+     CROSS(u01, u02, uC);
+     norm1   = sqrt(uC[0] * uC[0] + uC[1] * uC[1] + uC[2] * uC[2]);
+     if ( norm1 == 0. ) {
+        printf(" \n EG_createMeshMap FACE %d TRI %d, zero area !!!\n",
+        f +1, q + 1 );
+        qm->fID       = 0;
+     }
+     uC[0] /= norm1;
+     uC[1] /= norm1;
+     uC[2] /= norm1;
+     for (kk = 0; kk < 3; kk++) {
+       k      = tric[3 * q + kk] - 1;
+       if (k < 0 || k < q) continue;
+       iA     = tris[3 * k     ] - 1;
+       iB     = tris[3 * k  + 1] - 1;
+       iC     = tris[3 * k  + 2] - 1;
+
+       v01[0] = xyzs[3 * iB    ] - xyzs[3 * iA    ];
+       v01[1] = xyzs[3 * iB + 1] - xyzs[3 * iA + 1];
+       v01[2] = xyzs[3 * iB + 2] - xyzs[3 * iA + 2];
+
+       v02[0] = xyzs[3 * iC    ] - xyzs[3 * iA    ];
+       v02[1] = xyzs[3 * iC + 1] - xyzs[3 * iA + 1];
+       v02[2] = xyzs[3 * iC + 2] - xyzs[3 * iA + 2];
+       CROSS(v01, v02, vC);
+       norm1  = sqrt(vC[0] * vC[0] + vC[1] * vC[1] + vC[2] * vC[2]);
+       if ( norm1 == 0. ) {
+          printf(" \n EG_createMeshMap FACE %d TRI %d, zero area !!!\n",
+          f +1, k + 1 );
+          qm->fID       = 0;
+       }
+       vC[0] /= norm1;
+       vC[1] /= norm1;
+       vC[2] /= norm1;
+
+       if (DOT(uC, vC) < -EPS08 ) {
+          printf(" \n EG_createMeshMap FACE %d TRI %d, %d %.12f wrong OR !!!\n",
+          f +1, q + 1, k + 1, DOT(uC, vC) );
+          qm->fID       = 0;
+       }
+    }
+  }
+  nquad      = (int) ntri/2;
+  qm->oriV   = len;
+  qm->oriQ   = nquad;
+  qm->sizeV  = 2 * len;
+  qm->sizeQ  = 2 * nquad;
+  qm->totV   = len;
+  qm->totQ   = nquad;
+  qm->vInv   = NULL;
+  qm->regBd  = 1;
+  if( btess->tess2d[f].tfi == 1 || qm->fID == 0) {
+      qm->fID     = 0;
+      return;
+  }
+  qm->xyzs    = (double *) EG_alloc(3*(2 * len  )*sizeof(double));
+  qm->uvs     = (double *) EG_alloc(2*(2 * len  )*sizeof(double));
+  qm->vType   = (int    *) EG_alloc(  (2 * len  )*sizeof(  int ));
+  qm->qIdx    = (int    *) EG_alloc(4*(2 * nquad)*sizeof(  int ));
+  qm->qAdj    = (int    *) EG_alloc(4*(2 * nquad)*sizeof(  int ));
+  qm->remQ    = (int    *) EG_alloc(  (2 * nquad)*sizeof(  int ));
+  qm->remV    = (int    *) EG_alloc(  (2 * len  )*sizeof(  int ));
+  qm->valence = (int   **) EG_alloc(  (2 * len  )*sizeof(  int*));
+  qm->star    = (vStar **) EG_alloc(  (2 * len  )*sizeof(vStar*));
+  qm->bufV    = (int    *) EG_alloc(  (2 * len  )*sizeof(  int ));
+  qm->bufQ    = (int    *) EG_alloc(  (2 * nquad)*sizeof(  int ));
+  qm->lstV    = (int    *) EG_alloc(  (2 * len  )*sizeof(  int ));
+  qm->lstQ    = (int    *) EG_alloc(  (2 * nquad)*sizeof(  int ));
+  qm->tagV    = (int    *) EG_alloc(  (2 * len  )*sizeof(  int ));
+  qm->tagQ    = (int    *) EG_alloc(  (2 * nquad)*sizeof(  int ));
+  if (qm->qIdx  == NULL || qm->qAdj    == NULL ||
+      qm->xyzs  == NULL || qm->uvs     == NULL ||
+      qm->vType == NULL || qm->remQ    == NULL ||
+      qm->remV  == NULL || qm->valence == NULL ||
+      qm->star  == NULL || qm->bufV    == NULL ||
+      qm->bufQ  == NULL || qm->lstV    == NULL ||
+      qm->lstQ  == NULL || qm->tagV    == NULL ||
+      qm->tagQ  == NULL) {
+      // nothing has been put in the star & valence arrays yet
+      EG_free(qm->valence);
+      EG_free(qm->star);
+      qm->valence = NULL;
+      qm->star    = NULL;
+      qm->fID     = 0;
+      return;
+  }
+  qm->tag = 0;
+  for (j = 0; j < 2 * len;   j++) qm->tagV[j] = 0;
+  for (j = 0; j < 2 * nquad; j++) qm->tagQ[j] = 0;
+  qm->remQ[0]  = 0;
+  qm->remV[0]  = 0;
+  qm->invsteps = 0;
+  for (j = 0; j < 2 * len; j++) {
+      qm->star[j]    = NULL;
+      qm->valence[j] = (int *) EG_alloc(3 * sizeof(int));
+      if (qm->valence[j] == NULL) {
+          qm->fID = 0;
+          continue;
+      }
+      qm->valence[j][2] = 0;
+  }
+  if (qm->fID == 0) return;
+  qm->face = bodydata->faces[f];
+  stat = EG_getRange(qm->face, qm->range, &j);
+  if (stat != EGADS_SUCCESS)
+      printf(" EG_createMeshMap :: getRange = %d !! \n", stat);
+  qm->range[0] -= 1.e-4;
+  qm->range[1] += 1.e-4;
+  qm->range[2] -= 1.e-4;
+  qm->range[3] += 1.e-4;
+  for (k = j = 0; j < len; j++) {
+      qm->vType  [j]         = ptype[j];
+      if (ptype[j] >= 0 ) k++;
+      qm->uvs    [2 * j    ] = uvs[2 * j    ];
+      qm->uvs    [2 * j + 1] = uvs[2 * j + 1];
+      if (uvs[2 * j    ] < qm->range[0] ||
+          uvs[2 * j    ] > qm->range[1] ||
+          uvs[2 * j + 1] < qm->range[2] ||
+          uvs[2 * j + 1] > qm->range[3] ) {
+          printf(" EG_createMeshMap :: vertex %d = %f  %f  is out of range !! \n ",
+                 j + 1, uvs[2 * j], uvs[2 * j + 1]);
+          printf(" Range FACE %d --- > %f  %f  %f  %f\n ", qm->fID,
+                 qm->range[0],qm->range[1],
+                 qm->range[2],qm->range[3]);
+          qm->fID = 0;
+          break;
+      }
+      qm->xyzs[3 * j    ] = xyzs[3 * j    ];
+      qm->xyzs[3 * j + 1] = xyzs[3 * j + 1];
+      qm->xyzs[3 * j + 2] = xyzs[3 * j + 2];
+  }
+  qm->bdAng = (double *) EG_alloc(k * sizeof(double));
+  qm->degen = (int    *) EG_alloc(k * sizeof(   int));
+  if (qm->bdAng == NULL ||
+      qm->degen == NULL){
+      qm->fID = 0;
+      return;
+  }
+  for (j = 0; j < len; j++) {
+      if(qm->vType[j] == -1) break;
+      qm->degen[j] = 0;
+      stat  = EG_evaluate(qm->face, &qm->uvs[2*j],
+                          xyz);
+      if (stat != EGADS_SUCCESS)
+          printf(" EG_createMeshMap :: evaluate = %d !! \n", stat);
+      norm1 = xyz[3] * xyz[3] + xyz[4] * xyz[4] + xyz[5] * xyz[5];
+      norm2 = xyz[6] * xyz[6] + xyz[7] * xyz[7] + xyz[8] * xyz[8];
+      if (sqrt(norm1) < qEPS || sqrt(norm2) < qEPS) {
+#ifdef DEBUG
+          printf("\n\n FACE %d V %d is degenerate\n", f + 1, j + 1);
+          printf(" DU %lf %lf %lf DV %lf %lf %lf\n",
+                 xyz[3], xyz[4], xyz[5], xyz[6], xyz[7], xyz[8]);
+#endif
+          qm->degen[j] = 1;
+      }
+  }
+  for (j = 0; j < nquad; j++) {
+      for (k = 0; k < 4; ++k)
+        qm->qIdx[4*j + k] = tris[6*j + qV[k+1]];
+  }
+  // the neighbor across each side is the lowest numbered other quad that
+  // has the side -- look through the quads that touch the side's first vertex
+  off = (int *) EG_alloc((len + 1)  * sizeof(int));
+  pos = (int *) EG_alloc( len       * sizeof(int));
+  vq  = (int *) EG_alloc((4 * nquad + 1) * sizeof(int));
+  if (off == NULL || pos == NULL || vq == NULL) {
+      EG_free(off);
+      EG_free(pos);
+      EG_free(vq);
+      qm->fID = 0;
+      return;
+  }
+  for (j = 0; j <= len; j++) off[j] = 0;
+  for (j = 0; j < 4 * nquad; j++) off[qm->qIdx[j]]++;
+  for (j = 0; j <  len; j++) {
+      off[j + 1] += off[j];
+      pos[j]      = off[j];
+  }
+  for (j = 0; j < nquad; j++)
+    for (k = 0; k < 4; ++k)
+      vq[pos[qm->qIdx[4*j + k] - 1]++] = j;
+  for (j = 0; j < nquad; j++) {
+      for (kk = 0; kk < 4; kk++) {
+          a = qm->qIdx[4*j + qLoop[kk    ]];
+          b = qm->qIdx[4*j + qLoop[kk + 1]];
+          qm->qAdj[4*j + kk] = -1;
+          for (iA = off[a - 1]; iA < off[a]; iA++) {
+              q = vq[iA];
+              if (q == j) continue;
+              for (k = 0; k < 4; ++k) {
+                  c = qm->qIdx[4*q + qLoop[k    ]];
+                  d = qm->qIdx[4*q + qLoop[k + 1]];
+                  if ((a == c || a == d) && (b == c || b == d)) break;
+              }
+              if (k < 4) {
+                  qm->qAdj[4*j + kk] = q + 1;
+                  break;
+              }
+          }
+      }
+  }
+  EG_free(off);
+  EG_free(pos);
+  EG_free(vq);
+  for (j = 0; j < nquad; j++) {
+      for (q = 0; q < 4; ++q)
+        qm->valence[qm->qIdx[4 * j + q] - 1][0] = j + 1;
+  }
+  for (j = 0; j < len; j++) {
+      stat = EG_setValence (qm, j + 1);
+      if (stat != EGADS_SUCCESS) {
+          printf("In EG_createMeshMap :: set valence at %d is %d!!\n ",
+                 j + 1, stat);
+          qm->fID = 0;
+          break;
+      }
+  }
+  for (e4[0]= e4[1] = j = 0; j < len; j++) {
+      if (qm->vType[j] == -1) break;
+      stat     = EG_angAtBdVert(qm, j + 1, e4, &angle);
+      if (stat != EGADS_SUCCESS || angle < EPS08 ) {
+#ifdef REPORT
+          printf(" FACE %d EG_angAtBdVert %d angle %f\n ",f + 1, stat, angle);
+          printf(" Vertices: %d %d %d \n ", j+ 1, e4[0], e4[1]);
+#endif
+          if (qm->vType[j] == 0) qm->vType[j] = 2;
+      }
+      else if (angle < 0.75 * PI) qm->vType[j] = 2;
+      else if (angle < 1.25 * PI) qm->vType[j] = 3;
+      else if (angle < 1.75 * PI) qm->vType[j] = 4;
+      else                        qm->vType[j] = 5;
+      if (qm->valence[j][2] < qm->vType[j])
+          qm->vType[j] = qm->valence[j][2];
+      if (qm->vType[j] == 2)
+               qm->valence[j][1] = qm->valence[j][2] + 2;
+      else if (qm->vType[j] == 3)
+               qm->valence[j][1] = qm->valence[j][2] + 1;
+      else if (qm->vType[j] >= 5)
+               qm->valence[j][1] = qm->valence[j][2] - 1;
+      qm->bdAng[j] = angle;
+  }
+}
+
+
+static void EG_meshMapThread(void *struc)
+{
+  int    index, iface;
+  long   ID;
+  EMPmap *qmap;
+
+  qmap = (EMPmap *) struc;
+
+  /* get our identifier */
+  ID = EMP_ThreadID();
+
+  /* look for work */
+  for (;;) {
+
+    iface = -1;
+    /* only one thread at a time here -- controlled by a mutex! */
+    if (qmap->mutex != NULL) EMP_LockSet(qmap->mutex);
+    for (index = qmap->index; index < qmap->end; index++) {
+      iface = index;
+      if (qmap->order != NULL) iface = qmap->order[index];
+      if (qmap->bodydata->qm[iface] == NULL) continue;
+      break;
+    }
+    qmap->index = index+1;
+    if (qmap->mutex != NULL) EMP_LockRelease(qmap->mutex);
+    if (index >= qmap->end) break;
+
+    /* do the work */
+    EG_faceMeshMap(qmap->bodydata, qmap->btess, iface);
+  }
+
+  /* exhausted all work -- exit */
+  if (ID != qmap->master) EMP_ThreadExit();
+}
+
+
+/* order the Faces by decreasing cost */
+static int EG_mapCost(const void *a, const void *b)
+{
+  const int *ia = (const int *) a;
+  const int *ib = (const int *) b;
+
+  if (ia[0] != ib[0]) return ib[0] - ia[0];
+  return ia[1] - ib[1];
+}
+
+
+int EG_createMeshMap(bodyQuad *bodydata)
+{
+  int          f, np, *order = NULL;
+  long         start;
+  void         **threads = NULL;
   ego          tess;
   egTessel     *btess;
+  EMPmap       qmap;
 
   tess  = bodydata->tess;
   btess = (egTessel *) tess->blind;
@@ -1745,265 +2073,94 @@ int EG_createMeshMap(bodyQuad *bodydata)
           printf("EG_createMeshMap face %d VOID ptr\n ", f + 1);
           continue;
       }
-      bodydata->qm[f]->fID        = f + 1;
-      bodydata->qm[f]->plotcount  = 0;
-      /* Edges associated to face */
-      stat = EG_getTessFace(bodydata->tess, f + 1, &len,
-                            &xyzs, &uvs, &ptype, &pindex, &ntri,
-                            &tris, &tric);
-      if (stat != EGADS_SUCCESS) {
-          printf("EG_createMeshMap :: EG_getTessFace %d = %d !!\n",f + 1, stat);
-          bodydata->qm[f]->fID   = 0;
-      }
-      // CHECK TESSELATION IS WELL CONSTRUCTED
-      for (q = 0; q < ntri; q++) {
-         iA     = tris[3 * q     ] - 1;
-         iB     = tris[3 * q  + 1] - 1;
-         iC     = tris[3 * q  + 2] - 1;
-
-         u01[0] = xyzs[3 * iB    ] - xyzs[3 * iA    ];
-         u01[1] = xyzs[3 * iB + 1] - xyzs[3 * iA + 1];
-         u01[2] = xyzs[3 * iB + 2] - xyzs[3 * iA + 2];
-
-         u02[0] = xyzs[3 * iC    ] - xyzs[3 * iA    ];
-         u02[1] = xyzs[3 * iC + 1] - xyzs[3 * iA + 1];
-         u02[2] = xyzs[3 * iC + 2] - xyzs[3 * iA + 2];
-         CROSS(u01, u02, uC);
-         norm1   = sqrt(uC[0] * uC[0] + uC[1] * uC[1] + uC[2] * uC[2]);
-         if ( norm1 == 0. ) {
-            printf(" \n EG_createMeshMap FACE %d TRI %d, zero area !!!\n",
-            f +1, q + 1 );
-            bodydata->qm[f]->fID       = 0;
-         }
-         uC[0] /= norm1;
-         uC[1] /= norm1;
-         uC[2] /= norm1;
-         for (kk = 0; kk < 3; kk++) {
-           k      = tric[3 * q + kk] - 1;
-           if (k < 0 || k < q) continue;
-           iA     = tris[3 * k     ] - 1;
-           iB     = tris[3 * k  + 1] - 1;
-           iC     = tris[3 * k  + 2] - 1;
-
-           v01[0] = xyzs[3 * iB    ] - xyzs[3 * iA    ];
-           v01[1] = xyzs[3 * iB + 1] - xyzs[3 * iA + 1];
-           v01[2] = xyzs[3 * iB + 2] - xyzs[3 * iA + 2];
-
-           v02[0] = xyzs[3 * iC    ] - xyzs[3 * iA    ];
-           v02[1] = xyzs[3 * iC + 1] - xyzs[3 * iA + 1];
-           v02[2] = xyzs[3 * iC + 2] - xyzs[3 * iA + 2];
-           CROSS(v01, v02, vC);
-           norm1  = sqrt(vC[0] * vC[0] + vC[1] * vC[1] + vC[2] * vC[2]);
-           if ( norm1 == 0. ) {
-              printf(" \n EG_createMeshMap FACE %d TRI %d, zero area !!!\n",
-              f +1, k + 1 );
-              bodydata->qm[f]->fID       = 0;
-           }
-           vC[0] /= norm1;
-           vC[1] /= norm1;
-           vC[2] /= norm1;
-
-           if (DOT(uC, vC) < -EPS08 ) {
-              printf(" \n EG_createMeshMap FACE %d TRI %d, %d %.12f wrong OR !!!\n",
-              f +1, q + 1, k + 1, DOT(uC, vC) );
-              bodydata->qm[f]->fID       = 0;
-           }
-        }
-      }
-      nquad                   = (int) ntri/2;
-      bodydata->qm[f]->oriV   = len;
-      bodydata->qm[f]->oriQ   = nquad;
-      bodydata->qm[f]->sizeV  = 2 * len;
-      bodydata->qm[f]->sizeQ  = 2 * nquad;
-      bodydata->qm[f]->totV   = len;
-      bodydata->qm[f]->totQ   = nquad;
-      bodydata->qm[f]->vInv   = NULL;
-      bodydata->qm[f]->regBd  = 1;
-      if( btess->tess2d[f].tfi == 1 || bodydata->qm[f]->fID == 0) {
-          bodydata->qm[f]->xyzs    = NULL;
-          bodydata->qm[f]->uvs     = NULL;
-          bodydata->qm[f]->vType   = NULL;
-          bodydata->qm[f]->qIdx    = NULL;
-          bodydata->qm[f]->qAdj    = NULL;
-          bodydata->qm[f]->remQ    = NULL;
-          bodydata->qm[f]->remV    = NULL;
-          bodydata->qm[f]->valence = NULL;
-          bodydata->qm[f]->star    = NULL;
-          bodydata->qm[f]->bdAng   = NULL;
-          bodydata->qm[f]->degen   = NULL;
-          bodydata->qm[f]->fID     = 0;
-          continue;
-      }
-      bodydata->qm[f]->xyzs    = (double *) EG_alloc(3*(2 * len  )*sizeof(double));
-      bodydata->qm[f]->uvs     = (double *) EG_alloc(2*(2 * len  )*sizeof(double));
-      bodydata->qm[f]->vType   = (int    *) EG_alloc(  (2 * len  )*sizeof(  int ));
-      bodydata->qm[f]->qIdx    = (int    *) EG_alloc(4*(2 * nquad)*sizeof(  int ));
-      bodydata->qm[f]->qAdj    = (int    *) EG_alloc(4*(2 * nquad)*sizeof(  int ));
-      bodydata->qm[f]->remQ    = (int    *) EG_alloc(  (2 * nquad)*sizeof(  int ));
-      bodydata->qm[f]->remV    = (int    *) EG_alloc(  (2 * len  )*sizeof(  int ));
-      bodydata->qm[f]->valence = (int   **) EG_alloc(  (2 * len  )*sizeof(  int*));
-      bodydata->qm[f]->star    = (vStar **) EG_alloc(  (2 * len  )*sizeof(vStar*));
-      if (bodydata->qm[f]->qIdx  == NULL || bodydata->qm[f]->qAdj    == NULL ||
-          bodydata->qm[f]->xyzs  == NULL || bodydata->qm[f]->uvs     == NULL ||
-          bodydata->qm[f]->vType == NULL || bodydata->qm[f]->remQ    == NULL ||
-          bodydata->qm[f]->remV  == NULL || bodydata->qm[f]->valence == NULL ||
-          bodydata->qm[f]->star  == NULL) {
-          bodydata->qm[f]->fID = 0;
-          continue;
-      }
-      bodydata->qm[f]->remQ[0]  = 0;
-      bodydata->qm[f]->remV[0]  = 0;
-      bodydata->qm[f]->invsteps = 0;
-      for (j = 0; j < 2 * len; j++) {
-          bodydata->qm[f]->star[j]    = NULL;
-          bodydata->qm[f]->valence[j] = (int *) EG_alloc(3 * sizeof(int));
-          if (bodydata->qm[f]->valence[j] == NULL) {
-              bodydata->qm[f]->fID = 0;
-              continue;
-          }
-          bodydata->qm[f]->valence[j][2] = 0;
-      }
-      if (bodydata->qm[f]->fID == 0) continue;
-      bodydata->qm[f]->face = bodydata->faces[f];
-      stat = EG_getRange(bodydata->qm[f]->face, bodydata->qm[f]->range, &j);
-      if (stat != EGADS_SUCCESS)
-          printf(" EG_createMeshMap :: getRange = %d !! \n", stat);
-      bodydata->qm[f]->range[0] -= 1.e-4;
-      bodydata->qm[f]->range[1] += 1.e-4;
-      bodydata->qm[f]->range[2] -= 1.e-4;
-      bodydata->qm[f]->range[3] += 1.e-4;
-      for (k = j = 0; j < len; j++) {
-          bodydata->qm[f]->vType  [j]         = ptype[j];
-          if (ptype[j] >= 0 ) k++;
-          bodydata->qm[f]->uvs    [2 * j    ] = uvs[2 * j    ];
-          bodydata->qm[f]->uvs    [2 * j + 1] = uvs[2 * j + 1];
-          if (uvs[2 * j    ] < bodydata->qm[f]->range[0] ||
-              uvs[2 * j    ] > bodydata->qm[f]->range[1] ||
-              uvs[2 * j + 1] < bodydata->qm[f]->range[2] ||
-              uvs[2 * j + 1] > bodydata->qm[f]->range[3] ) {
-              printf(" EG_createMeshMap :: vertex %d = %f  %f  is out of range !! \n ",
-                     j + 1, uvs[2 * j], uvs[2 * j + 1]);
-              printf(" Range FACE %d --- > %f  %f  %f  %f\n ", bodydata->qm[f]->fID,
-                     bodydata->qm[f]->range[0],bodydata->qm[f]->range[1],
-                     bodydata->qm[f]->range[2],bodydata->qm[f]->range[3]);
-              bodydata->qm[f]->fID = 0;
-              break;
-          }
-          bodydata->qm[f]->xyzs[3 * j    ] = xyzs[3 * j    ];
-          bodydata->qm[f]->xyzs[3 * j + 1] = xyzs[3 * j + 1];
-          bodydata->qm[f]->xyzs[3 * j + 2] = xyzs[3 * j + 2];
-      }
-      bodydata->qm[f]->bdAng = (double *) EG_alloc(k * sizeof(double));
-      bodydata->qm[f]->degen = (int    *) EG_alloc(k * sizeof(   int));
-      if (bodydata->qm[f]->bdAng == NULL ||
-          bodydata->qm[f]->degen == NULL){
-          bodydata->qm[f]->fID = 0;
-          continue;
-      }
-      for (j = 0; j < len; j++) {
-          if(bodydata->qm[f]->vType[j] == -1) break;
-          bodydata->qm[f]->degen[j] = 0;
-          stat  = EG_evaluate(bodydata->qm[f]->face, &bodydata->qm[f]->uvs[2*j],
-                              xyz);
-          if (stat != EGADS_SUCCESS)
-              printf(" EG_createMeshMap :: evaluate = %d !! \n", stat);
-          norm1 = xyz[3] * xyz[3] + xyz[4] * xyz[4] + xyz[5] * xyz[5];
-          norm2 = xyz[6] * xyz[6] + xyz[7] * xyz[7] + xyz[8] * xyz[8];
-          if (sqrt(norm1) < qEPS || sqrt(norm2) < qEPS) {
-#ifdef DEBUG
-              printf("\n\n FACE %d V %d is degenerate\n", f + 1, j + 1);
-              printf(" DU %lf %lf %lf DV %lf %lf %lf\n",
-                     xyz[3], xyz[4], xyz[5], xyz[6], xyz[7], xyz[8]);
-#endif
-              bodydata->qm[f]->degen[j] = 1;
-          }
-      }
-      for (j = 0; j < nquad; j++) {
-          for (k = 0; k < 4; ++k)
-            bodydata->qm[f]->qIdx[4*j + k] = tris[6*j + qV[k+1]];
-      }
-      for (j = 0; j < nquad; j++)
-        {
-          kk  = 0;
-          kOK = 0;
-          q   = 0;
-          while (q < nquad) {
-              if (q == j) {
-                  if (j == nquad - 1 && kk < 4) {
-                      bodydata->qm[f]->qAdj[4*j + kk++] = -1;
-                      if (kk == 4) break;
-                      q = 0;
-                  }
-                  else q++;
-              }
-              if  (q == nquad) break;
-              for (k = 0; k < 4; ++k) {
-                  if ((bodydata->qm[f]->qIdx[4*j + qLoop[kk    ]] ==
-                      bodydata->qm[f]->qIdx[4*q + qLoop[k     ]] ||
-                      bodydata->qm[f]->qIdx[4*j + qLoop[kk    ]] ==
-                          bodydata->qm[f]->qIdx[4*q + qLoop[k  + 1]]) &&
-                      (bodydata->qm[f]->qIdx[4*j + qLoop[kk + 1]] ==
-                          bodydata->qm[f]->qIdx[4*q + qLoop[k     ]] ||
-                          bodydata->qm[f]->qIdx[4*j + qLoop[kk + 1]] ==
-                              bodydata->qm[f]->qIdx[4*q + qLoop[k  + 1]])) {
-                      bodydata->qm[f]->qAdj[4*j + kk++] = q + 1;
-                      q   = -1;
-                      kOK =  1;
-                      k   =  4;
-                      if (kk == 4) q = nquad;
-                  }
-              }
-              if ((kOK == 0) && (q >= nquad -1)) {
-                  bodydata->qm[f]->qAdj[4*j + kk++] = -1;
-                  q = -1;
-                  if (kk == 4) break;
-              }
-              else kOK = 0;
-              q++;
-          }
-          if (kOK == 0 && kk < 4) {
-              while (kk < 4)
-                bodydata->qm[f]->qAdj[4*j + kk++] = -1;
-          }
-        }
-      for (j = 0; j < nquad; j++) {
-          for (q = 0; q < 4; ++q)
-            bodydata->qm[f]->valence[bodydata->qm[f]->qIdx[4 * j + q] - 1][0] = j + 1;
-      }
-      for (j = 0; j < len; j++) {
-          stat = EG_setValence (bodydata->qm[f], j + 1);
-          if (stat != EGADS_SUCCESS) {
-              printf("In EG_createMeshMap :: set valence at %d is %d!!\n ",
-                     j + 1, stat);
-              bodydata->qm[f]->fID = 0;
-              break;
-          }
-      }
-      for (e4[0]= e4[1] = j = 0; j < len; j++) {
-          if (bodydata->qm[f]->vType[j] == -1) break;
-          stat     = EG_angAtBdVert(bodydata->qm[f], j + 1, e4, &angle);
-          if (stat != EGADS_SUCCESS || angle < EPS08 ) {
-#ifdef REPORT
-              printf(" FACE %d EG_angAtBdVert %d angle %f\n ",f + 1, stat, angle);
-              printf(" Vertices: %d %d %d \n ", j+ 1, e4[0], e4[1]);
-#endif
-              if (bodydata->qm[f]->vType[j] == 0) bodydata->qm[f]->vType[j] = 2;
-          }
-          else if (angle < 0.75 * PI) bodydata->qm[f]->vType[j] = 2;
-          else if (angle < 1.25 * PI) bodydata->qm[f]->vType[j] = 3;
-          else if (angle < 1.75 * PI) bodydata->qm[f]->vType[j] = 4;
-          else                        bodydata->qm[f]->vType[j] = 5;
-		  if (bodydata->qm[f]->valence[j][2] < bodydata->qm[f]->vType[j])
-              bodydata->qm[f]->vType[j] = bodydata->qm[f]->valence[j][2];
-		  if (bodydata->qm[f]->vType[j] == 2)
-                   bodydata->qm[f]->valence[j][1] = bodydata->qm[f]->valence[j][2] + 2;
-          else if (bodydata->qm[f]->vType[j] == 3)
-                   bodydata->qm[f]->valence[j][1] = bodydata->qm[f]->valence[j][2] + 1;
-          else if (bodydata->qm[f]->vType[j] >= 5)
-                   bodydata->qm[f]->valence[j][1] = bodydata->qm[f]->valence[j][2] - 1;
-          bodydata->qm[f]->bdAng[j] = angle;
+      bodydata->qm[f]->fID       = f + 1;
+      bodydata->qm[f]->plotcount = 0;
+      bodydata->qm[f]->sizeV     = 0;
+      bodydata->qm[f]->sizeQ     = 0;
+      bodydata->qm[f]->xyzs      = NULL;
+      bodydata->qm[f]->uvs       = NULL;
+      bodydata->qm[f]->vType     = NULL;
+      bodydata->qm[f]->qIdx      = NULL;
+      bodydata->qm[f]->qAdj      = NULL;
+      bodydata->qm[f]->remQ      = NULL;
+      bodydata->qm[f]->remV      = NULL;
+      bodydata->qm[f]->valence   = NULL;
+      bodydata->qm[f]->star      = NULL;
+      bodydata->qm[f]->vInv      = NULL;
+      bodydata->qm[f]->bdAng     = NULL;
+      bodydata->qm[f]->degen     = NULL;
+      bodydata->qm[f]->bufV      = NULL;
+      bodydata->qm[f]->bufQ      = NULL;
+      bodydata->qm[f]->lstV      = NULL;
+      bodydata->qm[f]->lstQ      = NULL;
+      bodydata->qm[f]->tagV      = NULL;
+      bodydata->qm[f]->tagQ      = NULL;
+      bodydata->qm[f]->tag       = 0;
+  }
+
+  /* build the biggest Faces first */
+  order = (int *) EG_alloc(2*bodydata->nfaces*sizeof(int));
+  if (order != NULL) {
+    for (f = 0; f < bodydata->nfaces; f++) {
+      order[2*f  ] = btess->tess2d[f].ntris;
+      order[2*f+1] = f;
+    }
+    qsort(order, bodydata->nfaces, 2*sizeof(int), EG_mapCost);
+    for (f = 0; f < bodydata->nfaces; f++) order[f] = order[2*f+1];
+  }
+
+  /* set the thread storage */
+  qmap.mutex    = NULL;
+  qmap.master   = EMP_ThreadID();
+  qmap.end      = bodydata->nfaces;
+  qmap.index    = 0;
+  qmap.order    = order;
+  qmap.btess    = btess;
+  qmap.bodydata = bodydata;
+
+  np = EMP_Init(&start);
+  if (np > bodydata->nfaces) np = bodydata->nfaces;
+
+  if (np > 1) {
+    /* create the mutex to handle list synchronization */
+    qmap.mutex = EMP_LockCreate();
+    if (qmap.mutex == NULL) {
+      printf(" EMP Error: mutex creation = NULL!\n");
+      np = 1;
+    } else {
+      /* get storage for our extra threads */
+      threads = (void **) malloc((np-1)*sizeof(void *));
+      if (threads == NULL) {
+        EMP_LockDestroy(qmap.mutex);
+        qmap.mutex = NULL;
+        np = 1;
       }
+    }
   }
+
+  /* create the threads and get going! */
+  if (threads != NULL)
+    for (f = 0; f < np-1; f++) {
+      threads[f] = EMP_ThreadCreate(EG_meshMapThread, &qmap);
+      if (threads[f] == NULL)
+        printf(" EMP Error Creating Thread #%d!\n", f+1);
+    }
+  /* now run the thread block from the original thread */
+  EG_meshMapThread(&qmap);
+
+  /* wait for all others to return */
+  if (threads != NULL)
+    for (f = 0; f < np-1; f++)
+      if (threads[f] != NULL) EMP_ThreadWait(threads[f]);
+
+  /* thread cleanup */
+  if (threads != NULL)
+    for (f = 0; f < np-1; f++)
+      if (threads[f] != NULL) EMP_ThreadDestroy(threads[f]);
+  if (qmap.mutex != NULL) EMP_LockDestroy(qmap.mutex);
+  if (threads != NULL) free(threads);
+  EG_free(order);
+
   return EGADS_SUCCESS;
 }
 
@@ -2011,7 +2168,7 @@ int EG_createMeshMap(bodyQuad *bodydata)
 static int EG_makeValidMesh(meshMap *qm, int nP, /*@null@*/ int *pList, int fullReg)
 {
   int    si, v, q, i, ii, j, k, kv, it = 0, itMax, sum = 0, *qlist = NULL, kq = 0;
-  int    stat = EGADS_SUCCESS, *mv = NULL, *area = NULL, fr, pass;
+  int    stat = EGADS_SUCCESS, *mv = NULL, *area = NULL, fr, pass, tag, ghost;
   double *uvxyz = NULL;
 #ifdef DEBUG2
   double pos[18], uv[2];
@@ -2021,16 +2178,20 @@ static int EG_makeValidMesh(meshMap *qm, int nP, /*@null@*/ int *pList, int full
   gnuData(qm, NULL);
 #endif
 
-  mv      = (int   *)EG_alloc(qm->totV * sizeof(int));
-  qlist   = (int   *)EG_alloc(qm->totQ * sizeof(int));
+  // the Face's scratch -- lists are kept unique with tags
+  mv      = qm->lstV;
+  qlist   = qm->lstQ;
   if (mv == NULL || qlist == NULL) return EGADS_MALLOC;
   if (fullReg == 0) { // move around only affected vertices
       if (nP  == 0 || pList == NULL) goto cleanup;
+      tag = newTag(qm);
       for (kv = j = 0; j < nP; j++) {
           si = pList[j] - 1;
           if (qm->vType[si] == -2) continue;
-          if (qm->vType[si] == -1 &&
-              inList (kv, mv, si) == -1 ) mv[kv++] = si;
+          if (qm->vType[si] == -1 && qm->tagV[si] != tag) {
+              qm->tagV[si] = tag;
+              mv[kv++]     = si;
+          }
           if( qm->star[si] == NULL) {
               printf(" STAR %d is NULL !!!\n ", si + 1);
               stat = EGADS_MALLOC;
@@ -2039,23 +2200,21 @@ static int EG_makeValidMesh(meshMap *qm, int nP, /*@null@*/ int *pList, int full
           for (i = 0; i < qm->star[si]->nQ; i++) {
               if (qm->star[si]->quads[i] == -1) continue;
               v = qm->star[si]->verts[2 * i + 1] - 1;
-              if (qm->vType[v] == -1 && inList (kv, mv, v) == -1 ) mv[kv++] = v;
+              if (qm->vType[v] == -1 && qm->tagV[v] != tag) {
+                  qm->tagV[v] = tag;
+                  mv[kv++]    = v;
+              }
               v = qm->star[si]->verts[2 * i + 2] - 1;
-              if (qm->vType[v] == -1 && inList (kv, mv, v) == -1 ) mv[kv++] = v;
+              if (qm->vType[v] == -1 && qm->tagV[v] != tag) {
+                  qm->tagV[v] = tag;
+                  mv[kv++]    = v;
+              }
           }
       }
-      if ( kv == 0 ) {
-          EG_free(mv);
-          EG_free(qlist);
-          return EGADS_SUCCESS;
-      }
+      if ( kv == 0 ) return EGADS_SUCCESS;
       itMax = 5;
       uvxyz = (double*)EG_alloc(5 * kv * sizeof(double));
-      if ( uvxyz == NULL ) {
-          EG_free(mv);
-          EG_free(qlist);
-          return EGADS_MALLOC;
-      }
+      if ( uvxyz == NULL ) return EGADS_MALLOC;
       for (j = 0; j < kv; j++) {
           uvxyz[5 * j    ] = qm->uvs [2 * mv[j]    ];
           uvxyz[5 * j + 1] = qm->uvs [2 * mv[j] + 1];
@@ -2063,10 +2222,18 @@ static int EG_makeValidMesh(meshMap *qm, int nP, /*@null@*/ int *pList, int full
           uvxyz[5 * j + 3] = qm->xyzs[3 * mv[j] + 1];
           uvxyz[5 * j + 4] = qm->xyzs[3 * mv[j] + 2];
       }
-      for ( kq = k = 0 ; k < kv; k++) {
+      tag = newTag(qm);
+      for (ghost = kq = k = 0 ; k < kv; k++) {
           for (i = 0; i < qm->star[mv[k]]->nQ; i++) {
-              if (kq == 0 || inList(kq, qlist, qm->star[mv[k]]->quads[i]) == -1)
-                qlist[kq++] = qm->star[mv[k]]->quads[i];
+              q = qm->star[mv[k]]->quads[i];
+              if (q == -1) {
+                  if (ghost == 1) continue;
+                  ghost = 1;
+              } else {
+                  if (qm->tagQ[q - 1] == tag) continue;
+                  qm->tagQ[q - 1] = tag;
+              }
+              qlist[kq++] = q;
           }
       }
   } else {
@@ -2078,9 +2245,7 @@ static int EG_makeValidMesh(meshMap *qm, int nP, /*@null@*/ int *pList, int full
   }
   area = (int *)EG_alloc(kv * sizeof(int));
   if (area == NULL ) {
-      EG_free(mv);
       EG_free(uvxyz);
-      EG_free(qlist);
       return EGADS_MALLOC;
   }
   for (i = 0; i < kv; i++) {
@@ -2256,9 +2421,7 @@ static int EG_makeValidMesh(meshMap *qm, int nP, /*@null@*/ int *pList, int full
 #endif
   cleanup:
   EG_free(uvxyz);
-  EG_free(mv);
   EG_free(area);
-  EG_free(qlist);
   return stat;
 }
 
@@ -4284,6 +4447,12 @@ void EG_destroyMeshMap(bodyQuad *bodydata)
           EG_free(bodydata->qm[i]->vInv);
           EG_free(bodydata->qm[i]->bdAng);
           EG_free(bodydata->qm[i]->degen);
+          EG_free(bodydata->qm[i]->bufV);
+          EG_free(bodydata->qm[i]->bufQ);
+          EG_free(bodydata->qm[i]->lstV);
+          EG_free(bodydata->qm[i]->lstQ);
+          EG_free(bodydata->qm[i]->tagV);
+          EG_free(bodydata->qm[i]->tagQ);
           EG_free(bodydata->qm[i]);
       }
   }
@@ -4569,7 +4738,7 @@ int EG_meshRegularization(meshMap *qm)
 {
   int    i, j, k, s, q, stat = EGADS_SUCCESS,  ni = 0, n0 = 0;
   int    ITMAX, it = 0, activity = 0, totActivity = 0, loopact;
-  int    iV0, iV, qPair[4], prevPair[2], totV, totV0, vQ0, vQ, transfer = 0, *skipQuad = NULL, sq;
+  int    iV0, iV, qPair[4], prevPair[2], totV, totV0, vQ0, vQ, transfer = 0, *skipQuad = NULL, sq, nsk;
   double minArea, maxArea, minArea0, maxArea0, avArea0, avArea, *qArea = NULL;
 
   if(qm      == NULL) return EGADS_SUCCESS;
@@ -4601,12 +4770,17 @@ int EG_meshRegularization(meshMap *qm)
 #ifdef DEBUG
   printf(" IMPOSING REG BOUNDS %d\n", qm->regBd);
 #endif
-  skipQuad = (int *)    EG_alloc (qm->totQ * sizeof(int   ));
+  // skipQuad flags the quads that could not be collapsed (sq of them)
+  nsk      = qm->totQ;
+  skipQuad = (int *)    EG_alloc (nsk      * sizeof(int   ));
   qArea    = (double *) EG_alloc (qm->totQ * sizeof(double));
   if (skipQuad == NULL || qArea == NULL) {
+      EG_free (skipQuad);
+      EG_free (qArea   );
       qm->fID = 0;
       return EGADS_MALLOC;
   }
+  for (i = 0; i < nsk; i++) skipQuad[i] = 0;
   ITMAX = qm->totQ;
   qm->pp = 1;
   minArea0 = 10000000.00;
@@ -4719,7 +4893,7 @@ break;
           }
       }
       for (k = i = 0; i < qm->totQ; i++) {
-          if (qm->qIdx[4 * i] == -2 || inList (sq, skipQuad, i + 1) != -1) continue;
+          if (qm->qIdx[4 * i] == -2 || (i < nsk && skipQuad[i] == 1)) continue;
           if (qArea[i] <= avArea ) {
               stat  = EG_collapse(qm, i+1, &activity, 2, 0);
               if (stat != EGADS_SUCCESS) {
@@ -4728,12 +4902,18 @@ break;
               }
               loopact += activity;
               if (activity == 0) {
-                  if (sq <= qm->totQ -1) skipQuad[sq++] = i + 1;
+                  if (sq <= qm->totQ -1 && i < nsk) {
+                      skipQuad[i] = 1;
+                      sq++;
+                  }
               }
               else break;
           }
       }
-      if (it < ITMAX / 2 && sq == qm->totQ) sq = 0 ;
+      if (it < ITMAX / 2 && sq == qm->totQ) {
+          for (i = 0; i < nsk; i++) skipQuad[i] = 0;
+          sq = 0;
+      }
   }
 #ifdef REPORT
   fprintf(stderr, "RATIO MIN MAX AREA %lf %lf  av %lf \n",
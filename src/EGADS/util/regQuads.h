@@ -47,6 +47,7 @@ typedef struct{
   int  *verts, *quads, type; // -1 interior, 0 its vertices are linked to bounds, 1 links to bounds directly
   int   nV, nQ; // nV = n + 1 =  origin(1) + peaks (n)
   int  *idxV, *idxQ, *area;
+  int   mV, mQ; // allocated lengths -- the star is rebuilt in place when it fits
   double *angle, *ratio;
 } vStar;
 
@@ -58,6 +59,9 @@ typedef struct {
   ego      face;
   double   range[4],  *xyzs, *uvs, minArea, maxArea, avArea, *bdAng, fin;
   vStar **star;
+  // per-Face scratch (sizeV & sizeQ long) reused by the star, backup/restore
+  // and vertex placement functions -- bufV/bufQ are only held by EG_buildStar
+  int      *bufV, *bufQ, *lstV, *lstQ, *tagV, *tagQ, tag;
 } meshMap;
 
 
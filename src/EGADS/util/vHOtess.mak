@@ -25,7 +25,8 @@ $(ODIR)\vHOtess.obj:	vHOtess.c $(IDIR)\egads.h $(IDIR)\egadsTypes.h \
 		/Fo$(ODIR)\vHOtess.obj
 
 $(ODIR)\egadsHOtess.obj:	$(UDIR)\egadsHOtess.c $(IDIR)\egads.h \
-				$(IDIR)\egadsTypes.h $(IDIR)\egadsErrors.h
+				$(IDIR)\egadsTypes.h $(IDIR)\egadsErrors.h \
+				$(IDIR)\emp.h
 	cl /c $(COPTS) $(DEFINE) -I$(IDIR) $(UDIR)\egadsHOtess.c \
 		/Fo$(ODIR)\egadsHOtess.obj
 
@@ -226,6 +226,7 @@ static int buildSolver(   modl_T *modl, int ibrch, varg_T args[], int *nvar, int
                           int *ncon, int solcons[]);
 static int buildTransform(modl_T *modl, int ibrch, varg_T args[], int *nstack, int stack[]);
 static int checkForFiniteDifferences(modl_T *modl, int ibody);
+static int cleanUdp(modl_T *modl, int ibody);
 static int colorizeEdge(modl_T *modl, int ibody, int iedge);
 static int colorizeFace(modl_T *modl, int ibody, int iface);
 static int colorizeNode(modl_T *modl, int ibody, int inode);
@@ -5928,18 +5929,8 @@ ocsmFree(
             MODL->body[ibody].etess = NULL;
         }
 
-        ibrch = MODL->body[ibody].ibrch;
-        if (ibrch > 0 && ibrch <= MODL->nbrch) {
-            if (MODL->brch[ibrch].type == OCSM_UDPRIM) {
-                status = udp_clean(MODL->body[ibody].arg[1].str, MODL->body[ibody].ebody);
-                if (status == EGADS_NOTFOUND || status == EGADS_NOTMODEL) {
-                    /* this means that some other Body probably cleaned up this udp
-                       or that this is a user-defined component (udc) */
-                } else {
-                    CHECK_STATUS(udp_clean);
-                }
-            }
-        }
+        status = cleanUdp(MODL, ibody);
+        CHECK_STATUS(cleanUdp);
 
         if (MODL->body[ibody].ebody != NULL) {
             /* ignore "dereference with active objects" message and/or any errors
@@ -6682,6 +6673,11 @@ ocsmBuild(void   *modl,                 /* (in)  pointer to MODL */
                     }
                 }
 
+                /* the Body is about to be deleted, so its udp does not
+                   need to be cached any more */
+                status = cleanUdp(MODL, jbody);
+                CHECK_STATUS(cleanUdp);
+
                 status = freeBody(MODL, ibody);
                 CHECK_STATUS(freeBody);
 
@@ -29080,6 +29076,50 @@ cleanup:
 }
 
 
+/*
+ ************************************************************************
+ *                                                                      *
+ *   cleanUdp - remove a Body from its udp's cache                      *
+ *                                                                      *
+ ************************************************************************
+ */
+
+static int
+cleanUdp(modl_T *MODL,                  /* (in)  pointer to MODL */
+         int    ibody)                  /* (in)  Body index (bias-1) */
+{
+    int       status = 0;               /* (out) return status */
+
+    int       ibrch;
+
+    ROUTINE(cleanUdp);
+    DPRINT2("%s(ibody=%d) {",
+            routine, ibody);
+
+    /* --------------------------------------------------------------- */
+
+    if (MODL->body[ibody].ebody == NULL) goto cleanup;
+
+    ibrch = MODL->body[ibody].ibrch;
+    if (ibrch > 0 && ibrch <= MODL->nbrch) {
+        if (MODL->brch[ibrch].type == OCSM_UDPRIM) {
+            status = udp_clean(MODL->body[ibody].arg[1].str, MODL->body[ibody].ebody);
+            if (status == EGADS_NOTFOUND || status == EGADS_NOTMODEL) {
+                /* this means that some other Body probably cleaned up this udp
+                   or that this is a user-defined component (udc) */
+                status = SUCCESS;
+            } else {
+                CHECK_STATUS(udp_clean);
+            }
+        }
+    }
+
+cleanup:
+    DPRINT2("%s --> status=%d}", routine, status);
+    return status;
+}
+
+
 /*
  ************************************************************************
  *                                                                      *
@@ -36661,6 +36701,9 @@ recycleBody(modl_T *modl,               /* (in)  pointer to MODL */
             status = removeTessVels(MODL, jbody);
             CHECK_STATUS(removeTessVels);
 
+            status = cleanUdp(MODL, jbody);
+            CHECK_STATUS(cleanUdp);
+
             status = freeBody(MODL, jbody);
             CHECK_STATUS(freeBody);
 
@@ -42212,6 +42255,9 @@ tessellate(modl_T *MODL,                /* (in)  pointer to MODL */
                 status = EG_mapBody(BASE->body[ibody].ebody, MODL->body[ibody].ebody,
                                     "_faceID", &newBody);
                 if (status == SUCCESS && newBody != NULL) {
+                    status = cleanUdp(MODL, ibody);
+                    CHECK_STATUS(cleanUdp);
+
                     EG_deleteObject(MODL->body[ibody].ebody);
                     MODL->body[ibody].ebody = newBody;
                 }
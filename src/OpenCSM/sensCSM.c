@@ -35,6 +35,12 @@
 #include <time.h>
 #include <assert.h>
 
+#ifndef WIN32
+   #include <unistd.h>
+   #include <sys/types.h>
+   #include <sys/wait.h>
+#endif
+
 #include "egads.h"
 
 #define CINT    const int
@@ -89,6 +95,20 @@ static int       tessel   = 0;         /* =1 for tessellation sensitivities */
 static int       showAll  = 0;         /* =1 to show all velocities */
 static double    errlist  = 1.0e-4;    /* maximum error to list */
 static int       maxlist  = 10;        /* maximum number of errors to list */
+static int       njobs    = 1;         /* number of worker processes */
+
+/* one design Parameter (or matrix entry) to be checked */
+typedef struct {
+    int       ipmtr;                   /* Parameter index (bias-1) */
+    int       irow;                    /* row    index (bias-1) */
+    int       icol;                    /* column index (bias-1) */
+    int       status;                  /* return status of the checks */
+    int       ntotal;                  /* number of points beyond toler */
+    int       nsuppress;               /* number of suppressions */
+    double    errmaxConf;              /* maximum error (configuration) */
+    double    errmaxTess;              /* maximum error (tessellation) */
+    double    CPU;                     /* CPU time for the checks */
+} task_T;
 
 /***********************************************************************/
 /*                                                                     */
@@ -97,6 +117,10 @@ static int       maxlist  = 10;        /* maximum number of errors to list */
 /***********************************************************************/
 
 /* declarations for high-level routines defined below */
+static int runTask(task_T *task, int *ntotal, int *nsuppress, double *errmaxConf, double *errmaxTess);
+#ifndef WIN32
+static int runTasksParallel(int ntask, task_T tasks[]);
+#endif
 static int checkConfigSens(int ipmtr, int irow, int icol, int *ntotal, int *nsuppress, double *errmaxConf);
 static int checkTesselSens(int ipmtr, int irow, int icol, int *ntotal, /*@unused@*/int *nsuppress, double *errmaxTess);
 
@@ -114,11 +138,12 @@ main(int       argc,                    /* (in)  number of arguments */
 
     int       status, status2, i, nbody, ibody;
     int       imajor, iminor, builtTo, showUsage=0;
-    int       ipmtr, irow, icol, ntotal, nsuppress=0;
-    double    errmaxConf=0, errmaxTess=0;
+    int       ipmtr, irow, icol, ntotal, nsuppress=0, ntask, itask;
+    double    errmaxConf=0, errmaxTess=0, CPUttl;
     char      filename[255];
     CCHAR     *OCC_ver;
     ego       context;
+    task_T    *tasks=NULL;
 
     modl_T    *MODL;
 
@@ -160,6 +185,14 @@ main(int       argc,                    /* (in)  number of arguments */
                    strcmp(argv[i], "-h"   ) == 0   ) {
             showUsage = 1;
             break;
+        } else if (strcmp(argv[i], "-jobs") == 0) {
+            if (i < argc-1) {
+                sscanf(argv[++i], "%d", &njobs);
+                if (njobs < 1) njobs = 1;
+            } else {
+                showUsage = 1;
+                break;
+            }
         } else if (strcmp(argv[i], "-outLevel") == 0) {
             if (i < argc-1) {
                 sscanf(argv[++i], "%d", &outLevel);
@@ -199,6 +232,7 @@ main(int       argc,                    /* (in)  number of arguments */
         SPRINT0(0, "                        -despmtr pmtrname");
         SPRINT0(0, "                        -dtime dtime");
         SPRINT0(0, "                        -help  -or-  -h");
+        SPRINT0(0, "                        -jobs njobs");
         SPRINT0(0, "                        -outLevel X");
         SPRINT0(0, "                        -showAll");
         SPRINT0(0, "                        -tessel");
@@ -227,6 +261,7 @@ main(int       argc,                    /* (in)  number of arguments */
     SPRINT1(1, "    config     = %d", config    );
     SPRINT1(1, "    despmtr    = %s", pmtrname  );
     SPRINT1(1, "    dtime      = %f", dtime     );
+    SPRINT1(1, "    jobs       = %d", njobs     );
     SPRINT1(1, "    outLevel   = %d", outLevel  );
     SPRINT1(1, "    showAll    = %d", showAll   );
     SPRINT1(1, "    tessel     = %d", tessel    );
@@ -297,7 +332,20 @@ main(int       argc,                    /* (in)  number of arguments */
     errmaxConf = 0;              // maximmum error   (configuration)
     errmaxTess = 0;              // maximum error (tessellation)
 
-    /* loop through all design Parameters */
+    /* make a list of all design Parameters (and matrix entries) to check */
+    ntask = 0;
+    for (ipmtr = 1; ipmtr <= MODL->npmtr; ipmtr++) {
+        if (MODL->pmtr[ipmtr].type != OCSM_EXTERNAL) continue;
+
+        if (strlen(pmtrname) > 0 &&
+            strcmp(pmtrname, MODL->pmtr[ipmtr].name) != 0) continue;
+
+        ntask += MODL->pmtr[ipmtr].nrow * MODL->pmtr[ipmtr].ncol;
+    }
+
+    MALLOC(tasks, task_T, MAX(ntask, 1));
+
+    ntask = 0;
     for (ipmtr = 1; ipmtr <= MODL->npmtr; ipmtr++) {
         if (MODL->pmtr[ipmtr].type != OCSM_EXTERNAL) continue;
 
@@ -306,37 +354,77 @@ main(int       argc,                    /* (in)  number of arguments */
 
         for (irow = 1; irow <= MODL->pmtr[ipmtr].nrow; irow++) {
             for (icol = 1; icol <= MODL->pmtr[ipmtr].ncol; icol++) {
+                tasks[ntask].ipmtr      = ipmtr;
+                tasks[ntask].irow       = irow;
+                tasks[ntask].icol       = icol;
+                tasks[ntask].status     = SUCCESS;
+                tasks[ntask].ntotal     = 0;
+                tasks[ntask].nsuppress  = 0;
+                tasks[ntask].errmaxConf = 0;
+                tasks[ntask].errmaxTess = 0;
+                tasks[ntask].CPU        = 0;
+                ntask++;
+            }
+        }
+    }
 
-//$$$                /* set the velocity */
-//$$$                status = ocsmSetVelD(MODL, 0, 0, 0, 0.0);
-//$$$                CHECK_STATUS(ocsmSetVelD);
-//$$$                status = ocsmSetVelD(MODL, ipmtr, irow, icol, 1.0);
-//$$$                CHECK_STATUS(ocsmSetVelD);
-//$$$
-//$$$                /* build needed to propagate velocities to the Branch arguments */
-//$$$                ntemp    = 0;
-//$$$                status   = ocsmBuild(MODL, 0, &builtTo, &ntemp, NULL);
-//$$$                CHECK_STATUS(ocsmBuild);
-
-                if (config) {
-                    status = checkConfigSens(ipmtr, irow, icol, &ntotal, &nsuppress, &errmaxConf);
-                    CHECK_STATUS(check_status);
-                }
+#ifdef WIN32
+    if (njobs > 1) {
+        SPRINT0(0, "WARNING:: -jobs is not supported on Windows, so running serially");
+        njobs = 1;
+    }
+#endif
 
-                if (tessel) {
-                    status = checkTesselSens(ipmtr, irow, icol, &ntotal, &nsuppress, &errmaxTess);
-                    CHECK_STATUS(checkTesselSens);
-                }
-            }
+    /* run the checks in this process, one design Parameter at a time */
+    if (njobs == 1 || ntask <= 1) {
+        for (itask = 0; itask < ntask; itask++) {
+            status = runTask(&(tasks[itask]), &ntotal, &nsuppress, &errmaxConf, &errmaxTess);
+            CHECK_STATUS(runTask);
         }
-        SPRINT0(0, " ");
+
+#ifndef WIN32
+    /* spread the design Parameters over the worker processes and then
+       merge their reports in the order that they would have been run */
+    } else {
+        status = runTasksParallel(ntask, tasks);
+
+        for (itask = 0; itask < ntask; itask++) {
+            ntotal    += tasks[itask].ntotal;
+            nsuppress += tasks[itask].nsuppress;
+            errmaxConf = MAX(errmaxConf, tasks[itask].errmaxConf);
+            errmaxTess = MAX(errmaxTess, tasks[itask].errmaxTess);
+        }
+
+        CHECK_STATUS(runTasksParallel);
+#endif
     }
 
+    /* report the time needed for each design Parameter (which doubles
+       as a benchmark of the rebuilds) */
+    SPRINT0(1, "Time needed for each design Parameter:");
+    CPUttl = 0;
+    for (itask = 0; itask < ntask; itask++) {
+        ipmtr = tasks[itask].ipmtr;
+        if (MODL->pmtr[ipmtr].nrow == 1 &&
+            MODL->pmtr[ipmtr].ncol == 1   ) {
+            SPRINT3(1, "    %-32s %10.3f sec %8d errors",
+                    MODL->pmtr[ipmtr].name, tasks[itask].CPU, tasks[itask].ntotal);
+        } else {
+            SPRINT5(1, "    %-24s[%3d,%3d] %10.3f sec %8d errors",
+                    MODL->pmtr[ipmtr].name, tasks[itask].irow, tasks[itask].icol,
+                    tasks[itask].CPU, tasks[itask].ntotal);
+        }
+        CPUttl += tasks[itask].CPU;
+    }
+    SPRINT3(1, "    %-32s %10.3f sec (%d jobs)\n", "total", CPUttl, njobs);
+
     SPRINT0(0, "==> sensCSM completed successfully");
     status = EXIT_SUCCESS;
 
     /* cleanup and exit */
 cleanup:
+    FREE(tasks);
+
     context = MODL->context;
 
     /* remove all Bodys and etess objects */
@@ -403,6 +491,253 @@ cleanup:
 }
 
 
+/***********************************************************************/
+/*                                                                     */
+/*   runTask - check the sensitivities wrt one design Parameter        */
+/*                                                                     */
+/***********************************************************************/
+
+static int
+runTask(task_T *task,                   /* (both) task to run */
+        int    *ntotal,                 /* (both) total number of points beyond toler */
+        int    *nsuppress,              /* (both) number of suppressions */
+        double *errmaxConf,             /* (both) maximum error (configuration) */
+        double *errmaxTess)             /* (both) maximum error (tessellation) */
+{
+    int       status = SUCCESS;
+
+    int       ntotal_old, nsuppress_old;
+    clock_t   old_time, new_time;
+
+    modl_T    *MODL = (modl_T *)modl;
+
+    ROUTINE(runTask);
+
+    /* --------------------------------------------------------------- */
+
+    ntotal_old    = *ntotal;
+    nsuppress_old = *nsuppress;
+
+    old_time = clock();
+
+    if (config) {
+        status = checkConfigSens(task->ipmtr, task->irow, task->icol,
+                                 ntotal, nsuppress, &(task->errmaxConf));
+        CHECK_STATUS(checkConfigSens);
+    }
+
+    if (tessel) {
+        status = checkTesselSens(task->ipmtr, task->irow, task->icol,
+                                 ntotal, nsuppress, &(task->errmaxTess));
+        CHECK_STATUS(checkTesselSens);
+    }
+
+    if (task->irow == MODL->pmtr[task->ipmtr].nrow &&
+        task->icol == MODL->pmtr[task->ipmtr].ncol   ) {
+        SPRINT0(0, " ");
+    }
+
+cleanup:
+    new_time = clock();
+
+    task->status    = status;
+    task->ntotal    = *ntotal    - ntotal_old;
+    task->nsuppress = *nsuppress - nsuppress_old;
+    task->CPU       = (double)(new_time - old_time) / (double)(CLOCKS_PER_SEC);
+
+    *errmaxConf = MAX(*errmaxConf, task->errmaxConf);
+    *errmaxTess = MAX(*errmaxTess, task->errmaxTess);
+
+    return status;
+}
+
+
+#ifndef WIN32
+/***********************************************************************/
+/*                                                                     */
+/*   runTasksParallel - run the tasks in njobs worker processes        */
+/*                                                                     */
+/***********************************************************************/
+
+static int
+runTasksParallel(int    ntask,          /* (in)  number of tasks */
+                 task_T tasks[])        /* (both) tasks to run */
+{
+    int       status = SUCCESS;
+
+    int       ijob, itask, ntotal, nsuppress, ndone=0, *done=NULL;
+    int       nwork, nnext, stop;
+    int       workfd[2]={-1,-1}, rsltfd[2]={-1,-1};
+    double    errmaxConf, errmaxTess;
+    char      logname[255], line[1025];
+    pid_t     master, *pids=NULL;
+    FILE      *fp;
+
+    struct {
+        int       itask;               /* task index (bias-0) */
+        task_T    task;                /* results of the task */
+    } rslt;
+
+    ROUTINE(runTasksParallel);
+
+    /* --------------------------------------------------------------- */
+
+    nwork = njobs;
+    if (nwork > ntask) nwork = ntask;
+
+    MALLOC(pids, pid_t, nwork);
+    MALLOC(done, int,   ntask);
+
+    for (itask = 0; itask < ntask; itask++) {
+        done[itask] = 0;
+    }
+
+    /* the workers take the index of their next task from workfd and
+       send back the results in rsltfd (the records are small enough
+       that the reads and writes of each are atomic).  a new index is
+       only sent when a result comes back, so neither pipe ever holds
+       more than nwork entries and neither side can block the other */
+    if (pipe(workfd) != 0 || pipe(rsltfd) != 0) {
+        SPRINT0(0, "ERROR:: could not create pipes for the worker processes");
+        status = OCSM_INTERNAL_ERROR;
+        goto cleanup;
+    }
+
+    SPRINT2(0, "Running %d tasks in %d worker processes\n", ntask, nwork);
+    fflush(stdout);
+
+    master = getpid();
+
+    /* each worker gets its own copy of the MODL */
+    for (ijob = 0; ijob < nwork; ijob++) {
+        pids[ijob] = fork();
+
+        if (pids[ijob] < 0) {
+            SPRINT1(0, "ERROR:: could not fork worker process %d", ijob);
+            nwork = ijob;
+            break;
+
+        } else if (pids[ijob] == 0) {
+            close(workfd[1]);
+            close(rsltfd[0]);
+
+            ntotal     = 0;
+            nsuppress  = 0;
+            errmaxConf = 0;
+            errmaxTess = 0;
+
+            while (read(workfd[0], &itask, sizeof(int)) == sizeof(int)) {
+
+                /* the output for each task goes to its own log file (stdout
+                   is gone if this fails, so report it and stop the worker) */
+                snprintf(logname, 254, "sensCSM.%ld.%d.log", (long)master, itask);
+                if (freopen(logname, "w", stdout) == NULL) {
+                    tasks[itask].status = OCSM_INTERNAL_ERROR;
+                    stop = 1;
+                } else {
+                    (void) runTask(&(tasks[itask]), &ntotal, &nsuppress, &errmaxConf, &errmaxTess);
+                    fflush(stdout);
+                    stop = 0;
+                }
+
+                rslt.itask = itask;
+                rslt.task  = tasks[itask];
+                if (write(rsltfd[1], &rslt, sizeof(rslt)) != sizeof(rslt)) break;
+                if (stop) break;
+            }
+
+            close(workfd[0]);
+            close(rsltfd[1]);
+            _exit(EXIT_SUCCESS);
+        }
+    }
+
+    /* workfd[0] stays open here so that handing out a task never
+       raises SIGPIPE, even if every worker has stopped */
+    close(rsltfd[1]);
+    rsltfd[1] = -1;
+
+    /* start each worker on one task */
+    nnext = 0;
+    for (ijob = 0; ijob < nwork && nnext < ntask; ijob++) {
+        if (write(workfd[1], &nnext, sizeof(int)) != sizeof(int)) break;
+        nnext++;
+    }
+
+    /* closing workfd tells the workers that there is nothing more to do */
+    if (nnext >= ntask || ijob < nwork) {
+        close(workfd[1]);
+        workfd[1] = -1;
+    }
+
+    /* collect the results until all workers are done, handing out the
+       next task as each result comes back */
+    while (read(rsltfd[0], &rslt, sizeof(rslt)) == sizeof(rslt)) {
+        if (rslt.itask >= 0 && rslt.itask < ntask) {
+            tasks[rslt.itask] = rslt.task;
+            done[ rslt.itask] = 1;
+            ndone++;
+        }
+
+        if (workfd[1] >= 0) {
+            if (write(workfd[1], &nnext, sizeof(int)) == sizeof(int)) {
+                nnext++;
+            } else {
+                nnext = ntask;
+            }
+
+            if (nnext >= ntask) {
+                close(workfd[1]);
+                workfd[1] = -1;
+            }
+        }
+    }
+    close(rsltfd[0]);
+    rsltfd[0] = -1;
+
+    for (ijob = 0; ijob < nwork; ijob++) {
+        (void) waitpid(pids[ijob], NULL, 0);
+    }
+
+    /* merge the logs into one report */
+    for (itask = 0; itask < ntask; itask++) {
+        snprintf(logname, 254, "sensCSM.%ld.%d.log", (long)master, itask);
+
+        fp = fopen(logname, "r");
+        if (fp != NULL) {
+            while (fgets(line, 1024, fp) != NULL) {
+                fputs(line, stdout);
+            }
+            fclose(fp);
+            remove(logname);
+        }
+
+        if (done[itask] == 0) {
+            SPRINT1(0, "ERROR:: worker process did not finish task %d", itask);
+            tasks[itask].status = OCSM_INTERNAL_ERROR;
+        }
+
+        if (status == SUCCESS && tasks[itask].status < SUCCESS) {
+            status = tasks[itask].status;
+        }
+    }
+
+    SPRINT2(1, "Worker processes finished %d of %d tasks", ndone, ntask);
+
+cleanup:
+    if (workfd[0] >= 0) close(workfd[0]);
+    if (workfd[1] >= 0) close(workfd[1]);
+    if (rsltfd[0] >= 0) close(rsltfd[0]);
+    if (rsltfd[1] >= 0) close(rsltfd[1]);
+
+    FREE(pids);
+    FREE(done);
+
+    return status;
+}
+#endif
+
+
 /***********************************************************************/
 /*                                                                     */
 /*   checkConfigSens - check configuration sensitivities               */
@@ -74,6 +74,8 @@
 
 #include "wsserver.h"
 
+#include "emp.h"
+
 /***********************************************************************/
 /*                                                                     */
 /* macros (including those that go along with common.h)                */
@@ -97,6 +99,27 @@ static void *realloc_temp=NULL;            /* used by RALLOC macro */
 /*                                                                     */
 /***********************************************************************/
 
+/* GPrim data for one Face in the scene graph */
+typedef struct {
+    int       ibody;                    /* Body index (bias-1) */
+    int       iface;                    /* Face index (bias-1) */
+    int       newStyleQuads;            /* =1 if new-style quadding */
+    double    size2;                    /* square of Body diagonal (if plotType>0) */
+    int       status;                   /* status from buildSceneGraphFace */
+    int       nitems;                   /* number of items (=0 to skip Face) */
+    wvData    items[6];                 /* items for the Face GPrim */
+} sgFace_T;
+
+/* structure shared by the threads that make the Face GPrim data */
+typedef struct {
+    void      *mutex;                   /* the mutex or NULL for single thread */
+    long      master;                   /* master thread ID */
+    int       end;                      /* number of Faces */
+    int       index;                    /* next entry in order */
+    int       *order;                   /* Faces (biggest first) */
+    sgFace_T  *sgface;                  /* array  of Face GPrim data */
+} sgThread_T;
+
 /* blue-white-red spectrum */
 static float color_map[256*3] =
 { 0.0000, 0.0000, 1.0000,    0.0078, 0.0078, 1.0000,   0.0156, 0.0156, 1.0000,    0.0234, 0.0234, 1.0000,
@@ -322,6 +345,10 @@ static int        applyDisplacement(modl_T *MODL, int ipmtr);
 static int        buildBodys(int buildTo, int *builtTo, int *buildStatus, int *nwarn);
 static int        buildSceneGraph();
 static int        buildSceneGraphBody(int ibody);
+static int        buildSceneGraphFace(sgFace_T *sgface);
+static int        buildSceneGraphFaces(int *nsgface, sgFace_T **sgface);
+static void       buildSceneGraphThread(void *struc);
+static int        buildSceneGraphCost(const void *a, const void *b);
 static void       cleanupMemory(int quiet);
 static int        getToken(char *text, int nskip, char sep, char *token);
 static int        maxDistance(modl_T *MODL1, modl_T *MODL2, int ibody, double *dist);
@@ -2147,23 +2174,22 @@ buildSceneGraph()
 {
     int       status = SUCCESS;         /* return status */
 
-    int       ibody, jbody, iface, iedge, inode, iattr, nattr, ipmtr, irc, newStyleQuads, atype, alen;
-    int       npnt, ipnt, ntri, itri, igprim, nseg, i, j, k, ij, ij1, ij2, ngrid, ncrod, nctri3, ncquad4;
+    int       ibody, jbody, iface, iedge, inode, iattr, nattr, ipmtr, irc;
+    int       npnt, ipnt, ntri, igprim, nseg, i, j, ij, ij1, ij2, ngrid, ncrod, nctri3, ncquad4;
     int       imax, jmax, ibeg, iend, isw, ise, ine, inw;
     int       attrs, head[3], nitems;
     int       oclass, mtype, nchild, *senses, *header;
     int       *segs=NULL, *ivrts=NULL;
-    int        npatch2, ipatch, n1, n2, i1, i2, *Tris;
-    CINT      *ptype, *pindx, *tris, *tric, *pvindex, *pbounds;
-    float     color[18], *pcolors, *plotdata=NULL, *segments=NULL, *tuft=NULL;
-    double    bigbox[6], box[6], size, size2=0, xyz_dum[6], *vel, velmag;
-    double    uvlimits[4], ubar, vbar, rcurv;
-    double    data[18], normx, normy, normz, axis[18], *cp;
+    int       nsgface=0, jface=0;
+    CINT      *ptype, *pindx, *tris, *tric;
+    float     color[18], *plotdata=NULL, *segments=NULL, *tuft=NULL;
+    double    bigbox[6], box[6], size, xyz_dum[6], *vel;
+    double    data[18], axis[18], *cp;
     CDOUBLE   *xyz, *uv, *t;
     char      gpname[MAX_STRVAL_LEN], bname[MAX_NAME_LEN], temp[MAX_FILENAME_LEN];
     char      text[81], dum[81];
     FILE      *fp;
-    ego       ebody, etess, eface, eedge, enode, eref, prev, next, *echilds, esurf;
+    ego       ebody, etess, eface, eedge, enode, eref, *echilds, esurf;
 
     int       nlist, itype;
     CINT      *tempIlist;
@@ -2171,6 +2197,7 @@ buildSceneGraph()
     CCHAR     *attrName, *tempClist;
 
     wvData    items[6];
+    sgFace_T  *sgface=NULL, *sgf;
 
     modl_T    *MODL = (modl_T*)modl;
 
@@ -2227,6 +2254,46 @@ buildSceneGraph()
     /* initialize the scene graph meta data */
     STRNCPY(sgMetaData, "sgData|{", sgMetaDataLen);
 
+    /* determine if any of the external Parameters have a velocity */
+    haveDots   = 0;
+    dotName[0] = '\0';
+
+    for (ipmtr = 1; ipmtr <= MODL->npmtr; ipmtr++) {
+        if (MODL->pmtr[ipmtr].type == OCSM_EXTERNAL) {
+            for (irc = 0; irc < (MODL->pmtr[ipmtr].nrow)*(MODL->pmtr[ipmtr].ncol); irc++) {
+                if (MODL->pmtr[ipmtr].dot[irc] != 0) {
+                    if (fabs(MODL->pmtr[ipmtr].dot[irc]-1) < EPS06) {
+                        if (haveDots == 0) {
+                            if (sensTess == 0) {
+                                snprintf(dotName, MAX_STRVAL_LEN-1, "Config: d(norm)/d(%s)", MODL->pmtr[ipmtr].name);
+                            } else {
+                                snprintf(dotName, MAX_STRVAL_LEN-1, "Tessel: d(norm)/d(%s)", MODL->pmtr[ipmtr].name);
+                            }
+                        } else {
+                            if (sensTess == 0) {
+                                snprintf(dotName, MAX_STRVAL_LEN-1, "Config: d(norm)/d(***)");
+                            } else {
+                                snprintf(dotName, MAX_STRVAL_LEN-1, "Tessel: d(norm)/d(***)");
+                            }
+                        }
+                        haveDots++;
+                    } else if (MODL->pmtr[ipmtr].dot[irc] != 0) {
+                        if (sensTess == 0) {
+                            snprintf(dotName, MAX_STRVAL_LEN-1, "Config: d(norm)/d(***)");
+                        } else {
+                            snprintf(dotName, MAX_STRVAL_LEN-1, "Tessel: d(norm)/d(***)");
+                        }
+                        haveDots++;
+                    }
+                }
+            }
+        }
+    }
+
+    /* make the GPrim data for the Faces (in parallel) */
+    status = buildSceneGraphFaces(&nsgface, &sgface);
+    CHECK_STATUS(buildSceneGraphFaces);
+
     /* loop through the Bodys */
     for (ibody = 1; ibody <= MODL->nbody; ibody++) {
         if (MODL->body[ibody].onstack != 1) continue;
@@ -2314,77 +2381,23 @@ buildSceneGraph()
 
         etess = MODL->body[ibody].etess;
 
-        /* determine if any of the external Parameters have a velocity */
-        haveDots   = 0;
-        dotName[0] = '\0';
-
-        for (ipmtr = 1; ipmtr <= MODL->npmtr; ipmtr++) {
-            if (MODL->pmtr[ipmtr].type == OCSM_EXTERNAL) {
-                for (irc = 0; irc < (MODL->pmtr[ipmtr].nrow)*(MODL->pmtr[ipmtr].ncol); irc++) {
-                    if (MODL->pmtr[ipmtr].dot[irc] != 0) {
-                        if (fabs(MODL->pmtr[ipmtr].dot[irc]-1) < EPS06) {
-                            if (haveDots == 0) {
-                                if (sensTess == 0) {
-                                    snprintf(dotName, MAX_STRVAL_LEN-1, "Config: d(norm)/d(%s)", MODL->pmtr[ipmtr].name);
-                                } else {
-                                    snprintf(dotName, MAX_STRVAL_LEN-1, "Tessel: d(norm)/d(%s)", MODL->pmtr[ipmtr].name);
-                                }
-                            } else {
-                                if (sensTess == 0) {
-                                    snprintf(dotName, MAX_STRVAL_LEN-1, "Config: d(norm)/d(***)");
-                                } else {
-                                    snprintf(dotName, MAX_STRVAL_LEN-1, "Tessel: d(norm)/d(***)");
-                                }
-                            }
-                            haveDots++;
-                        } else if (MODL->pmtr[ipmtr].dot[irc] != 0) {
-                            if (sensTess == 0) {
-                                snprintf(dotName, MAX_STRVAL_LEN-1, "Config: d(norm)/d(***)");
-                            } else {
-                                snprintf(dotName, MAX_STRVAL_LEN-1, "Tessel: d(norm)/d(***)");
-                            }
-                            haveDots++;
-                        }
-                    }
-                }
-            }
-        }
-
-        /* get bounding box info if non-zero plottype */
-        if (plotType > 0) {
-            box[0] = box[1] = box[2] = 0;
-            box[3] = box[4] = box[5] = 1;
-            status = EG_getBoundingBox(ebody, box);
-            if (status != SUCCESS) {
-                SPRINT2(0, "ERROR:: EG_getBoundingBox(%d) -> status=%d", ibody, status);
-            }
-
-            size2 = (box[3] - box[0]) * (box[3] - box[0])
-                  + (box[4] - box[1]) * (box[4] - box[1])
-                  + (box[5] - box[2]) * (box[5] - box[2]);
-        }
-
-        /* determine if new-style quadding */
-        newStyleQuads = 0;
-        status = EG_attributeRet(MODL->body[ibody].etess, ".tessType",
-                                 &atype, &alen, &tempIlist, &tempRlist, &tempClist);
-        if (status == SUCCESS) {
-            if (strcmp(tempClist, "Quad") == 0) {
-                newStyleQuads = 1;
-            }
-        }
-
         /* loop through the Faces within the current Body */
         for (iface = 1; iface <= MODL->body[ibody].nface; iface++) {
-            nitems = 0;
+            sgf = &(sgface[jface++]);
 
-            status = EG_getQuads(etess, iface,
-                                 &npnt, &xyz, &uv, &ptype, &pindx,
-                                 &npatch2);
-            if (status != SUCCESS) {
-                SPRINT3(0, "ERROR:: EG_getQuads(%d,%d) -> status=%d", ibody, iface, status);
+            /* Faces that show sensitivities are made here (in order)
+               since they update sensLo and sensHi */
+            if (haveDots >= 1) {
+                sgf->status = buildSceneGraphFace(sgf);
+            }
+            if (sgf->status != SUCCESS) {
+                status = sgf->status;
+                goto cleanup;
             }
 
+            /* skip if no Triangles either */
+            if (sgf->nitems == 0) continue;
+
             /* name and attributes */
             snprintf(gpname, MAX_STRVAL_LEN-1, "%s Face %d", bname, iface);
             if (haveDots >= 1 || plotType > 0) {
@@ -2393,100 +2406,109 @@ buildSceneGraph()
                 attrs = WV_ON | WV_ORIENTATION;
             }
 
-            /* render the Quadrilaterals (if they exist) */
-            if (npatch2 > 0) {
-                /* vertices */
-                status = wv_setData(WV_REAL64, npnt, (void*)xyz, WV_VERTICES, &(items[nitems]));
-                if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
-                }
+            /* make graphic primitive (which takes over the items) */
+            igprim = wv_addGPrim(cntxt, gpname, WV_TRIANGLE, attrs, sgf->nitems, sgf->items);
+            sgf->nitems = 0;
+            if (igprim < 0) {
+                SPRINT2(0, "ERROR:: wv_addGPrim(%s) -> igprim=%d", gpname, igprim);
+            } else {
+                cntxt->gPrims[igprim].lWidth = 1.0;
+            }
 
-                wv_adjustVerts(&(items[nitems]), sgFocus);
-                nitems++;
+            /* if plotCP is set and the associated surface is a BSPLINE, plot
+               the control polygon (note that the control polygon is not listed in
+               ESP as part of the Body, but separately at the bottom) */
+            if (plotCP == 1) {
+                status = EG_getTopology(MODL->body[ibody].face[iface].eface,
+                                        &esurf, &oclass, &mtype,
+                                        data, &nchild, &echilds, &senses);
 
-                /* loop through the patches and build up the triangle and
-                   segment tables */
-                ntri = 0;
-                nseg = 0;
+                if (status == SUCCESS) {
+                    status = EG_getGeometry(esurf, &oclass, &mtype,
+                                            &eref, &header, &cp);
 
-                for (ipatch = 1; ipatch <= npatch2; ipatch++) {
-                    status = EG_getPatch(etess, iface, ipatch, &n1, &n2, &pvindex, &pbounds);
-                    if (status != SUCCESS) {
-                        SPRINT3(0, "ERROR:: EG_getPatch(%d,%d) -> status=%d\n", ibody, iface, status);
-                    }
+                    if (status == SUCCESS && oclass == SURFACE && mtype == BSPLINE) {
+                        nitems = 0;
 
-                    ntri += 2 * (n1-1) * (n2-1);
-                    nseg += n1 * (n2-1) + n2 * (n1-1);
-                }
+                        snprintf(gpname, MAX_STRVAL_LEN-1, "PlotCP: %d:%d", ibody, iface);
+                        attrs = WV_ON;
 
-                Tris = (int*) malloc(3*ntri*sizeof(int));
-                if (Tris == NULL) goto cleanup;
+                        /* control points */
+                        status = wv_setData(WV_REAL64, header[2]*header[5], &(cp[header[3]+header[6]]),
+                                            WV_VERTICES, &(items[nitems]));
+                        if (status != SUCCESS) {
+                            SPRINT3(0, "ERROR:: wv_setdata(%d,%d) -> status=%d", ibody, iface, status);
+                        }
 
-                segs = (int*) malloc(2*nseg*sizeof(int));
-                if (segs == NULL) goto cleanup;
+                        wv_adjustVerts(&(items[nitems]), sgFocus);
+                        nitems++;
 
-                ntri = 0;
-                nseg = 0;
+                        segs = (int*) malloc(4*header[2]*header[5]*sizeof(int));
+                        if (segs == NULL) goto cleanup;
+                        nseg = 0;
 
-                for (ipatch = 1; ipatch <= npatch2; ipatch++) {
-                    status = EG_getPatch(etess, iface, ipatch, &n1, &n2, &pvindex, &pbounds);
-                    if (status != SUCCESS) {
-                        SPRINT3(0, "ERROR:: EG_getPatch(%d,%d) -> status=%d\n", ibody, iface, status);
-                    }
+                        /* i=constant lines */
+                        for (i = 0; i < header[2]; i++) {
+                            for (j = 0; j < header[5]-1; j++) {
+                                segs[2*nseg  ] = 1 + (i) + (j  ) * header[2];
+                                segs[2*nseg+1] = 1 + (i) + (j+1) * header[2];
+                                nseg++;
+                            }
+                        }
+
+                        /* j=constant lines */
+                        for (j = 0; j < header[5]; j++) {
+                            for (i = 0; i < header[2]-1; i++) {
+                                segs[2*nseg  ] = 1 + (i  ) + (j) * header[2];
+                                segs[2*nseg+1] = 1 + (i+1) + (j) * header[2];
+                                nseg++;
+                            }
+                        }
 
-                    for (i2 = 1; i2 < n2; i2++) {
-                        for (i1 = 1; i1 < n1; i1++) {
-                            Tris[3*ntri  ] = pvindex[(i1-1)+n1*(i2-1)];
-                            Tris[3*ntri+1] = pvindex[(i1  )+n1*(i2-1)];
-                            Tris[3*ntri+2] = pvindex[(i1  )+n1*(i2  )];
-                            ntri++;
-
-                            Tris[3*ntri  ] = pvindex[(i1  )+n1*(i2  )];
-                            Tris[3*ntri+1] = pvindex[(i1-1)+n1*(i2  )];
-                            Tris[3*ntri+2] = pvindex[(i1-1)+n1*(i2-1)];
-                            ntri++;
+                        status = wv_setData(WV_INT32, 2*nseg, (void*)segs, WV_INDICES, &(items[nitems]));
+                        if (status != SUCCESS) {
+                            SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
                         }
-                    }
+                        nitems++;
+
+                        free(segs);
 
-                    for (i2 = 0; i2 < n2; i2++) {
-                        for (i1 = 1; i1 < n1; i1++) {
-                            segs[2*nseg  ] = pvindex[(i1-1)+n1*(i2)];
-                            segs[2*nseg+1] = pvindex[(i1  )+n1*(i2)];
-                            nseg++;
+                        /* color */
+                        color[0] = 0;   color[1] = 0;   color[2] = 0;
+                        status = wv_setData(WV_REAL32, 1, (void*)color, WV_COLORS, &(items[nitems]));
+                        if (status != SUCCESS) {
+                            SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
                         }
-                    }
+                        nitems++;
 
-                    for (i1 = 0; i1 < n1; i1++) {
-                        for (i2 = 1; i2 < n2; i2++) {
-                            segs[2*nseg  ] = pvindex[(i1)+n1*(i2-1)];
-                            segs[2*nseg+1] = pvindex[(i1)+n1*(i2  )];
-                            nseg++;
+                        /* make graphic primitive */
+                        igprim = wv_addGPrim(cntxt, gpname, WV_LINE, attrs, nitems, items);
+                        if (igprim < 0) {
+                            SPRINT2(0, "ERROR:: wv_addGPrim(%s) -> igprim=%d", gpname, igprim);
                         }
                     }
                 }
+            }
 
-                /* two triangles for rendering each quadrilateral */
-                status = wv_setData(WV_INT32, 3*ntri, (void*)Tris, WV_INDICES, &(items[nitems]));
-                if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
-                }
-                nitems++;
-
-                free(Tris);
-
-            /* render the Quadrilaterals if new-style quadding */
-            } else if (newStyleQuads == 1) {
+            /* if sensTess is set and we are asking for smooth colors
+               (sensitivities) is set, draw tufts, whose length can be changed
+               by recomputing sensitivity with a different value for the velocity
+               of the Design Parameter.  (note that the tufts cannot be toggled in ESP) */
+            if (sensTess == 1 && haveDots >= 1) {
                 status = EG_getTessFace(etess, iface,
                                         &npnt, &xyz, &uv, &ptype, &pindx,
                                         &ntri, &tris, &tric);
                 if (status != SUCCESS) {
                     SPRINT3(0, "ERROR:: EG_getTessFace(%d,%d) -> status=%d", ibody, iface, status);
+                    goto cleanup;
                 }
 
-                /* skip if no Triangles either */
-                if (ntri <= 0) continue;
+                nitems = 0;
+
+                /* name and attributes */
+                snprintf(gpname, MAX_STRVAL_LEN-1, "Face %s:%d points", bname, iface);
+                attrs = WV_ON;
 
-                /* vertices */
                 status = wv_setData(WV_REAL64, npnt, (void*)xyz, WV_VERTICES, &(items[nitems]));
                 if (status != SUCCESS) {
                     SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
@@ -2495,666 +2517,326 @@ buildSceneGraph()
                 wv_adjustVerts(&(items[nitems]), sgFocus);
                 nitems++;
 
-                /* loop through the triangles and build up the segment table */
-                nseg = 0;
-                for (itri = 0; itri < ntri; itri++) {
-                    for (k = 0; k < 3; k++) {
-                        if (tric[3*itri+k] < itri+1) {
-                            nseg++;
-                        }
-                    }
-                }
-
-                segs = (int*) malloc(2*nseg*sizeof(int));
-                if (segs == NULL) goto cleanup;
-
-                /* create segments between Triangles (but not within the pair) */
-                nseg = 0;
-                for (itri = 0; itri < ntri; itri++) {
-                    if (tric[3*itri  ] < itri+2) {
-                        segs[2*nseg  ] = tris[3*itri+1];
-                        segs[2*nseg+1] = tris[3*itri+2];
-                        nseg++;
-                    }
-                    if (tric[3*itri+1] < itri+2) {
-                        segs[2*nseg  ] = tris[3*itri+2];
-                        segs[2*nseg+1] = tris[3*itri  ];
-                        nseg++;
-                    }
-                    if (tric[3*itri+2] < itri+2) {
-                        segs[2*nseg  ] = tris[3*itri  ];
-                        segs[2*nseg+1] = tris[3*itri+1];
-                        nseg++;
-                    }
-                    itri++;
-
-                    if (tric[3*itri  ] < itri) {
-                        segs[2*nseg  ] = tris[3*itri+1];
-                        segs[2*nseg+1] = tris[3*itri+2];
-                        nseg++;
-                    }
-                    if (tric[3*itri+1] < itri) {
-                        segs[2*nseg  ] = tris[3*itri+2];
-                        segs[2*nseg+1] = tris[3*itri  ];
-                        nseg++;
-                    }
-                    if (tric[3*itri+2] < itri) {
-                        segs[2*nseg  ] = tris[3*itri  ];
-                        segs[2*nseg+1] = tris[3*itri+1];
-                        nseg++;
-                    }
-                }
+                /* point color */
+                color[0] = 0;   color[1] = 0;   color[2] = 0;
 
-                /* triangles */
-                status = wv_setData(WV_INT32, 3*ntri, (void*)tris, WV_INDICES, &(items[nitems]));
+                status = wv_setData(WV_REAL32, 1, (void*)color, WV_COLORS, &(items[nitems]));
                 if (status != SUCCESS) {
                     SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
                 }
                 nitems++;
 
-            /* render the Triangles (if quads do not exist) */
-            } else {
-                status = EG_getTessFace(etess, iface,
-                                        &npnt, &xyz, &uv, &ptype, &pindx,
-                                        &ntri, &tris, &tric);
-                if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: EG_getTessFace(%d,%d) -> status=%d", ibody, iface, status);
+                /* make graphic primitive for points */
+                igprim = wv_addGPrim(cntxt, gpname, WV_POINT, attrs, nitems, items);
+                if (igprim < 0) {
+                    SPRINT2(0, "ERROR:: wv_addGPrim(%s) -> igprim=%d", gpname, igprim);
+                } else {
+                    cntxt->gPrims[igprim].pSize = 3.0;
                 }
 
-                /* skip if no Triangles either */
-                if (ntri <= 0) continue;
+                nitems = 0;
 
-                /* vertices */
-                status = wv_setData(WV_REAL64, npnt, (void*)xyz, WV_VERTICES, &(items[nitems]));
+                /* name and attributes */
+                snprintf(gpname, MAX_STRVAL_LEN-1, "Face %s:%d tufts", bname, iface);
+                attrs = WV_ON;
+
+                status = ocsmGetTessVel(MODL, ibody, OCSM_FACE, iface, (const double**)(&vel));
                 if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
+                    SPRINT3(0, "ERROR:: ocsmGetTessVel(%d,%d) -> status=%d", ibody, iface, status);
+                    goto cleanup;
                 }
 
-                wv_adjustVerts(&(items[nitems]), sgFocus);
-                nitems++;
+                /* create tufts */
+                tuft = (float *) malloc(6*npnt*sizeof(float));
+                if (tuft == NULL) {
+                    SPRINT0(0, "MALLOC error");
+                    goto cleanup;
+                }
 
-                /* loop through the triangles and build up the segment table */
-                nseg = 0;
-                for (itri = 0; itri < ntri; itri++) {
-                    for (k = 0; k < 3; k++) {
-                        if (tric[3*itri+k] < itri+1) {
-                            nseg++;
-                        }
-                    }
+                for (ipnt = 0; ipnt < npnt; ipnt++) {
+                    tuft[6*ipnt  ] = xyz[3*ipnt  ];
+                    tuft[6*ipnt+1] = xyz[3*ipnt+1];
+                    tuft[6*ipnt+2] = xyz[3*ipnt+2];
+                    tuft[6*ipnt+3] = xyz[3*ipnt  ] + vel[3*ipnt  ];
+                    tuft[6*ipnt+4] = xyz[3*ipnt+1] + vel[3*ipnt+1];
+                    tuft[6*ipnt+5] = xyz[3*ipnt+2] + vel[3*ipnt+2];
                 }
 
-                segs = (int*) malloc(2*nseg*sizeof(int));
-                if (segs == NULL) goto cleanup;
+                status = wv_setData(WV_REAL32, 2*npnt, (void*)tuft, WV_VERTICES, &(items[nitems]));
 
-                nseg = 0;
-                for (itri = 0; itri < ntri; itri++) {
-                    for (k = 0; k < 3; k++) {
-                        if (tric[3*itri+k] < itri+1) {
-                            segs[2*nseg  ] = tris[3*itri+(k+1)%3];
-                            segs[2*nseg+1] = tris[3*itri+(k+2)%3];
-                            nseg++;
-                        }
-                    }
-                }
+                free(tuft);
 
-                /* triangles */
-                status = wv_setData(WV_INT32, 3*ntri, (void*)tris, WV_INDICES, &(items[nitems]));
                 if (status != SUCCESS) {
                     SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
                 }
+
+                wv_adjustVerts(&(items[nitems]), sgFocus);
                 nitems++;
-            }
 
-            /* smooth colors (sensitivities) */
-            if (haveDots >= 1) {
-                sensPost = 1;
+                /* tuft color */
+                color[0] = 0;   color[1] = 0;   color[2] = 0;
 
-                status = EG_getTessFace(etess, iface,
-                                        &npnt, &xyz, &uv, &ptype, &pindx,
-                                        &ntri, &tris, &tric);
+                status = wv_setData(WV_REAL32, 1, (void*)color, WV_COLORS, &(items[nitems]));
                 if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: EG_getTessFace(%d,%d) -> status=%d", ibody, iface, status);
-                    goto cleanup;
+                    SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
                 }
+                nitems++;
 
-                status = EG_getInfo(MODL->body[ibody].face[iface].eface,
-                                    &oclass, &mtype, &eref, &prev, &next);
-                if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: EG_getInfo(%d,%d) -> status=%d", ibody, iface, status);
-                    goto cleanup;
+                /* make graphic primitive for tufts */
+                igprim = wv_addGPrim(cntxt, gpname, WV_LINE, attrs, nitems, items);
+                if (igprim < 0) {
+                    SPRINT2(0, "ERROR:: wv_addGPrim(%s) -> igprim=%d", gpname, igprim);
                 }
+            }
 
-                pcolors = (float *) malloc(3*npnt*sizeof(float));
-                if (pcolors == NULL) {
-                    SPRINT0(0, "MALLOC error");
-                    goto cleanup;
+            /* get Attributes for the Face */
+            eface  = MODL->body[ibody].face[iface].eface;
+            status = EG_attributeNum(eface, &nattr);
+            if (status != SUCCESS) {
+                SPRINT3(0, "ERROR:: EG_attributeNum(%d,%d) -> status=%d", ibody, iface, status);
+            }
+
+            /* add Face to meta data (if there is room) */
+            if (STRLEN(sgMetaData) >= sgMetaDataLen-1000) {
+                sgMetaDataLen += MAX_METADATA_CHUNK;
+                RALLOC(sgMetaData, char, sgMetaDataLen);
+                RALLOC(sgTempData, char, sgMetaDataLen);
+            }
+
+            if (nattr > 0) {
+                STRNCPY( sgTempData, sgMetaData, sgMetaDataLen);
+                snprintf(sgMetaData, sgMetaDataLen, "%s\"%s\":[",  sgTempData, gpname);
+            } else {
+                STRNCPY( sgTempData, sgMetaData, sgMetaDataLen);
+                snprintf(sgMetaData, sgMetaDataLen, "%s\"%s\":[]", sgTempData, gpname);
+            }
+
+            for (iattr = 1; iattr <= nattr; iattr++) {
+                status = EG_attributeGet(eface, iattr, &attrName, &itype, &nlist,
+                                         &tempIlist, &tempRlist, &tempClist);
+                if (status != SUCCESS) {
+                    SPRINT3(0, "ERROR:: EG_attributeGet(%d,%d) -> status=%d", ibody, iface, status);
                 }
 
-                if (sensTess == 0) {
-                    vel = (double *) malloc(3*npnt*sizeof(double));
-                    if (vel == NULL) {
-                        SPRINT0(0, "MALLOC error");
-                        goto cleanup;
-                    }
+                if (itype == ATTRCSYS) continue;
 
-                    status = ocsmGetVel(MODL, ibody, OCSM_FACE, iface, npnt, NULL, vel);
-                    if (status != SUCCESS) {
-                        SPRINT3(0, "ERROR:: ocsmGetVel(%d,%d) -> status=%d", ibody, iface, status);
-                        goto cleanup;
+                STRNCPY( sgTempData, sgMetaData, sgMetaDataLen);
+                snprintf(sgMetaData, sgMetaDataLen, "%s\"%s\",\"", sgTempData, attrName);
+
+                if        (itype == ATTRINT) {
+                    for (i = 0; i < nlist ; i++) {
+                        STRNCPY( sgTempData, sgMetaData, sgMetaDataLen);
+                        snprintf(sgMetaData, sgMetaDataLen, "%s %d", sgTempData, tempIlist[i]);
                     }
-                } else {
-                    status = ocsmGetTessVel(MODL, ibody, OCSM_FACE, iface, (const double**)(&vel));
-                    if (status != SUCCESS) {
-                        SPRINT3(0, "ERROR:: ocsmGetTessVel(%d,%d) -> status=%d", ibody, iface, status);
-                        goto cleanup;
+                } else if (itype == ATTRREAL) {
+                    for (i = 0; i < nlist ; i++) {
+                        STRNCPY( sgTempData, sgMetaData, sgMetaDataLen);
+                        snprintf(sgMetaData, sgMetaDataLen, "%s %f", sgTempData, tempRlist[i]);
                     }
+                } else if (itype == ATTRSTRING) {
+                    STRNCPY( sgTempData, sgMetaData, sgMetaDataLen);
+                    snprintf(sgMetaData, sgMetaDataLen, "%s %s ", sgTempData, tempClist);
                 }
 
-                /* special plotting of tufts for sensitivities (adjust DESPMTR velocity
-                   to adjust tuft length) */
-#ifdef SHOW_TUFTS
-                if (sensTess == 0) {
-                    float  *ptufts;
-                    int    nitems1=0, attrs1;
-                    char   gpname1[MAX_STRVAL_LEN];
-                    wvData items1[6];
-
-                    ptufts = (float *) malloc(6*npnt*sizeof(float));
-                    if (ptufts == NULL) {
-                        SPRINT0(0, "MALLOC error");
-                        goto cleanup;
-                    }
+                STRNCPY( sgTempData, sgMetaData, sgMetaDataLen);
+                snprintf(sgMetaData, sgMetaDataLen, "%s\",", sgTempData);
+            }
+            sgMetaData[sgMetaDataLen-1] = '\0';
+            STRNCPY( sgTempData, sgMetaData, sgMetaDataLen);
+            snprintf(sgMetaData, sgMetaDataLen, "%s],", sgTempData);
+        }
 
-                    for (ipnt = 0; ipnt < npnt; ipnt++) {
-                        ptufts[6*ipnt  ] = xyz[3*ipnt  ];
-                        ptufts[6*ipnt+1] = xyz[3*ipnt+1];
-                        ptufts[6*ipnt+2] = xyz[3*ipnt+2];
+        /* loop through the Edges within the current Body */
+        for (iedge = 1; iedge <= MODL->body[ibody].nedge; iedge++) {
+            nitems = 0;
 
-                        ptufts[6*ipnt+3] = xyz[3*ipnt  ] + vel[3*ipnt  ];
-                        ptufts[6*ipnt+4] = xyz[3*ipnt+1] + vel[3*ipnt+1];
-                        ptufts[6*ipnt+5] = xyz[3*ipnt+2] + vel[3*ipnt+2];
-                    }
+            /* skip edge if this is a NodeBody */
+            if (MODL->body[ibody].botype == OCSM_NODE_BODY) continue;
 
-                    color[0] = 0;
-                    color[1] = 0;
-                    color[2] = 0;
-                    status = wv_setData(WV_REAL32, 1, (void*)color, WV_COLORS, &(items1[nitems1]));
-                    if (status != SUCCESS) {
-                        SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
-                    }
-                    nitems1++;
+            status = EG_getTessEdge(etess, iedge, &npnt, &xyz, &t);
+            if (status != SUCCESS) {
+                SPRINT3(0, "ERROR:: EG_getTessEdge(%d,%d) -> status=%d", ibody, iedge, status);
+            }
 
-                    status = wv_setData(WV_REAL32, 2*npnt, (void*)ptufts, WV_VERTICES, &(items1[nitems1]));
-                    if (status != SUCCESS) {
-                        SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
-                    }
-                    wv_adjustVerts(&(items1[nitems1]), sgFocus);
-                    nitems1++;
+            /* name and attributes */
+            snprintf(gpname, MAX_STRVAL_LEN-1, "%s Edge %d", bname, iedge);
+            attrs = WV_ON;
 
-                    snprintf(gpname1, MAX_STRVAL_LEN-1, "Tufts_%d:%d", ibody, iface);
-                    attrs1 = WV_ON;
+            /* vertices */
+            status = wv_setData(WV_REAL64, npnt, (void*)xyz, WV_VERTICES, &(items[nitems]));
+            if (status != SUCCESS) {
+                SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iedge, status);
+            }
 
-                    igprim = wv_addGPrim(cntxt, gpname1, WV_LINE, attrs1, nitems1, items1);
-                    if (igprim < 0) {
-                        SPRINT2(0, "ERROR:: wv_addGPrim(%s) -> igprim=%d", gpname1, igprim);
-                    } else {
-                        cntxt->gPrims[igprim].lWidth = 1.0;
-                    }
+            wv_adjustVerts(&(items[nitems]), sgFocus);
+            nitems++;
 
-                    free(ptufts);
-                }
-#endif
+            /* segments */
+            ivrts = (int*) malloc(2*(npnt-1)*sizeof(int));
+            if (ivrts == NULL) goto cleanup;
 
-                for (ipnt = 0; ipnt < npnt; ipnt++) {
-                    /* correct for NaN */
-                    if (vel[3*ipnt  ] != vel[3*ipnt  ] ||
-                        vel[3*ipnt+1] != vel[3*ipnt+1] ||
-                        vel[3*ipnt+2] != vel[3*ipnt+2]   ) {
-                        SPRINT1(0, "WARNING:: vel[%d] = NaN (being changed to 0)", ipnt);
-                        velmag = 0;
-
-                    /* find signed velocity magnitude */
-                    } else if (sensTess == 0) {
-                        status = EG_evaluate(MODL->body[ibody].face[iface].eface, &(uv[2*ipnt]), data);
-                        if (status != SUCCESS) {
-                            SPRINT3(0, "ERROR:: EG_evaluate(%d,%d) -> srtatus=%d", ibody, iface, status);
-                            goto cleanup;
-                        }
+            for (ipnt = 0; ipnt < npnt-1; ipnt++) {
+                ivrts[2*ipnt  ] = ipnt + 1;
+                ivrts[2*ipnt+1] = ipnt + 2;
+            }
 
-                        normx  = data[4] * data[8] - data[5] * data[7];
-                        normy  = data[5] * data[6] - data[3] * data[8];
-                        normz  = data[3] * data[7] - data[4] * data[6];
+            status = wv_setData(WV_INT32, 2*(npnt-1), (void*)ivrts, WV_INDICES, &(items[nitems]));
+            if (status != SUCCESS) {
+                SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iedge, status);
+            }
+            nitems++;
 
-                        velmag = mtype * ( vel[3*ipnt  ] * normx
-                                          +vel[3*ipnt+1] * normy
-                                          +vel[3*ipnt+2] * normz)
-                               / sqrt(normx * normx + normy * normy + normz * normz);
+            free(ivrts);
 
-                        if (velmag != velmag) {
-                            SPRINT1(0, "WARNING:: vel[%d] = NaN (being changed to 0)", ipnt);
-                            velmag = 0;
-                        }
+            /* line colors */
+            color[0] = RED(  MODL->body[ibody].edge[iedge].gratt.color);
+            color[1] = GREEN(MODL->body[ibody].edge[iedge].gratt.color);
+            color[2] = BLUE( MODL->body[ibody].edge[iedge].gratt.color);
+            status = wv_setData(WV_REAL32, 1, (void*)color, WV_COLORS, &(items[nitems]));
+            if (status != SUCCESS) {
+                SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iedge, status);
+            }
+            nitems++;
 
-                    /* find unsigned velocity magnitude */
-                    } else {
-                        velmag = sqrt( vel[3*ipnt  ] * vel[3*ipnt  ]
-                                     + vel[3*ipnt+1] * vel[3*ipnt+1]
-                                     + vel[3*ipnt+2] * vel[3*ipnt+2]);
-                    }
+            /* points */
+            ivrts = (int*) malloc(npnt*sizeof(int));
+            if (ivrts == NULL) goto cleanup;
 
-                    spec_col((float)(velmag), &(pcolors[3*ipnt]));
+            for (ipnt = 0; ipnt < npnt; ipnt++) {
+                ivrts[ipnt] = ipnt + 1;
+            }
 
-                    if (velmag < sensLo) sensLo = velmag;
-                    if (velmag > sensHi) sensHi = velmag;
-                }
+            status = wv_setData(WV_INT32, npnt, (void*)ivrts, WV_PINDICES, &(items[nitems]));
+            if (status != SUCCESS) {
+                SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iedge, status);
+            }
+            nitems++;
 
-                status = wv_setData(WV_REAL32, npnt, (void*)pcolors, WV_COLORS, &(items[nitems]));
-                if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
-                }
-                nitems++;
+            free(ivrts);
 
-                free(pcolors);
-                if (sensTess == 0) {
-                    free(vel);
-                }
+            /* point colors */
+            color[0] = RED(  MODL->body[ibody].edge[iedge].gratt.mcolor);
+            color[1] = GREEN(MODL->body[ibody].edge[iedge].gratt.mcolor);
+            color[2] = BLUE( MODL->body[ibody].edge[iedge].gratt.mcolor);
+            status = wv_setData(WV_REAL32, 1, (void*)color, WV_PCOLOR, &(items[nitems]));
+            if (status != SUCCESS) {
+                SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iedge, status);
+            }
+            nitems++;
 
-            /* smooth colors (normalized U) */
-            } else if (plotType == 1) {
-                status = EG_getTessFace(etess, iface,
-                                        &npnt, &xyz, &uv, &ptype, &pindx,
-                                        &ntri, &tris, &tric);
+            /* make graphic primitive */
+            igprim = wv_addGPrim(cntxt, gpname, WV_LINE, attrs, nitems, items);
+            if (igprim < 0) {
+                SPRINT2(0, "ERROR:: wv_addGPrim(%s) -> igprim=%d", gpname, igprim);
+            } else {
+                /* make line width 2 (does not work for ANGLE) */
+                cntxt->gPrims[igprim].lWidth = 2.0;
+
+                /* make point size 5 */
+                cntxt->gPrims[igprim].pSize  = 5.0;
+
+                /* add arrow heads (requires that WV_ORIENTATION be set above) */
+                head[0] = npnt - 1;
+                status = wv_addArrowHeads(cntxt, igprim, 0.10/sgFocus[3], 1, head);
                 if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: EG_getTessFace(%d,%d) -> status=%d", ibody, iface, status);
-                    goto cleanup;
+                    SPRINT3(0, "ERROR:: wv_addArrowHeads(%d,%d) -> status=%d", ibody, iedge, status);
                 }
+            }
 
-                status = EG_getTopology(MODL->body[ibody].face[iface].eface,
-                                        &eref, &oclass, &mtype, uvlimits,
-                                        &nchild, &echilds, &senses);
+            eedge  = MODL->body[ibody].edge[iedge].eedge;
+            status = EG_attributeNum(eedge, &nattr);
+            if (status != SUCCESS) {
+                SPRINT3(0, "ERROR:: EG_attributeNum(%d,%d) -> status=%d", ibody, iedge, status);
+            }
+
+            /* if sensTess is set and we are asking for smooth colors
+               (sensitivities) is set, draw tufts, whose length can be changed
+               by recomputing sensitivity with a different value for the velocity
+               of the Design Parameter.  (note that the tufts cannot be toggled in ESP) */
+            if (sensTess == 1 && haveDots >= 1) {
+                status = EG_getTessEdge(etess, iedge,
+                                        &npnt, &xyz, &uv);
                 if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR::EG_getTopology(%d,%d) -> status=%d", ibody, iface, status);
+                    SPRINT3(0, "ERROR:: EG_getTessEdge(%d,%d) -> status=%d", ibody, iedge, status);
                     goto cleanup;
                 }
 
-                pcolors = (float *) malloc(3*npnt*sizeof(float));
-                if (pcolors == NULL) {
-                    SPRINT0(0, "MALLOC error");
-                    goto cleanup;
-                }
+                nitems = 0;
 
-                for (ipnt = 0; ipnt < npnt; ipnt++) {
-                    ubar = (uv[2*ipnt  ] - uvlimits[0]) / (uvlimits[1] - uvlimits[0]);
-                    spec_col((float)(ubar), &(pcolors[3*ipnt]));
-                }
+                /* name and attributes */
+                snprintf(gpname, MAX_STRVAL_LEN-1, "Edge %s:%d points", bname, iedge);
+                attrs = WV_ON;
 
-                status = wv_setData(WV_REAL32, npnt, (void*)pcolors, WV_COLORS, &(items[nitems]));
+                status = wv_setData(WV_REAL64, npnt, (void*)xyz, WV_VERTICES, &(items[nitems]));
                 if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
+                    SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iedge, status);
                 }
+
+                wv_adjustVerts(&(items[nitems]), sgFocus);
                 nitems++;
 
-                free(pcolors);
+                /* point color */
+                color[0] = 0;   color[1] = 0;   color[2] = 0;
 
-            /* smooth colors (normalized V) */
-            } else if (plotType == 2) {
-                status = EG_getTessFace(etess, iface,
-                                        &npnt, &xyz, &uv, &ptype, &pindx,
-                                        &ntri, &tris, &tric);
+                status = wv_setData(WV_REAL32, 1, (void*)color, WV_COLORS, &(items[nitems]));
                 if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: EG_getTessFace(%d,%d) -> status=%d", ibody, iface, status);
-                    goto cleanup;
+                    SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iedge, status);
                 }
+                nitems++;
 
-                status = EG_getTopology(MODL->body[ibody].face[iface].eface,
-                                        &eref, &oclass, &mtype, uvlimits,
-                                        &nchild, &echilds, &senses);
+                /* make graphic primitive for points */
+                igprim = wv_addGPrim(cntxt, gpname, WV_POINT, attrs, nitems, items);
+                if (igprim < 0) {
+                    SPRINT2(0, "ERROR:: wv_addGPrim(%s) -> igprim=%d", gpname, igprim);
+                } else {
+                    cntxt->gPrims[igprim].pSize = 3.0;
+                }
+
+                nitems = 0;
+
+                /* name and attributes */
+                snprintf(gpname, MAX_STRVAL_LEN-1, "Edge %s:%d tufts", bname, iedge);
+                attrs = WV_ON;
+
+                status = ocsmGetTessVel(MODL, ibody, OCSM_EDGE, iedge, (const double**)(&vel));
                 if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: EG_getTopology(%d,%d) -> status=%d", ibody, iface, status);
+                    SPRINT3(0, "ERROR:: ocsmGetTessVel(%d,%d) -> status=%d", ibody, iedge, status);
                     goto cleanup;
                 }
 
-                pcolors = (float *) malloc(3*npnt*sizeof(float));
-                if (pcolors == NULL) {
+                /* create tufts */
+                tuft = (float *) malloc(6*npnt*sizeof(float));
+                if (tuft == NULL) {
                     SPRINT0(0, "MALLOC error");
                     goto cleanup;
                 }
 
                 for (ipnt = 0; ipnt < npnt; ipnt++) {
-                    vbar = (uv[2*ipnt+1] - uvlimits[2]) / (uvlimits[3] - uvlimits[2]);
-                    spec_col((float)(vbar), &(pcolors[3*ipnt]));
+                    tuft[6*ipnt  ] = xyz[3*ipnt  ];
+                    tuft[6*ipnt+1] = xyz[3*ipnt+1];
+                    tuft[6*ipnt+2] = xyz[3*ipnt+2];
+                    tuft[6*ipnt+3] = xyz[3*ipnt  ] + vel[3*ipnt  ];
+                    tuft[6*ipnt+4] = xyz[3*ipnt+1] + vel[3*ipnt+1];
+                    tuft[6*ipnt+5] = xyz[3*ipnt+2] + vel[3*ipnt+2];
                 }
 
-                status = wv_setData(WV_REAL32, npnt, (void*)pcolors, WV_COLORS, &(items[nitems]));
-                if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
-                }
-                nitems++;
+                status = wv_setData(WV_REAL32, 2*npnt, (void*)tuft, WV_VERTICES, &(items[nitems]));
 
-                free(pcolors);
+                free(tuft);
 
-            /* smooth colors (minimum Curv) */
-            } else if (plotType == 3) {
-                status = EG_getTessFace(etess, iface,
-                                        &npnt, &xyz, &uv, &ptype, &pindx,
-                                        &ntri, &tris, &tric);
                 if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: EG_getTessFace(%d,%d) -> status=%d", ibody, iface, status);
-                    goto cleanup;
+                    SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iedge, status);
                 }
 
-                pcolors = (float *) malloc(3*npnt*sizeof(float));
-                if (pcolors == NULL) {
-                    SPRINT0(0, "MALLOC error");
-                    goto cleanup;
-                }
+                wv_adjustVerts(&(items[nitems]), sgFocus);
+                nitems++;
 
-                for (ipnt = 0; ipnt < npnt; ipnt++) {
-                    status = EG_curvature(MODL->body[ibody].face[iface].eface,
-                                          &(uv[2*ipnt]), data);
-                    if (status != SUCCESS) {
-                        rcurv = 0;
-                    } else {
-                        rcurv = MIN(data[0], data[4]) * sqrt(size2);
-                    }
-                    spec_col((float)(rcurv), &(pcolors[3*ipnt]));
-                }
+                /* tuft color */
+                color[0] = 0;   color[1] = 0;   color[2] = 0;
 
-                status = wv_setData(WV_REAL32, npnt, (void*)pcolors, WV_COLORS, &(items[nitems]));
+                status = wv_setData(WV_REAL32, 1, (void*)color, WV_COLORS, &(items[nitems]));
                 if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
-                }
-                nitems++;
-
-                free(pcolors);
-
-            /* smooth colors (maximum Curv) */
-            } else if (plotType == 4) {
-                status = EG_getTessFace(etess, iface,
-                                        &npnt, &xyz, &uv, &ptype, &pindx,
-                                        &ntri, &tris, &tric);
-                if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: EG_getTessFace(%d,%d) -> status=%d", ibody, iface, status);
-                    goto cleanup;
-                }
-
-                pcolors = (float *) malloc(3*npnt*sizeof(float));
-                if (pcolors == NULL) {
-                    SPRINT0(0, "MALLOC error");
-                    goto cleanup;
-                }
-
-                for (ipnt = 0; ipnt < npnt; ipnt++) {
-                    status = EG_curvature(MODL->body[ibody].face[iface].eface,
-                                          &(uv[2*ipnt]), data);
-                    if (status != SUCCESS) {
-                        rcurv = 0;
-                    } else {
-                        rcurv = MAX(data[0], data[4]) * sqrt(size2);
-                    }
-                    spec_col((float)(rcurv), &(pcolors[3*ipnt]));
-                }
-                status = wv_setData(WV_REAL32, npnt, (void*)pcolors, WV_COLORS, &(items[nitems]));
-                if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
-                }
-                nitems++;
-
-                free(pcolors);
-
-            /* smooth colors (Gaussian Curv) */
-            } else if (plotType == 5) {
-                status = EG_getTessFace(etess, iface,
-                                        &npnt, &xyz, &uv, &ptype, &pindx,
-                                        &ntri, &tris, &tric);
-                if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: EG_getTessFace(%d,%d) -> status=%d", ibody, iface, status);
-                    goto cleanup;
-                }
-
-                pcolors = (float *) malloc(3*npnt*sizeof(float));
-                if (pcolors == NULL) {
-                    SPRINT0(0, "MALLOC error");
-                    goto cleanup;
-                }
-
-                for (ipnt = 0; ipnt < npnt; ipnt++) {
-                    status = EG_curvature(MODL->body[ibody].face[iface].eface,
-                                          &(uv[2*ipnt]), data);
-                    if (status != SUCCESS) {
-                        rcurv = 0;
-                    } else if (MIN(fabs(data[0]), fabs(data[4])) < 0.00001 * MAX(fabs(data[0]), fabs(data[4]))) {
-                        rcurv = 0;
-                    } else if (data[0]*data[4] > 0) {
-                        rcurv = +pow(fabs(data[0]*data[4]*size2), 0.25);
-                    } else if (data[0]*data[4] < 0) {
-                        rcurv = -pow(fabs(data[0]*data[4]*size2), 0.25);
-                    } else {
-                        rcurv = 0;
-                    }
-                    spec_col((float)(rcurv), &(pcolors[3*ipnt]));
-                }
-                status = wv_setData(WV_REAL32, npnt, (void*)pcolors, WV_COLORS, &(items[nitems]));
-                if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
-                }
-                nitems++;
-
-                free(pcolors);
-
-            /* constant triangle colors */
-            } else {
-                color[0] = RED(  MODL->body[ibody].face[iface].gratt.color);
-                color[1] = GREEN(MODL->body[ibody].face[iface].gratt.color);
-                color[2] = BLUE( MODL->body[ibody].face[iface].gratt.color);
-                status = wv_setData(WV_REAL32, 1, (void*)color, WV_COLORS, &(items[nitems]));
-                if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
-                }
-                nitems++;
-            }
-
-            /* triangle backface color */
-            color[0] = RED(  MODL->body[ibody].face[iface].gratt.bcolor);
-            color[1] = GREEN(MODL->body[ibody].face[iface].gratt.bcolor);
-            color[2] = BLUE( MODL->body[ibody].face[iface].gratt.bcolor);
-            status = wv_setData(WV_REAL32, 1, (void*)color, WV_BCOLOR, &(items[nitems]));
-            if (status != SUCCESS) {
-                SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
-            }
-            nitems++;
-
-            /* segment indices */
-            status = wv_setData(WV_INT32, 2*nseg, (void*)segs, WV_LINDICES, &(items[nitems]));
-            if (status != SUCCESS) {
-                SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
-            }
-            nitems++;
-
-            free(segs);
-
-            /* segment colors */
-            color[0] = RED(  MODL->body[ibody].face[iface].gratt.mcolor);
-            color[1] = GREEN(MODL->body[ibody].face[iface].gratt.mcolor);
-            color[2] = BLUE( MODL->body[ibody].face[iface].gratt.mcolor);
-            status = wv_setData(WV_REAL32, 1, (void*)color, WV_LCOLOR, &(items[nitems]));
-            if (status != SUCCESS) {
-                SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
-            }
-            nitems++;
-
-            /* make graphic primitive */
-            igprim = wv_addGPrim(cntxt, gpname, WV_TRIANGLE, attrs, nitems, items);
-            if (igprim < 0) {
-                SPRINT2(0, "ERROR:: wv_addGPrim(%s) -> igprim=%d", gpname, igprim);
-            } else {
-                cntxt->gPrims[igprim].lWidth = 1.0;
-            }
-
-            /* if plotCP is set and the associated surface is a BSPLINE, plot
-               the control polygon (note that the control polygon is not listed in
-               ESP as part of the Body, but separately at the bottom) */
-            if (plotCP == 1) {
-                status = EG_getTopology(MODL->body[ibody].face[iface].eface,
-                                        &esurf, &oclass, &mtype,
-                                        data, &nchild, &echilds, &senses);
-
-                if (status == SUCCESS) {
-                    status = EG_getGeometry(esurf, &oclass, &mtype,
-                                            &eref, &header, &cp);
-
-                    if (status == SUCCESS && oclass == SURFACE && mtype == BSPLINE) {
-                        nitems = 0;
-
-                        snprintf(gpname, MAX_STRVAL_LEN-1, "PlotCP: %d:%d", ibody, iface);
-                        attrs = WV_ON;
-
-                        /* control points */
-                        status = wv_setData(WV_REAL64, header[2]*header[5], &(cp[header[3]+header[6]]),
-                                            WV_VERTICES, &(items[nitems]));
-                        if (status != SUCCESS) {
-                            SPRINT3(0, "ERROR:: wv_setdata(%d,%d) -> status=%d", ibody, iface, status);
-                        }
-
-                        wv_adjustVerts(&(items[nitems]), sgFocus);
-                        nitems++;
-
-                        segs = (int*) malloc(4*header[2]*header[5]*sizeof(int));
-                        if (segs == NULL) goto cleanup;
-                        nseg = 0;
-
-                        /* i=constant lines */
-                        for (i = 0; i < header[2]; i++) {
-                            for (j = 0; j < header[5]-1; j++) {
-                                segs[2*nseg  ] = 1 + (i) + (j  ) * header[2];
-                                segs[2*nseg+1] = 1 + (i) + (j+1) * header[2];
-                                nseg++;
-                            }
-                        }
-
-                        /* j=constant lines */
-                        for (j = 0; j < header[5]; j++) {
-                            for (i = 0; i < header[2]-1; i++) {
-                                segs[2*nseg  ] = 1 + (i  ) + (j) * header[2];
-                                segs[2*nseg+1] = 1 + (i+1) + (j) * header[2];
-                                nseg++;
-                            }
-                        }
-
-                        status = wv_setData(WV_INT32, 2*nseg, (void*)segs, WV_INDICES, &(items[nitems]));
-                        if (status != SUCCESS) {
-                            SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
-                        }
-                        nitems++;
-
-                        free(segs);
-
-                        /* color */
-                        color[0] = 0;   color[1] = 0;   color[2] = 0;
-                        status = wv_setData(WV_REAL32, 1, (void*)color, WV_COLORS, &(items[nitems]));
-                        if (status != SUCCESS) {
-                            SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
-                        }
-                        nitems++;
-
-                        /* make graphic primitive */
-                        igprim = wv_addGPrim(cntxt, gpname, WV_LINE, attrs, nitems, items);
-                        if (igprim < 0) {
-                            SPRINT2(0, "ERROR:: wv_addGPrim(%s) -> igprim=%d", gpname, igprim);
-                        }
-                    }
-                }
-            }
-
-            /* if sensTess is set and we are asking for smooth colors
-               (sensitivities) is set, draw tufts, whose length can be changed
-               by recomputing sensitivity with a different value for the velocity
-               of the Design Parameter.  (note that the tufts cannot be toggled in ESP) */
-            if (sensTess == 1 && haveDots >= 1) {
-                status = EG_getTessFace(etess, iface,
-                                        &npnt, &xyz, &uv, &ptype, &pindx,
-                                        &ntri, &tris, &tric);
-                if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: EG_getTessFace(%d,%d) -> status=%d", ibody, iface, status);
-                    goto cleanup;
-                }
-
-                nitems = 0;
-
-                /* name and attributes */
-                snprintf(gpname, MAX_STRVAL_LEN-1, "Face %s:%d points", bname, iface);
-                attrs = WV_ON;
-
-                status = wv_setData(WV_REAL64, npnt, (void*)xyz, WV_VERTICES, &(items[nitems]));
-                if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
-                }
-
-                wv_adjustVerts(&(items[nitems]), sgFocus);
-                nitems++;
-
-                /* point color */
-                color[0] = 0;   color[1] = 0;   color[2] = 0;
-
-                status = wv_setData(WV_REAL32, 1, (void*)color, WV_COLORS, &(items[nitems]));
-                if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
-                }
-                nitems++;
-
-                /* make graphic primitive for points */
-                igprim = wv_addGPrim(cntxt, gpname, WV_POINT, attrs, nitems, items);
-                if (igprim < 0) {
-                    SPRINT2(0, "ERROR:: wv_addGPrim(%s) -> igprim=%d", gpname, igprim);
-                } else {
-                    cntxt->gPrims[igprim].pSize = 3.0;
-                }
-
-                nitems = 0;
-
-                /* name and attributes */
-                snprintf(gpname, MAX_STRVAL_LEN-1, "Face %s:%d tufts", bname, iface);
-                attrs = WV_ON;
-
-                status = ocsmGetTessVel(MODL, ibody, OCSM_FACE, iface, (const double**)(&vel));
-                if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: ocsmGetTessVel(%d,%d) -> status=%d", ibody, iface, status);
-                    goto cleanup;
-                }
-
-                /* create tufts */
-                tuft = (float *) malloc(6*npnt*sizeof(float));
-                if (tuft == NULL) {
-                    SPRINT0(0, "MALLOC error");
-                    goto cleanup;
-                }
-
-                for (ipnt = 0; ipnt < npnt; ipnt++) {
-                    tuft[6*ipnt  ] = xyz[3*ipnt  ];
-                    tuft[6*ipnt+1] = xyz[3*ipnt+1];
-                    tuft[6*ipnt+2] = xyz[3*ipnt+2];
-                    tuft[6*ipnt+3] = xyz[3*ipnt  ] + vel[3*ipnt  ];
-                    tuft[6*ipnt+4] = xyz[3*ipnt+1] + vel[3*ipnt+1];
-                    tuft[6*ipnt+5] = xyz[3*ipnt+2] + vel[3*ipnt+2];
-                }
-
-                status = wv_setData(WV_REAL32, 2*npnt, (void*)tuft, WV_VERTICES, &(items[nitems]));
-
-                free(tuft);
-
-                if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
-                }
-
-                wv_adjustVerts(&(items[nitems]), sgFocus);
-                nitems++;
-
-                /* tuft color */
-                color[0] = 0;   color[1] = 0;   color[2] = 0;
-
-                status = wv_setData(WV_REAL32, 1, (void*)color, WV_COLORS, &(items[nitems]));
-                if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
+                    SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iedge, status);
                 }
                 nitems++;
 
@@ -3165,14 +2847,7 @@ buildSceneGraph()
                 }
             }
 
-            /* get Attributes for the Face */
-            eface  = MODL->body[ibody].face[iface].eface;
-            status = EG_attributeNum(eface, &nattr);
-            if (status != SUCCESS) {
-                SPRINT3(0, "ERROR:: EG_attributeNum(%d,%d) -> status=%d", ibody, iface, status);
-            }
-
-            /* add Face to meta data (if there is room) */
+            /* add Edge to meta data (if there is room) */
             if (STRLEN(sgMetaData) >= sgMetaDataLen-1000) {
                 sgMetaDataLen += MAX_METADATA_CHUNK;
                 RALLOC(sgMetaData, char, sgMetaDataLen);
@@ -3188,261 +2863,10 @@ buildSceneGraph()
             }
 
             for (iattr = 1; iattr <= nattr; iattr++) {
-                status = EG_attributeGet(eface, iattr, &attrName, &itype, &nlist,
+                status = EG_attributeGet(eedge, iattr, &attrName, &itype, &nlist,
                                          &tempIlist, &tempRlist, &tempClist);
                 if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: EG_attributeGet(%d,%d) -> status=%d", ibody, iface, status);
-                }
-
-                if (itype == ATTRCSYS) continue;
-
-                STRNCPY( sgTempData, sgMetaData, sgMetaDataLen);
-                snprintf(sgMetaData, sgMetaDataLen, "%s\"%s\",\"", sgTempData, attrName);
-
-                if        (itype == ATTRINT) {
-                    for (i = 0; i < nlist ; i++) {
-                        STRNCPY( sgTempData, sgMetaData, sgMetaDataLen);
-                        snprintf(sgMetaData, sgMetaDataLen, "%s %d", sgTempData, tempIlist[i]);
-                    }
-                } else if (itype == ATTRREAL) {
-                    for (i = 0; i < nlist ; i++) {
-                        STRNCPY( sgTempData, sgMetaData, sgMetaDataLen);
-                        snprintf(sgMetaData, sgMetaDataLen, "%s %f", sgTempData, tempRlist[i]);
-                    }
-                } else if (itype == ATTRSTRING) {
-                    STRNCPY( sgTempData, sgMetaData, sgMetaDataLen);
-                    snprintf(sgMetaData, sgMetaDataLen, "%s %s ", sgTempData, tempClist);
-                }
-
-                STRNCPY( sgTempData, sgMetaData, sgMetaDataLen);
-                snprintf(sgMetaData, sgMetaDataLen, "%s\",", sgTempData);
-            }
-            sgMetaData[sgMetaDataLen-1] = '\0';
-            STRNCPY( sgTempData, sgMetaData, sgMetaDataLen);
-            snprintf(sgMetaData, sgMetaDataLen, "%s],", sgTempData);
-        }
-
-        /* loop through the Edges within the current Body */
-        for (iedge = 1; iedge <= MODL->body[ibody].nedge; iedge++) {
-            nitems = 0;
-
-            /* skip edge if this is a NodeBody */
-            if (MODL->body[ibody].botype == OCSM_NODE_BODY) continue;
-
-            status = EG_getTessEdge(etess, iedge, &npnt, &xyz, &t);
-            if (status != SUCCESS) {
-                SPRINT3(0, "ERROR:: EG_getTessEdge(%d,%d) -> status=%d", ibody, iedge, status);
-            }
-
-            /* name and attributes */
-            snprintf(gpname, MAX_STRVAL_LEN-1, "%s Edge %d", bname, iedge);
-            attrs = WV_ON;
-
-            /* vertices */
-            status = wv_setData(WV_REAL64, npnt, (void*)xyz, WV_VERTICES, &(items[nitems]));
-            if (status != SUCCESS) {
-                SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iedge, status);
-            }
-
-            wv_adjustVerts(&(items[nitems]), sgFocus);
-            nitems++;
-
-            /* segments */
-            ivrts = (int*) malloc(2*(npnt-1)*sizeof(int));
-            if (ivrts == NULL) goto cleanup;
-
-            for (ipnt = 0; ipnt < npnt-1; ipnt++) {
-                ivrts[2*ipnt  ] = ipnt + 1;
-                ivrts[2*ipnt+1] = ipnt + 2;
-            }
-
-            status = wv_setData(WV_INT32, 2*(npnt-1), (void*)ivrts, WV_INDICES, &(items[nitems]));
-            if (status != SUCCESS) {
-                SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iedge, status);
-            }
-            nitems++;
-
-            free(ivrts);
-
-            /* line colors */
-            color[0] = RED(  MODL->body[ibody].edge[iedge].gratt.color);
-            color[1] = GREEN(MODL->body[ibody].edge[iedge].gratt.color);
-            color[2] = BLUE( MODL->body[ibody].edge[iedge].gratt.color);
-            status = wv_setData(WV_REAL32, 1, (void*)color, WV_COLORS, &(items[nitems]));
-            if (status != SUCCESS) {
-                SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iedge, status);
-            }
-            nitems++;
-
-            /* points */
-            ivrts = (int*) malloc(npnt*sizeof(int));
-            if (ivrts == NULL) goto cleanup;
-
-            for (ipnt = 0; ipnt < npnt; ipnt++) {
-                ivrts[ipnt] = ipnt + 1;
-            }
-
-            status = wv_setData(WV_INT32, npnt, (void*)ivrts, WV_PINDICES, &(items[nitems]));
-            if (status != SUCCESS) {
-                SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iedge, status);
-            }
-            nitems++;
-
-            free(ivrts);
-
-            /* point colors */
-            color[0] = RED(  MODL->body[ibody].edge[iedge].gratt.mcolor);
-            color[1] = GREEN(MODL->body[ibody].edge[iedge].gratt.mcolor);
-            color[2] = BLUE( MODL->body[ibody].edge[iedge].gratt.mcolor);
-            status = wv_setData(WV_REAL32, 1, (void*)color, WV_PCOLOR, &(items[nitems]));
-            if (status != SUCCESS) {
-                SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iedge, status);
-            }
-            nitems++;
-
-            /* make graphic primitive */
-            igprim = wv_addGPrim(cntxt, gpname, WV_LINE, attrs, nitems, items);
-            if (igprim < 0) {
-                SPRINT2(0, "ERROR:: wv_addGPrim(%s) -> igprim=%d", gpname, igprim);
-            } else {
-                /* make line width 2 (does not work for ANGLE) */
-                cntxt->gPrims[igprim].lWidth = 2.0;
-
-                /* make point size 5 */
-                cntxt->gPrims[igprim].pSize  = 5.0;
-
-                /* add arrow heads (requires that WV_ORIENTATION be set above) */
-                head[0] = npnt - 1;
-                status = wv_addArrowHeads(cntxt, igprim, 0.10/sgFocus[3], 1, head);
-                if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: wv_addArrowHeads(%d,%d) -> status=%d", ibody, iedge, status);
-                }
-            }
-
-            eedge  = MODL->body[ibody].edge[iedge].eedge;
-            status = EG_attributeNum(eedge, &nattr);
-            if (status != SUCCESS) {
-                SPRINT3(0, "ERROR:: EG_attributeNum(%d,%d) -> status=%d", ibody, iedge, status);
-            }
-
-            /* if sensTess is set and we are asking for smooth colors
-               (sensitivities) is set, draw tufts, whose length can be changed
-               by recomputing sensitivity with a different value for the velocity
-               of the Design Parameter.  (note that the tufts cannot be toggled in ESP) */
-            if (sensTess == 1 && haveDots >= 1) {
-                status = EG_getTessEdge(etess, iedge,
-                                        &npnt, &xyz, &uv);
-                if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: EG_getTessEdge(%d,%d) -> status=%d", ibody, iedge, status);
-                    goto cleanup;
-                }
-
-                nitems = 0;
-
-                /* name and attributes */
-                snprintf(gpname, MAX_STRVAL_LEN-1, "Edge %s:%d points", bname, iedge);
-                attrs = WV_ON;
-
-                status = wv_setData(WV_REAL64, npnt, (void*)xyz, WV_VERTICES, &(items[nitems]));
-                if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iedge, status);
-                }
-
-                wv_adjustVerts(&(items[nitems]), sgFocus);
-                nitems++;
-
-                /* point color */
-                color[0] = 0;   color[1] = 0;   color[2] = 0;
-
-                status = wv_setData(WV_REAL32, 1, (void*)color, WV_COLORS, &(items[nitems]));
-                if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iedge, status);
-                }
-                nitems++;
-
-                /* make graphic primitive for points */
-                igprim = wv_addGPrim(cntxt, gpname, WV_POINT, attrs, nitems, items);
-                if (igprim < 0) {
-                    SPRINT2(0, "ERROR:: wv_addGPrim(%s) -> igprim=%d", gpname, igprim);
-                } else {
-                    cntxt->gPrims[igprim].pSize = 3.0;
-                }
-
-                nitems = 0;
-
-                /* name and attributes */
-                snprintf(gpname, MAX_STRVAL_LEN-1, "Edge %s:%d tufts", bname, iedge);
-                attrs = WV_ON;
-
-                status = ocsmGetTessVel(MODL, ibody, OCSM_EDGE, iedge, (const double**)(&vel));
-                if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: ocsmGetTessVel(%d,%d) -> status=%d", ibody, iedge, status);
-                    goto cleanup;
-                }
-
-                /* create tufts */
-                tuft = (float *) malloc(6*npnt*sizeof(float));
-                if (tuft == NULL) {
-                    SPRINT0(0, "MALLOC error");
-                    goto cleanup;
-                }
-
-                for (ipnt = 0; ipnt < npnt; ipnt++) {
-                    tuft[6*ipnt  ] = xyz[3*ipnt  ];
-                    tuft[6*ipnt+1] = xyz[3*ipnt+1];
-                    tuft[6*ipnt+2] = xyz[3*ipnt+2];
-                    tuft[6*ipnt+3] = xyz[3*ipnt  ] + vel[3*ipnt  ];
-                    tuft[6*ipnt+4] = xyz[3*ipnt+1] + vel[3*ipnt+1];
-                    tuft[6*ipnt+5] = xyz[3*ipnt+2] + vel[3*ipnt+2];
-                }
-
-                status = wv_setData(WV_REAL32, 2*npnt, (void*)tuft, WV_VERTICES, &(items[nitems]));
-
-                free(tuft);
-
-                if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iedge, status);
-                }
-
-                wv_adjustVerts(&(items[nitems]), sgFocus);
-                nitems++;
-
-                /* tuft color */
-                color[0] = 0;   color[1] = 0;   color[2] = 0;
-
-                status = wv_setData(WV_REAL32, 1, (void*)color, WV_COLORS, &(items[nitems]));
-                if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iedge, status);
-                }
-                nitems++;
-
-                /* make graphic primitive for tufts */
-                igprim = wv_addGPrim(cntxt, gpname, WV_LINE, attrs, nitems, items);
-                if (igprim < 0) {
-                    SPRINT2(0, "ERROR:: wv_addGPrim(%s) -> igprim=%d", gpname, igprim);
-                }
-            }
-
-            /* add Edge to meta data (if there is room) */
-            if (STRLEN(sgMetaData) >= sgMetaDataLen-1000) {
-                sgMetaDataLen += MAX_METADATA_CHUNK;
-                RALLOC(sgMetaData, char, sgMetaDataLen);
-                RALLOC(sgTempData, char, sgMetaDataLen);
-            }
-
-            if (nattr > 0) {
-                STRNCPY( sgTempData, sgMetaData, sgMetaDataLen);
-                snprintf(sgMetaData, sgMetaDataLen, "%s\"%s\":[",  sgTempData, gpname);
-            } else {
-                STRNCPY( sgTempData, sgMetaData, sgMetaDataLen);
-                snprintf(sgMetaData, sgMetaDataLen, "%s\"%s\":[]", sgTempData, gpname);
-            }
-
-            for (iattr = 1; iattr <= nattr; iattr++) {
-                status = EG_attributeGet(eedge, iattr, &attrName, &itype, &nlist,
-                                         &tempIlist, &tempRlist, &tempClist);
-                if (status != SUCCESS) {
-                    SPRINT3(0, "ERROR:: EG_attributeGet(%d,%d) -> status=%d", ibody, iedge, status);
+                    SPRINT3(0, "ERROR:: EG_attributeGet(%d,%d) -> status=%d", ibody, iedge, status);
                 }
 
                 if (itype == ATTRCSYS) continue;
@@ -4091,354 +3515,1276 @@ buildSceneGraph()
         /* name */
         snprintf(gpname, MAX_STRVAL_LEN-1, "PlotPoints: BDF_GRIDs");
 
-        /* points in plotdata */
-        status = wv_setData(WV_REAL32, ngrid, plotdata, WV_VERTICES, &(items[nitems]));
+        /* points in plotdata */
+        status = wv_setData(WV_REAL32, ngrid, plotdata, WV_VERTICES, &(items[nitems]));
+        if (status != SUCCESS) {
+            SPRINT1(0, "ERROR:: wv_setData -> status=%d", status);
+        }
+
+        wv_adjustVerts(&(items[nitems]), sgFocus);
+        nitems++;
+
+        /* point color */
+        color[0] = 0;   color[1] = 0;   color[2] = 0;
+
+        status = wv_setData(WV_REAL32, 1, (void*)color, WV_COLORS, &(items[nitems]));
+        if (status != SUCCESS) {
+            SPRINT1(0, "ERROR:: wv_setData -> status=%d", status);
+        }
+        nitems++;
+
+        /* make graphic primitive */
+        attrs  = WV_ON;
+        igprim = wv_addGPrim(cntxt, gpname, WV_POINT, attrs, nitems, items);
+        if (igprim < 0) {
+            SPRINT2(0, "ERROR:: wv_addGPrim(%s) -> igprim=%d", gpname, igprim);
+        } else {
+            cntxt->gPrims[igprim].pSize = 3.0;
+        }
+
+        /* add plotdata to meta data (if there is room) */
+        if (STRLEN(sgMetaData) >= sgMetaDataLen-1000) {
+            sgMetaDataLen += MAX_METADATA_CHUNK;
+            RALLOC(sgMetaData, char, sgMetaDataLen);
+            RALLOC(sgTempData, char, sgMetaDataLen);
+        }
+
+        STRNCPY( sgTempData, sgMetaData, sgMetaDataLen);
+        snprintf(sgMetaData, sgMetaDataLen, "%s\"%s\":[],", sgTempData, gpname);
+
+        /* count the number of CRODs in the file */
+        rewind(fp);
+        ncrod = 0;
+        while (1) {
+            if (fgets(text, 80, fp) == NULL) break;
+            if (feof(fp)) break;
+
+            if (strncmp(text, "CROD    ", 8) == 0) {
+                ncrod++;
+            }
+        }
+        SPRINT1(1, "   there are %d CRODs", ncrod);
+
+        if (ncrod > 0) {
+            segments = (float *) malloc(6*ncrod*sizeof(float));
+            if (segments == NULL) goto cleanup;
+
+            rewind(fp);
+            i = 0;
+            while (1) {
+                if (fgets(text, 80, fp) == NULL) break;
+                if (feof(fp)) break;
+
+                if (strncmp(text, "CROD    ", 8) != 0) continue;
+
+                sscanf(text, "%s %d %d %d %d", dum, &imax, &jmax, &ibeg, &iend);
+
+                segments[6*i  ] = plotdata[3*ibeg-3];
+                segments[6*i+1] = plotdata[3*ibeg-2];
+                segments[6*i+2] = plotdata[3*ibeg-1];
+
+                segments[6*i+3] = plotdata[3*iend-3];
+                segments[6*i+4] = plotdata[3*iend-2];
+                segments[6*i+5] = plotdata[3*iend-1];
+
+                i++;
+            }
+
+            nitems = 0;
+
+            /* name */
+            snprintf(gpname, MAX_STRVAL_LEN-1, "PlotLine: BDF_CRODs");
+
+            /* segments */
+            status = wv_setData(WV_REAL32, 2*i, (void*)segments, WV_VERTICES, &(items[nitems]));
+            if (status != SUCCESS) {
+                SPRINT1(0, "ERROR:: wv_setData -> status=%d", status);
+            }
+
+            free(segments);
+            segments = NULL;
+
+            wv_adjustVerts(&(items[nitems]), sgFocus);
+            nitems++;
+
+            /* line color */
+            color[0] = 1.0;   color[1] = 0.5;   color[2] = 0.5;
+
+            status = wv_setData(WV_REAL32, 1, (void*)color, WV_COLORS, &(items[nitems]));
+            if (status != SUCCESS) {
+                SPRINT1(0, "ERROR:: wv_setData -> status=%d", status);
+            }
+            nitems++;
+
+            /* make graphic primitive and set line width */
+            attrs = WV_ON;
+            igprim = wv_addGPrim(cntxt, gpname, WV_LINE, attrs, nitems, items);
+            if (igprim < 0) {
+                SPRINT2(0, "ERROR:: wv_addGPrim(%s) -> igprim=%d", gpname, igprim);
+            } else {
+                cntxt->gPrims[igprim].lWidth = 1.0;
+            }
+
+            /* add plotdata to meta data (if there is room) */
+            if (STRLEN(sgMetaData) >= sgMetaDataLen-1000) {
+                sgMetaDataLen += MAX_METADATA_CHUNK;
+                RALLOC(sgMetaData, char, sgMetaDataLen);
+                RALLOC(sgTempData, char, sgMetaDataLen);
+            }
+
+            STRNCPY( sgTempData, sgMetaData, sgMetaDataLen);
+            snprintf(sgMetaData, sgMetaDataLen, "%s\"%s\":[],", sgTempData, gpname);
+        }
+
+        /* count the number of CTRI3s in the file */
+        rewind(fp);
+        nctri3 = 0;
+        while (1) {
+            if (fgets(text, 80, fp) == NULL) break;
+            if (feof(fp)) break;
+
+            if (strncmp(text, "CTRI3   ", 8) == 0) {
+                nctri3++;
+            }
+        }
+        SPRINT1(1, "   there are %d CTRI3s", nctri3);
+
+        if (nctri3 > 0) {
+            segments = (float *) malloc(18*nctri3*sizeof(float));
+            if (segments == NULL) goto cleanup;
+
+            rewind(fp);
+            i = 0;
+            while (1) {
+                if (fgets(text, 80, fp) == NULL) break;
+                if (feof(fp)) break;
+
+                if (strncmp(text, "CTRI3   ", 8) != 0) continue;
+
+                sscanf(text, "%s %d %d %d %d %d", dum, &imax, &jmax, &isw, &ise, &ine);
+
+                segments[18*i   ] = plotdata[3*isw-3];
+                segments[18*i+ 1] = plotdata[3*isw-2];
+                segments[18*i+ 2] = plotdata[3*isw-1];
+
+                segments[18*i+ 3] = plotdata[3*ise-3];
+                segments[18*i+ 4] = plotdata[3*ise-2];
+                segments[18*i+ 5] = plotdata[3*ise-1];
+
+                segments[18*i+ 6] = plotdata[3*ise-3];
+                segments[18*i+ 7] = plotdata[3*ise-2];
+                segments[18*i+ 8] = plotdata[3*ise-1];
+
+                segments[18*i+ 9] = plotdata[3*ine-3];
+                segments[18*i+10] = plotdata[3*ine-2];
+                segments[18*i+11] = plotdata[3*ine-1];
+
+                segments[18*i+12] = plotdata[3*ine-3];
+                segments[18*i+13] = plotdata[3*ine-2];
+                segments[18*i+14] = plotdata[3*ine-1];
+
+                segments[18*i+15] = plotdata[3*isw-3];
+                segments[18*i+16] = plotdata[3*isw-2];
+                segments[18*i+17] = plotdata[3*isw-1];
+
+                i++;
+            }
+
+            nitems = 0;
+
+            /* name */
+            snprintf(gpname, MAX_STRVAL_LEN-1, "PlotLine: BDF_CTRI4s");
+
+            /* segments */
+            status = wv_setData(WV_REAL32, 6*i, (void*)segments, WV_VERTICES, &(items[nitems]));
+            if (status != SUCCESS) {
+                SPRINT1(0, "ERROR:: wv_setData -> status=%d", status);
+            }
+
+            free(segments);
+            segments = NULL;
+
+            wv_adjustVerts(&(items[nitems]), sgFocus);
+            nitems++;
+
+            /* line color */
+            color[0] = 0.5;   color[1] = 1.0;   color[2] = 0.5;
+
+            status = wv_setData(WV_REAL32, 1, (void*)color, WV_COLORS, &(items[nitems]));
+            if (status != SUCCESS) {
+                SPRINT1(0, "ERROR:: wv_setData -> status=%d", status);
+            }
+            nitems++;
+
+            /* make graphic primitive and set line width */
+            attrs = WV_ON;
+            igprim = wv_addGPrim(cntxt, gpname, WV_LINE, attrs, nitems, items);
+            if (igprim < 0) {
+                SPRINT2(0, "ERROR:: wv_addGPrim(%s) -> igprim=%d", gpname, igprim);
+            } else {
+                cntxt->gPrims[igprim].lWidth = 1.0;
+            }
+
+            /* add plotdata to meta data (if there is room) */
+            if (STRLEN(sgMetaData) >= sgMetaDataLen-1000) {
+                sgMetaDataLen += MAX_METADATA_CHUNK;
+                RALLOC(sgMetaData, char, sgMetaDataLen);
+                RALLOC(sgTempData, char, sgMetaDataLen);
+            }
+
+            STRNCPY( sgTempData, sgMetaData, sgMetaDataLen);
+            snprintf(sgMetaData, sgMetaDataLen, "%s\"%s\":[],", sgTempData, gpname);
+        }
+
+        /* count the number of CQUAD4s in the file */
+        rewind(fp);
+        ncquad4 = 0;
+        while (1) {
+            if (fgets(text, 80, fp) == NULL) break;
+            if (feof(fp)) break;
+
+            if (strncmp(text, "CQUAD4  ", 8) == 0) {
+                ncquad4++;
+            }
+        }
+        SPRINT1(1, "   there are %d CQUAD4s", ncquad4);
+
+        if (ncquad4 > 0) {
+            segments = (float *) malloc(24*ncquad4*sizeof(float));
+            if (segments == NULL) goto cleanup;
+
+            rewind(fp);
+            i = 0;
+            while (1) {
+                if (fgets(text, 80, fp) == NULL) break;
+                if (feof(fp)) break;
+
+                if (strncmp(text, "CQUAD4  ", 8) != 0) continue;
+
+                sscanf(text, "%s %d %d %d %d %d %d", dum, &imax, &jmax, &isw, &ise, &ine, &inw);
+
+                segments[24*i   ] = plotdata[3*isw-3];
+                segments[24*i+ 1] = plotdata[3*isw-2];
+                segments[24*i+ 2] = plotdata[3*isw-1];
+
+                segments[24*i+ 3] = plotdata[3*ise-3];
+                segments[24*i+ 4] = plotdata[3*ise-2];
+                segments[24*i+ 5] = plotdata[3*ise-1];
+
+                segments[24*i+ 6] = plotdata[3*ise-3];
+                segments[24*i+ 7] = plotdata[3*ise-2];
+                segments[24*i+ 8] = plotdata[3*ise-1];
+
+                segments[24*i+ 9] = plotdata[3*ine-3];
+                segments[24*i+10] = plotdata[3*ine-2];
+                segments[24*i+11] = plotdata[3*ine-1];
+
+                segments[24*i+12] = plotdata[3*ine-3];
+                segments[24*i+13] = plotdata[3*ine-2];
+                segments[24*i+14] = plotdata[3*ine-1];
+
+                segments[24*i+15] = plotdata[3*inw-3];
+                segments[24*i+16] = plotdata[3*inw-2];
+                segments[24*i+17] = plotdata[3*inw-1];
+
+                segments[24*i+18] = plotdata[3*inw-3];
+                segments[24*i+19] = plotdata[3*inw-2];
+                segments[24*i+20] = plotdata[3*inw-1];
+
+                segments[24*i+21] = plotdata[3*isw-3];
+                segments[24*i+22] = plotdata[3*isw-2];
+                segments[24*i+23] = plotdata[3*isw-1];
+
+                i++;
+            }
+
+            nitems = 0;
+
+            /* name */
+            snprintf(gpname, MAX_STRVAL_LEN-1, "PlotLine: BDF_CQUAD4s");
+
+            /* segments */
+            status = wv_setData(WV_REAL32, 8*i, (void*)segments, WV_VERTICES, &(items[nitems]));
+            if (status != SUCCESS) {
+                SPRINT1(0, "ERROR:: wv_setData -> status=%d", status);
+            }
+
+            free(segments);
+            segments = NULL;
+
+            wv_adjustVerts(&(items[nitems]), sgFocus);
+            nitems++;
+
+            /* line color */
+            color[0] = 0.5;   color[1] = 0.5;   color[2] = 1.0;
+
+            status = wv_setData(WV_REAL32, 1, (void*)color, WV_COLORS, &(items[nitems]));
+            if (status != SUCCESS) {
+                SPRINT1(0, "ERROR:: wv_setData -> status=%d", status);
+            }
+            nitems++;
+
+            /* make graphic primitive and set line width */
+            attrs = WV_ON;
+            igprim = wv_addGPrim(cntxt, gpname, WV_LINE, attrs, nitems, items);
+            if (igprim < 0) {
+                SPRINT2(0, "ERROR:: wv_addGPrim(%s) -> igprim=%d", gpname, igprim);
+            } else {
+                cntxt->gPrims[igprim].lWidth = 1.0;
+            }
+
+            /* add plotdata to meta data (if there is room) */
+            if (STRLEN(sgMetaData) >= sgMetaDataLen-1000) {
+                sgMetaDataLen += MAX_METADATA_CHUNK;
+                RALLOC(sgMetaData, char, sgMetaDataLen);
+                RALLOC(sgTempData, char, sgMetaDataLen);
+            }
+
+            STRNCPY( sgTempData, sgMetaData, sgMetaDataLen);
+            snprintf(sgMetaData, sgMetaDataLen, "%s\"%s\":[],", sgTempData, gpname);
+        }
+
+        free(plotdata);
+        plotdata = NULL;
+
+        fclose(fp);
+    }
+
+    /* finish the scene graph meta data */
+    sgMetaData[sgMetaDataLen-1] = '\0';
+    STRNCPY( sgTempData, sgMetaData, sgMetaDataLen);
+    snprintf(sgMetaData, sgMetaDataLen, "%s}", sgTempData);
+
+cleanup:
+    if (plotdata != NULL) free(plotdata);
+    if (segments != NULL) free(segments);
+
+    if (sgface != NULL) {
+        for (jface = 0; jface < nsgface; jface++) {
+            for (i = 0; i < sgface[jface].nitems; i++) {
+                wv_freeItem(&(sgface[jface].items[i]));
+            }
+        }
+        free(sgface);
+    }
+
+
+    return status;
+}
+
+
+/***********************************************************************/
+/*                                                                     */
+/*   buildSceneGraphFace - make the GPrim data for one Face            */
+/*                                                                     */
+/***********************************************************************/
+
+static int
+buildSceneGraphFace(sgFace_T *sgface)   /* (both) Face GPrim data */
+{
+    int       status = SUCCESS;         /* return status */
+
+    int       ibody, iface, newStyleQuads, nitems, npnt, ipnt, ntri, itri, nseg, k;
+    int       oclass, mtype, nchild, *senses, *Tris=NULL, *segs=NULL;
+    int       npatch2, ipatch, n1, n2, i1, i2;
+    CINT      *ptype, *pindx, *tris, *tric, *pvindex, *pbounds;
+    float     color[18], *pcolors=NULL;
+    double    size2, *vel=NULL, velmag, uvlimits[4], ubar, vbar, rcurv;
+    double    data[18], normx, normy, normz;
+    CDOUBLE   *xyz, *uv;
+    ego       etess, eref, prev, next, *echilds;
+
+    wvData    *items = sgface->items;
+
+    modl_T    *MODL = (modl_T*)modl;
+
+    ROUTINE(buildSceneGraphFace);
+
+    /* --------------------------------------------------------------- */
+
+    ibody         = sgface->ibody;
+    iface         = sgface->iface;
+    newStyleQuads = sgface->newStyleQuads;
+    size2         = sgface->size2;
+
+    etess  = MODL->body[ibody].etess;
+    nitems = 0;
+
+    status = EG_getQuads(etess, iface,
+                         &npnt, &xyz, &uv, &ptype, &pindx,
+                         &npatch2);
+    if (status != SUCCESS) {
+        SPRINT3(0, "ERROR:: EG_getQuads(%d,%d) -> status=%d", ibody, iface, status);
+    }
+
+    /* render the Quadrilaterals (if they exist) */
+    if (npatch2 > 0) {
+        /* vertices */
+        status = wv_setData(WV_REAL64, npnt, (void*)xyz, WV_VERTICES, &(items[nitems]));
+        if (status != SUCCESS) {
+            SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
+        }
+
+        wv_adjustVerts(&(items[nitems]), sgFocus);
+        nitems++;
+
+        /* loop through the patches and build up the triangle and
+           segment tables */
+        ntri = 0;
+        nseg = 0;
+
+        for (ipatch = 1; ipatch <= npatch2; ipatch++) {
+            status = EG_getPatch(etess, iface, ipatch, &n1, &n2, &pvindex, &pbounds);
+            if (status != SUCCESS) {
+                SPRINT3(0, "ERROR:: EG_getPatch(%d,%d) -> status=%d\n", ibody, iface, status);
+            }
+
+            ntri += 2 * (n1-1) * (n2-1);
+            nseg += n1 * (n2-1) + n2 * (n1-1);
+        }
+
+        Tris = (int*) malloc(3*ntri*sizeof(int));
+        if (Tris == NULL) {
+            status = EGADS_MALLOC;
+            goto cleanup;
+        }
+
+        segs = (int*) malloc(2*nseg*sizeof(int));
+        if (segs == NULL) {
+            status = EGADS_MALLOC;
+            goto cleanup;
+        }
+
+        ntri = 0;
+        nseg = 0;
+
+        for (ipatch = 1; ipatch <= npatch2; ipatch++) {
+            status = EG_getPatch(etess, iface, ipatch, &n1, &n2, &pvindex, &pbounds);
+            if (status != SUCCESS) {
+                SPRINT3(0, "ERROR:: EG_getPatch(%d,%d) -> status=%d\n", ibody, iface, status);
+            }
+
+            for (i2 = 1; i2 < n2; i2++) {
+                for (i1 = 1; i1 < n1; i1++) {
+                    Tris[3*ntri  ] = pvindex[(i1-1)+n1*(i2-1)];
+                    Tris[3*ntri+1] = pvindex[(i1  )+n1*(i2-1)];
+                    Tris[3*ntri+2] = pvindex[(i1  )+n1*(i2  )];
+                    ntri++;
+
+                    Tris[3*ntri  ] = pvindex[(i1  )+n1*(i2  )];
+                    Tris[3*ntri+1] = pvindex[(i1-1)+n1*(i2  )];
+                    Tris[3*ntri+2] = pvindex[(i1-1)+n1*(i2-1)];
+                    ntri++;
+                }
+            }
+
+            for (i2 = 0; i2 < n2; i2++) {
+                for (i1 = 1; i1 < n1; i1++) {
+                    segs[2*nseg  ] = pvindex[(i1-1)+n1*(i2)];
+                    segs[2*nseg+1] = pvindex[(i1  )+n1*(i2)];
+                    nseg++;
+                }
+            }
+
+            for (i1 = 0; i1 < n1; i1++) {
+                for (i2 = 1; i2 < n2; i2++) {
+                    segs[2*nseg  ] = pvindex[(i1)+n1*(i2-1)];
+                    segs[2*nseg+1] = pvindex[(i1)+n1*(i2  )];
+                    nseg++;
+                }
+            }
+        }
+
+        /* two triangles for rendering each quadrilateral */
+        status = wv_setData(WV_INT32, 3*ntri, (void*)Tris, WV_INDICES, &(items[nitems]));
+        if (status != SUCCESS) {
+            SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
+        }
+        nitems++;
+
+        free(Tris);
+        Tris = NULL;
+
+    /* render the Quadrilaterals if new-style quadding */
+    } else if (newStyleQuads == 1) {
+        status = EG_getTessFace(etess, iface,
+                                &npnt, &xyz, &uv, &ptype, &pindx,
+                                &ntri, &tris, &tric);
+        if (status != SUCCESS) {
+            SPRINT3(0, "ERROR:: EG_getTessFace(%d,%d) -> status=%d", ibody, iface, status);
+        }
+
+        /* skip if no Triangles either */
+        if (ntri <= 0) {
+            status = SUCCESS;
+            goto cleanup;
+        }
+
+        /* vertices */
+        status = wv_setData(WV_REAL64, npnt, (void*)xyz, WV_VERTICES, &(items[nitems]));
+        if (status != SUCCESS) {
+            SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
+        }
+
+        wv_adjustVerts(&(items[nitems]), sgFocus);
+        nitems++;
+
+        /* loop through the triangles and build up the segment table */
+        nseg = 0;
+        for (itri = 0; itri < ntri; itri++) {
+            for (k = 0; k < 3; k++) {
+                if (tric[3*itri+k] < itri+1) {
+                    nseg++;
+                }
+            }
+        }
+
+        segs = (int*) malloc(2*nseg*sizeof(int));
+        if (segs == NULL) {
+            status = EGADS_MALLOC;
+            goto cleanup;
+        }
+
+        /* create segments between Triangles (but not within the pair) */
+        nseg = 0;
+        for (itri = 0; itri < ntri; itri++) {
+            if (tric[3*itri  ] < itri+2) {
+                segs[2*nseg  ] = tris[3*itri+1];
+                segs[2*nseg+1] = tris[3*itri+2];
+                nseg++;
+            }
+            if (tric[3*itri+1] < itri+2) {
+                segs[2*nseg  ] = tris[3*itri+2];
+                segs[2*nseg+1] = tris[3*itri  ];
+                nseg++;
+            }
+            if (tric[3*itri+2] < itri+2) {
+                segs[2*nseg  ] = tris[3*itri  ];
+                segs[2*nseg+1] = tris[3*itri+1];
+                nseg++;
+            }
+            itri++;
+
+            if (tric[3*itri  ] < itri) {
+                segs[2*nseg  ] = tris[3*itri+1];
+                segs[2*nseg+1] = tris[3*itri+2];
+                nseg++;
+            }
+            if (tric[3*itri+1] < itri) {
+                segs[2*nseg  ] = tris[3*itri+2];
+                segs[2*nseg+1] = tris[3*itri  ];
+                nseg++;
+            }
+            if (tric[3*itri+2] < itri) {
+                segs[2*nseg  ] = tris[3*itri  ];
+                segs[2*nseg+1] = tris[3*itri+1];
+                nseg++;
+            }
+        }
+
+        /* triangles */
+        status = wv_setData(WV_INT32, 3*ntri, (void*)tris, WV_INDICES, &(items[nitems]));
+        if (status != SUCCESS) {
+            SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
+        }
+        nitems++;
+
+    /* render the Triangles (if quads do not exist) */
+    } else {
+        status = EG_getTessFace(etess, iface,
+                                &npnt, &xyz, &uv, &ptype, &pindx,
+                                &ntri, &tris, &tric);
+        if (status != SUCCESS) {
+            SPRINT3(0, "ERROR:: EG_getTessFace(%d,%d) -> status=%d", ibody, iface, status);
+        }
+
+        /* skip if no Triangles either */
+        if (ntri <= 0) {
+            status = SUCCESS;
+            goto cleanup;
+        }
+
+        /* vertices */
+        status = wv_setData(WV_REAL64, npnt, (void*)xyz, WV_VERTICES, &(items[nitems]));
+        if (status != SUCCESS) {
+            SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
+        }
+
+        wv_adjustVerts(&(items[nitems]), sgFocus);
+        nitems++;
+
+        /* loop through the triangles and build up the segment table */
+        nseg = 0;
+        for (itri = 0; itri < ntri; itri++) {
+            for (k = 0; k < 3; k++) {
+                if (tric[3*itri+k] < itri+1) {
+                    nseg++;
+                }
+            }
+        }
+
+        segs = (int*) malloc(2*nseg*sizeof(int));
+        if (segs == NULL) {
+            status = EGADS_MALLOC;
+            goto cleanup;
+        }
+
+        nseg = 0;
+        for (itri = 0; itri < ntri; itri++) {
+            for (k = 0; k < 3; k++) {
+                if (tric[3*itri+k] < itri+1) {
+                    segs[2*nseg  ] = tris[3*itri+(k+1)%3];
+                    segs[2*nseg+1] = tris[3*itri+(k+2)%3];
+                    nseg++;
+                }
+            }
+        }
+
+        /* triangles */
+        status = wv_setData(WV_INT32, 3*ntri, (void*)tris, WV_INDICES, &(items[nitems]));
         if (status != SUCCESS) {
-            SPRINT1(0, "ERROR:: wv_setData -> status=%d", status);
+            SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
         }
-
-        wv_adjustVerts(&(items[nitems]), sgFocus);
         nitems++;
+    }
 
-        /* point color */
-        color[0] = 0;   color[1] = 0;   color[2] = 0;
+    /* smooth colors (sensitivities) */
+    if (haveDots >= 1) {
+        sensPost = 1;
 
-        status = wv_setData(WV_REAL32, 1, (void*)color, WV_COLORS, &(items[nitems]));
+        status = EG_getTessFace(etess, iface,
+                                &npnt, &xyz, &uv, &ptype, &pindx,
+                                &ntri, &tris, &tric);
         if (status != SUCCESS) {
-            SPRINT1(0, "ERROR:: wv_setData -> status=%d", status);
+            SPRINT3(0, "ERROR:: EG_getTessFace(%d,%d) -> status=%d", ibody, iface, status);
+            goto cleanup;
         }
-        nitems++;
 
-        /* make graphic primitive */
-        attrs  = WV_ON;
-        igprim = wv_addGPrim(cntxt, gpname, WV_POINT, attrs, nitems, items);
-        if (igprim < 0) {
-            SPRINT2(0, "ERROR:: wv_addGPrim(%s) -> igprim=%d", gpname, igprim);
-        } else {
-            cntxt->gPrims[igprim].pSize = 3.0;
+        status = EG_getInfo(MODL->body[ibody].face[iface].eface,
+                            &oclass, &mtype, &eref, &prev, &next);
+        if (status != SUCCESS) {
+            SPRINT3(0, "ERROR:: EG_getInfo(%d,%d) -> status=%d", ibody, iface, status);
+            goto cleanup;
         }
 
-        /* add plotdata to meta data (if there is room) */
-        if (STRLEN(sgMetaData) >= sgMetaDataLen-1000) {
-            sgMetaDataLen += MAX_METADATA_CHUNK;
-            RALLOC(sgMetaData, char, sgMetaDataLen);
-            RALLOC(sgTempData, char, sgMetaDataLen);
+        pcolors = (float *) malloc(3*npnt*sizeof(float));
+        if (pcolors == NULL) {
+            SPRINT0(0, "MALLOC error");
+            status = EGADS_MALLOC;
+            goto cleanup;
         }
 
-        STRNCPY( sgTempData, sgMetaData, sgMetaDataLen);
-        snprintf(sgMetaData, sgMetaDataLen, "%s\"%s\":[],", sgTempData, gpname);
-
-        /* count the number of CRODs in the file */
-        rewind(fp);
-        ncrod = 0;
-        while (1) {
-            if (fgets(text, 80, fp) == NULL) break;
-            if (feof(fp)) break;
+        if (sensTess == 0) {
+            vel = (double *) malloc(3*npnt*sizeof(double));
+            if (vel == NULL) {
+                SPRINT0(0, "MALLOC error");
+                status = EGADS_MALLOC;
+                goto cleanup;
+            }
 
-            if (strncmp(text, "CROD    ", 8) == 0) {
-                ncrod++;
+            status = ocsmGetVel(MODL, ibody, OCSM_FACE, iface, npnt, NULL, vel);
+            if (status != SUCCESS) {
+                SPRINT3(0, "ERROR:: ocsmGetVel(%d,%d) -> status=%d", ibody, iface, status);
+                goto cleanup;
+            }
+        } else {
+            status = ocsmGetTessVel(MODL, ibody, OCSM_FACE, iface, (const double**)(&vel));
+            if (status != SUCCESS) {
+                SPRINT3(0, "ERROR:: ocsmGetTessVel(%d,%d) -> status=%d", ibody, iface, status);
+                goto cleanup;
             }
         }
-        SPRINT1(1, "   there are %d CRODs", ncrod);
 
-        if (ncrod > 0) {
-            segments = (float *) malloc(6*ncrod*sizeof(float));
-            if (segments == NULL) goto cleanup;
+        /* special plotting of tufts for sensitivities (adjust DESPMTR velocity
+           to adjust tuft length) */
+#ifdef SHOW_TUFTS
+        if (sensTess == 0) {
+            float  *ptufts;
+            int    nitems1=0, attrs1, igprim;
+            char   gpname1[MAX_STRVAL_LEN];
+            wvData items1[6];
+
+            ptufts = (float *) malloc(6*npnt*sizeof(float));
+            if (ptufts == NULL) {
+                SPRINT0(0, "MALLOC error");
+                status = EGADS_MALLOC;
+                goto cleanup;
+            }
 
-            rewind(fp);
-            i = 0;
-            while (1) {
-                if (fgets(text, 80, fp) == NULL) break;
-                if (feof(fp)) break;
+            for (ipnt = 0; ipnt < npnt; ipnt++) {
+                ptufts[6*ipnt  ] = xyz[3*ipnt  ];
+                ptufts[6*ipnt+1] = xyz[3*ipnt+1];
+                ptufts[6*ipnt+2] = xyz[3*ipnt+2];
 
-                if (strncmp(text, "CROD    ", 8) != 0) continue;
+                ptufts[6*ipnt+3] = xyz[3*ipnt  ] + vel[3*ipnt  ];
+                ptufts[6*ipnt+4] = xyz[3*ipnt+1] + vel[3*ipnt+1];
+                ptufts[6*ipnt+5] = xyz[3*ipnt+2] + vel[3*ipnt+2];
+            }
 
-                sscanf(text, "%s %d %d %d %d", dum, &imax, &jmax, &ibeg, &iend);
+            color[0] = 0;
+            color[1] = 0;
+            color[2] = 0;
+            status = wv_setData(WV_REAL32, 1, (void*)color, WV_COLORS, &(items1[nitems1]));
+            if (status != SUCCESS) {
+                SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
+            }
+            nitems1++;
 
-                segments[6*i  ] = plotdata[3*ibeg-3];
-                segments[6*i+1] = plotdata[3*ibeg-2];
-                segments[6*i+2] = plotdata[3*ibeg-1];
+            status = wv_setData(WV_REAL32, 2*npnt, (void*)ptufts, WV_VERTICES, &(items1[nitems1]));
+            if (status != SUCCESS) {
+                SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
+            }
+            wv_adjustVerts(&(items1[nitems1]), sgFocus);
+            nitems1++;
 
-                segments[6*i+3] = plotdata[3*iend-3];
-                segments[6*i+4] = plotdata[3*iend-2];
-                segments[6*i+5] = plotdata[3*iend-1];
+            snprintf(gpname1, MAX_STRVAL_LEN-1, "Tufts_%d:%d", ibody, iface);
+            attrs1 = WV_ON;
 
-                i++;
+            igprim = wv_addGPrim(cntxt, gpname1, WV_LINE, attrs1, nitems1, items1);
+            if (igprim < 0) {
+                SPRINT2(0, "ERROR:: wv_addGPrim(%s) -> igprim=%d", gpname1, igprim);
+            } else {
+                cntxt->gPrims[igprim].lWidth = 1.0;
             }
 
-            nitems = 0;
+            free(ptufts);
+        }
+#endif
 
-            /* name */
-            snprintf(gpname, MAX_STRVAL_LEN-1, "PlotLine: BDF_CRODs");
+        for (ipnt = 0; ipnt < npnt; ipnt++) {
+            /* correct for NaN */
+            if (vel[3*ipnt  ] != vel[3*ipnt  ] ||
+                vel[3*ipnt+1] != vel[3*ipnt+1] ||
+                vel[3*ipnt+2] != vel[3*ipnt+2]   ) {
+                SPRINT1(0, "WARNING:: vel[%d] = NaN (being changed to 0)", ipnt);
+                velmag = 0;
+
+            /* find signed velocity magnitude */
+            } else if (sensTess == 0) {
+                status = EG_evaluate(MODL->body[ibody].face[iface].eface, &(uv[2*ipnt]), data);
+                if (status != SUCCESS) {
+                    SPRINT3(0, "ERROR:: EG_evaluate(%d,%d) -> srtatus=%d", ibody, iface, status);
+                    goto cleanup;
+                }
 
-            /* segments */
-            status = wv_setData(WV_REAL32, 2*i, (void*)segments, WV_VERTICES, &(items[nitems]));
-            if (status != SUCCESS) {
-                SPRINT1(0, "ERROR:: wv_setData -> status=%d", status);
+                normx  = data[4] * data[8] - data[5] * data[7];
+                normy  = data[5] * data[6] - data[3] * data[8];
+                normz  = data[3] * data[7] - data[4] * data[6];
+
+                velmag = mtype * ( vel[3*ipnt  ] * normx
+                                  +vel[3*ipnt+1] * normy
+                                  +vel[3*ipnt+2] * normz)
+                       / sqrt(normx * normx + normy * normy + normz * normz);
+
+                if (velmag != velmag) {
+                    SPRINT1(0, "WARNING:: vel[%d] = NaN (being changed to 0)", ipnt);
+                    velmag = 0;
+                }
+
+            /* find unsigned velocity magnitude */
+            } else {
+                velmag = sqrt( vel[3*ipnt  ] * vel[3*ipnt  ]
+                             + vel[3*ipnt+1] * vel[3*ipnt+1]
+                             + vel[3*ipnt+2] * vel[3*ipnt+2]);
             }
 
-            free(segments);
-            segments = NULL;
+            spec_col((float)(velmag), &(pcolors[3*ipnt]));
 
-            wv_adjustVerts(&(items[nitems]), sgFocus);
-            nitems++;
+            if (velmag < sensLo) sensLo = velmag;
+            if (velmag > sensHi) sensHi = velmag;
+        }
 
-            /* line color */
-            color[0] = 1.0;   color[1] = 0.5;   color[2] = 0.5;
+        status = wv_setData(WV_REAL32, npnt, (void*)pcolors, WV_COLORS, &(items[nitems]));
+        if (status != SUCCESS) {
+            SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
+        }
+        nitems++;
 
-            status = wv_setData(WV_REAL32, 1, (void*)color, WV_COLORS, &(items[nitems]));
-            if (status != SUCCESS) {
-                SPRINT1(0, "ERROR:: wv_setData -> status=%d", status);
-            }
-            nitems++;
+        free(pcolors);
+        pcolors = NULL;
+        if (sensTess == 0) {
+            free(vel);
+            vel = NULL;
+        }
 
-            /* make graphic primitive and set line width */
-            attrs = WV_ON;
-            igprim = wv_addGPrim(cntxt, gpname, WV_LINE, attrs, nitems, items);
-            if (igprim < 0) {
-                SPRINT2(0, "ERROR:: wv_addGPrim(%s) -> igprim=%d", gpname, igprim);
-            } else {
-                cntxt->gPrims[igprim].lWidth = 1.0;
-            }
+    /* smooth colors (normalized U) */
+    } else if (plotType == 1) {
+        status = EG_getTessFace(etess, iface,
+                                &npnt, &xyz, &uv, &ptype, &pindx,
+                                &ntri, &tris, &tric);
+        if (status != SUCCESS) {
+            SPRINT3(0, "ERROR:: EG_getTessFace(%d,%d) -> status=%d", ibody, iface, status);
+            goto cleanup;
+        }
 
-            /* add plotdata to meta data (if there is room) */
-            if (STRLEN(sgMetaData) >= sgMetaDataLen-1000) {
-                sgMetaDataLen += MAX_METADATA_CHUNK;
-                RALLOC(sgMetaData, char, sgMetaDataLen);
-                RALLOC(sgTempData, char, sgMetaDataLen);
-            }
+        status = EG_getTopology(MODL->body[ibody].face[iface].eface,
+                                &eref, &oclass, &mtype, uvlimits,
+                                &nchild, &echilds, &senses);
+        if (status != SUCCESS) {
+            SPRINT3(0, "ERROR::EG_getTopology(%d,%d) -> status=%d", ibody, iface, status);
+            goto cleanup;
+        }
 
-            STRNCPY( sgTempData, sgMetaData, sgMetaDataLen);
-            snprintf(sgMetaData, sgMetaDataLen, "%s\"%s\":[],", sgTempData, gpname);
+        pcolors = (float *) malloc(3*npnt*sizeof(float));
+        if (pcolors == NULL) {
+            SPRINT0(0, "MALLOC error");
+            status = EGADS_MALLOC;
+            goto cleanup;
         }
 
-        /* count the number of CTRI3s in the file */
-        rewind(fp);
-        nctri3 = 0;
-        while (1) {
-            if (fgets(text, 80, fp) == NULL) break;
-            if (feof(fp)) break;
+        for (ipnt = 0; ipnt < npnt; ipnt++) {
+            ubar = (uv[2*ipnt  ] - uvlimits[0]) / (uvlimits[1] - uvlimits[0]);
+            spec_col((float)(ubar), &(pcolors[3*ipnt]));
+        }
 
-            if (strncmp(text, "CTRI3   ", 8) == 0) {
-                nctri3++;
-            }
+        status = wv_setData(WV_REAL32, npnt, (void*)pcolors, WV_COLORS, &(items[nitems]));
+        if (status != SUCCESS) {
+            SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
         }
-        SPRINT1(1, "   there are %d CTRI3s", nctri3);
+        nitems++;
 
-        if (nctri3 > 0) {
-            segments = (float *) malloc(18*nctri3*sizeof(float));
-            if (segments == NULL) goto cleanup;
+        free(pcolors);
+        pcolors = NULL;
 
-            rewind(fp);
-            i = 0;
-            while (1) {
-                if (fgets(text, 80, fp) == NULL) break;
-                if (feof(fp)) break;
+    /* smooth colors (normalized V) */
+    } else if (plotType == 2) {
+        status = EG_getTessFace(etess, iface,
+                                &npnt, &xyz, &uv, &ptype, &pindx,
+                                &ntri, &tris, &tric);
+        if (status != SUCCESS) {
+            SPRINT3(0, "ERROR:: EG_getTessFace(%d,%d) -> status=%d", ibody, iface, status);
+            goto cleanup;
+        }
 
-                if (strncmp(text, "CTRI3   ", 8) != 0) continue;
+        status = EG_getTopology(MODL->body[ibody].face[iface].eface,
+                                &eref, &oclass, &mtype, uvlimits,
+                                &nchild, &echilds, &senses);
+        if (status != SUCCESS) {
+            SPRINT3(0, "ERROR:: EG_getTopology(%d,%d) -> status=%d", ibody, iface, status);
+            goto cleanup;
+        }
 
-                sscanf(text, "%s %d %d %d %d %d", dum, &imax, &jmax, &isw, &ise, &ine);
+        pcolors = (float *) malloc(3*npnt*sizeof(float));
+        if (pcolors == NULL) {
+            SPRINT0(0, "MALLOC error");
+            status = EGADS_MALLOC;
+            goto cleanup;
+        }
 
-                segments[18*i   ] = plotdata[3*isw-3];
-                segments[18*i+ 1] = plotdata[3*isw-2];
-                segments[18*i+ 2] = plotdata[3*isw-1];
+        for (ipnt = 0; ipnt < npnt; ipnt++) {
+            vbar = (uv[2*ipnt+1] - uvlimits[2]) / (uvlimits[3] - uvlimits[2]);
+            spec_col((float)(vbar), &(pcolors[3*ipnt]));
+        }
 
-                segments[18*i+ 3] = plotdata[3*ise-3];
-                segments[18*i+ 4] = plotdata[3*ise-2];
-                segments[18*i+ 5] = plotdata[3*ise-1];
+        status = wv_setData(WV_REAL32, npnt, (void*)pcolors, WV_COLORS, &(items[nitems]));
+        if (status != SUCCESS) {
+            SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
+        }
+        nitems++;
 
-                segments[18*i+ 6] = plotdata[3*ise-3];
-                segments[18*i+ 7] = plotdata[3*ise-2];
-                segments[18*i+ 8] = plotdata[3*ise-1];
+        free(pcolors);
+        pcolors = NULL;
 
-                segments[18*i+ 9] = plotdata[3*ine-3];
-                segments[18*i+10] = plotdata[3*ine-2];
-                segments[18*i+11] = plotdata[3*ine-1];
+    /* smooth colors (minimum Curv) */
+    } else if (plotType == 3) {
+        status = EG_getTessFace(etess, iface,
+                                &npnt, &xyz, &uv, &ptype, &pindx,
+                                &ntri, &tris, &tric);
+        if (status != SUCCESS) {
+            SPRINT3(0, "ERROR:: EG_getTessFace(%d,%d) -> status=%d", ibody, iface, status);
+            goto cleanup;
+        }
 
-                segments[18*i+12] = plotdata[3*ine-3];
-                segments[18*i+13] = plotdata[3*ine-2];
-                segments[18*i+14] = plotdata[3*ine-1];
+        pcolors = (float *) malloc(3*npnt*sizeof(float));
+        if (pcolors == NULL) {
+            SPRINT0(0, "MALLOC error");
+            status = EGADS_MALLOC;
+            goto cleanup;
+        }
 
-                segments[18*i+15] = plotdata[3*isw-3];
-                segments[18*i+16] = plotdata[3*isw-2];
-                segments[18*i+17] = plotdata[3*isw-1];
+        for (ipnt = 0; ipnt < npnt; ipnt++) {
+            status = EG_curvature(MODL->body[ibody].face[iface].eface,
+                                  &(uv[2*ipnt]), data);
+            if (status != SUCCESS) {
+                rcurv = 0;
+            } else {
+                rcurv = MIN(data[0], data[4]) * sqrt(size2);
+            }
+            spec_col((float)(rcurv), &(pcolors[3*ipnt]));
+        }
 
-                i++;
+        status = wv_setData(WV_REAL32, npnt, (void*)pcolors, WV_COLORS, &(items[nitems]));
+        if (status != SUCCESS) {
+            SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
+        }
+        nitems++;
+
+        free(pcolors);
+        pcolors = NULL;
+
+    /* smooth colors (maximum Curv) */
+    } else if (plotType == 4) {
+        status = EG_getTessFace(etess, iface,
+                                &npnt, &xyz, &uv, &ptype, &pindx,
+                                &ntri, &tris, &tric);
+        if (status != SUCCESS) {
+            SPRINT3(0, "ERROR:: EG_getTessFace(%d,%d) -> status=%d", ibody, iface, status);
+            goto cleanup;
+        }
+
+        pcolors = (float *) malloc(3*npnt*sizeof(float));
+        if (pcolors == NULL) {
+            SPRINT0(0, "MALLOC error");
+            status = EGADS_MALLOC;
+            goto cleanup;
+        }
+
+        for (ipnt = 0; ipnt < npnt; ipnt++) {
+            status = EG_curvature(MODL->body[ibody].face[iface].eface,
+                                  &(uv[2*ipnt]), data);
+            if (status != SUCCESS) {
+                rcurv = 0;
+            } else {
+                rcurv = MAX(data[0], data[4]) * sqrt(size2);
             }
+            spec_col((float)(rcurv), &(pcolors[3*ipnt]));
+        }
+        status = wv_setData(WV_REAL32, npnt, (void*)pcolors, WV_COLORS, &(items[nitems]));
+        if (status != SUCCESS) {
+            SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
+        }
+        nitems++;
 
-            nitems = 0;
+        free(pcolors);
+        pcolors = NULL;
 
-            /* name */
-            snprintf(gpname, MAX_STRVAL_LEN-1, "PlotLine: BDF_CTRI4s");
+    /* smooth colors (Gaussian Curv) */
+    } else if (plotType == 5) {
+        status = EG_getTessFace(etess, iface,
+                                &npnt, &xyz, &uv, &ptype, &pindx,
+                                &ntri, &tris, &tric);
+        if (status != SUCCESS) {
+            SPRINT3(0, "ERROR:: EG_getTessFace(%d,%d) -> status=%d", ibody, iface, status);
+            goto cleanup;
+        }
 
-            /* segments */
-            status = wv_setData(WV_REAL32, 6*i, (void*)segments, WV_VERTICES, &(items[nitems]));
+        pcolors = (float *) malloc(3*npnt*sizeof(float));
+        if (pcolors == NULL) {
+            SPRINT0(0, "MALLOC error");
+            status = EGADS_MALLOC;
+            goto cleanup;
+        }
+
+        for (ipnt = 0; ipnt < npnt; ipnt++) {
+            status = EG_curvature(MODL->body[ibody].face[iface].eface,
+                                  &(uv[2*ipnt]), data);
             if (status != SUCCESS) {
-                SPRINT1(0, "ERROR:: wv_setData -> status=%d", status);
+                rcurv = 0;
+            } else if (MIN(fabs(data[0]), fabs(data[4])) < 0.00001 * MAX(fabs(data[0]), fabs(data[4]))) {
+                rcurv = 0;
+            } else if (data[0]*data[4] > 0) {
+                rcurv = +pow(fabs(data[0]*data[4]*size2), 0.25);
+            } else if (data[0]*data[4] < 0) {
+                rcurv = -pow(fabs(data[0]*data[4]*size2), 0.25);
+            } else {
+                rcurv = 0;
             }
+            spec_col((float)(rcurv), &(pcolors[3*ipnt]));
+        }
+        status = wv_setData(WV_REAL32, npnt, (void*)pcolors, WV_COLORS, &(items[nitems]));
+        if (status != SUCCESS) {
+            SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
+        }
+        nitems++;
+
+        free(pcolors);
+        pcolors = NULL;
+
+    /* constant triangle colors */
+    } else {
+        color[0] = RED(  MODL->body[ibody].face[iface].gratt.color);
+        color[1] = GREEN(MODL->body[ibody].face[iface].gratt.color);
+        color[2] = BLUE( MODL->body[ibody].face[iface].gratt.color);
+        status = wv_setData(WV_REAL32, 1, (void*)color, WV_COLORS, &(items[nitems]));
+        if (status != SUCCESS) {
+            SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
+        }
+        nitems++;
+    }
 
-            free(segments);
-            segments = NULL;
+    /* triangle backface color */
+    color[0] = RED(  MODL->body[ibody].face[iface].gratt.bcolor);
+    color[1] = GREEN(MODL->body[ibody].face[iface].gratt.bcolor);
+    color[2] = BLUE( MODL->body[ibody].face[iface].gratt.bcolor);
+    status = wv_setData(WV_REAL32, 1, (void*)color, WV_BCOLOR, &(items[nitems]));
+    if (status != SUCCESS) {
+        SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
+    }
+    nitems++;
 
-            wv_adjustVerts(&(items[nitems]), sgFocus);
-            nitems++;
+    /* segment indices */
+    status = wv_setData(WV_INT32, 2*nseg, (void*)segs, WV_LINDICES, &(items[nitems]));
+    if (status != SUCCESS) {
+        SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
+    }
+    nitems++;
 
-            /* line color */
-            color[0] = 0.5;   color[1] = 1.0;   color[2] = 0.5;
+    free(segs);
+    segs = NULL;
 
-            status = wv_setData(WV_REAL32, 1, (void*)color, WV_COLORS, &(items[nitems]));
-            if (status != SUCCESS) {
-                SPRINT1(0, "ERROR:: wv_setData -> status=%d", status);
-            }
-            nitems++;
+    /* segment colors */
+    color[0] = RED(  MODL->body[ibody].face[iface].gratt.mcolor);
+    color[1] = GREEN(MODL->body[ibody].face[iface].gratt.mcolor);
+    color[2] = BLUE( MODL->body[ibody].face[iface].gratt.mcolor);
+    status = wv_setData(WV_REAL32, 1, (void*)color, WV_LCOLOR, &(items[nitems]));
+    if (status != SUCCESS) {
+        SPRINT3(0, "ERROR:: wv_setData(%d,%d) -> status=%d", ibody, iface, status);
+    }
+    nitems++;
 
-            /* make graphic primitive and set line width */
-            attrs = WV_ON;
-            igprim = wv_addGPrim(cntxt, gpname, WV_LINE, attrs, nitems, items);
-            if (igprim < 0) {
-                SPRINT2(0, "ERROR:: wv_addGPrim(%s) -> igprim=%d", gpname, igprim);
-            } else {
-                cntxt->gPrims[igprim].lWidth = 1.0;
-            }
+    status = SUCCESS;
 
-            /* add plotdata to meta data (if there is room) */
-            if (STRLEN(sgMetaData) >= sgMetaDataLen-1000) {
-                sgMetaDataLen += MAX_METADATA_CHUNK;
-                RALLOC(sgMetaData, char, sgMetaDataLen);
-                RALLOC(sgTempData, char, sgMetaDataLen);
-            }
+cleanup:
+    if (Tris    != NULL) free(Tris   );
+    if (segs    != NULL) free(segs   );
+    if (pcolors != NULL) free(pcolors);
+    if (vel != NULL && sensTess == 0) free(vel);
 
-            STRNCPY( sgTempData, sgMetaData, sgMetaDataLen);
-            snprintf(sgMetaData, sgMetaDataLen, "%s\"%s\":[],", sgTempData, gpname);
+    /* the Face is only drawn if all of its data were made */
+    if (status != SUCCESS) {
+        for (k = 0; k < nitems; k++) {
+            wv_freeItem(&(items[k]));
         }
+        nitems = 0;
+    }
+    sgface->nitems = nitems;
 
-        /* count the number of CQUAD4s in the file */
-        rewind(fp);
-        ncquad4 = 0;
-        while (1) {
-            if (fgets(text, 80, fp) == NULL) break;
-            if (feof(fp)) break;
+    return status;
+}
 
-            if (strncmp(text, "CQUAD4  ", 8) == 0) {
-                ncquad4++;
-            }
-        }
-        SPRINT1(1, "   there are %d CQUAD4s", ncquad4);
 
-        if (ncquad4 > 0) {
-            segments = (float *) malloc(24*ncquad4*sizeof(float));
-            if (segments == NULL) goto cleanup;
+/***********************************************************************/
+/*                                                                     */
+/*   buildSceneGraphFaces - make the GPrim data for all Faces          */
+/*                                                                     */
+/***********************************************************************/
 
-            rewind(fp);
-            i = 0;
-            while (1) {
-                if (fgets(text, 80, fp) == NULL) break;
-                if (feof(fp)) break;
+static int
+buildSceneGraphFaces(int      *nsgface, /* (out) number of Faces */
+                     sgFace_T **sgface) /* (out) array  of Face GPrim data (freeable) */
+{
+    int       status = SUCCESS;         /* return status */
 
-                if (strncmp(text, "CQUAD4  ", 8) != 0) continue;
+    int       ibody, iface, nface, atype, alen, newStyleQuads, npnt, ntri, i, np;
+    int       *order=NULL;
+    long      start;
+    double    box[6], size2=0;
+    void      **threads=NULL;
+    CINT      *ptype, *pindx, *tris, *tric;
+    CDOUBLE   *xyz, *uv;
+    sgFace_T  *sgf=NULL;
+    sgThread_T sgthread;
 
-                sscanf(text, "%s %d %d %d %d %d %d", dum, &imax, &jmax, &isw, &ise, &ine, &inw);
+    CINT      *tempIlist;
+    CDOUBLE   *tempRlist;
+    CCHAR     *tempClist;
 
-                segments[24*i   ] = plotdata[3*isw-3];
-                segments[24*i+ 1] = plotdata[3*isw-2];
-                segments[24*i+ 2] = plotdata[3*isw-1];
+    modl_T    *MODL = (modl_T*)modl;
 
-                segments[24*i+ 3] = plotdata[3*ise-3];
-                segments[24*i+ 4] = plotdata[3*ise-2];
-                segments[24*i+ 5] = plotdata[3*ise-1];
+    ROUTINE(buildSceneGraphFaces);
 
-                segments[24*i+ 6] = plotdata[3*ise-3];
-                segments[24*i+ 7] = plotdata[3*ise-2];
-                segments[24*i+ 8] = plotdata[3*ise-1];
+    /* --------------------------------------------------------------- */
 
-                segments[24*i+ 9] = plotdata[3*ine-3];
-                segments[24*i+10] = plotdata[3*ine-2];
-                segments[24*i+11] = plotdata[3*ine-1];
+    *nsgface = 0;
+    *sgface  = NULL;
 
-                segments[24*i+12] = plotdata[3*ine-3];
-                segments[24*i+13] = plotdata[3*ine-2];
-                segments[24*i+14] = plotdata[3*ine-1];
+    /* one entry for each Face of the Bodys on the stack (in the order
+       that buildSceneGraph visits them) */
+    nface = 0;
+    for (ibody = 1; ibody <= MODL->nbody; ibody++) {
+        if (MODL->body[ibody].onstack != 1) continue;
 
-                segments[24*i+15] = plotdata[3*inw-3];
-                segments[24*i+16] = plotdata[3*inw-2];
-                segments[24*i+17] = plotdata[3*inw-1];
+        nface += MODL->body[ibody].nface;
+    }
 
-                segments[24*i+18] = plotdata[3*inw-3];
-                segments[24*i+19] = plotdata[3*inw-2];
-                segments[24*i+20] = plotdata[3*inw-1];
+    if (nface == 0) goto cleanup;
 
-                segments[24*i+21] = plotdata[3*isw-3];
-                segments[24*i+22] = plotdata[3*isw-2];
-                segments[24*i+23] = plotdata[3*isw-1];
+    MALLOC(sgf,   sgFace_T,   nface);
+    MALLOC(order, int,      2*nface);
 
-                i++;
+    *nsgface = nface;
+    *sgface  = sgf;
+
+    nface = 0;
+    for (ibody = 1; ibody <= MODL->nbody; ibody++) {
+        if (MODL->body[ibody].onstack != 1) continue;
+
+        /* get bounding box info if non-zero plottype */
+        if (plotType > 0) {
+            box[0] = box[1] = box[2] = 0;
+            box[3] = box[4] = box[5] = 1;
+            status = EG_getBoundingBox(MODL->body[ibody].ebody, box);
+            if (status != SUCCESS) {
+                SPRINT2(0, "ERROR:: EG_getBoundingBox(%d) -> status=%d", ibody, status);
             }
 
-            nitems = 0;
+            size2 = (box[3] - box[0]) * (box[3] - box[0])
+                  + (box[4] - box[1]) * (box[4] - box[1])
+                  + (box[5] - box[2]) * (box[5] - box[2]);
+        }
 
-            /* name */
-            snprintf(gpname, MAX_STRVAL_LEN-1, "PlotLine: BDF_CQUAD4s");
+        /* determine if new-style quadding */
+        newStyleQuads = 0;
+        status = EG_attributeRet(MODL->body[ibody].etess, ".tessType",
+                                 &atype, &alen, &tempIlist, &tempRlist, &tempClist);
+        if (status == SUCCESS) {
+            if (strcmp(tempClist, "Quad") == 0) {
+                newStyleQuads = 1;
+            }
+        }
 
-            /* segments */
-            status = wv_setData(WV_REAL32, 8*i, (void*)segments, WV_VERTICES, &(items[nitems]));
+        for (iface = 1; iface <= MODL->body[ibody].nface; iface++) {
+            sgf[nface].ibody         = ibody;
+            sgf[nface].iface         = iface;
+            sgf[nface].newStyleQuads = newStyleQuads;
+            sgf[nface].size2         = size2;
+            sgf[nface].status        = SUCCESS;
+            sgf[nface].nitems        = 0;
+
+            /* the number of points is a good measure of the work */
+            status = EG_getTessFace(MODL->body[ibody].etess, iface,
+                                    &npnt, &xyz, &uv, &ptype, &pindx,
+                                    &ntri, &tris, &tric);
             if (status != SUCCESS) {
-                SPRINT1(0, "ERROR:: wv_setData -> status=%d", status);
+                npnt = 0;
             }
 
-            free(segments);
-            segments = NULL;
+            order[2*nface  ] = npnt;
+            order[2*nface+1] = nface;
+            nface++;
+        }
+    }
 
-            wv_adjustVerts(&(items[nitems]), sgFocus);
-            nitems++;
+    status = SUCCESS;
 
-            /* line color */
-            color[0] = 0.5;   color[1] = 0.5;   color[2] = 1.0;
+    /* Faces that show sensitivities are made serially by buildSceneGraph */
+    if (haveDots >= 1) goto cleanup;
 
-            status = wv_setData(WV_REAL32, 1, (void*)color, WV_COLORS, &(items[nitems]));
-            if (status != SUCCESS) {
-                SPRINT1(0, "ERROR:: wv_setData -> status=%d", status);
-            }
-            nitems++;
+    /* hand out the biggest Faces first */
+    qsort(order, nface, 2*sizeof(int), buildSceneGraphCost);
+    for (i = 0; i < nface; i++) {
+        order[i] = order[2*i+1];
+    }
 
-            /* make graphic primitive and set line width */
-            attrs = WV_ON;
-            igprim = wv_addGPrim(cntxt, gpname, WV_LINE, attrs, nitems, items);
-            if (igprim < 0) {
-                SPRINT2(0, "ERROR:: wv_addGPrim(%s) -> igprim=%d", gpname, igprim);
-            } else {
-                cntxt->gPrims[igprim].lWidth = 1.0;
+    sgthread.mutex  = NULL;
+    sgthread.end    = nface;
+    sgthread.index  = 0;
+    sgthread.order  = order;
+    sgthread.sgface = sgf;
+
+    np = EMP_Init(&start);
+    if (np > nface) np = nface;
+    if (np > 1) {
+        sgthread.mutex = EMP_LockCreate();
+        if (sgthread.mutex == NULL) {
+            SPRINT0(0, "WARNING:: mutex creation = NULL (using one thread)");
+            np = 1;
+        } else {
+            threads = (void **) malloc((np-1)*sizeof(void *));
+            if (threads == NULL) {
+                EMP_LockDestroy(sgthread.mutex);
+                sgthread.mutex = NULL;
+                np = 1;
             }
+        }
+    }
+    sgthread.master = EMP_ThreadID();
 
-            /* add plotdata to meta data (if there is room) */
-            if (STRLEN(sgMetaData) >= sgMetaDataLen-1000) {
-                sgMetaDataLen += MAX_METADATA_CHUNK;
-                RALLOC(sgMetaData, char, sgMetaDataLen);
-                RALLOC(sgTempData, char, sgMetaDataLen);
+    if (threads != NULL) {
+        for (i = 0; i < np-1; i++) {
+            threads[i] = EMP_ThreadCreate(buildSceneGraphThread, &sgthread);
+            if (threads[i] == NULL) {
+                SPRINT1(0, "WARNING:: error creating thread #%d", i+1);
             }
-
-            STRNCPY( sgTempData, sgMetaData, sgMetaDataLen);
-            snprintf(sgMetaData, sgMetaDataLen, "%s\"%s\":[],", sgTempData, gpname);
         }
+    }
 
-        free(plotdata);
-        plotdata = NULL;
+    buildSceneGraphThread(&sgthread);
 
-        fclose(fp);
+    if (threads != NULL) {
+        for (i = 0; i < np-1; i++) {
+            if (threads[i] != NULL) EMP_ThreadWait(threads[i]);
+        }
+        for (i = 0; i < np-1; i++) {
+            if (threads[i] != NULL) EMP_ThreadDestroy(threads[i]);
+        }
     }
+    if (sgthread.mutex != NULL) EMP_LockDestroy(sgthread.mutex);
 
-    /* finish the scene graph meta data */
-    sgMetaData[sgMetaDataLen-1] = '\0';
-    STRNCPY( sgTempData, sgMetaData, sgMetaDataLen);
-    snprintf(sgMetaData, sgMetaDataLen, "%s}", sgTempData);
+    SPRINT3(2, "--> GPrim data for %d Faces made with %d threads in %ld msec",
+            nface, np, EMP_Done(&start));
 
 cleanup:
-    if (plotdata != NULL) free(plotdata);
-    if (segments != NULL) free(segments);
-
+    if (threads != NULL) free(threads);
+    if (order   != NULL) free(order  );
 
     return status;
 }
 
+
+/***********************************************************************/
+/*                                                                     */
+/*   buildSceneGraphThread - make Face GPrim data until none are left  */
+/*                                                                     */
+/***********************************************************************/
+
+static void
+buildSceneGraphThread(void *struc)      /* (in)  shared data */
+{
+    int        index;
+    long       ID;
+    sgThread_T *sgthread = (sgThread_T *) struc;
+    sgFace_T   *sgf;
+
+    /* --------------------------------------------------------------- */
+
+    ID = EMP_ThreadID();
+
+    /* every Face is made (and keeps its own status) so that
+       buildSceneGraph reports errors in the usual order */
+    for (;;) {
+        if (sgthread->mutex != NULL) EMP_LockSet(sgthread->mutex);
+        index = sgthread->index;
+        sgthread->index++;
+        if (sgthread->mutex != NULL) EMP_LockRelease(sgthread->mutex);
+
+        if (index >= sgthread->end) break;
+
+        sgf = &(sgthread->sgface[sgthread->order[index]]);
+        sgf->status = buildSceneGraphFace(sgf);
+    }
+
+    if (ID != sgthread->master) EMP_ThreadExit();
+}
+
+
+/***********************************************************************/
+/*                                                                     */
+/*   buildSceneGraphCost - order (npnt,index) pairs by decreasing npnt */
+/*                                                                     */
+/***********************************************************************/
+
+static int
+buildSceneGraphCost(const void *a,      /* (in)  first  (npnt,index) pair */
+                    const void *b)      /* (in)  second (npnt,index) pair */
+{
+    const int *ia = (const int *) a;
+    const int *ib = (const int *) b;
+
+    if (ia[0] != ib[0]) return ib[0] - ia[0];
+    return ia[1] - ib[1];
+}
+
 
 /***********************************************************************/
 /*                                                                     */
@@ -7037,12 +7383,8 @@ computeMassProps(modl_T *MODL,          /* (in)  pointer to MODL */
 {
     int    status = SUCCESS;            /* return status */
 
-    int      iedge, iface, npnt, ipnt, ntri, itri, ip0, ip1, ip2, nnode;
-    CINT     *ptype, *pindx, *tris, *tric;
-    double   len=0, area=0, vol=0, xcg=0, ycg=0, zcg=0;
-    double   Ixx=0, Ixy=0, Ixz=0, Iyy=0, Iyz=0, Izz=0;
-    double   data1[18], len1, area1, xa, ya, za, xb, yb, zb, xbar, ybar, zbar, areax, areay, areaz;
-    CDOUBLE  *xyz, *uv;
+    int      nnode, i;
+    double   data1[18];
     ego      *enodes;
 
     ROUTINE(computeMassProps);
@@ -7059,167 +7401,25 @@ computeMassProps(modl_T *MODL,          /* (in)  pointer to MODL */
 
         EG_free(enodes);
 
-        xcg  = data1[0];
-        ycg  = data1[1];
-        zcg  = data1[2];
-
-    /* for a WireBody, accumulate statistics on each segment of each Edge */
-    } else if (MODL->body[ibody].botype == OCSM_WIRE_BODY) {
-        if (MODL->body[ibody].etess == NULL) {
-            status = OCSM_NEED_TESSELLATION;
-            goto cleanup;
-        }
-
-        for (iedge = 1; iedge <= MODL->body[ibody].nedge; iedge++) {
-            status = EG_getTessEdge(MODL->body[ibody].etess, iedge,
-                                    &npnt, &xyz, &uv);
-
-            for (ipnt = 1; ipnt < npnt; ipnt++) {
-                ip0 = 3 * (ipnt - 1);
-                ip1 = 3 * (ipnt    );
-
-                len1 = sqrt((xyz[ip1  ]-xyz[ip0  ]) * (xyz[ip1  ]-xyz[ip0  ])
-                            +(xyz[ip1+1]-xyz[ip0+1]) * (xyz[ip1+1]-xyz[ip0+1])
-                            +(xyz[ip1+2]-xyz[ip0+2]) * (xyz[ip1+2]-xyz[ip0+2]));
-
-                len += len1;
-                xcg += (xyz[ip1  ] + xyz[ip0  ]) * len1 / 2;
-                ycg += (xyz[ip1+1] + xyz[ip0+1]) * len1 / 2;
-                zcg += (xyz[ip1+2] + xyz[ip0+2]) * len1 / 2;
-            }
-        }
-
-        xcg /= len;
-        ycg /= len;
-        zcg /= len;
-
-        area = len;     // store length in area for printout below
-
-    /* for a SheetBody, accumulate statistics on each triangle of each face */
-    } else if (MODL->body[ibody].botype == OCSM_SHEET_BODY) {
-        if (MODL->body[ibody].etess == NULL) {
-            status = OCSM_NEED_TESSELLATION;
-            goto cleanup;
-        }
-
-        for (iface = 1; iface <= MODL->body[ibody].nface; iface++) {
-            status = EG_getTessFace(MODL->body[ibody].etess, iface,
-                                    &npnt, &xyz, &uv, &ptype, &pindx,
-                                    &ntri, &tris, &tric);
-
-            for (itri = 0; itri < ntri; itri++) {
-                ip0 = 3 * (tris[3*itri  ] - 1);
-                ip1 = 3 * (tris[3*itri+1] - 1);
-                ip2 = 3 * (tris[3*itri+2] - 1);
-
-                xa = xyz[ip1  ] - xyz[ip0  ];
-                ya = xyz[ip1+1] - xyz[ip0+1];
-                za = xyz[ip1+2] - xyz[ip0+2];
-
-                xb = xyz[ip2  ] - xyz[ip0  ];
-                yb = xyz[ip2+1] - xyz[ip0+1];
-                zb = xyz[ip2+2] - xyz[ip0+2];
-
-                xbar = xyz[ip0  ] + xyz[ip1  ] + xyz[ip2  ];
-                ybar = xyz[ip0+1] + xyz[ip1+1] + xyz[ip2+1];
-                zbar = xyz[ip0+2] + xyz[ip1+2] + xyz[ip2+2];
-
-                areax = ya * zb - za * yb;
-                areay = za * xb - xa * zb;
-                areaz = xa * yb - ya * xb;
-                area1 = sqrt(areax*areax + areay*areay + areaz*areaz) / 2;
-
-                area += area1;
-                xcg  += (xbar * area1) / 3;
-                ycg  += (ybar * area1) / 3;
-                zcg  += (zbar * area1) / 3;
-            }
+        for (i = 0; i < 14; i++) {
+            props[i] = 0;
         }
 
-        xcg /= area;
-        ycg /= area;
-        zcg /= area;
+        props[2] = data1[0];
+        props[3] = data1[1];
+        props[4] = data1[2];
 
-    /* for a SolidBody, use the divergence theorem on each triangle
-       of each Face to get the volume statistics */
-    } else if (MODL->body[ibody].botype == OCSM_SOLID_BODY) {
+    /* for a WireBody, SheetBody or SolidBody, let EGADS accumulate the
+       statistics over the segments or triangles of the tessellation */
+    } else {
         if (MODL->body[ibody].etess == NULL) {
             status = OCSM_NEED_TESSELLATION;
             goto cleanup;
         }
 
-        for (iface = 1; iface <= MODL->body[ibody].nface; iface++) {
-            status = EG_getTessFace(MODL->body[ibody].etess, iface,
-                                    &npnt, &xyz, &uv, &ptype, &pindx,
-                                    &ntri, &tris, &tric);
-
-            for (itri = 0; itri < ntri; itri++) {
-                ip0 = 3 * (tris[3*itri  ] - 1);
-                ip1 = 3 * (tris[3*itri+1] - 1);
-                ip2 = 3 * (tris[3*itri+2] - 1);
-
-                xa = xyz[ip1  ] - xyz[ip0  ];
-                ya = xyz[ip1+1] - xyz[ip0+1];
-                za = xyz[ip1+2] - xyz[ip0+2];
-
-                xb = xyz[ip2  ] - xyz[ip0  ];
-                yb = xyz[ip2+1] - xyz[ip0+1];
-                zb = xyz[ip2+2] - xyz[ip0+2];
-
-                xbar = xyz[ip0  ] + xyz[ip1  ] + xyz[ip2  ];
-                ybar = xyz[ip0+1] + xyz[ip1+1] + xyz[ip2+1];
-                zbar = xyz[ip0+2] + xyz[ip1+2] + xyz[ip2+2];
-
-                areax = ya * zb - za * yb;
-                areay = za * xb - xa * zb;
-                areaz = xa * yb - ya * xb;
-
-                area += sqrt(areax*areax + areay*areay + areaz*areaz) / 2;
-                vol  += (                xbar * areax +                 ybar * areay +                 zbar * areaz) /  18;
-
-                xcg  += (xbar/2        * xbar * areax + xbar          * ybar * areay + xbar          * zbar * areaz) /  54;
-                ycg  += (ybar          * xbar * areax + ybar/2        * ybar * areay + ybar          * zbar * areaz) /  54;
-                zcg  += (zbar          * xbar * areax + zbar          * ybar * areay + zbar/2        * zbar * areaz) /  54;
-
-                Ixx  += (                               ybar   * ybar * ybar * areay + zbar   * zbar * zbar * areaz) / 162;
-                Iyy  += (xbar   * xbar * xbar * areax                                + zbar   * zbar * zbar * areaz) / 162;
-                Izz  += (xbar   * xbar * xbar * areax + ybar   * ybar * ybar * areay                               ) / 162;
-
-                Ixy  -= (xbar/2 * ybar * xbar * areax + ybar/2 * xbar * ybar * areay + xbar   * ybar * zbar * areaz) / 162;
-                Ixz  -= (xbar/2 * zbar * xbar * areax + xbar   * zbar * ybar * areay + zbar/2 * xbar * zbar * areaz) / 162;
-                Iyz  -= (ybar   * zbar * xbar * areax + ybar/2 * zbar * ybar * areay + zbar/2 * ybar * zbar * areaz) / 162;
-            }
-        }
-
-        xcg /= vol;
-        ycg /= vol;
-        zcg /= vol;
-
-        /* parallel-axis theorem */
-        Ixx -= vol * (            ycg * ycg + zcg * zcg);
-        Iyy -= vol * (xcg * xcg             + zcg * zcg);
-        Izz -= vol * (xcg * xcg + ycg * ycg            );
-
-        Ixy += vol * (xcg * ycg      );
-        Ixz += vol * (xcg *       zcg);
-        Iyz += vol * (      ycg * zcg);
-    }
-
-    /* store the properties in the array */
-    props[ 0] = vol;
-    props[ 1] = area;
-    props[ 2] = xcg;
-    props[ 3] = ycg;
-    props[ 4] = zcg;
-    props[ 5] = Ixx;
-    props[ 6] = Ixy;
-    props[ 7] = Ixz;
-    props[ 8] = Ixy;
-    props[ 9] = Iyy;
-    props[10] = Iyz;
-    props[11] = Ixz;
-    props[12] = Iyz;
-    props[13] = Izz;
+        status = EG_tessMassProps(MODL->body[ibody].etess, props);
+        CHECK_STATUS(EG_tessMassProps);
+    }
 
 cleanup:
     return status;
@@ -48,6 +48,8 @@ static double argDdefs[NUMUDPARGS] = {0.,         0.,          0.,          0.,
                          udpGet, udpVel, udpClean, udpMesh */
 #include "udpUtilities.c"
 
+#include "emp.h"
+
 /* structure to hole Face info */
 typedef struct face_T {
     ego      eface;
@@ -59,15 +61,75 @@ typedef struct face_T {
     double   zmax;
 } face_TT;
 
+/* structure to hold a triangle of the fine tessellation */
+typedef struct tri_T {
+    int      iface;                     /* Face index (bias-0) */
+    double   xyz[9];                    /* coordinates of the corners */
+    double   uv[6];                     /* parameters  of the corners */
+} tri_TT;
+
+/* structure to hold a node of the bounding volume hierarchy */
+typedef struct bvh_T {
+    double   box[6];                    /* xmin, ymin, zmin, xmax, ymax, zmax */
+    int      child;                     /* first of two children (or -1 for a leaf) */
+    int      itri;                      /* first triangle in leaf */
+    int      ntri;                      /* number of triangles in leaf */
+} bvh_TT;
+
+/* structure shared by the threads that process the points */
+typedef struct compare_T {
+    void     *mutex;                    /* the mutex or NULL for single thread */
+    long     master;                    /* master thread ID */
+    int      end;                       /* number of points */
+    int      index;                     /* first point in next block */
+    int      status;                    /* first error (stops the dispatch) */
+    int      nface;                     /* number of Faces */
+    face_TT  *faces;                    /* array  of Face info */
+    tri_TT   *tris;                     /* array  of triangles (in bvh order) */
+    bvh_TT   *bvh;                      /* bounding volume hierarchy of tris */
+    int      depth;                     /* depth of bvh */
+    double   slack;                     /* how far tris may be from the Faces */
+    double   *xyz;                      /* coordinates of the points */
+    double   *dist;                     /* distance from each point to Brep */
+    int      *ifbest;                   /* closest Face for each point (bias-0) */
+    double   *uvbest;                   /* parameters on the closest Face */
+    int      nhist;                     /* number of histogram entries */
+    double   *dhist;                    /* histogram entries */
+    int      *hist;                     /* histogram counts (merged) */
+    double   distmax;                   /* maximum distance (merged) */
+    double   distavg;                   /* sum of distances (merged) */
+    double   distrms;                   /* sum of squared distances (merged) */
+    int      ndist;                     /* number of distances (merged) */
+} compare_TT;
+
 /* declaration for gmgwCSM routines defined below */
 static int      pointToBrepDist(double xyz[], int nface, face_TT faces[], double *dbest,
                                 int *ifbest, double uvbest[]);
 static int      addToHistogram(double entry, int nhist, double dhist[], int hist[]);
 static int      printHistogram(FILE *fp, int nhist, double dhist[], int hist[]);
+static int      readTessPoints(FILE *fp, int tess_nnode, int tess_nedge, int tess_nface,
+                               int *npnt, double *xyz[], int *label[]);
+static int      makeTris(ego ebody, int nface, double params[], int *ntri, tri_TT *tris[]);
+static int      makeBvh(int ntri, tri_TT tris[], int *nbvh, bvh_TT *bvh[], int *depth);
+static int      splitBvh(tri_TT tris[], bvh_TT bvh[], int ibvh, int *nbvh, int level, int *depth);
+static void     selectTri(tri_TT tris[], int ibeg, int iend, int k, int idir);
+static double   boxDist2(double xyz[], double box[]);
+static double   triDist2(double xyz[], tri_TT *tri, double uv[]);
+static int      closestFace(compare_TT *data, int ipnt, int mark[], int cand[],
+                            double guess[], int stack[]);
+static void     compareThread(void *struc);
 
 #define  EPS03     1.0e-03
+#define  HUGEQ     1.0e+200
+#define  MIN(A,B)  (((A) < (B)) ? (A) : (B))
 #define  MAX(A,B)  (((A) < (B)) ? (B) : (A))
 
+/* number of points given to a thread at a time */
+#define  PNTBLOCK  256
+
+/* number of triangles in a leaf of the bvh */
+#define  LEAFSIZE  4
+
 
 /*
  ************************************************************************
@@ -85,16 +147,19 @@ udpExecute(ego  emodel,                 /* (in)  input model */
 {
     int     status = EGADS_SUCCESS;
     int     oclass, mtype, nchild, *senses;
-    int     tess_nnode, tess_nedge, tess_nface, nface, inode, iedge, iface;
-    int     npnt, ipnt, ntri, itri, ifbest, ndist;
-    int     idum1, idum2, idum3, idum4, idum5, idum6;
-    double  data[4], dumu, dumv;
-    double  xyz_in[3], dbest, uvbest[2], xyz_out[18];
-    double  distmax, distavg, distrms;
+    int     tess_nnode, tess_nedge, tess_nface, nface, iface;
+    int     npnt, ipnt, ntri, nbvh, i, np=1, *label=NULL;
+    long    start;
+    double  data[4], bbox[6], size, params[3];
+    double  *xyz=NULL, xyz_out[18];
     FILE    *fp_tess, *fp_hist, *fp_plot;
     ego     *efaces;
     face_TT *faces=NULL;
+    tri_TT  *tris=NULL;
+    bvh_TT  *bvh=NULL;
+    void    **threads=NULL;
     ego     context, eref, *ebodys;
+    compare_TT cmp;
 
     int     ihist, nhist=28, hist[28];
     double  dhist[] = {1e-8, 2e-8, 5e-8,
@@ -108,6 +173,15 @@ udpExecute(ego  emodel,                 /* (in)  input model */
                        1e+0, 2e+0, 5e+0,
                        1e+1};
 
+    ROUTINE(udpExecute);
+
+    /* --------------------------------------------------------------- */
+
+    cmp.mutex  = NULL;
+    cmp.dist   = NULL;
+    cmp.ifbest = NULL;
+    cmp.uvbest = NULL;
+
 #ifdef DEBUG
     printf("udpExecute(emodel=%llx)\n", (long long)emodel);
     printf("tessfile(0) = %s\n", TESSFILE(0));
@@ -229,116 +303,134 @@ udpExecute(ego  emodel,                 /* (in)  input model */
 
     EG_free(efaces);
 
-    /* initialize the histogram */
-    for (ihist = 0; ihist < nhist; ihist++) {
-        hist[ihist] = 0;
-    }
-
-    distmax = 0;
-    distavg = 0;
-    distrms = 0;
-    ndist   = 0;
-
-    /* process each point in TESSFILE */
-    for (inode = 0; inode < tess_nnode; inode++) {
-        fscanf(fp_tess, "%lf %lf %lf", &(xyz_in[0]), &(xyz_in[1]), &(xyz_in[2]));
+    /* read all of the points in TESSFILE */
+    status = readTessPoints(fp_tess, tess_nnode, tess_nedge, tess_nface,
+                            &npnt, &xyz, &label);
+    if (status < EGADS_SUCCESS) goto cleanup;
 
-        /* find closest location in Brep */
-        dbest = 1e6;
-        status = pointToBrepDist(xyz_in, nface, faces, &dbest, &ifbest, uvbest);
-        if (status < EGADS_SUCCESS) goto cleanup;
+    /* make a fine tessellation of the Body and put its triangles into
+       a bounding volume hierarchy.  this is used to find the Face(s)
+       that are closest to each point and a starting guess for the
+       inverse evaluation, so that only a few Faces have to be checked.
+       if the tessellation fails, the (empty) hierarchy gives no candidates
+       and every point falls back to the exhaustive search */
+    status = EG_getBoundingBox(*ebody, bbox);
+    if (status < EGADS_SUCCESS) goto cleanup;
 
-        distmax = MAX(distmax,  dbest);
-        distavg =     distavg + dbest;
-        distrms =     distrms + dbest * dbest;
-        ndist++;
-        
-        /* evaluate position in Brep */
-        status = EG_evaluate(faces[ifbest].eface, uvbest, xyz_out);
-        if (status < EGADS_SUCCESS) goto cleanup;
+    size = sqrt((bbox[3]-bbox[0]) * (bbox[3]-bbox[0])
+               +(bbox[4]-bbox[1]) * (bbox[4]-bbox[1])
+               +(bbox[5]-bbox[2]) * (bbox[5]-bbox[2]));
 
-        /* add to histogram */
-        status = addToHistogram(dbest, nhist, dhist, hist);
-        if (status < EGADS_SUCCESS) goto cleanup;
+    params[0] = 0.0250 * size;
+    params[1] = 0.0010 * size;
+    params[2] = 15.0;
 
-        /* add to PLOTFILE (if it exists) */
-        if (fp_plot != NULL && dbest > TOLER(numUdp)) {
-            fprintf(fp_plot, "%3d %3d Node_%d\n",
-                    2, 1, inode);
-            fprintf(fp_plot, "%12.5f %12.5f %12.5f  %12.5f %12.5f %12.5f\n",
-                    xyz_in[0], xyz_in[1], xyz_in[2], xyz_out[0], xyz_out[1], xyz_out[2]);
-        }
+    status = makeTris(*ebody, nface, params, &ntri, &tris);
+    if (status < EGADS_SUCCESS) {
+        printf(" udpExecute: tessellation failed (status=%d), using exhaustive search\n", status);
+        FREE(tris);
+        ntri = 0;
     }
 
-    for (iedge = 0; iedge < tess_nedge; iedge++) {
-        fscanf(fp_tess, "%d", &npnt);
+    status = makeBvh(ntri, tris, &nbvh, &bvh, &cmp.depth);
+    if (status < EGADS_SUCCESS) goto cleanup;
 
-        for (ipnt = 0; ipnt < npnt; ipnt++) {
-            fscanf(fp_tess, "%lf %lf %lf %lf", &(xyz_in[0]), &(xyz_in[1]), &(xyz_in[2]), &dumu);
+    /* set up the data shared by the threads */
+    MALLOC(cmp.dist,   double,   npnt);
+    MALLOC(cmp.ifbest, int,      npnt);
+    MALLOC(cmp.uvbest, double, 2*npnt);
+
+    cmp.end     = npnt;
+    cmp.index   = 0;
+    cmp.status  = EGADS_SUCCESS;
+    cmp.nface   = nface;
+    cmp.faces   = faces;
+    cmp.tris    = tris;
+    cmp.bvh     = bvh;
+    cmp.slack   = 4 * params[1];
+    cmp.xyz     = xyz;
+    cmp.nhist   = nhist;
+    cmp.dhist   = dhist;
+    cmp.hist    = hist;
+    cmp.distmax = 0;
+    cmp.distavg = 0;
+    cmp.distrms = 0;
+    cmp.ndist   = 0;
 
-            /* find closest location in Brep */
-            dbest = 1e6;
-            status = pointToBrepDist(xyz_in, nface, faces, &dbest, &ifbest, uvbest);
-            if (status < EGADS_SUCCESS) goto cleanup;
+    /* initialize the histogram */
+    for (ihist = 0; ihist < nhist; ihist++) {
+        hist[ihist] = 0;
+    }
 
-            distmax = MAX(distmax,  dbest);
-            distavg =     distavg + dbest;
-            distrms =     distrms + dbest * dbest;
-            ndist++;
-        
-            /* evaluate position in Brep */
-            status = EG_evaluate(faces[ifbest].eface, uvbest, xyz_out);
-            if (status < EGADS_SUCCESS) goto cleanup;
+    /* find the closest location in the Brep to each point (in parallel).
+       each thread accumulates its own histogram, which are merged at the end */
+    np = EMP_Init(&start);
+    if (np > (npnt+PNTBLOCK-1)/PNTBLOCK) np = (npnt+PNTBLOCK-1)/PNTBLOCK;
+    if (np > 1) {
+        cmp.mutex = EMP_LockCreate();
+        if (cmp.mutex == NULL) {
+            printf(" udpExecute: mutex creation = NULL!\n");
+            np = 1;
+        } else {
+            threads = (void **) EG_alloc((np-1)*sizeof(void *));
+            if (threads == NULL) {
+                EMP_LockDestroy(cmp.mutex);
+                cmp.mutex = NULL;
+                np = 1;
+            }
+        }
+    }
+    cmp.master = EMP_ThreadID();
 
-            /* add to histogram */
-            status = addToHistogram(dbest, nhist, dhist, hist);
-            if (status < EGADS_SUCCESS) goto cleanup;
-            
-            /* add to PLOTFILE (if it exists) */
-            if (fp_plot != NULL && dbest > TOLER(numUdp)) {
-                fprintf(fp_plot, "%3d %3d Edge_%d.%d\n",
-                        2, 1, iedge, ipnt);
-                fprintf(fp_plot, "%12.5f %12.5f %12.5f  %12.5f %12.5f %12.5f\n",
-                        xyz_in[0], xyz_in[1], xyz_in[2], xyz_out[0], xyz_out[1], xyz_out[2]);
+    if (threads != NULL) {
+        for (i = 0; i < np-1; i++) {
+            threads[i] = EMP_ThreadCreate(compareThread, &cmp);
+            if (threads[i] == NULL) {
+                printf(" udpExecute: error creating thread #%d\n", i+1);
             }
         }
     }
-        
-    for (iface = 0; iface < tess_nface; iface++) {
-        fscanf(fp_tess, "%d %d", &npnt, &ntri);
 
-        for (ipnt = 0; ipnt < npnt; ipnt++) {
-            fscanf(fp_tess, "%lf %lf %lf %lf %lf %d %d", &(xyz_in[0]), &(xyz_in[1]), &(xyz_in[2]), &dumu, &dumv, &idum1, &idum2);
+    compareThread(&cmp);
 
-            /* find closest location in Brep */
-            dbest = 1e6;
-            status = pointToBrepDist(xyz_in, nface, faces, &dbest, &ifbest, uvbest);
-            if (status < EGADS_SUCCESS) goto cleanup;
+    if (threads != NULL) {
+        for (i = 0; i < np-1; i++) {
+            if (threads[i] != NULL) EMP_ThreadWait(threads[i]);
+        }
+        for (i = 0; i < np-1; i++) {
+            if (threads[i] != NULL) EMP_ThreadDestroy(threads[i]);
+        }
+    }
 
-            distmax = MAX(distmax,  dbest);
-            distavg =     distavg + dbest;
-            distrms =     distrms + dbest * dbest;
-            ndist++;
+#ifdef DEBUG
+    printf("udpExecute: %d points compared with %d threads in %ld msec\n",
+           npnt, np, EMP_Done(&start));
+#endif
+
+    status = cmp.status;
+    if (status < EGADS_SUCCESS) goto cleanup;
+
+    /* add to PLOTFILE (if it exists) */
+    if (fp_plot != NULL) {
+        for (ipnt = 0; ipnt < npnt; ipnt++) {
+            if (cmp.dist[ipnt] <= TOLER(numUdp)) continue;
 
             /* evaluate position in Brep */
-            status = EG_evaluate(faces[ifbest].eface, uvbest, xyz_out);
+            status = EG_evaluate(faces[cmp.ifbest[ipnt]].eface, &(cmp.uvbest[2*ipnt]), xyz_out);
             if (status < EGADS_SUCCESS) goto cleanup;
 
-            /* add to histogram */
-            status = addToHistogram(dbest, nhist, dhist, hist);
-            if (status < EGADS_SUCCESS) goto cleanup;
-            
-            /* add to PLOTFILE (if it exists) */
-            if (fp_plot != NULL && dbest > TOLER(numUdp)) {
+            if        (label[3*ipnt] == 0) {
+                fprintf(fp_plot, "%3d %3d Node_%d\n",
+                        2, 1, label[3*ipnt+1]);
+            } else if (label[3*ipnt] == 1) {
+                fprintf(fp_plot, "%3d %3d Edge_%d.%d\n",
+                        2, 1, label[3*ipnt+1], label[3*ipnt+2]);
+            } else {
                 fprintf(fp_plot, "%3d %3d Face_%d.%d\n",
-                        2, 1, iface, ipnt);
-                fprintf(fp_plot, "%12.5f %12.5f %12.5f  %12.5f %12.5f %12.5f\n",
-                        xyz_in[0], xyz_in[1], xyz_in[2], xyz_out[0], xyz_out[1], xyz_out[2]);
+                        2, 1, label[3*ipnt+1], label[3*ipnt+2]);
             }
-        }
-
-        for (itri = 0; itri < ntri; itri++) {
-            fscanf(fp_tess, "%d %d %d %d %d %d", &idum1, &idum2, &idum3, &idum4, &idum5, &idum6);
+            fprintf(fp_plot, "%12.5f %12.5f %12.5f  %12.5f %12.5f %12.5f\n",
+                    xyz[3*ipnt], xyz[3*ipnt+1], xyz[3*ipnt+2], xyz_out[0], xyz_out[1], xyz_out[2]);
         }
     }
 
@@ -350,9 +442,9 @@ udpExecute(ego  emodel,                 /* (in)  input model */
     if (fp_hist != NULL) {
         status = printHistogram(fp_hist, nhist, dhist, hist);
 
-        fprintf(fp_hist, "    max dist = %12.4e\n", distmax);
-        fprintf(fp_hist, "    avg dist = %12.4e\n", distavg/ndist);
-        fprintf(fp_hist, "    rms dist = %12.4e\n", sqrt(distrms/ndist));
+        fprintf(fp_hist, "    max dist = %12.4e\n", cmp.distmax);
+        fprintf(fp_hist, "    avg dist = %12.4e\n", cmp.distavg/cmp.ndist);
+        fprintf(fp_hist, "    rms dist = %12.4e\n", sqrt(cmp.distrms/cmp.ndist));
 
         /* close HISTFILE if not stdout */
         if (fp_hist != stdout) {
@@ -371,6 +463,16 @@ udpExecute(ego  emodel,                 /* (in)  input model */
 #endif
 
 cleanup:
+    if (cmp.mutex != NULL) EMP_LockDestroy(cmp.mutex);
+    FREE(threads);
+
+    FREE(cmp.dist);
+    FREE(cmp.ifbest);
+    FREE(cmp.uvbest);
+    FREE(bvh);
+    FREE(tris);
+    FREE(label);
+    FREE(xyz);
     FREE(faces);
 
     if (status != EGADS_SUCCESS) {
@@ -397,20 +499,14 @@ udpSensitivity(ego    ebody,            /* (in)  Body pointer */
    /*@unused@*/double uvs[],            /* (in)  parametric coordinates for evaluation */
    /*@unused@*/double vels[])           /* (out) velocities */
 {
-    int iudp, judp;
+    int iudp;
 
     ROUTINE(udpSensitivity);
 
     /* --------------------------------------------------------------- */
 
     /* check that ebody matches one of the ebodys */
-    iudp = 0;
-    for (judp = 1; judp <= numUdp; judp++) {
-        if (ebody == udps[judp].ebody) {
-            iudp = judp;
-            break;
-        }
-    }
+    iudp = findUdp(ebody);
     if (iudp <= 0) {
         return EGADS_NOTMODEL;
     }
@@ -484,6 +580,712 @@ cleanup:
     return status;
 }
 
+
+/***********************************************************************/
+/*                                                                     */
+/*   readTessPoints - read all of the points in the tessfile           */
+/*                                                                     */
+/***********************************************************************/
+
+static int
+readTessPoints(FILE    *fp,             /* (in)  tessfile (after the header) */
+               int     tess_nnode,      /* (in)  number of Nodes in tessfile */
+               int     tess_nedge,      /* (in)  number of Edges in tessfile */
+               int     tess_nface,      /* (in)  number of Faces in tessfile */
+               int     *npnt,           /* (out) number of points */
+               double  *xyz[],          /* (out) coordinates of points (freeable) */
+               int     *label[])        /* (out) type, index, and point in type (freeable) */
+{
+    int    status = EGADS_SUCCESS;      /* return status */
+
+    int    mpnt, inode, iedge, n, ntri, i, itri;
+    int    idum1, idum2, idum3, idum4, idum5, idum6;
+    double dumu, dumv;
+    void   *temp;
+
+    ROUTINE(readTessPoints);
+
+    /* --------------------------------------------------------------- */
+
+    *npnt  = 0;
+    *xyz   = NULL;
+    *label = NULL;
+
+    mpnt = MAX(tess_nnode, 1000);
+
+    MALLOC(*xyz,   double, 3*mpnt);
+    MALLOC(*label, int,    3*mpnt);
+
+    for (inode = 0; inode < tess_nnode; inode++) {
+        fscanf(fp, "%lf %lf %lf", &((*xyz)[3*(*npnt)]), &((*xyz)[3*(*npnt)+1]), &((*xyz)[3*(*npnt)+2]));
+
+        (*label)[3*(*npnt)  ] = 0;
+        (*label)[3*(*npnt)+1] = inode;
+        (*label)[3*(*npnt)+2] = 0;
+        (*npnt)++;
+    }
+
+    for (iedge = 0; iedge < tess_nedge+tess_nface; iedge++) {
+        if (iedge < tess_nedge) {
+            fscanf(fp, "%d", &n);
+            ntri = 0;
+        } else {
+            fscanf(fp, "%d %d", &n, &ntri);
+        }
+
+        /* make room for the points in this Edge or Face */
+        if (*npnt+n > mpnt) {
+            mpnt = MAX(2*mpnt, *npnt+n);
+
+            temp = EG_reall(*xyz, 3*mpnt*sizeof(double));
+            if (temp == NULL) {
+                status = EGADS_MALLOC;
+                goto cleanup;
+            }
+            *xyz = (double *) temp;
+
+            temp = EG_reall(*label, 3*mpnt*sizeof(int));
+            if (temp == NULL) {
+                status = EGADS_MALLOC;
+                goto cleanup;
+            }
+            *label = (int *) temp;
+        }
+
+        for (i = 0; i < n; i++) {
+            if (iedge < tess_nedge) {
+                fscanf(fp, "%lf %lf %lf %lf", &((*xyz)[3*(*npnt)]), &((*xyz)[3*(*npnt)+1]), &((*xyz)[3*(*npnt)+2]), &dumu);
+
+                (*label)[3*(*npnt)  ] = 1;
+                (*label)[3*(*npnt)+1] = iedge;
+            } else {
+                fscanf(fp, "%lf %lf %lf %lf %lf %d %d", &((*xyz)[3*(*npnt)]), &((*xyz)[3*(*npnt)+1]), &((*xyz)[3*(*npnt)+2]), &dumu, &dumv, &idum1, &idum2);
+
+                (*label)[3*(*npnt)  ] = 2;
+                (*label)[3*(*npnt)+1] = iedge - tess_nedge;
+            }
+            (*label)[3*(*npnt)+2] = i;
+            (*npnt)++;
+        }
+
+        for (itri = 0; itri < ntri; itri++) {
+            fscanf(fp, "%d %d %d %d %d %d", &idum1, &idum2, &idum3, &idum4, &idum5, &idum6);
+        }
+    }
+
+cleanup:
+    return status;
+}
+
+
+
+/***********************************************************************/
+/*                                                                     */
+/*   makeTris - make the triangles of a fine tessellation of the Body  */
+/*                                                                     */
+/***********************************************************************/
+
+static int
+makeTris(ego     ebody,                 /* (in)  Body */
+         int     nface,                 /* (in)  number of Faces */
+         double  params[],              /* (in)  tessellation parameters */
+         int     *ntri,                 /* (out) number of triangles */
+         tri_TT  *tris[])               /* (out) array  of triangles (freeable) */
+{
+    int    status = EGADS_SUCCESS;      /* return status */
+
+    int    iface, npnt, nface_tri, itri, i, j;
+    CINT   *ptype, *pindex, *tri, *tric;
+    CDOUBLE *xyz, *uv;
+    ego    etess=NULL;
+
+    ROUTINE(makeTris);
+
+    /* --------------------------------------------------------------- */
+
+    *ntri = 0;
+    *tris = NULL;
+
+    status = EG_makeTessBody(ebody, params, &etess);
+    CHECK_STATUS(EG_makeTessBody);
+
+    /* count the triangles */
+    for (iface = 0; iface < nface; iface++) {
+        status = EG_getTessFace(etess, iface+1, &npnt, &xyz, &uv, &ptype, &pindex,
+                                &nface_tri, &tri, &tric);
+        CHECK_STATUS(EG_getTessFace);
+
+        *ntri += nface_tri;
+    }
+
+    MALLOC(*tris, tri_TT, MAX(*ntri, 1));
+
+    /* copy the coordinates and parameters of their corners */
+    *ntri = 0;
+    for (iface = 0; iface < nface; iface++) {
+        status = EG_getTessFace(etess, iface+1, &npnt, &xyz, &uv, &ptype, &pindex,
+                                &nface_tri, &tri, &tric);
+        CHECK_STATUS(EG_getTessFace);
+
+        for (itri = 0; itri < nface_tri; itri++) {
+            (*tris)[*ntri].iface = iface;
+
+            for (i = 0; i < 3; i++) {
+                j = tri[3*itri+i] - 1;
+
+                (*tris)[*ntri].xyz[3*i  ] = xyz[3*j  ];
+                (*tris)[*ntri].xyz[3*i+1] = xyz[3*j+1];
+                (*tris)[*ntri].xyz[3*i+2] = xyz[3*j+2];
+                (*tris)[*ntri].uv[ 2*i  ] = uv[ 2*j  ];
+                (*tris)[*ntri].uv[ 2*i+1] = uv[ 2*j+1];
+            }
+
+            (*ntri)++;
+        }
+    }
+
+cleanup:
+    if (etess != NULL) EG_deleteObject(etess);
+
+    return status;
+}
+
+
+
+/***********************************************************************/
+/*                                                                     */
+/*   makeBvh - make bounding volume hierarchy of the triangles         */
+/*                                                                     */
+/***********************************************************************/
+
+static int
+makeBvh(int     ntri,                   /* (in)  number of triangles */
+        tri_TT  tris[],                 /* (both)array  of triangles (reordered) */
+        int     *nbvh,                  /* (out) number of nodes */
+        bvh_TT  *bvh[],                 /* (out) array  of nodes (freeable) */
+        int     *depth)                 /* (out) depth of hierarchy */
+{
+    int    status = EGADS_SUCCESS;      /* return status */
+
+    ROUTINE(makeBvh);
+
+    /* --------------------------------------------------------------- */
+
+    *nbvh  = 1;
+    *bvh   = NULL;
+    *depth = 1;
+
+    /* a binary tree with at least one triangle in each leaf has
+       fewer than 2*ntri nodes */
+    MALLOC(*bvh, bvh_TT, MAX(2*ntri, 1));
+
+    (*bvh)[0].child = -1;
+    (*bvh)[0].itri  =  0;
+    (*bvh)[0].ntri  = ntri;
+
+    status = splitBvh(tris, *bvh, 0, nbvh, 1, depth);
+    CHECK_STATUS(splitBvh);
+
+cleanup:
+    return status;
+}
+
+
+
+/***********************************************************************/
+/*                                                                     */
+/*   splitBvh - set box of node and split it (recursively)             */
+/*                                                                     */
+/***********************************************************************/
+
+static int
+splitBvh(tri_TT  tris[],                /* (both)array  of triangles (reordered) */
+         bvh_TT  bvh[],                 /* (both)array  of nodes */
+         int     ibvh,                  /* (in)  node to split */
+         int     *nbvh,                 /* (both)number of nodes */
+         int     level,                 /* (in)  level of ibvh */
+         int     *depth)                /* (both)depth of hierarchy */
+{
+    int    status = EGADS_SUCCESS;      /* return status */
+
+    int    itri, ibeg, iend, i, idir, ichild;
+    double cmin[3], cmax[3], cent;
+
+    ROUTINE(splitBvh);
+
+    /* --------------------------------------------------------------- */
+
+    ibeg = bvh[ibvh].itri;
+    iend = bvh[ibvh].itri + bvh[ibvh].ntri;
+
+    *depth = MAX(*depth, level);
+
+    /* bounding box of the triangles and of their centroids */
+    for (i = 0; i < 3; i++) {
+        bvh[ibvh].box[i  ] = +HUGEQ;
+        bvh[ibvh].box[i+3] = -HUGEQ;
+        cmin[i]            = +HUGEQ;
+        cmax[i]            = -HUGEQ;
+    }
+
+    for (itri = ibeg; itri < iend; itri++) {
+        for (i = 0; i < 3; i++) {
+            bvh[ibvh].box[i  ] = MIN(bvh[ibvh].box[i  ], MIN(tris[itri].xyz[i], MIN(tris[itri].xyz[i+3], tris[itri].xyz[i+6])));
+            bvh[ibvh].box[i+3] = MAX(bvh[ibvh].box[i+3], MAX(tris[itri].xyz[i], MAX(tris[itri].xyz[i+3], tris[itri].xyz[i+6])));
+
+            cent    = tris[itri].xyz[i] + tris[itri].xyz[i+3] + tris[itri].xyz[i+6];
+            cmin[i] = MIN(cmin[i], cent);
+            cmax[i] = MAX(cmax[i], cent);
+        }
+    }
+
+    if (iend-ibeg <= LEAFSIZE) goto cleanup;
+
+    /* split at the median centroid in the longest direction, so that
+       the depth is about log2(ntri) */
+    idir = 0;
+    if (cmax[1]-cmin[1] > cmax[idir]-cmin[idir]) idir = 1;
+    if (cmax[2]-cmin[2] > cmax[idir]-cmin[idir]) idir = 2;
+
+    selectTri(tris, ibeg, iend, (ibeg+iend)/2, idir);
+
+    ichild = *nbvh;
+    *nbvh += 2;
+
+    bvh[ibvh].child = ichild;
+
+    bvh[ichild  ].child = -1;
+    bvh[ichild  ].itri  = ibeg;
+    bvh[ichild  ].ntri  = (ibeg+iend)/2 - ibeg;
+
+    bvh[ichild+1].child = -1;
+    bvh[ichild+1].itri  = (ibeg+iend)/2;
+    bvh[ichild+1].ntri  = iend - (ibeg+iend)/2;
+
+    status = splitBvh(tris, bvh, ichild,   nbvh, level+1, depth);
+    CHECK_STATUS(splitBvh);
+
+    status = splitBvh(tris, bvh, ichild+1, nbvh, level+1, depth);
+    CHECK_STATUS(splitBvh);
+
+cleanup:
+    return status;
+}
+
+
+
+/***********************************************************************/
+/*                                                                     */
+/*   selectTri - partially sort triangles so that k-th one is in place */
+/*                                                                     */
+/***********************************************************************/
+
+static void
+selectTri(tri_TT  tris[],               /* (both)array  of triangles */
+          int     ibeg,                 /* (in)  first triangle */
+          int     iend,                 /* (in)  one past last triangle */
+          int     k,                    /* (in)  triangle to put in place */
+          int     idir)                 /* (in)  direction to sort (0-2) */
+{
+    int    i, j;
+    double pivot;
+    tri_TT temp;
+
+    /* quickselect on the (scaled) centroids.  afterwards, every triangle
+       before k has a centroid <= that of k and every one after has >= */
+    iend--;
+    while (ibeg < iend) {
+        pivot = tris[(ibeg+iend)/2].xyz[idir] + tris[(ibeg+iend)/2].xyz[idir+3] + tris[(ibeg+iend)/2].xyz[idir+6];
+
+        i = ibeg;
+        j = iend;
+        while (i <= j) {
+            while (tris[i].xyz[idir] + tris[i].xyz[idir+3] + tris[i].xyz[idir+6] < pivot) i++;
+            while (tris[j].xyz[idir] + tris[j].xyz[idir+3] + tris[j].xyz[idir+6] > pivot) j--;
+
+            if (i <= j) {
+                temp    = tris[i];
+                tris[i] = tris[j];
+                tris[j] = temp;
+                i++;
+                j--;
+            }
+        }
+
+        if        (k <= j) {
+            iend = j;
+        } else if (k >= i) {
+            ibeg = i;
+        } else {
+            break;
+        }
+    }
+}
+
+
+
+/***********************************************************************/
+/*                                                                     */
+/*   boxDist2 - square of distance from point to bounding box          */
+/*                                                                     */
+/***********************************************************************/
+
+static double
+boxDist2(double  xyz[],                 /* (in)  point */
+         double  box[])                 /* (in)  xmin, ymin, zmin, xmax, ymax, zmax */
+{
+    int    i;
+    double d, dist2 = 0;
+
+    for (i = 0; i < 3; i++) {
+        if        (xyz[i] < box[i  ]) {
+            d      = box[i  ] - xyz[i];
+            dist2 += d * d;
+        } else if (xyz[i] > box[i+3]) {
+            d      = xyz[i] - box[i+3];
+            dist2 += d * d;
+        }
+    }
+
+    return dist2;
+}
+
+
+
+/***********************************************************************/
+/*                                                                     */
+/*   triDist2 - square of distance from point to triangle              */
+/*                                                                     */
+/***********************************************************************/
+
+static double
+triDist2(double  xyz[],                 /* (in)  point */
+         tri_TT  *tri,                  /* (in)  triangle */
+         double  uv[])                  /* (out) parameters at closest point */
+{
+    int    i;
+    double ab[3], ac[3], ap[3], bp[3], cp[3], d1, d2, d3, d4, d5, d6;
+    double va, vb, vc, denom, s, t, clos[3], dist2;
+
+    /* closest point on the triangle (Voronoi regions of the corners,
+       sides, and interior), given as clos = A + s*(B-A) + t*(C-A) */
+    for (i = 0; i < 3; i++) {
+        ab[i] = tri->xyz[i+3] - tri->xyz[i];
+        ac[i] = tri->xyz[i+6] - tri->xyz[i];
+        ap[i] = xyz[i]        - tri->xyz[i];
+        bp[i] = xyz[i]        - tri->xyz[i+3];
+        cp[i] = xyz[i]        - tri->xyz[i+6];
+    }
+
+    d1 = ab[0]*ap[0] + ab[1]*ap[1] + ab[2]*ap[2];
+    d2 = ac[0]*ap[0] + ac[1]*ap[1] + ac[2]*ap[2];
+    d3 = ab[0]*bp[0] + ab[1]*bp[1] + ab[2]*bp[2];
+    d4 = ac[0]*bp[0] + ac[1]*bp[1] + ac[2]*bp[2];
+    d5 = ab[0]*cp[0] + ab[1]*cp[1] + ab[2]*cp[2];
+    d6 = ac[0]*cp[0] + ac[1]*cp[1] + ac[2]*cp[2];
+
+    vc = d1*d4 - d3*d2;
+    vb = d5*d2 - d1*d6;
+    va = d3*d6 - d5*d4;
+
+    if        (d1 <= 0 && d2 <= 0) {
+        s = 0;
+        t = 0;
+    } else if (d3 >= 0 && d4 <= d3) {
+        s = 1;
+        t = 0;
+    } else if (d6 >= 0 && d5 <= d6) {
+        s = 0;
+        t = 1;
+    } else if (vc <= 0 && d1 >= 0 && d3 <= 0) {
+        s = d1 / (d1 - d3);
+        t = 0;
+    } else if (vb <= 0 && d2 >= 0 && d6 <= 0) {
+        s = 0;
+        t = d2 / (d2 - d6);
+    } else if (va <= 0 && d4-d3 >= 0 && d5-d6 >= 0) {
+        t = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+        s = 1 - t;
+    } else {
+        denom = va + vb + vc;
+        if (denom == 0) {
+            s = 0;
+            t = 0;
+        } else {
+            s = vb / denom;
+            t = vc / denom;
+        }
+    }
+
+    dist2 = 0;
+    for (i = 0; i < 3; i++) {
+        clos[i] = tri->xyz[i] + s * ab[i] + t * ac[i];
+        dist2  += (xyz[i] - clos[i]) * (xyz[i] - clos[i]);
+    }
+
+    uv[0] = (1 - s - t) * tri->uv[0] + s * tri->uv[2] + t * tri->uv[4];
+    uv[1] = (1 - s - t) * tri->uv[1] + s * tri->uv[3] + t * tri->uv[5];
+
+    return dist2;
+}
+
+
+
+/***********************************************************************/
+/*                                                                     */
+/*   closestFace - find closest location in Brep to a point            */
+/*                                                                     */
+/***********************************************************************/
+
+static int
+closestFace(compare_TT *data,           /* (in)  shared data */
+            int     ipnt,               /* (in)  point to check (bias-0) */
+            int     mark[],             /* (both)scratch (nface, initialized to -1) */
+            int     cand[],             /* (both)scratch (nface) */
+            double  guess[],            /* (both)scratch (3*nface) */
+            int     stack[])            /* (both)scratch (depth+1) */
+{
+    int    status = EGADS_SUCCESS;      /* return status */
+
+    int    nstack, ibvh, itri, iface, ncand, icand, jcand, ifbest;
+    double xyz[3], pnt[3], uv[2], xyz_out[18], uvbest[2];
+    double dist2, d2min, r2, dtest, dbest;
+    bvh_TT *bvh  = data->bvh;
+    tri_TT *tris = data->tris;
+
+    /* --------------------------------------------------------------- */
+
+    xyz[0] = data->xyz[3*ipnt  ];
+    xyz[1] = data->xyz[3*ipnt+1];
+    xyz[2] = data->xyz[3*ipnt+2];
+
+    /* find the distance to the closest triangle (visiting the nearer
+       child first so that most of the tree gets pruned) */
+    d2min     = HUGEQ;
+    nstack    = 0;
+    stack[0]  = 0;
+    nstack    = 1;
+
+    while (nstack > 0) {
+        ibvh = stack[--nstack];
+        if (boxDist2(xyz, bvh[ibvh].box) >= d2min) continue;
+
+        if (bvh[ibvh].child < 0) {
+            for (itri = bvh[ibvh].itri; itri < bvh[ibvh].itri+bvh[ibvh].ntri; itri++) {
+                dist2 = triDist2(xyz, &(tris[itri]), uv);
+                if (dist2 < d2min) d2min = dist2;
+            }
+        } else if (boxDist2(xyz, bvh[bvh[ibvh].child].box) < boxDist2(xyz, bvh[bvh[ibvh].child+1].box)) {
+            stack[nstack++] = bvh[ibvh].child + 1;
+            stack[nstack++] = bvh[ibvh].child;
+        } else {
+            stack[nstack++] = bvh[ibvh].child;
+            stack[nstack++] = bvh[ibvh].child + 1;
+        }
+    }
+
+    /* every Face that has a triangle within slack of the closest one
+       is a candidate.  keep the parameters on the closest triangle of
+       each as the starting guess for the inverse evaluation */
+    ncand = 0;
+
+    if (d2min < HUGEQ) {
+        r2 = (sqrt(d2min) + data->slack) * (sqrt(d2min) + data->slack);
+
+        stack[0] = 0;
+        nstack   = 1;
+
+        while (nstack > 0) {
+            ibvh = stack[--nstack];
+            if (boxDist2(xyz, bvh[ibvh].box) > r2) continue;
+
+            if (bvh[ibvh].child >= 0) {
+                stack[nstack++] = bvh[ibvh].child;
+                stack[nstack++] = bvh[ibvh].child + 1;
+                continue;
+            }
+
+            for (itri = bvh[ibvh].itri; itri < bvh[ibvh].itri+bvh[ibvh].ntri; itri++) {
+                dist2 = triDist2(xyz, &(tris[itri]), uv);
+                if (dist2 > r2) continue;
+
+                iface = tris[itri].iface;
+                if (mark[iface] != ipnt) {
+                    mark[iface]     = ipnt;
+                    cand[ncand++]   = iface;
+                } else if (dist2 >= guess[3*iface]) {
+                    continue;
+                }
+                guess[3*iface  ] = dist2;
+                guess[3*iface+1] = uv[0];
+                guess[3*iface+2] = uv[1];
+            }
+        }
+    }
+
+    /* visit the candidates in Face order (so that ties are broken as
+       they are in pointToBrepDist) */
+    for (icand = 1; icand < ncand; icand++) {
+        iface = cand[icand];
+        for (jcand = icand; jcand > 0 && cand[jcand-1] > iface; jcand--) {
+            cand[jcand] = cand[jcand-1];
+        }
+        cand[jcand] = iface;
+    }
+
+    dbest     = 1e6;
+    ifbest    = -1;
+    uvbest[0] = 0;
+    uvbest[1] = 0;
+
+    for (icand = 0; icand < ncand; icand++) {
+        iface = cand[icand];
+
+        /* start from the guess, but use the full inverse evaluation if
+           that fails or lands outside of the Face */
+        pnt[0] = xyz[0];
+        pnt[1] = xyz[1];
+        pnt[2] = xyz[2];
+        uv[0]  = guess[3*iface+1];
+        uv[1]  = guess[3*iface+2];
+
+        status = EG_invEvaluateGuess(data->faces[iface].eface, pnt, uv, xyz_out);
+        if (status != EGADS_SUCCESS || EG_inFace(data->faces[iface].eface, uv) != EGADS_SUCCESS) {
+            pnt[0] = xyz[0];
+            pnt[1] = xyz[1];
+            pnt[2] = xyz[2];
+
+            status = EG_invEvaluate(data->faces[iface].eface, pnt, uv, xyz_out);
+            if (status < EGADS_SUCCESS) goto cleanup;
+        }
+
+        dtest = sqrt((xyz_out[0]-xyz[0]) * (xyz_out[0]-xyz[0])
+                    +(xyz_out[1]-xyz[1]) * (xyz_out[1]-xyz[1])
+                    +(xyz_out[2]-xyz[2]) * (xyz_out[2]-xyz[2]));
+
+        if (dtest < dbest) {
+            dbest     = dtest;
+            ifbest    = iface;
+            uvbest[0] = uv[0];
+            uvbest[1] = uv[1];
+        }
+    }
+
+    /* fall back to an exhaustive search if the tessellation did not help */
+    if (ifbest < 0) {
+        dbest  = 1e6;
+        status = pointToBrepDist(xyz, data->nface, data->faces, &dbest, &ifbest, uvbest);
+        if (status < EGADS_SUCCESS) goto cleanup;
+
+        if (ifbest < 0) {
+            status = EGADS_NOTFOUND;
+            goto cleanup;
+        }
+    }
+
+    data->dist[    ipnt  ] = dbest;
+    data->ifbest[  ipnt  ] = ifbest;
+    data->uvbest[2*ipnt  ] = uvbest[0];
+    data->uvbest[2*ipnt+1] = uvbest[1];
+
+cleanup:
+    return status;
+}
+
+
+
+/***********************************************************************/
+/*                                                                     */
+/*   compareThread - process blocks of points (in a thread)            */
+/*                                                                     */
+/***********************************************************************/
+
+static void
+compareThread(void    *struc)           /* (in)  shared data */
+{
+    int        status = EGADS_SUCCESS;  /* return status */
+
+    int        ipnt, iend, iface, ihist, ndist=0;
+    int        *hist=NULL, *mark=NULL, *cand=NULL, *stack=NULL;
+    long       ID;
+    double     distmax=0, distavg=0, distrms=0, *guess=NULL;
+    compare_TT *data = (compare_TT *) struc;
+
+    /* --------------------------------------------------------------- */
+
+    ID = EMP_ThreadID();
+
+    /* scratch space and accumulators for this thread */
+    hist  = (int    *) EG_alloc(  data->nhist   *sizeof(int   ));
+    mark  = (int    *) EG_alloc(  data->nface   *sizeof(int   ));
+    cand  = (int    *) EG_alloc(  data->nface   *sizeof(int   ));
+    guess = (double *) EG_alloc(3*data->nface   *sizeof(double));
+    stack = (int    *) EG_alloc( (data->depth+1)*sizeof(int   ));
+
+    if (hist == NULL || mark == NULL || cand == NULL || guess == NULL || stack == NULL) {
+        status = EGADS_MALLOC;
+        goto cleanup;
+    }
+
+    for (ihist = 0; ihist < data->nhist; ihist++) {
+        hist[ihist] = 0;
+    }
+    for (iface = 0; iface < data->nface; iface++) {
+        mark[iface] = -1;
+    }
+
+    /* get blocks of points until they are all done (or there is an error) */
+    for (;;) {
+        if (data->mutex != NULL) EMP_LockSet(data->mutex);
+        ipnt = data->index;
+        data->index += PNTBLOCK;
+        if (data->status != EGADS_SUCCESS) ipnt = data->end;
+        if (data->mutex != NULL) EMP_LockRelease(data->mutex);
+
+        if (ipnt >= data->end) break;
+
+        iend = MIN(ipnt+PNTBLOCK, data->end);
+
+        for (; ipnt < iend; ipnt++) {
+            status = closestFace(data, ipnt, mark, cand, guess, stack);
+            if (status < EGADS_SUCCESS) goto cleanup;
+
+            distmax = MAX(distmax,  data->dist[ipnt]);
+            distavg =     distavg + data->dist[ipnt];
+            distrms =     distrms + data->dist[ipnt] * data->dist[ipnt];
+            ndist++;
+
+            status = addToHistogram(data->dist[ipnt], data->nhist, data->dhist, hist);
+            if (status < EGADS_SUCCESS) goto cleanup;
+        }
+    }
+
+cleanup:
+    /* merge into the shared accumulators (or remember the first error) */
+    if (data->mutex != NULL) EMP_LockSet(data->mutex);
+    if (status != EGADS_SUCCESS) {
+        if (data->status == EGADS_SUCCESS) data->status = status;
+    } else {
+        for (ihist = 0; ihist < data->nhist; ihist++) {
+            data->hist[ihist] += hist[ihist];
+        }
+        data->distmax  = MAX(data->distmax, distmax);
+        data->distavg += distavg;
+        data->distrms += distrms;
+        data->ndist   += ndist;
+    }
+    if (data->mutex != NULL) EMP_LockRelease(data->mutex);
+
+    if (stack != NULL) EG_free(stack);
+    if (guess != NULL) EG_free(guess);
+    if (cand  != NULL) EG_free(cand );
+    if (mark  != NULL) EG_free(mark );
+    if (hist  != NULL) EG_free(hist );
+
+    if (ID != data->master) EMP_ThreadExit();
+}
+
+
 
 /***********************************************************************/
 /*                                                                     */
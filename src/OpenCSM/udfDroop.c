@@ -517,20 +517,14 @@ udpSensitivity(ego    ebody,            /* (in)  Body pointer */
    /*@unused@*/double uvs[],            /* (in)  parametric coordinates for evaluation */
    /*@unused@*/double vels[])           /* (out) velocities */
 {
-    int iudp, judp;
+    int iudp;
 
     ROUTINE(udpSensitivity);
 
     /* --------------------------------------------------------------- */
 
     /* check that ebody matches one of the ebodys */
-    iudp = 0;
-    for (judp = 1; judp <= numUdp; judp++) {
-        if (ebody == udps[judp].ebody) {
-            iudp = judp;
-            break;
-        }
-    }
+    iudp = findUdp(ebody);
     if (iudp <= 0) {
         return EGADS_NOTMODEL;
     }
@@ -49,6 +49,12 @@ static double argDdefs[NUMUDPARGS] = {1e-6,     0.,       0.,       0.,       };
 #include "udpUtilities.c"
 
 #include "OpenCSM.h"
+
+#define           MIN(A,B)        (((A) < (B)) ? (A) : (B))
+#define           MAX(A,B)        (((A) < (B)) ? (B) : (A))
+
+static int matchNodes(int nnode1, ego enode1[], int nnode2, ego enode2[],
+                      double toler, int *nmatch, int *list1[], int *list2[]);
 
 /*
  ************************************************************************
@@ -68,10 +74,10 @@ udpExecute(ego  emodel,                 /* (in)  input model */
 
     ego     context, *ebodys;
 
-    int    oclass, mtype, inode1, inode2, nnode1, nnode2, nchild, *senses;
+    int    oclass, mtype, nnode1, nnode2, nchild, *senses;
     int    nmatch, i, *matches=NULL, *list1=NULL, *list2=NULL;
-    double data[18], xyz1[4], xyz2[4];
-    ego    *enode1, *enode2, eref, *echilds;
+    double data[18];
+    ego    *enode1, *enode2, eref;
 
 #ifdef DEBUG
     printf("udpExecute(emodel=%llx)\n", (long long)emodel);
@@ -141,36 +147,10 @@ udpExecute(ego  emodel,                 /* (in)  input model */
     status = EG_getBodyTopos(ebodys[1], NULL, NODE, &nnode2, &enode2);
     if (status != EGADS_SUCCESS) goto cleanup;
 
-    /* make an array to hold the possible Node matches */
-    list1 = (int *) malloc(nnode1*sizeof(int));
-    list2 = (int *) malloc(nnode2*sizeof(int));
-    if (list1 == NULL || list2 == NULL) {
-        status = EGADS_MALLOC;
-        goto cleanup;
-    }
-
     /* find Node matches */
-    nmatch = 0;
-
-    for (inode1 = 0; inode1 < nnode1; inode1++) {
-        status = EG_getTopology(enode1[inode1], &eref, &oclass, &mtype,
-                                xyz1, &nchild, &echilds, &senses);
-        if (status != EGADS_SUCCESS) goto cleanup;
-
-        for (inode2 = 0; inode2 < nnode2; inode2++) {
-            status = EG_getTopology(enode2[inode2], &eref, &oclass, &mtype,
-                                    xyz2, &nchild, &echilds, &senses);
-            if (status != EGADS_SUCCESS) goto cleanup;
-
-            if (fabs(xyz1[0]-xyz2[0]) < TOLER(0) &&
-                fabs(xyz1[1]-xyz2[1]) < TOLER(0) &&
-                fabs(xyz1[2]-xyz2[2]) < TOLER(0)   ) {
-                list1[nmatch] = inode1 + 1;
-                list2[nmatch] = inode2 + 1;
-                nmatch++;
-            }
-        }
-    }
+    status = matchNodes(nnode1, enode1, nnode2, enode2, TOLER(0),
+                        &nmatch, &list1, &list2);
+    if (status != EGADS_SUCCESS) goto cleanup;
 
     EG_free(enode1);
     EG_free(enode2);
@@ -305,20 +285,14 @@ udpSensitivity(ego    ebody,            /* (in)  Body pointer */
    /*@unused@*/double uvs[],            /* (in)  parametric coordinates for evaluation */
    /*@unused@*/double vels[])           /* (out) velocities */
 {
-    int iudp, judp;
+    int iudp;
 
     ROUTINE(udpSensitivity);
 
     /* --------------------------------------------------------------- */
 
     /* check that ebody matches one of the ebodys */
-    iudp = 0;
-    for (judp = 1; judp <= numUdp; judp++) {
-        if (ebody == udps[judp].ebody) {
-            iudp = judp;
-            break;
-        }
-    }
+    iudp = findUdp(ebody);
     if (iudp <= 0) {
         return EGADS_NOTMODEL;
     }
@@ -326,3 +300,192 @@ udpSensitivity(ego    ebody,            /* (in)  Body pointer */
     /* this routine is not written yet */
     return EGADS_NOLOAD;
 }
+
+
+
+/*
+ ************************************************************************
+ *                                                                      *
+ *   matchNodes - find Nodes in two Bodys that are within toler         *
+ *                                                                      *
+ ************************************************************************
+ */
+
+static int
+matchNodes(int    nnode1,               /* (in)  number of Nodes in Body 1 */
+           ego    enode1[],             /* (in)  Nodes in Body 1 */
+           int    nnode2,               /* (in)  number of Nodes in Body 2 */
+           ego    enode2[],             /* (in)  Nodes in Body 2 */
+           double toler,                /* (in)  tolerance in each direction */
+           int    *nmatch,              /* (out) number of matches */
+           int    *list1[],             /* (out) Nodes in Body 1 (bias-1, freeable) */
+           int    *list2[])             /* (out) Nodes in Body 2 (bias-1, freeable) */
+{
+    int    status = EGADS_SUCCESS;      /* (out) return status */
+
+    int    inode1, inode2, oclass, mtype, nchild, *senses, mmatch, imatch, jmatch, itemp;
+    int    nhash, ihash, *head=NULL, *next=NULL, *cell2=NULL, cell[3], i, j, k;
+    double *xyz1=NULL, *xyz2=NULL, bbox[6], size, data[4];
+    int    *ptemp;
+    ego    eref, *echilds;
+
+    ROUTINE(matchNodes);
+
+    /* --------------------------------------------------------------- */
+
+    *nmatch = 0;
+    *list1  = NULL;
+    *list2  = NULL;
+
+    if (nnode1 <= 0 || nnode2 <= 0 || toler <= 0) goto cleanup;
+
+    /* get the coordinates of all the Nodes once */
+    MALLOC(xyz1, double, 3*nnode1);
+    MALLOC(xyz2, double, 3*nnode2);
+
+    for (inode1 = 0; inode1 < nnode1; inode1++) {
+        status = EG_getTopology(enode1[inode1], &eref, &oclass, &mtype,
+                                data, &nchild, &echilds, &senses);
+        CHECK_STATUS(EG_getTopology);
+
+        xyz1[3*inode1  ] = data[0];
+        xyz1[3*inode1+1] = data[1];
+        xyz1[3*inode1+2] = data[2];
+    }
+
+    for (inode2 = 0; inode2 < nnode2; inode2++) {
+        status = EG_getTopology(enode2[inode2], &eref, &oclass, &mtype,
+                                data, &nchild, &echilds, &senses);
+        CHECK_STATUS(EG_getTopology);
+
+        for (k = 0; k < 3; k++) {
+            xyz2[3*inode2+k] = data[k];
+            if (inode2 == 0) {
+                bbox[k  ] = data[k];
+                bbox[k+3] = data[k];
+            } else {
+                bbox[k  ] = MIN(bbox[k  ], data[k]);
+                bbox[k+3] = MAX(bbox[k+3], data[k]);
+            }
+        }
+    }
+
+    /* hash the Nodes of Body 2 into a uniform grid of cells that are at
+       least toler on a side, so that any match for a Node in Body 1
+       lies in its own cell or one of its 26 neighbors.  the cells are
+       made larger if needed to keep the cell indices reasonable */
+    size = MAX(bbox[3]-bbox[0], MAX(bbox[4]-bbox[1], bbox[5]-bbox[2]));
+    size = MAX(toler, size/1048576);
+
+    nhash = 64;
+    while (nhash < 2*nnode2) {
+        nhash *= 2;
+    }
+
+    MALLOC(head,  int, nhash   );
+    MALLOC(next,  int, nnode2  );
+    MALLOC(cell2, int, 3*nnode2);
+
+    for (ihash = 0; ihash < nhash; ihash++) {
+        head[ihash] = -1;
+    }
+
+    for (inode2 = 0; inode2 < nnode2; inode2++) {
+        for (k = 0; k < 3; k++) {
+            cell2[3*inode2+k] = (int) floor((xyz2[3*inode2+k] - bbox[k]) / size);
+        }
+
+        ihash = (int) ((  (unsigned) cell2[3*inode2  ] * 73856093u
+                        ^ (unsigned) cell2[3*inode2+1] * 19349663u
+                        ^ (unsigned) cell2[3*inode2+2] * 83492791u) & (unsigned) (nhash-1));
+
+        next[inode2] = head[ihash];
+        head[ihash]  = inode2;
+    }
+
+    /* look for the matches of each Node in Body 1 (in the same order
+       as an all-pairs search would find them) */
+    mmatch = 0;
+
+    for (inode1 = 0; inode1 < nnode1; inode1++) {
+
+        /* Nodes outside the (grown) bbox of Body 2 cannot match */
+        for (k = 0; k < 3; k++) {
+            if (xyz1[3*inode1+k] < bbox[k  ]-toler ||
+                xyz1[3*inode1+k] > bbox[k+3]+toler   ) break;
+        }
+        if (k < 3) continue;
+
+        imatch = *nmatch;
+
+        for (i = -1; i <= 1; i++) {
+            for (j = -1; j <= 1; j++) {
+                for (k = -1; k <= 1; k++) {
+                    cell[0] = (int) floor((xyz1[3*inode1  ] - bbox[0]) / size) + i;
+                    cell[1] = (int) floor((xyz1[3*inode1+1] - bbox[1]) / size) + j;
+                    cell[2] = (int) floor((xyz1[3*inode1+2] - bbox[2]) / size) + k;
+
+                    ihash = (int) ((  (unsigned) cell[0] * 73856093u
+                                    ^ (unsigned) cell[1] * 19349663u
+                                    ^ (unsigned) cell[2] * 83492791u) & (unsigned) (nhash-1));
+
+                    for (inode2 = head[ihash]; inode2 >= 0; inode2 = next[inode2]) {
+                        if (cell2[3*inode2  ] != cell[0] ||
+                            cell2[3*inode2+1] != cell[1] ||
+                            cell2[3*inode2+2] != cell[2]   ) continue;
+
+                        if (fabs(xyz1[3*inode1  ]-xyz2[3*inode2  ]) < toler &&
+                            fabs(xyz1[3*inode1+1]-xyz2[3*inode2+1]) < toler &&
+                            fabs(xyz1[3*inode1+2]-xyz2[3*inode2+2]) < toler   ) {
+                            if (*nmatch >= mmatch) {
+                                mmatch += MAX(nnode1, 100);
+
+                                itemp = 0;
+                                if ((ptemp = (int *) realloc(*list1, mmatch*sizeof(int))) != NULL) {
+                                    *list1 = ptemp;
+                                    itemp++;
+                                }
+                                if ((ptemp = (int *) realloc(*list2, mmatch*sizeof(int))) != NULL) {
+                                    *list2 = ptemp;
+                                    itemp++;
+                                }
+                                if (itemp != 2) {
+                                    status = EGADS_MALLOC;
+                                    goto cleanup;
+                                }
+                            }
+
+                            (*list1)[*nmatch] = inode1 + 1;
+                            (*list2)[*nmatch] = inode2 + 1;
+                            (*nmatch)++;
+                        }
+                    }
+                }
+            }
+        }
+
+        /* sort the matches for this Node by their Node in Body 2 */
+        for (jmatch = imatch+1; jmatch < *nmatch; jmatch++) {
+            itemp = (*list2)[jmatch];
+            for (i = jmatch; i > imatch && (*list2)[i-1] > itemp; i--) {
+                (*list2)[i] = (*list2)[i-1];
+            }
+            (*list2)[i] = itemp;
+        }
+    }
+
+cleanup:
+    FREE(xyz1);
+    FREE(xyz2);
+    FREE(head);
+    FREE(next);
+    FREE(cell2);
+
+    if (status != EGADS_SUCCESS) {
+        if (*list1 != NULL) {free(*list1);  *list1 = NULL;}
+        if (*list2 != NULL) {free(*list2);  *list2 = NULL;}
+        *nmatch = 0;
+    }
+
+    return status;
+}
@@ -340,7 +340,7 @@ udpSensitivity(ego    ebody,            /* (in)  Body pointer */
 {
     int    status = EGADS_SUCCESS;
 
-    int    iudp, judp, nnode, nedge, nface, ipnt, oclass, mtype, nchild, *senses;
+    int    iudp, nnode, nedge, nface, ipnt, oclass, mtype, nchild, *senses;
     int    iupper, ilower;
     double Hup, Hupdot, Hlo, Hlodot, L, Rup, Rupdot, Rlo, Rlodot;
     double Tup, Tupdot, Tlo, Tlodot, xcup, xcupdot, xclo, xclodot, ycup, ycupdot, yclo, yclodot;
@@ -353,13 +353,7 @@ udpSensitivity(ego    ebody,            /* (in)  Body pointer */
 #endif
 
     /* check that ebody matches one of the ebodys */
-    iudp = 0;
-    for (judp = 1; judp <= numUdp; judp++) {
-        if (ebody == udps[judp].ebody) {
-            iudp = judp;
-            break;
-        }
-    }
+    iudp = findUdp(ebody);
     if (iudp <= 0) {
         return EGADS_NOTMODEL;
     }
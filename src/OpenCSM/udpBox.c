@@ -999,7 +999,7 @@ udpSensitivity(ego    ebody,            /* (in)  Body pointer */
 {
     int    status = EGADS_SUCCESS;
 
-    int    iudp, judp, ipnt, nnode, nedge, nface, nchild, oclass, mtype, *senses;
+    int    iudp, ipnt, nnode, nedge, nface, nchild, oclass, mtype, *senses;
     double data[18];
     ego    eref, *echilds, *enodes, *eedges, *efaces, eent;
 
@@ -1009,13 +1009,7 @@ udpSensitivity(ego    ebody,            /* (in)  Body pointer */
 #endif
 
     /* check that ebody matches one of the ebodys */
-    iudp = 0;
-    for (judp = 1; judp <= numUdp; judp++) {
-        if (ebody == udps[judp].ebody) {
-            iudp = judp;
-            break;
-        }
-    }
+    iudp = findUdp(ebody);
     if (iudp <= 0) {
         status = EGADS_NOTMODEL;
         goto cleanup;
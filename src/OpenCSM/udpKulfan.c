@@ -400,7 +400,7 @@ udpSensitivity(ego    ebody,            /* (in)  Body pointer */
 {
 //$$$    int    status = EGADS_SUCCESS;
 
-    int    iudp, judp;
+    int    iudp;
 
 //$$$    int    ipnt, nedge, r, n;
 //$$$    double xyz[18], shape, shape_dot, s, K, temp;
@@ -412,13 +412,7 @@ udpSensitivity(ego    ebody,            /* (in)  Body pointer */
 //$$$#endif
 
     /* check that ebody matches one of the ebodys */
-    iudp = 0;
-    for (judp = 1; judp <= numUdp; judp++) {
-        if (ebody == udps[judp].ebody) {
-            iudp = judp;
-            break;
-        }
-    }
+    iudp = findUdp(ebody);
     if (iudp <= 0) {
         return EGADS_NOTMODEL;
     }
@@ -722,7 +722,7 @@ udpSensitivity(ego    ebody,            /* (in)  Body pointer */
 {
     int    status = EGADS_SUCCESS;
 
-    int    iudp, judp, ipnt, nnode, nedge, nface, nchild, oclass, mtype, *senses;
+    int    iudp, ipnt, nnode, nedge, nface, nchild, oclass, mtype, *senses;
     int    sharpte, iter;
     double x, dx, dx_ds, dx_dt, y, dy, dy_ds, dy_dt, dyt_ds, dyt_dt, dyc_ds, th, dth_ds, D;
     double s, t, t_dot, m, m_dot, p;
@@ -736,13 +736,7 @@ udpSensitivity(ego    ebody,            /* (in)  Body pointer */
 #endif
 
     /* check that ebody matches one of the ebodys */
-    iudp = 0;
-    for (judp = 1; judp <= numUdp; judp++) {
-        if (ebody == udps[judp].ebody) {
-            iudp = judp;
-            break;
-        }
-    }
+    iudp = findUdp(ebody);
     if (iudp <= 0) {
         return EGADS_NOTMODEL;
     }
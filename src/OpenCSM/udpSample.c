@@ -558,7 +558,7 @@ udpSensitivity(ego    ebody,            /* (in)  Body pointer */
 {
     int    status = EGADS_SUCCESS;
 
-    int    iudp, judp, i, inode, iedge, iface;
+    int    iudp, i, inode, iedge, iface;
     double dx_dot, dy_dot, dz_dot;
 
 #ifdef DEBUG
@@ -567,13 +567,7 @@ udpSensitivity(ego    ebody,            /* (in)  Body pointer */
 #endif
 
     /* check that ebody matches one of the ebodys */
-    iudp = 0;
-    for (judp = 1; judp <= numUdp; judp++) {
-        if (ebody == udps[judp].ebody) {
-            iudp = judp;
-            break;
-        }
-    }
+    iudp = findUdp(ebody);
     if (iudp <= 0) {
         status = EGADS_NOTMODEL;
         goto cleanup;
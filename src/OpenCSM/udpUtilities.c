@@ -32,6 +32,10 @@
 
 #define STRLEN(A)   (int)strlen(A)
 
+static int  findUdp(ego ebody);
+static int  hashUdp(ego ebody, int iudp);
+static void freeUdp(int iudp);
+
 
 /*
  ************************************************************************
@@ -289,8 +293,18 @@ udpReset(int flag)                      /* (in)  flag: 0=reset current, 1=close
         }
 
         EG_free(udps);
-        udps   = NULL;
-        numUdp = 0;
+        udps     = NULL;
+        numUdp   = 0;
+        numFreed = 0;
+
+        /* hash table */
+        if (udpHash != NULL) {
+            EG_free(udpHash);
+        }
+        udpHash     = NULL;
+        udpHashSize = 0;
+        udpHashUsed = 0;
+        udpHashed   = 0;
     }
 
     return EGADS_SUCCESS;
@@ -441,7 +455,7 @@ udpGet(ego    ebody,                    /* (in)  Body pointer */
        char   name[],                   /* (in)  argument name */
        void   *value)                   /* (out) argument value (can be int* or double*) */
 {
-    int  i, iudp, judp, iarg;
+    int  i, iudp, iarg;
     char lowername[257];
 
 #ifdef DEBUG
@@ -459,16 +473,7 @@ udpGet(ego    ebody,                    /* (in)  Body pointer */
     }
 
     /* check that ebody matches one of the ebodys */
-    iudp = 0;
-    for (judp = 1; judp <= numUdp; judp++) {
-#ifdef DEBUG
-        printf("udpGet: udps[%d].ebody=%lx\n", judp, (long)(udps[judp].ebody));
-#endif
-        if (ebody == udps[judp].ebody) {
-            iudp = judp;
-            break;
-        }
-    }
+    iudp = findUdp(ebody);
     if (iudp <= 0) {
         return EGADS_NOTMODEL;
     }
@@ -517,7 +522,7 @@ udpVel(ego    ebody,                    /* (in)  Body pointer */
        double dot[],                    /* (in)  argument velocity(s) */
        int    ndot)                     /* (in)  number of velocities */
 {
-    int  i, iudp, judp, iarg, idot, hasdots;
+    int  i, iudp, iarg, idot, hasdots;
     char lowername[257];
 
 #ifdef DEBUG
@@ -537,16 +542,7 @@ udpVel(ego    ebody,                    /* (in)  Body pointer */
     }
 
     /* check that ebody matches one of the ebodys */
-    iudp = 0;
-    for (judp = 1; judp <= numUdp; judp++) {
-#ifdef DEBUG
-        printf("udpVel: udps[%d].ebody=%lx\n", judp, (long)(udps[judp].ebody));
-#endif
-        if (ebody == udps[judp].ebody) {
-            iudp = judp;
-            break;
-        }
-    }
+    iudp = findUdp(ebody);
     if (iudp <= 0) {
         return EGADS_NOTMODEL;
     }
@@ -610,72 +606,66 @@ udpVel(ego    ebody,                    /* (in)  Body pointer */
 int
 udpClean(ego ebody)                     /* (in)   Body pointer to clean from cache */
 {
-    int iudp, judp, iarg;
+    int iudp, judp;
 
 #ifdef DEBUG
     printf("udpClean(ebody=%llx)\n", (long long)ebody);
 #endif
 
     /* check that ebody matches one of the ebodys */
-    iudp = 0;
-    for (judp = 1; judp <= numUdp; judp++) {
-#ifdef DEBUG
-        printf("udpClean: udps[%d].ebody=%lx\n", judp, (long)(udps[judp].ebody));
-#endif
-        if (ebody == udps[judp].ebody) {
-            iudp = judp;
-
-            break;
-        }
-    }
+    iudp = findUdp(ebody);
     if (iudp <= 0) {
         return EGADS_NOTMODEL;
     }
 
-    /* remove ebody from the udp's cache */
+    /* remove ebody, its arguments, and any private data from udp's cache */
+    freeUdp(iudp);
     udps[iudp].ebody = NULL;
-
-    /* remove any private data from udp's cache */
-    if (udps[iudp].data != NULL) {
-#ifdef FREEUDPDATA
-        FREEUDPDATA(udps[iudp].data);
-#else
-        EG_free(udps[iudp].data);
-#endif
-        udps[iudp].data = NULL;
-    }
-
-    /* decrement number of udps based upon NULL ebody entries */
-    while (numUdp > 0) {
-        if (udps[numUdp].ebody == NULL) {
-
-            /* arguments */
-            for (iarg = 0; iarg < NUMUDPARGS; iarg++) {
-                if (udps[numUdp].arg[iarg].val != NULL) {
-                    EG_free(udps[numUdp].arg[iarg].val);
+    udps[iudp].freed = 1;
+    numFreed++;
+
+    /* fill the freed slots with the last udps (which have their Bodys, so
+       they are not being executed) so that the cache does not grow as
+       Bodys are rebuilt */
+    judp = 0;
+    while (numFreed > 0) {
+
+        /* decrement number of udps based upon NULL ebody entries */
+        while (numUdp > 0) {
+            if (udps[numUdp].ebody == NULL) {
+                if (udps[numUdp].freed == 1) {
+                    numFreed--;
                 }
+                freeUdp(numUdp);
 
-                if (udps[numUdp].arg[iarg].dot != NULL) {
-                    EG_free(udps[numUdp].arg[iarg].dot);
-                }
+                numUdp--;
+            } else {
+                break;
             }
+        }
 
-            /* private data */
-            if (udps[numUdp].data != NULL) {
-#ifdef FREEUDPDATA
-                FREEUDPDATA(udps[numUdp].data);
-#else
-                EG_free(udps[numUdp].data);
-#endif
-                udps[numUdp].data = NULL;
-            }
+        for (judp++; judp < numUdp; judp++) {
+            if (udps[judp].ebody == NULL && udps[judp].freed == 1) break;
+        }
+        if (judp >= numUdp) break;
 
-            numUdp--;
-        } else {
-            break;
+        udps[judp] = udps[numUdp];
+        numUdp--;
+        numFreed--;
+
+        if (udpHashed > numUdp) {
+            udpHashed = numUdp;
+        }
+        if (judp <= udpHashed) {
+            (void) hashUdp(udps[judp].ebody, judp);
         }
     }
 
+    /* the hash table only needs to know about the remaining udps */
+    if (udpHashed > numUdp) {
+        udpHashed = numUdp;
+    }
+
     return EGADS_SUCCESS;
 }
 
@@ -696,7 +686,7 @@ udpMesh(ego    ebody,                   /* (in)  Body pointer for mesh */
         int    *kmax,                   /* (out) k-dimension of mesh */
         double *mesh[])                 /* (out) array of mesh points */
 {
-    int    iudp, judp;
+    int    iudp;
 
 #ifdef DEBUG
     printf("udpMesh(ebody=%llx)\n", (long long)ebody);
@@ -708,16 +698,7 @@ udpMesh(ego    ebody,                   /* (in)  Body pointer for mesh */
     *mesh = NULL;
 
     /* check that ebody matches one of the ebodys */
-    iudp = 0;
-    for (judp = 1; judp <= numUdp; judp++) {
-#ifdef DEBUG
-        printf("udpMesh: udps[%d].ebody=%lx\n", judp, (long)(udps[judp].ebody));
-#endif
-        if (ebody == udps[judp].ebody) {
-            iudp = judp;
-            break;
-        }
-    }
+    iudp = findUdp(ebody);
     if (iudp <= 0) {
         return EGADS_NOTMODEL;
     }
@@ -750,6 +731,7 @@ cacheUdp()
     udps = (udp_T *) EG_reall(udps, (numUdp+1)*sizeof(udp_T));
     if (udps == NULL) return EGADS_MALLOC;
     udps[numUdp].ebody = NULL;
+    udps[numUdp].freed = 0;
 
     /* copy info from udps[0] into udps[numUdp] */
     udps[numUdp].data = udps[0].data;
@@ -818,3 +800,188 @@ cacheUdp()
 
     return EGADS_SUCCESS;
 }
+
+
+
+/*
+ ************************************************************************
+ *                                                                      *
+ *   findUdp - find the index of the UDP that made a Body               *
+ *                                                                      *
+ ************************************************************************
+ */
+
+static int
+findUdp(ego    ebody)                   /* (in)  Body pointer */
+{
+    int    iudp, judp, ihash, mask, status;
+
+#ifdef DEBUG
+    printf("findUdp(ebody=%llx)\n", (long long)ebody);
+#endif
+
+    if (ebody == NULL || numUdp <= 0) {
+        return 0;
+    }
+
+    /* add any Bodys that were made since the last lookup to the hash
+       table.  a udp that did not have its Body yet (because it was still
+       being executed) is found by the linear search below */
+    for (judp = udpHashed+1; judp <= numUdp; judp++) {
+        if (udps[judp].ebody != NULL) {
+            status = hashUdp(udps[judp].ebody, judp);
+            if (status < EGADS_SUCCESS) break;
+        }
+
+        udpHashed = judp;
+    }
+
+    /* look up ebody.  an entry is only valid if udps still holds
+       the same Body (the udp may have been cleaned or moved) */
+    if (udpHash != NULL) {
+        mask  = udpHashSize - 1;
+        ihash = (int)(((((size_t)ebody) >> 4) * 2654435761u) & (size_t)mask);
+
+        while (udpHash[ihash].ebody != NULL) {
+            if (udpHash[ihash].ebody == ebody) {
+                iudp = udpHash[ihash].iudp;
+                if (iudp > 0 && iudp <= numUdp && udps[iudp].ebody == ebody) {
+                    return iudp;
+                }
+                break;
+            }
+            ihash = (ihash + 1) & mask;
+        }
+    }
+
+    /* fall back to a linear search (most recent first) */
+    for (judp = numUdp; judp > 0; judp--) {
+        if (ebody == udps[judp].ebody) {
+            return judp;
+        }
+    }
+
+    return 0;
+}
+
+
+
+/*
+ ************************************************************************
+ *                                                                      *
+ *   hashUdp - add (or update) a Body in the hash table                 *
+ *                                                                      *
+ ************************************************************************
+ */
+
+static int
+hashUdp(ego    ebody,                   /* (in)  Body pointer */
+        int    iudp)                    /* (in)  index into udps */
+{
+    int       ihash, jhash, mask, size;
+    udphash_T *temp;
+
+    /* grow (or rebuild) the table if it would become more than half full.
+       entries for Bodys that have since been cleaned are dropped here */
+    if (2*(udpHashUsed+1) > udpHashSize) {
+        size = 64;
+        while (size < 4*(numUdp+1)) {
+            size *= 2;
+        }
+
+        temp = (udphash_T *) EG_alloc(size*sizeof(udphash_T));
+        if (temp == NULL) return EGADS_MALLOC;
+
+        for (ihash = 0; ihash < size; ihash++) {
+            temp[ihash].ebody = NULL;
+            temp[ihash].iudp  = 0;
+        }
+
+        if (udpHash != NULL) {
+            EG_free(udpHash);
+        }
+        udpHash     = temp;
+        udpHashSize = size;
+        udpHashUsed = 0;
+
+        /* re-add the udps that have already been hashed */
+        for (jhash = 1; jhash <= udpHashed && jhash <= numUdp; jhash++) {
+            if (udps[jhash].ebody != NULL) {
+                (void) hashUdp(udps[jhash].ebody, jhash);
+            }
+        }
+    }
+
+    /* linear probing; a later udp with the same Body pointer (which
+       happens when EGADS re-uses the memory of a deleted Body) wins */
+    mask  = udpHashSize - 1;
+    ihash = (int)(((((size_t)ebody) >> 4) * 2654435761u) & (size_t)mask);
+
+    while (udpHash[ihash].ebody != NULL && udpHash[ihash].ebody != ebody) {
+        ihash = (ihash + 1) & mask;
+    }
+
+    if (udpHash[ihash].ebody == NULL) {
+        udpHashUsed++;
+
+    /* the Body of the earlier udp must have been deleted for its memory
+       to be re-used, so its arguments and private data can be freed now
+       (its slot is filled the next time udpClean is called) */
+    } else {
+        jhash = udpHash[ihash].iudp;
+        if (jhash > 0 && jhash < iudp && jhash <= numUdp &&
+            udps[jhash].ebody == ebody) {
+            freeUdp(jhash);
+            udps[jhash].ebody = NULL;
+            udps[jhash].freed = 1;
+            numFreed++;
+        }
+    }
+    udpHash[ihash].ebody = ebody;
+    udpHash[ihash].iudp  = iudp;
+
+    return EGADS_SUCCESS;
+}
+
+
+
+/*
+ ************************************************************************
+ *                                                                      *
+ *   freeUdp - free the arguments and private data of a UDP             *
+ *                                                                      *
+ ************************************************************************
+ */
+
+static void
+freeUdp(int    iudp)                    /* (in)  index into udps */
+{
+    int    iarg;
+
+    /* arguments */
+    for (iarg = 0; iarg < NUMUDPARGS; iarg++) {
+        if (udps[iudp].arg[iarg].val != NULL) {
+            EG_free(udps[iudp].arg[iarg].val);
+        }
+        udps[iudp].arg[iarg].val = NULL;
+
+        if (udps[iudp].arg[iarg].dot != NULL) {
+            EG_free(udps[iudp].arg[iarg].dot);
+        }
+        udps[iudp].arg[iarg].dot = NULL;
+        udps[iudp].arg[iarg].size = 0;
+    }
+
+    /* private data */
+    if (udps[iudp].data != NULL) {
+#ifdef FREEUDPDATA
+        FREEUDPDATA(udps[iudp].data);
+#else
+        EG_free(udps[iudp].data);
+#endif
+        udps[iudp].data = NULL;
+    }
+}
+
+
+
@@ -99,11 +99,24 @@ typedef struct {
     ego        ebody;
     udparg_T   arg[NUMUDPARGS];
     void       *data;         /* private data */
+    int        freed;         /* =1 if the Body was deleted and the slot can be re-used */
 } udp_T;
 
+typedef struct {
+    ego        ebody;         /* Body pointer (key) */
+    int        iudp;          /* index into udps */
+} udphash_T;
+
 /* storage for UDPs */
-static int    numUdp = 0;     /* number of UDPs */
-static udp_T  *udps  = NULL;  /* array  of UDPs */
+static int       numUdp   = 0;     /* number of UDPs */
+static udp_T     *udps    = NULL;  /* array  of UDPs */
+static int       numFreed = 0;     /* number of freed slots in udps[1:numUdp] */
+
+/* hash table that maps ebody to an index in udps */
+static int       udpHashSize = 0;     /* size of hash table (power of 2) */
+static int       udpHashUsed = 0;     /* number of used entries in hash table */
+static int       udpHashed   = 0;     /* udps[1:udpHashed] are in hash table */
+static udphash_T *udpHash    = NULL;  /* hash table */
 
 #endif  /* _UDPUTILITIES_H_ */
 
@@ -74,16 +74,56 @@ typedef struct {
     char   **avalu;                     /* array  of Attribute values */
 } seg_T;
 
+typedef struct {
+    int    nx;                          /* number of cells in X-direction */
+    int    ny;                          /* number of cells in Y-direction */
+    double xmin;                        /* X-coordinate of lower-left corner */
+    double ymin;                        /* Y-coordinate of lower-left corner */
+    double dx;                          /* cell size in X-direction */
+    double dy;                          /* cell size in Y-direction */
+    int    *head;                       /* first entry in each cell (or -1) */
+    int    nent;                        /* number of entries */
+    int    ment;                        /* maximum   entries */
+    int    *item;                       /* item  for each entry */
+    int    *next;                       /* next entry in same cell (or -1) */
+} grid_T;
+
+typedef struct {
+    double xmin;                        /* X-coordinate of origin */
+    double ymin;                        /* Y-coordinate of origin */
+    double size;                        /* cell size */
+    int    nhash;                       /* number of buckets (power of 2) */
+    int    *head;                       /* first Point in each bucket (or -1) */
+    int    mnext;                       /* size of next */
+    int    *next;                       /* next Point in same bucket (or -1) */
+} phash_T;
+
 /* prototype for function defined below */
 static int processSegments(         int *npnt, pnt_T *pnt_p[], int *nseg, seg_T *seg_p[]);
 static int processFile(ego context, int *npnt, pnt_T *pnt_p[], int *nseg, seg_T *seg_p[]);
 static int getToken(char *text, int nskip, char sep, int maxtok, char *token);
+static int intersectSegments(int *npnt, pnt_T *pnt_p[], int *nseg, seg_T *seg_p[]);
+static int assignIndices(int nseg, seg_T seg[]);
+static void segmentBox(pnt_T pnt[], seg_T *seg, double toler, double box[]);
+static int gridInit(grid_T *grid, double box[], int nitem);
+static void gridRange(grid_T *grid, double box[], int range[]);
+static int gridAdd(grid_T *grid, int item, double box[]);
+static int gridFind(grid_T *grid, double box[], int imin, int mark[], int stamp, int *nfound, int *found[], int *mfound);
+static void gridFree(grid_T *grid);
+static int phashInit(phash_T *phash, double box[], double toler, int npnt);
+static int phashCell(phash_T *phash, double x, double y, int di, int dj);
+static int phashAdd(phash_T *phash, pnt_T pnt[], int ipnt);
+static int phashFind(phash_T *phash, pnt_T pnt[], double x, double y, double toler);
+static void phashFree(phash_T *phash);
+static int compareInts(const void *a, const void *b);
 
 #ifdef GRAFIC
 static int     plotWaffle(int npnt, pnt_T pnt[], int nseg, seg_T seg[]);
 #endif
 
+#define           MIN(A,B)        (((A) < (B)) ? (A) : (B))
 #define           MAX(A,B)        (((A) < (B)) ? (B) : (A))
+#define           MINMAX(A,B,C)   MIN(MAX((A), (B)), (C))
 
 
 /*
@@ -103,15 +143,12 @@ udpExecute(ego  context,                /* (in)  EGADS context */
     int     status = EGADS_SUCCESS;
 
     int     ipnt, npnt, inode, nnode, iseg, jseg, nseg, jedge, jface, senses[4];
-    int     ibeg, iend, jbeg, jend, seginfo[2], jpnt, mpnt, mseg, iter, nchange, iattr;
-    double  xyz[20], data[6], xyz_out[20], D, s, t, xx, yy, frac, dist;
+    int     seginfo[2], iattr;
+    double  xyz[20], data[6], xyz_out[20];
     pnt_T   *pnt=NULL;
     seg_T   *seg=NULL;
-    void    *temp;
     ego     *enodes=NULL, *eedges=NULL, *efaces=NULL, ecurve, echild[4], eloop, eshell;
 
-    double  EPS06 = 1.0e-6;
-
 #ifdef DEBUG
     printf("udpExecute(context=%llx)\n", (long long)context);
     printf("depth(   0) = %f\n", DEPTH(     0));
@@ -185,294 +222,42 @@ udpExecute(ego  context,                /* (in)  EGADS context */
         if (status != EGADS_SUCCESS) goto cleanup;
     }
 
-    mpnt = npnt;
-    mseg = nseg;
-
-    /* check for intersections of Lines only */
-    for (jseg = 0; jseg < nseg; jseg++) {
-        if (seg[jseg].type == 0) continue;
-
-        for (iseg = jseg+1; iseg < nseg; iseg++) {
-            if (seg[iseg].type == 0) continue;
-
-            ibeg = seg[iseg].ibeg;
-            iend = seg[iseg].iend;
-            jbeg = seg[jseg].ibeg;
-            jend = seg[jseg].iend;
-
-            D = (pnt[iend].x - pnt[ibeg].x) * (pnt[jbeg].y - pnt[jend].y) - (pnt[jbeg].x - pnt[jend].x) * (pnt[iend].y - pnt[ibeg].y);
-            if (fabs(D) > EPS06) {
-                s = ((pnt[jbeg].x - pnt[ibeg].x) * (pnt[jbeg].y - pnt[jend].y) - (pnt[jbeg].x - pnt[jend].x) * (pnt[jbeg].y - pnt[ibeg].y)) / D;
-                t = ((pnt[iend].x - pnt[ibeg].x) * (pnt[jbeg].y - pnt[ibeg].y) - (pnt[jbeg].x - pnt[ibeg].x) * (pnt[iend].y - pnt[ibeg].y)) / D;
-
-                if (s > -EPS06 && s < 1+EPS06 &&
-                    t > -EPS06 && t < 1+EPS06   ) {
-                    xx = (1 - s) * pnt[ibeg].x + s * pnt[iend].x;
-                    yy = (1 - s) * pnt[ibeg].y + s * pnt[iend].y;
-
-                    ipnt = -1;
-                    for (jpnt = 0; jpnt < npnt; jpnt++) {
-                        if (fabs(xx-pnt[jpnt].x) < EPS06 &&
-                            fabs(yy-pnt[jpnt].y) < EPS06   ) {
-                            ipnt = jpnt;
-                            break;
-                        }
-                    }
-
-                    if (ipnt < 0) {
-                        if (npnt+1 >= mpnt) {
-                            mpnt += 10;
-
-                            temp = EG_reall(pnt, mpnt*sizeof(pnt_T));
-                            if (temp != NULL) {
-                                pnt = (pnt_T *) temp;
-                            } else {
-                                status = EGADS_MALLOC;
-                                goto cleanup;
-                            }
-                        }
-
-                        ipnt = npnt;
-
-                        pnt[npnt].type = 1;
-                        pnt[npnt].x    = xx;
-                        pnt[npnt].y    = yy;
-                        npnt++;
-                    }
-
-                    if ((ibeg != ipnt && iend != ipnt) ||
-                        (jbeg != ipnt && jend != ipnt)   ) {
-                        if (nseg+2 >= mseg) {
-                            mseg += 10;
-
-                            temp = EG_reall(seg, mseg*sizeof(seg_T));
-                            if (temp != NULL) {
-                                seg = (seg_T *) temp;
-                            } else {
-                                status = EGADS_MALLOC;
-                                goto cleanup;
-                            }
-                        }
-                    }
-
-                    if (ibeg != ipnt && iend != ipnt) {
-                        seg[nseg].type    = seg[iseg].type;
-                        seg[nseg].ibeg    = ipnt;
-                        seg[nseg].iend    = iend;
-                        seg[nseg].num     = seg[iseg].num;
-                        seg[nseg].idx     = 0;
-                        seg[nseg].name[0] = '\0';
-
-                        seg[nseg].nattr = seg[iseg].nattr;
-                        if (seg[nseg].nattr == 0) {
-                            seg[nseg].aname = NULL;
-                            seg[nseg].avalu = NULL;
-                        } else {
-                            seg[nseg].aname = (char **) EG_alloc(seg[nseg].nattr*sizeof(char *));
-                            seg[nseg].avalu = (char **) EG_alloc(seg[nseg].nattr*sizeof(char *));
-                            if (seg[nseg].aname == NULL || seg[nseg].avalu == NULL) {
-                                status = EGADS_MALLOC;
-                                goto cleanup;
-                            }
-                        }
-
-                        for (iattr = 0; iattr < seg[nseg].nattr; iattr++) {
-                            seg[nseg].aname[iattr] = (char *) EG_alloc(80*sizeof(char));
-                            seg[nseg].avalu[iattr] = (char *) EG_alloc(80*sizeof(char));
-                            if (seg[nseg].aname[iattr] == NULL || seg[nseg].avalu[iattr] == NULL) {
-                                status = EGADS_MALLOC;
-                                goto cleanup;
-                            }
-
-                            strncpy(seg[nseg].aname[iattr], seg[iseg].aname[iattr], 80);
-                            strncpy(seg[nseg].avalu[iattr], seg[iseg].avalu[iattr], 80);
-                        }
-
-                        nseg++;
-
-                        seg[iseg].iend = ipnt;
-                    }
-
-                    if (jbeg != ipnt && jend != ipnt) {
-                        seg[nseg].type    = seg[jseg].type;
-                        seg[nseg].ibeg    = ipnt;
-                        seg[nseg].iend    = jend;
-                        seg[nseg].num     = seg[jseg].num;
-                        seg[nseg].idx     = 0;
-                        seg[nseg].name[0] = '\0';
-
-                        seg[nseg].nattr = seg[jseg].nattr;
-                        if (seg[nseg].nattr == 0) {
-                            seg[nseg].aname = NULL;
-                            seg[nseg].avalu = NULL;
-                        } else {
-                            seg[nseg].aname = (char **) EG_alloc(seg[nseg].nattr*sizeof(char *));
-                            seg[nseg].avalu = (char **) EG_alloc(seg[nseg].nattr*sizeof(char *));
-                            if (seg[nseg].aname == NULL || seg[nseg].avalu == NULL) {
-                                status = EGADS_MALLOC;
-                                goto cleanup;
-                            }
-                        }
-
-                        for (iattr = 0; iattr < seg[nseg].nattr; iattr++) {
-                            seg[nseg].aname[iattr] = (char *) EG_alloc(80*sizeof(char));
-                            seg[nseg].avalu[iattr] = (char *) EG_alloc(80*sizeof(char));
-                            if (seg[nseg].aname[iattr] == NULL || seg[nseg].avalu[iattr] == NULL) {
-                                status = EGADS_MALLOC;
-                                goto cleanup;
-                            }
-
-                            strncpy(seg[nseg].aname[iattr], seg[jseg].aname[iattr], 80);
-                            strncpy(seg[nseg].avalu[iattr], seg[jseg].avalu[iattr], 80);
-                        }
-
-                        nseg++;
-
-                        seg[jseg].iend = ipnt;
-                    }
-                }
-            }
-        }
-    }
-
-    /* break Lines at Points */
-    for (iseg = 0; iseg < nseg; iseg++) {
-        if (seg[iseg].type == 0) continue;
-        
-        ibeg = seg[iseg].ibeg;
-        iend = seg[iseg].iend;
-
-        for (ipnt = 0; ipnt < npnt; ipnt++) {
-            if (pnt[ipnt].type == 0) continue;
-            
-            /* distance from Point to line */
-            frac   = ( (pnt[ipnt].x - pnt[ibeg].x) * (pnt[iend].x - pnt[ibeg].x)
-                     + (pnt[ipnt].y - pnt[ibeg].y) * (pnt[iend].y - pnt[ibeg].y))
-                   / ( (pnt[iend].x - pnt[ibeg].x) * (pnt[iend].x - pnt[ibeg].x)
-                     + (pnt[iend].y - pnt[ibeg].y) * (pnt[iend].y - pnt[ibeg].y));
-
-            if (frac < EPS06 || frac > 1-EPS06) continue;
-
-            xx = (1-frac) * pnt[ibeg].x + frac * pnt[iend].x;
-            yy = (1-frac) * pnt[ibeg].y + frac * pnt[iend].y;
-
-            dist = sqrt( (xx - pnt[ipnt].x) * (xx - pnt[ipnt].x)
-                       + (yy - pnt[ipnt].y) * (yy - pnt[ipnt].y));
-            
-
-            if (dist < EPS06) {
-
-                /* make room for new Segment */
-                if (nseg+1 >= mseg) {
-                    mseg += 10;
-
-                    temp = EG_reall(seg, mseg*sizeof(seg_T));
-                    if (temp != NULL) {
-                        seg = (seg_T *) temp;
-                    } else {
-                        status = EGADS_MALLOC;
-                        goto cleanup;
-                    }
-                }
-
-                /* make second half */
-                seg[nseg].type    = seg[iseg].type;
-                seg[nseg].ibeg    = ipnt;
-                seg[nseg].iend    = seg[iseg].iend;
-                seg[nseg].num     = seg[iseg].num;
-                seg[nseg].idx     = 0;
-                seg[nseg].name[0] = '\0';
-
-                seg[nseg].nattr = seg[iseg].nattr;
-                if (seg[nseg].nattr == 0) {
-                    seg[nseg].aname = NULL;
-                    seg[nseg].avalu = NULL;
-                } else {
-                    seg[nseg].aname = (char **) EG_alloc(seg[nseg].nattr*sizeof(char *));
-                    seg[nseg].avalu = (char **) EG_alloc(seg[nseg].nattr*sizeof(char *));
-                    if (seg[nseg].aname == NULL || seg[nseg].avalu == NULL) {
-                        status = EGADS_MALLOC;
-                        goto cleanup;
-                    }
-                }
-
-                for (iattr = 0; iattr < seg[nseg].nattr; iattr++) {
-                    seg[nseg].aname[iattr] = (char *) EG_alloc(80*sizeof(char));
-                    seg[nseg].avalu[iattr] = (char *) EG_alloc(80*sizeof(char));
-                    if (seg[nseg].aname[iattr] == NULL || seg[nseg].avalu[iattr] == NULL) {
-                                status = EGADS_MALLOC;
-                                goto cleanup;
-                    }
-
-                    strncpy(seg[nseg].aname[iattr], seg[iseg].aname[iattr], 80);
-                    strncpy(seg[nseg].avalu[iattr], seg[iseg].avalu[iattr], 80);
-                }
-
-                nseg++;
-
-                seg[iseg].iend = ipnt;
-
-                /* revise first half */
-                seg[iseg].iend = ipnt;
-            }
-        }
-    }
-    
+    /* break the Lines where they intersect each other and at Points */
+    status = intersectSegments(&npnt, &pnt, &nseg, &seg);
+    if (status != EGADS_SUCCESS) goto cleanup;
 
     /* remove the "cline" Segments */
+    jseg = 0;
     for (iseg = 0; iseg < nseg; iseg++) {
         if (seg[iseg].type == 0) {
+            for (iattr = 0; iattr < seg[iseg].nattr; iattr++) {
+                if (seg[iseg].aname[iattr] != NULL) EG_free(seg[iseg].aname[iattr]);
+                if (seg[iseg].avalu[iattr] != NULL) EG_free(seg[iseg].avalu[iattr]);
+            }
             if (seg[iseg].aname != NULL) EG_free(seg[iseg].aname);
             if (seg[iseg].avalu != NULL) EG_free(seg[iseg].avalu);
+            continue;
+        }
 
-            for (jseg = iseg; jseg < nseg-1; jseg++) {
-                seg[jseg].type  = seg[jseg+1].type;
-                seg[jseg].ibeg  = seg[jseg+1].ibeg;
-                seg[jseg].iend  = seg[jseg+1].iend;
-                seg[jseg].num   = seg[jseg+1].num;
-                seg[jseg].idx   = seg[jseg+1].idx;
-                seg[jseg].nattr = seg[jseg+1].nattr;
-                seg[jseg].aname = seg[jseg+1].aname;
-                seg[jseg].avalu = seg[jseg+1].avalu;
-
-                strcpy(seg[jseg].name, seg[jseg+1].name);
-            }
-
-            iseg--;
-            nseg--;
+        if (jseg < iseg) {
+            seg[jseg] = seg[iseg];
         }
+        jseg++;
     }
+    nseg = jseg;
 
     /* check for degenerate Segments */
     for (jseg = 0; jseg < nseg; jseg++) {
         if (seg[jseg].ibeg == seg[jseg].iend) {
-            printf(" udpExecute: Segment %d is degenerate\n", iseg);
+            printf(" udpExecute: Segment %d is degenerate\n", jseg);
             status = EGADS_DEGEN;
             goto cleanup;
         }
     }
 
     /* assign the Segment indices */
-    for (iter = 0; iter < nseg; iter++) {
-        nchange = 0;
-
-        for (iseg = 0; iseg < nseg; iseg++) {
-            if (seg[iseg].idx > 0) continue;
-
-            for (jseg = 0; jseg < nseg; jseg++) {
-                if (jseg == iseg || seg[jseg].idx <= 0) continue;
-
-                if (seg[iseg].num  == seg[jseg].num  &&
-                    seg[iseg].ibeg == seg[jseg].iend   ) {
-                    seg[iseg].idx = seg[jseg].idx + 1;
-                    nchange++;
-                    break;
-                }
-            }
-        }
-
-        if (nchange == 0) break;
-    }
+    status = assignIndices(nseg, seg);
+    if (status != EGADS_SUCCESS) goto cleanup;
 
     /* show Points and Segments after intersections */
     if (PROGRESS(numUdp) != 0) {
@@ -1670,16 +1455,10 @@ udpSensitivity(ego    ebody,            /* (in)  Body pointer */
    /*@unused@*/double uvs[],            /* (in)  parametric coordinates for evaluation */
    /*@unused@*/double vels[])           /* (out) velocities */
 {
-    int iudp, judp;
+    int iudp;
 
     /* check that ebody matches one of the ebodys */
-    iudp = 0;
-    for (judp = 1; judp <= numUdp; judp++) {
-        if (ebody == udps[judp].ebody) {
-            iudp = judp;
-            break;
-        }
-    }
+    iudp = findUdp(ebody);
     if (iudp <= 0) {
         return EGADS_NOTMODEL;
     }
@@ -1688,6 +1467,949 @@ udpSensitivity(ego    ebody,            /* (in)  Body pointer */
     return EGADS_NOLOAD;
 }
 
+
+/*
+ ************************************************************************
+ *                                                                      *
+ *   intersectSegments - break Lines at intersections and at Points     *
+ *                                                                      *
+ ************************************************************************
+ */
+
+static int
+intersectSegments(int    *npnt_p,       /* (both)number of Points */
+                  pnt_T  *pnt_p[],      /* (both)array  of Points */
+                  int    *nseg_p,       /* (both)number of Segments */
+                  seg_T  *seg_p[])      /* (both)array  of Segments */
+{
+    int     status = EGADS_SUCCESS;     /* (out) return status */
+
+    int     npnt, ipnt, mpnt, nseg, iseg, jseg, mseg, nseg0, ibeg, iend, jbeg, jend, iattr;
+    int     nline, ncand=0, mcand=0, icand, *cand=NULL, *smark=NULL, *pmark=NULL;
+    double  D, s, t, xx, yy, frac, dist, box[4];
+    pnt_T   *pnt;
+    seg_T   *seg;
+    grid_T  sgrid, pgrid;
+    phash_T phash;
+    void    *temp;
+
+    double  EPS06 = 1.0e-6;
+
+    ROUTINE(intersectSegments);
+
+    /* --------------------------------------------------------------- */
+
+    npnt = *npnt_p;
+    pnt  = *pnt_p;
+    nseg = *nseg_p;
+    seg  = *seg_p;
+
+    mpnt = npnt;
+    mseg = nseg;
+
+    sgrid.head = sgrid.item = sgrid.next = NULL;
+    pgrid.head = pgrid.item = pgrid.next = NULL;
+    phash.head = phash.next = NULL;
+
+    if (npnt <= 0 || nseg <= 0) goto cleanup;
+
+    /* put the Lines into a uniform grid (with their bounding boxes grown
+       to cover the tolerance on the intersection parameters) and the
+       Points into a hash table that is used to merge coincident Points */
+    box[0] = box[2] = pnt[0].x;
+    box[1] = box[3] = pnt[0].y;
+    for (ipnt = 1; ipnt < npnt; ipnt++) {
+        box[0] = MIN(box[0], pnt[ipnt].x);
+        box[1] = MIN(box[1], pnt[ipnt].y);
+        box[2] = MAX(box[2], pnt[ipnt].x);
+        box[3] = MAX(box[3], pnt[ipnt].y);
+    }
+
+    status = phashInit(&phash, box, EPS06, npnt);
+    if (status != EGADS_SUCCESS) goto cleanup;
+
+    for (ipnt = 0; ipnt < npnt; ipnt++) {
+        status = phashAdd(&phash, pnt, ipnt);
+        if (status != EGADS_SUCCESS) goto cleanup;
+    }
+
+    nline = 0;
+    for (iseg = 0; iseg < nseg; iseg++) {
+        if (seg[iseg].type != 0) nline++;
+    }
+
+    status = gridInit(&sgrid, box, nline);
+    if (status != EGADS_SUCCESS) goto cleanup;
+
+    MALLOC(smark, int, mseg);
+
+    for (iseg = 0; iseg < nseg; iseg++) {
+        smark[iseg] = 0;
+        if (seg[iseg].type == 0) continue;
+
+        segmentBox(pnt, &seg[iseg], EPS06, box);
+
+        status = gridAdd(&sgrid, iseg, box);
+        if (status != EGADS_SUCCESS) goto cleanup;
+    }
+
+    /* check for intersections of Lines only.  the Lines are visited in
+       the same order as an all-pairs search (including the Lines that
+       are added as others are broken), but only pairs that share a
+       cell of the grid are checked */
+    for (jseg = 0; jseg < nseg; jseg++) {
+        if (seg[jseg].type == 0) continue;
+
+        segmentBox(pnt, &seg[jseg], EPS06, box);
+
+        status = gridFind(&sgrid, box, jseg, smark, jseg+1, &ncand, &cand, &mcand);
+        if (status != EGADS_SUCCESS) goto cleanup;
+
+        nseg0 = nseg;
+
+        for (icand = 0; icand < ncand+nseg-nseg0; icand++) {
+            if (icand < ncand) {
+                iseg = cand[icand];
+            } else {
+                iseg = nseg0 + icand - ncand;
+            }
+            if (seg[iseg].type == 0) continue;
+
+            ibeg = seg[iseg].ibeg;
+            iend = seg[iseg].iend;
+            jbeg = seg[jseg].ibeg;
+            jend = seg[jseg].iend;
+
+            D = (pnt[iend].x - pnt[ibeg].x) * (pnt[jbeg].y - pnt[jend].y) - (pnt[jbeg].x - pnt[jend].x) * (pnt[iend].y - pnt[ibeg].y);
+            if (fabs(D) > EPS06) {
+                s = ((pnt[jbeg].x - pnt[ibeg].x) * (pnt[jbeg].y - pnt[jend].y) - (pnt[jbeg].x - pnt[jend].x) * (pnt[jbeg].y - pnt[ibeg].y)) / D;
+                t = ((pnt[iend].x - pnt[ibeg].x) * (pnt[jbeg].y - pnt[ibeg].y) - (pnt[jbeg].x - pnt[ibeg].x) * (pnt[iend].y - pnt[ibeg].y)) / D;
+
+                if (s > -EPS06 && s < 1+EPS06 &&
+                    t > -EPS06 && t < 1+EPS06   ) {
+                    xx = (1 - s) * pnt[ibeg].x + s * pnt[iend].x;
+                    yy = (1 - s) * pnt[ibeg].y + s * pnt[iend].y;
+
+                    ipnt = phashFind(&phash, pnt, xx, yy, EPS06);
+
+                    if (ipnt < 0) {
+                        if (npnt+1 >= mpnt) {
+                            mpnt += MAX(10, mpnt/2);
+
+                            temp = EG_reall(pnt, mpnt*sizeof(pnt_T));
+                            if (temp != NULL) {
+                                pnt = (pnt_T *) temp;
+                            } else {
+                                status = EGADS_MALLOC;
+                                goto cleanup;
+                            }
+                        }
+
+                        ipnt = npnt;
+
+                        pnt[npnt].type    = 1;
+                        pnt[npnt].x       = xx;
+                        pnt[npnt].y       = yy;
+                        pnt[npnt].name[0] = '\0';
+
+                        status = phashAdd(&phash, pnt, npnt);
+                        if (status != EGADS_SUCCESS) goto cleanup;
+
+                        npnt++;
+                    }
+
+                    if ((ibeg != ipnt && iend != ipnt) ||
+                        (jbeg != ipnt && jend != ipnt)   ) {
+                        if (nseg+2 >= mseg) {
+                            mseg += MAX(10, mseg/2);
+
+                            temp = EG_reall(seg, mseg*sizeof(seg_T));
+                            if (temp != NULL) {
+                                seg = (seg_T *) temp;
+                            } else {
+                                status = EGADS_MALLOC;
+                                goto cleanup;
+                            }
+
+                            temp = EG_reall(smark, mseg*sizeof(int));
+                            if (temp != NULL) {
+                                smark = (int *) temp;
+                            } else {
+                                status = EGADS_MALLOC;
+                                goto cleanup;
+                            }
+                        }
+                    }
+
+                    if (ibeg != ipnt && iend != ipnt) {
+                        seg[nseg].type    = seg[iseg].type;
+                        seg[nseg].ibeg    = ipnt;
+                        seg[nseg].iend    = iend;
+                        seg[nseg].num     = seg[iseg].num;
+                        seg[nseg].idx     = 0;
+                        seg[nseg].name[0] = '\0';
+
+                        seg[nseg].nattr = seg[iseg].nattr;
+                        if (seg[nseg].nattr == 0) {
+                            seg[nseg].aname = NULL;
+                            seg[nseg].avalu = NULL;
+                        } else {
+                            seg[nseg].aname = (char **) EG_alloc(seg[nseg].nattr*sizeof(char *));
+                            seg[nseg].avalu = (char **) EG_alloc(seg[nseg].nattr*sizeof(char *));
+                            if (seg[nseg].aname == NULL || seg[nseg].avalu == NULL) {
+                                status = EGADS_MALLOC;
+                                goto cleanup;
+                            }
+                        }
+
+                        for (iattr = 0; iattr < seg[nseg].nattr; iattr++) {
+                            seg[nseg].aname[iattr] = (char *) EG_alloc(80*sizeof(char));
+                            seg[nseg].avalu[iattr] = (char *) EG_alloc(80*sizeof(char));
+                            if (seg[nseg].aname[iattr] == NULL || seg[nseg].avalu[iattr] == NULL) {
+                                status = EGADS_MALLOC;
+                                goto cleanup;
+                            }
+
+                            strncpy(seg[nseg].aname[iattr], seg[iseg].aname[iattr], 80);
+                            strncpy(seg[nseg].avalu[iattr], seg[iseg].avalu[iattr], 80);
+                        }
+
+                        smark[nseg] = 0;
+                        segmentBox(pnt, &seg[nseg], EPS06, box);
+
+                        status = gridAdd(&sgrid, nseg, box);
+                        if (status != EGADS_SUCCESS) goto cleanup;
+
+                        nseg++;
+
+                        seg[iseg].iend = ipnt;
+                    }
+
+                    if (jbeg != ipnt && jend != ipnt) {
+                        seg[nseg].type    = seg[jseg].type;
+                        seg[nseg].ibeg    = ipnt;
+                        seg[nseg].iend    = jend;
+                        seg[nseg].num     = seg[jseg].num;
+                        seg[nseg].idx     = 0;
+                        seg[nseg].name[0] = '\0';
+
+                        seg[nseg].nattr = seg[jseg].nattr;
+                        if (seg[nseg].nattr == 0) {
+                            seg[nseg].aname = NULL;
+                            seg[nseg].avalu = NULL;
+                        } else {
+                            seg[nseg].aname = (char **) EG_alloc(seg[nseg].nattr*sizeof(char *));
+                            seg[nseg].avalu = (char **) EG_alloc(seg[nseg].nattr*sizeof(char *));
+                            if (seg[nseg].aname == NULL || seg[nseg].avalu == NULL) {
+                                status = EGADS_MALLOC;
+                                goto cleanup;
+                            }
+                        }
+
+                        for (iattr = 0; iattr < seg[nseg].nattr; iattr++) {
+                            seg[nseg].aname[iattr] = (char *) EG_alloc(80*sizeof(char));
+                            seg[nseg].avalu[iattr] = (char *) EG_alloc(80*sizeof(char));
+                            if (seg[nseg].aname[iattr] == NULL || seg[nseg].avalu[iattr] == NULL) {
+                                status = EGADS_MALLOC;
+                                goto cleanup;
+                            }
+
+                            strncpy(seg[nseg].aname[iattr], seg[jseg].aname[iattr], 80);
+                            strncpy(seg[nseg].avalu[iattr], seg[jseg].avalu[iattr], 80);
+                        }
+
+                        smark[nseg] = 0;
+                        segmentBox(pnt, &seg[nseg], EPS06, box);
+
+                        status = gridAdd(&sgrid, nseg, box);
+                        if (status != EGADS_SUCCESS) goto cleanup;
+
+                        nseg++;
+
+                        seg[jseg].iend = ipnt;
+                    }
+                }
+            }
+        }
+    }
+
+    /* break Lines at Points.  only the Points in the cells of the grid
+       that are near the Line are checked (in the same order as before) */
+    box[0] = box[2] = pnt[0].x;
+    box[1] = box[3] = pnt[0].y;
+    for (ipnt = 1; ipnt < npnt; ipnt++) {
+        box[0] = MIN(box[0], pnt[ipnt].x);
+        box[1] = MIN(box[1], pnt[ipnt].y);
+        box[2] = MAX(box[2], pnt[ipnt].x);
+        box[3] = MAX(box[3], pnt[ipnt].y);
+    }
+
+    status = gridInit(&pgrid, box, npnt);
+    if (status != EGADS_SUCCESS) goto cleanup;
+
+    MALLOC(pmark, int, npnt);
+
+    for (ipnt = 0; ipnt < npnt; ipnt++) {
+        pmark[ipnt] = 0;
+        if (pnt[ipnt].type == 0) continue;
+
+        box[0] = box[2] = pnt[ipnt].x;
+        box[1] = box[3] = pnt[ipnt].y;
+
+        status = gridAdd(&pgrid, ipnt, box);
+        if (status != EGADS_SUCCESS) goto cleanup;
+    }
+
+    for (iseg = 0; iseg < nseg; iseg++) {
+        if (seg[iseg].type == 0) continue;
+        
+        ibeg = seg[iseg].ibeg;
+        iend = seg[iseg].iend;
+
+        box[0] = MIN(pnt[ibeg].x, pnt[iend].x) - EPS06;
+        box[1] = MIN(pnt[ibeg].y, pnt[iend].y) - EPS06;
+        box[2] = MAX(pnt[ibeg].x, pnt[iend].x) + EPS06;
+        box[3] = MAX(pnt[ibeg].y, pnt[iend].y) + EPS06;
+
+        status = gridFind(&pgrid, box, -1, pmark, iseg+1, &ncand, &cand, &mcand);
+        if (status != EGADS_SUCCESS) goto cleanup;
+
+        for (icand = 0; icand < ncand; icand++) {
+            ipnt = cand[icand];
+            
+            /* distance from Point to line */
+            frac   = ( (pnt[ipnt].x - pnt[ibeg].x) * (pnt[iend].x - pnt[ibeg].x)
+                     + (pnt[ipnt].y - pnt[ibeg].y) * (pnt[iend].y - pnt[ibeg].y))
+                   / ( (pnt[iend].x - pnt[ibeg].x) * (pnt[iend].x - pnt[ibeg].x)
+                     + (pnt[iend].y - pnt[ibeg].y) * (pnt[iend].y - pnt[ibeg].y));
+
+            if (frac < EPS06 || frac > 1-EPS06) continue;
+
+            xx = (1-frac) * pnt[ibeg].x + frac * pnt[iend].x;
+            yy = (1-frac) * pnt[ibeg].y + frac * pnt[iend].y;
+
+            dist = sqrt( (xx - pnt[ipnt].x) * (xx - pnt[ipnt].x)
+                       + (yy - pnt[ipnt].y) * (yy - pnt[ipnt].y));
+            
+
+            if (dist < EPS06) {
+
+                /* make room for new Segment */
+                if (nseg+1 >= mseg) {
+                    mseg += MAX(10, mseg/2);
+
+                    temp = EG_reall(seg, mseg*sizeof(seg_T));
+                    if (temp != NULL) {
+                        seg = (seg_T *) temp;
+                    } else {
+                        status = EGADS_MALLOC;
+                        goto cleanup;
+                    }
+                }
+
+                /* make second half */
+                seg[nseg].type    = seg[iseg].type;
+                seg[nseg].ibeg    = ipnt;
+                seg[nseg].iend    = seg[iseg].iend;
+                seg[nseg].num     = seg[iseg].num;
+                seg[nseg].idx     = 0;
+                seg[nseg].name[0] = '\0';
+
+                seg[nseg].nattr = seg[iseg].nattr;
+                if (seg[nseg].nattr == 0) {
+                    seg[nseg].aname = NULL;
+                    seg[nseg].avalu = NULL;
+                } else {
+                    seg[nseg].aname = (char **) EG_alloc(seg[nseg].nattr*sizeof(char *));
+                    seg[nseg].avalu = (char **) EG_alloc(seg[nseg].nattr*sizeof(char *));
+                    if (seg[nseg].aname == NULL || seg[nseg].avalu == NULL) {
+                        status = EGADS_MALLOC;
+                        goto cleanup;
+                    }
+                }
+
+                for (iattr = 0; iattr < seg[nseg].nattr; iattr++) {
+                    seg[nseg].aname[iattr] = (char *) EG_alloc(80*sizeof(char));
+                    seg[nseg].avalu[iattr] = (char *) EG_alloc(80*sizeof(char));
+                    if (seg[nseg].aname[iattr] == NULL || seg[nseg].avalu[iattr] == NULL) {
+                        status = EGADS_MALLOC;
+                        goto cleanup;
+                    }
+
+                    strncpy(seg[nseg].aname[iattr], seg[iseg].aname[iattr], 80);
+                    strncpy(seg[nseg].avalu[iattr], seg[iseg].avalu[iattr], 80);
+                }
+
+                nseg++;
+
+                seg[iseg].iend = ipnt;
+
+                /* revise first half */
+                seg[iseg].iend = ipnt;
+            }
+        }
+    }
+
+cleanup:
+    FREE(cand);
+    FREE(smark);
+    FREE(pmark);
+    gridFree(&sgrid);
+    gridFree(&pgrid);
+    phashFree(&phash);
+
+    *npnt_p = npnt;
+    *pnt_p  = pnt;
+    *nseg_p = nseg;
+    *seg_p  = seg;
+
+    return status;
+}
+
+
+/*
+ ************************************************************************
+ *                                                                      *
+ *   assignIndices - number the Segments along each original Segment    *
+ *                                                                      *
+ ************************************************************************
+ */
+
+static int
+assignIndices(int    nseg,              /* (in)  number of Segments */
+              seg_T  seg[])             /* (both)array  of Segments */
+{
+    int    status = EGADS_SUCCESS;      /* (out) return status */
+
+    int    iseg, jseg, iter, nchange, ntodo, itodo, nleft, nhash, ihash;
+    int    *head=NULL, *next=NULL, *todo=NULL;
+
+    ROUTINE(assignIndices);
+
+    /* --------------------------------------------------------------- */
+
+    if (nseg <= 0) goto cleanup;
+
+    /* hash the Segments by (num,iend) so that the Segment that ends where
+       another begins can be found directly.  each chain is in increasing
+       Segment order, so the first one found is the same as before */
+    nhash = 64;
+    while (nhash < 2*nseg) {
+        nhash *= 2;
+    }
+
+    MALLOC(head, int, nhash);
+    MALLOC(next, int, nseg );
+    MALLOC(todo, int, nseg );
+
+    for (ihash = 0; ihash < nhash; ihash++) {
+        head[ihash] = -1;
+    }
+
+    for (jseg = nseg-1; jseg >= 0; jseg--) {
+        ihash = (int) (((unsigned) seg[jseg].num  * 73856093u
+                      ^ (unsigned) seg[jseg].iend * 19349663u) & (unsigned) (nhash-1));
+
+        next[jseg]  = head[ihash];
+        head[ihash] = jseg;
+    }
+
+    ntodo = 0;
+    for (iseg = 0; iseg < nseg; iseg++) {
+        if (seg[iseg].idx <= 0) {
+            todo[ntodo++] = iseg;
+        }
+    }
+
+    /* sweep through the Segments that still need an index */
+    for (iter = 0; iter < nseg && ntodo > 0; iter++) {
+        nchange = 0;
+        nleft   = 0;
+
+        for (itodo = 0; itodo < ntodo; itodo++) {
+            iseg  = todo[itodo];
+            ihash = (int) (((unsigned) seg[iseg].num  * 73856093u
+                          ^ (unsigned) seg[iseg].ibeg * 19349663u) & (unsigned) (nhash-1));
+
+            for (jseg = head[ihash]; jseg >= 0; jseg = next[jseg]) {
+                if (jseg == iseg || seg[jseg].idx <= 0) continue;
+
+                if (seg[iseg].num  == seg[jseg].num  &&
+                    seg[iseg].ibeg == seg[jseg].iend   ) {
+                    seg[iseg].idx = seg[jseg].idx + 1;
+                    nchange++;
+                    break;
+                }
+            }
+
+            if (seg[iseg].idx <= 0) {
+                todo[nleft++] = iseg;
+            }
+        }
+
+        ntodo = nleft;
+
+        if (nchange == 0) break;
+    }
+
+cleanup:
+    FREE(head);
+    FREE(next);
+    FREE(todo);
+
+    return status;
+}
+
+
+/*
+ ************************************************************************
+ *                                                                      *
+ *   segmentBox - bounding box of a Segment (grown by tolerance)        *
+ *                                                                      *
+ ************************************************************************
+ */
+
+static void
+segmentBox(pnt_T  pnt[],                /* (in)  array  of Points */
+           seg_T  *seg,                 /* (in)  Segment */
+           double toler,                /* (in)  relative tolerance */
+           double box[])                /* (out) xmin, ymin, xmax, ymax */
+{
+    double dx, dy;
+
+    dx = fabs(pnt[seg->iend].x - pnt[seg->ibeg].x);
+    dy = fabs(pnt[seg->iend].y - pnt[seg->ibeg].y);
+
+    box[0] = MIN(pnt[seg->ibeg].x, pnt[seg->iend].x) - toler * (dx + 1);
+    box[1] = MIN(pnt[seg->ibeg].y, pnt[seg->iend].y) - toler * (dy + 1);
+    box[2] = MAX(pnt[seg->ibeg].x, pnt[seg->iend].x) + toler * (dx + 1);
+    box[3] = MAX(pnt[seg->ibeg].y, pnt[seg->iend].y) + toler * (dy + 1);
+}
+
+
+/*
+ ************************************************************************
+ *                                                                      *
+ *   gridInit - set up a uniform grid over a bounding box               *
+ *                                                                      *
+ ************************************************************************
+ */
+
+static int
+gridInit(grid_T *grid,                  /* (in)  grid */
+         double box[],                  /* (in)  xmin, ymin, xmax, ymax */
+         int    nitem)                  /* (in)  expected number of items */
+{
+    int    status = EGADS_SUCCESS;      /* (out) return status */
+
+    int    ncell, icell;
+    double wx, wy;
+
+    ROUTINE(gridInit);
+
+    /* --------------------------------------------------------------- */
+
+    /* about one cell per item (but not too many in either direction) */
+    ncell = MAX(1, nitem);
+    wx    = MAX(box[2] - box[0], 1.0e-12);
+    wy    = MAX(box[3] - box[1], 1.0e-12);
+
+    grid->nx = (int) MIN(1024, MAX(1, sqrt(ncell * wx / wy)));
+    grid->ny = (int) MIN(1024, MAX(1, ncell / grid->nx));
+
+    grid->xmin = box[0];
+    grid->ymin = box[1];
+    grid->dx   = wx / grid->nx;
+    grid->dy   = wy / grid->ny;
+
+    grid->nent = 0;
+    grid->ment = 0;
+    grid->head = NULL;
+    grid->item = NULL;
+    grid->next = NULL;
+
+    MALLOC(grid->head, int, grid->nx*grid->ny);
+
+    for (icell = 0; icell < grid->nx*grid->ny; icell++) {
+        grid->head[icell] = -1;
+    }
+
+cleanup:
+    return status;
+}
+
+
+/*
+ ************************************************************************
+ *                                                                      *
+ *   gridRange - range of cells covered by a bounding box               *
+ *                                                                      *
+ ************************************************************************
+ */
+
+static void
+gridRange(grid_T *grid,                 /* (in)  grid */
+          double box[],                 /* (in)  xmin, ymin, xmax, ymax */
+          int    range[])               /* (out) imin, jmin, imax, jmax */
+{
+
+    /* anything outside of the grid is put into the closest cell */
+    range[0] = (int) MINMAX(0, floor((box[0] - grid->xmin) / grid->dx), grid->nx-1);
+    range[1] = (int) MINMAX(0, floor((box[1] - grid->ymin) / grid->dy), grid->ny-1);
+    range[2] = (int) MINMAX(0, floor((box[2] - grid->xmin) / grid->dx), grid->nx-1);
+    range[3] = (int) MINMAX(0, floor((box[3] - grid->ymin) / grid->dy), grid->ny-1);
+}
+
+
+/*
+ ************************************************************************
+ *                                                                      *
+ *   gridAdd - add an item to all cells covered by a bounding box       *
+ *                                                                      *
+ ************************************************************************
+ */
+
+static int
+gridAdd(grid_T *grid,                   /* (in)  grid */
+        int    item,                    /* (in)  item to add */
+        double box[])                   /* (in)  xmin, ymin, xmax, ymax */
+{
+    int    status = EGADS_SUCCESS;      /* (out) return status */
+
+    int    range[4], i, j, icell;
+    void   *temp;
+
+    ROUTINE(gridAdd);
+
+    /* --------------------------------------------------------------- */
+
+    gridRange(grid, box, range);
+
+    for (j = range[1]; j <= range[3]; j++) {
+        for (i = range[0]; i <= range[2]; i++) {
+            if (grid->nent >= grid->ment) {
+                grid->ment += MAX(100, grid->ment);
+
+                temp = EG_reall(grid->item, grid->ment*sizeof(int));
+                if (temp == NULL) {
+                    status = EGADS_MALLOC;
+                    goto cleanup;
+                }
+                grid->item = (int *) temp;
+
+                temp = EG_reall(grid->next, grid->ment*sizeof(int));
+                if (temp == NULL) {
+                    status = EGADS_MALLOC;
+                    goto cleanup;
+                }
+                grid->next = (int *) temp;
+            }
+
+            icell = i + j * grid->nx;
+
+            grid->item[grid->nent] = item;
+            grid->next[grid->nent] = grid->head[icell];
+            grid->head[icell]      = grid->nent;
+            grid->nent++;
+        }
+    }
+
+cleanup:
+    return status;
+}
+
+
+/*
+ ************************************************************************
+ *                                                                      *
+ *   gridFind - find the items in the cells covered by a bounding box   *
+ *                                                                      *
+ ************************************************************************
+ */
+
+static int
+gridFind(grid_T *grid,                  /* (in)  grid */
+         double box[],                  /* (in)  xmin, ymin, xmax, ymax */
+         int    imin,                   /* (in)  only return items > imin */
+         int    mark[],                 /* (both)mark for each item */
+         int    stamp,                  /* (in)  unique stamp for this search */
+         int    *nfound,                /* (out) number of items found */
+         int    *found[],               /* (both)items found (in increasing order) */
+         int    *mfound)                /* (both)size of found */
+{
+    int    status = EGADS_SUCCESS;      /* (out) return status */
+
+    int    range[4], i, j, ient, item;
+    void   *temp;
+
+    ROUTINE(gridFind);
+
+    /* --------------------------------------------------------------- */
+
+    *nfound = 0;
+
+    gridRange(grid, box, range);
+
+    for (j = range[1]; j <= range[3]; j++) {
+        for (i = range[0]; i <= range[2]; i++) {
+            for (ient = grid->head[i+j*grid->nx]; ient >= 0; ient = grid->next[ient]) {
+                item = grid->item[ient];
+                if (item <= imin || mark[item] == stamp) continue;
+
+                mark[item] = stamp;
+
+                if (*nfound >= *mfound) {
+                    *mfound += MAX(100, *mfound);
+
+                    temp = EG_reall(*found, *mfound*sizeof(int));
+                    if (temp == NULL) {
+                        status = EGADS_MALLOC;
+                        goto cleanup;
+                    }
+                    *found = (int *) temp;
+                }
+
+                (*found)[(*nfound)++] = item;
+            }
+        }
+    }
+
+    if (*nfound > 1) {
+        qsort(*found, *nfound, sizeof(int), compareInts);
+    }
+
+cleanup:
+    return status;
+}
+
+
+/*
+ ************************************************************************
+ *                                                                      *
+ *   gridFree - free a grid                                             *
+ *                                                                      *
+ ************************************************************************
+ */
+
+static void
+gridFree(grid_T *grid)                  /* (in)  grid */
+{
+    FREE(grid->head);
+    FREE(grid->item);
+    FREE(grid->next);
+}
+
+
+/*
+ ************************************************************************
+ *                                                                      *
+ *   phashInit - set up the hash table for merging Points               *
+ *                                                                      *
+ ************************************************************************
+ */
+
+static int
+phashInit(phash_T *phash,               /* (in)  hash table */
+          double  box[],                /* (in)  xmin, ymin, xmax, ymax */
+          double  toler,                /* (in)  merge tolerance */
+          int     npnt)                 /* (in)  expected number of Points */
+{
+    int    status = EGADS_SUCCESS;      /* (out) return status */
+
+    int    ihash;
+
+    ROUTINE(phashInit);
+
+    /* --------------------------------------------------------------- */
+
+    /* cells must be at least toler on a side so that a match is in the
+       same or a neighboring cell */
+    phash->xmin  = box[0];
+    phash->ymin  = box[1];
+    phash->size  = MAX(toler, MAX(box[2]-box[0], box[3]-box[1]) / 1048576);
+
+    phash->nhash = 64;
+    while (phash->nhash < 2*npnt) {
+        phash->nhash *= 2;
+    }
+
+    phash->mnext = 0;
+    phash->head  = NULL;
+    phash->next  = NULL;
+
+    MALLOC(phash->head, int, phash->nhash);
+
+    for (ihash = 0; ihash < phash->nhash; ihash++) {
+        phash->head[ihash] = -1;
+    }
+
+cleanup:
+    return status;
+}
+
+
+/*
+ ************************************************************************
+ *                                                                      *
+ *   phashCell - hash bucket for the cell that contains (x,y)           *
+ *                                                                      *
+ ************************************************************************
+ */
+
+static int
+phashCell(phash_T *phash,               /* (in)  hash table */
+          double  x,                    /* (in)  X-coordinate */
+          double  y,                    /* (in)  Y-coordinate */
+          int     di,                   /* (in)  offset in X-cells */
+          int     dj)                   /* (in)  offset in Y-cells */
+{
+    int    i, j;
+
+    i = (int) MINMAX(-1.0e9, floor((x - phash->xmin) / phash->size), 1.0e9) + di;
+    j = (int) MINMAX(-1.0e9, floor((y - phash->ymin) / phash->size), 1.0e9) + dj;
+
+    return (int) (((unsigned) i * 73856093u
+                 ^ (unsigned) j * 19349663u) & (unsigned) (phash->nhash-1));
+}
+
+
+/*
+ ************************************************************************
+ *                                                                      *
+ *   phashAdd - add Point ipnt to the hash table                        *
+ *                                                                      *
+ ************************************************************************
+ */
+
+static int
+phashAdd(phash_T *phash,                /* (in)  hash table */
+         pnt_T   pnt[],                 /* (in)  array  of Points */
+         int     ipnt)                  /* (in)  Point to add (Points are added in order) */
+{
+    int    status = EGADS_SUCCESS;      /* (out) return status */
+
+    int    ihash, jpnt;
+    void   *temp;
+
+    ROUTINE(phashAdd);
+
+    /* --------------------------------------------------------------- */
+
+    if (ipnt >= phash->mnext) {
+        phash->mnext = MAX(2*phash->mnext, ipnt+100);
+
+        temp = EG_reall(phash->next, phash->mnext*sizeof(int));
+        if (temp == NULL) {
+            status = EGADS_MALLOC;
+            goto cleanup;
+        }
+        phash->next = (int *) temp;
+    }
+
+    /* keep the table no more than half full */
+    if (2*(ipnt+1) > phash->nhash) {
+        phash->nhash *= 2;
+
+        temp = EG_reall(phash->head, phash->nhash*sizeof(int));
+        if (temp == NULL) {
+            status = EGADS_MALLOC;
+            goto cleanup;
+        }
+        phash->head = (int *) temp;
+
+        for (ihash = 0; ihash < phash->nhash; ihash++) {
+            phash->head[ihash] = -1;
+        }
+
+        for (jpnt = 0; jpnt < ipnt; jpnt++) {
+            ihash = phashCell(phash, pnt[jpnt].x, pnt[jpnt].y, 0, 0);
+
+            phash->next[jpnt]  = phash->head[ihash];
+            phash->head[ihash] = jpnt;
+        }
+    }
+
+    ihash = phashCell(phash, pnt[ipnt].x, pnt[ipnt].y, 0, 0);
+
+    phash->next[ipnt]  = phash->head[ihash];
+    phash->head[ihash] = ipnt;
+
+cleanup:
+    return status;
+}
+
+
+/*
+ ************************************************************************
+ *                                                                      *
+ *   phashFind - find the first Point within toler of (x,y)             *
+ *                                                                      *
+ ************************************************************************
+ */
+
+static int
+phashFind(phash_T *phash,               /* (in)  hash table */
+          pnt_T   pnt[],                /* (in)  array  of Points */
+          double  x,                    /* (in)  X-coordinate */
+          double  y,                    /* (in)  Y-coordinate */
+          double  toler)                /* (in)  tolerance */
+{
+    int    ipnt = -1;                   /* (out) lowest matching Point (or -1) */
+
+    int    di, dj, jpnt;
+
+    for (dj = -1; dj <= 1; dj++) {
+        for (di = -1; di <= 1; di++) {
+            for (jpnt = phash->head[phashCell(phash, x, y, di, dj)]; jpnt >= 0; jpnt = phash->next[jpnt]) {
+                if (fabs(x-pnt[jpnt].x) < toler &&
+                    fabs(y-pnt[jpnt].y) < toler   ) {
+                    if (ipnt < 0 || jpnt < ipnt) {
+                        ipnt = jpnt;
+                    }
+                }
+            }
+        }
+    }
+
+    return ipnt;
+}
+
+
+/*
+ ************************************************************************
+ *                                                                      *
+ *   phashFree - free the hash table                                    *
+ *                                                                      *
+ ************************************************************************
+ */
+
+static void
+phashFree(phash_T *phash)               /* (in)  hash table */
+{
+    FREE(phash->head);
+    FREE(phash->next);
+}
+
+
+/*
+ ************************************************************************
+ *                                                                      *
+ *   compareInts - compare two ints (for qsort)                         *
+ *                                                                      *
+ ************************************************************************
+ */
+
+static int
+compareInts(const void *a,              /* (in)  first  int */
+            const void *b)              /* (in)  second int */
+{
+    int    ia = *((int *) a);
+    int    ib = *((int *) b);
+
+    return (ia > ib) - (ia < ib);
+}
+
+
 
 /*
  ************************************************************************